@@ -0,0 +1,147 @@
+#include "BinaryRecord.h"
+
+#include "swss/logger.h"
+
+using namespace sairedis;
+
+const std::string BinaryRecord::BLOCK_MAGIC = std::string("SRB\x01", 4);
+
+void BinaryRecord::encodeVarint(
+        _Inout_ std::string& buffer,
+        _In_ uint64_t value)
+{
+    SWSS_LOG_ENTER();
+
+    while (value >= 0x80)
+    {
+        buffer.push_back((char)((value & 0x7f) | 0x80));
+
+        value >>= 7;
+    }
+
+    buffer.push_back((char)value);
+}
+
+bool BinaryRecord::decodeVarint(
+        _In_ const std::string& buffer,
+        _Inout_ size_t& offset,
+        _Out_ uint64_t& value)
+{
+    SWSS_LOG_ENTER();
+
+    value = 0;
+
+    for (int shift = 0; shift < 64; shift += 7)
+    {
+        if (offset >= buffer.size())
+        {
+            return false;
+        }
+
+        uint8_t byte = (uint8_t)buffer[offset++];
+
+        value |= (uint64_t)(byte & 0x7f) << shift;
+
+        if ((byte & 0x80) == 0)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void BinaryRecord::encodeString(
+        _Inout_ std::string& buffer,
+        _In_ const std::string& value)
+{
+    SWSS_LOG_ENTER();
+
+    encodeVarint(buffer, value.size());
+
+    buffer += value;
+}
+
+bool BinaryRecord::decodeString(
+        _In_ const std::string& buffer,
+        _Inout_ size_t& offset,
+        _Out_ std::string& value)
+{
+    SWSS_LOG_ENTER();
+
+    uint64_t size;
+
+    if (!decodeVarint(buffer, offset, size) || size > buffer.size() - offset)
+    {
+        return false;
+    }
+
+    value.assign(buffer, offset, (size_t)size);
+
+    offset += (size_t)size;
+
+    return true;
+}
+
+uint64_t BinaryRecord::zigzagEncode(
+        _In_ int64_t value)
+{
+    SWSS_LOG_ENTER();
+
+    return ((uint64_t)value << 1) ^ (uint64_t)(value >> 63);
+}
+
+int64_t BinaryRecord::zigzagDecode(
+        _In_ uint64_t value)
+{
+    SWSS_LOG_ENTER();
+
+    return (int64_t)(value >> 1) ^ -(int64_t)(value & 1);
+}
+
+std::vector<std::string> BinaryRecord::tokenize(
+        _In_ const std::string& line)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<std::string> tokens;
+
+    size_t start = 0;
+
+    while (true)
+    {
+        size_t pos = line.find('|', start);
+
+        if (pos == std::string::npos)
+        {
+            tokens.push_back(line.substr(start));
+            break;
+        }
+
+        tokens.push_back(line.substr(start, pos - start));
+
+        start = pos + 1;
+    }
+
+    return tokens;
+}
+
+bool BinaryRecord::isBinary(
+        _In_ std::istream& stream)
+{
+    SWSS_LOG_ENTER();
+
+    auto pos = stream.tellg();
+
+    char magic[4] = {};
+
+    stream.read(magic, sizeof(magic));
+
+    bool binary = stream.gcount() == (std::streamsize)sizeof(magic) &&
+        BLOCK_MAGIC.compare(0, BLOCK_MAGIC.size(), magic, sizeof(magic)) == 0;
+
+    stream.clear();
+    stream.seekg(pos);
+
+    return binary;
+}
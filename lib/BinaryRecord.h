@@ -0,0 +1,109 @@
+#pragma once
+
+#include "swss/sal.h"
+
+#include <string>
+#include <vector>
+#include <istream>
+
+#include <stdint.h>
+
+namespace sairedis
+{
+    /**
+     * @brief Binary recording format.
+     *
+     * Recording is a sequence of independent blocks, so file can be appended
+     * after log rotate or restart and concatenated with other recordings.
+     * Each block starts with magic and varint encoded record count,
+     * uncompressed size and compressed size, followed by zlib compressed
+     * records.
+     *
+     * Each record is varint header with zigzag encoded timestamp delta in
+     * microseconds from previous record in block (first record in block holds
+     * absolute timestamp) and number of tokens, followed by tokens of text
+     * recording line split on '|'.
+     *
+     * Tokens starting with SAI_OBJECT_TYPE_ are encoded as index to object
+     * type table, other tokens starting with SAI_ as index to attribute table
+     * (which holds also statuses and stats), with remaining part of token
+     * (serialized object id or attribute value) kept as raw string. Index
+     * equal to current table size defines new entry which name follows.
+     * Tables are reset at the beginning of each block.
+     */
+    class BinaryRecord
+    {
+        public:
+
+            /**
+             * @brief Magic at the beginning of each block.
+             */
+            static const std::string BLOCK_MAGIC;
+
+            /**
+             * @brief Uncompressed size after which block is written.
+             */
+            static constexpr size_t BLOCK_SIZE = 64 * 1024;
+
+            /**
+             * @brief Max uncompressed block size accepted by reader.
+             */
+            static constexpr size_t MAX_BLOCK_SIZE = 64 * 1024 * 1024;
+
+            /**
+             * @brief Time in microseconds after which not full block is
+             * written on next record or by recorder flush thread.
+             */
+            static constexpr uint64_t BLOCK_FLUSH_INTERVAL = 1000000;
+
+            static constexpr uint64_t TOKEN_RAW = 0;
+            static constexpr uint64_t TOKEN_OBJECT_TYPE = 1;
+            static constexpr uint64_t TOKEN_ATTRIBUTE = 2;
+
+            static constexpr int TOKEN_KIND_BITS = 2;
+
+        public:
+
+            static void encodeVarint(
+                    _Inout_ std::string& buffer,
+                    _In_ uint64_t value);
+
+            /**
+             * @brief Decode varint at given offset and advance offset.
+             *
+             * @return False if buffer ends before varint or varint is too long.
+             */
+            static bool decodeVarint(
+                    _In_ const std::string& buffer,
+                    _Inout_ size_t& offset,
+                    _Out_ uint64_t& value);
+
+            static void encodeString(
+                    _Inout_ std::string& buffer,
+                    _In_ const std::string& value);
+
+            static bool decodeString(
+                    _In_ const std::string& buffer,
+                    _Inout_ size_t& offset,
+                    _Out_ std::string& value);
+
+            static uint64_t zigzagEncode(
+                    _In_ int64_t value);
+
+            static int64_t zigzagDecode(
+                    _In_ uint64_t value);
+
+            /**
+             * @brief Split line on '|', empty tokens are preserved.
+             */
+            static std::vector<std::string> tokenize(
+                    _In_ const std::string& line);
+
+            /**
+             * @brief Check whether stream starts with binary block magic,
+             * stream position is not changed.
+             */
+            static bool isBinary(
+                    _In_ std::istream& stream);
+    };
+}
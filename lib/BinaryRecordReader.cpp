@@ -0,0 +1,248 @@
+#include "BinaryRecordReader.h"
+#include "BinaryRecord.h"
+#include "Recorder.h"
+
+#include "swss/logger.h"
+
+#include <zlib.h>
+
+using namespace sairedis;
+
+BinaryRecordReader::BinaryRecordReader(
+        _In_ std::istream& stream):
+    m_stream(stream)
+{
+    SWSS_LOG_ENTER();
+
+    // empty constructor
+}
+
+bool BinaryRecordReader::getline(
+        _Out_ std::string& line)
+{
+    SWSS_LOG_ENTER();
+
+    while (m_lines.empty())
+    {
+        if (!readBlock())
+        {
+            return false;
+        }
+    }
+
+    line = std::move(m_lines.front());
+
+    m_lines.pop_front();
+
+    return true;
+}
+
+bool BinaryRecordReader::readVarint(
+        _Out_ uint64_t& value)
+{
+    SWSS_LOG_ENTER();
+
+    value = 0;
+
+    for (int shift = 0; shift < 64; shift += 7)
+    {
+        int c = m_stream.get();
+
+        if (c == EOF)
+        {
+            return false;
+        }
+
+        value |= (uint64_t)(c & 0x7f) << shift;
+
+        if ((c & 0x80) == 0)
+        {
+            return true;
+        }
+    }
+
+    SWSS_LOG_THROW("corrupted binary recording, varint too long");
+}
+
+bool BinaryRecordReader::readBlock()
+{
+    SWSS_LOG_ENTER();
+
+    std::string magic(BinaryRecord::BLOCK_MAGIC.size(), 0);
+
+    m_stream.read(&magic[0], (std::streamsize)magic.size());
+
+    if (m_stream.gcount() == 0)
+    {
+        return false;
+    }
+
+    if (m_stream.gcount() != (std::streamsize)magic.size())
+    {
+        SWSS_LOG_WARN("truncated block magic at end of binary recording");
+        return false;
+    }
+
+    if (magic != BinaryRecord::BLOCK_MAGIC)
+    {
+        SWSS_LOG_THROW("corrupted binary recording, invalid block magic");
+    }
+
+    uint64_t records;
+    uint64_t size;
+    uint64_t compressedSize;
+
+    if (!readVarint(records) || !readVarint(size) || !readVarint(compressedSize))
+    {
+        SWSS_LOG_WARN("truncated block header at end of binary recording");
+        return false;
+    }
+
+    if (size > BinaryRecord::MAX_BLOCK_SIZE || compressedSize > compressBound((uLong)size))
+    {
+        SWSS_LOG_THROW("corrupted binary recording, invalid block size %lu (compressed %lu)", size, compressedSize);
+    }
+
+    std::string compressed((size_t)compressedSize, 0);
+
+    m_stream.read(&compressed[0], (std::streamsize)compressedSize);
+
+    if (m_stream.gcount() != (std::streamsize)compressedSize)
+    {
+        SWSS_LOG_WARN("truncated block at end of binary recording, %lu records lost", records);
+        return false;
+    }
+
+    std::string block((size_t)size, 0);
+
+    uLongf blockSize = (uLongf)size;
+
+    int rc = uncompress((Bytef*)&block[0], &blockSize, (const Bytef*)compressed.data(), (uLong)compressedSize);
+
+    if (rc != Z_OK || blockSize != size)
+    {
+        SWSS_LOG_THROW("corrupted binary recording, failed to uncompress block: %d", rc);
+    }
+
+    decodeBlock(block, records);
+
+    return true;
+}
+
+void BinaryRecordReader::decodeBlock(
+        _In_ const std::string& block,
+        _In_ uint64_t records)
+{
+    SWSS_LOG_ENTER();
+
+    m_objectTypes.clear();
+    m_attributes.clear();
+
+    uint64_t timestamp = 0;
+
+    size_t offset = 0;
+
+    for (uint64_t record = 0; record < records; record++)
+    {
+        uint64_t delta;
+        uint64_t tokens;
+
+        if (!BinaryRecord::decodeVarint(block, offset, delta) ||
+                !BinaryRecord::decodeVarint(block, offset, tokens))
+        {
+            SWSS_LOG_THROW("corrupted binary recording, invalid record %lu header", record);
+        }
+
+        timestamp += (uint64_t)BinaryRecord::zigzagDecode(delta);
+
+        std::string line = Recorder::getTimestamp(timestamp);
+
+        for (uint64_t token = 0; token < tokens; token++)
+        {
+            line += "|";
+            line += decodeToken(block, offset);
+        }
+
+        m_lines.push_back(std::move(line));
+    }
+
+    if (offset != block.size())
+    {
+        SWSS_LOG_THROW("corrupted binary recording, %zu bytes left after last record", block.size() - offset);
+    }
+}
+
+std::string BinaryRecordReader::decodeToken(
+        _In_ const std::string& block,
+        _Inout_ size_t& offset)
+{
+    SWSS_LOG_ENTER();
+
+    uint64_t tag;
+
+    if (!BinaryRecord::decodeVarint(block, offset, tag))
+    {
+        SWSS_LOG_THROW("corrupted binary recording, invalid token");
+    }
+
+    uint64_t index = tag >> BinaryRecord::TOKEN_KIND_BITS;
+
+    switch (tag & ((1 << BinaryRecord::TOKEN_KIND_BITS) - 1))
+    {
+        case BinaryRecord::TOKEN_RAW:
+            {
+                std::string value;
+
+                if (!BinaryRecord::decodeString(block, offset, value))
+                {
+                    SWSS_LOG_THROW("corrupted binary recording, invalid raw token");
+                }
+
+                return value;
+            }
+
+        case BinaryRecord::TOKEN_OBJECT_TYPE:
+            return decodeInterned(block, offset, m_objectTypes, index);
+
+        case BinaryRecord::TOKEN_ATTRIBUTE:
+            return decodeInterned(block, offset, m_attributes, index);
+
+        default:
+            SWSS_LOG_THROW("corrupted binary recording, unknown token kind in tag %lu", tag);
+    }
+}
+
+std::string BinaryRecordReader::decodeInterned(
+        _In_ const std::string& block,
+        _Inout_ size_t& offset,
+        _Inout_ std::vector<std::string>& table,
+        _In_ uint64_t index)
+{
+    SWSS_LOG_ENTER();
+
+    if (index > table.size())
+    {
+        SWSS_LOG_THROW("corrupted binary recording, table index %lu out of range", index);
+    }
+
+    if (index == table.size())
+    {
+        std::string name;
+
+        if (!BinaryRecord::decodeString(block, offset, name))
+        {
+            SWSS_LOG_THROW("corrupted binary recording, invalid table entry");
+        }
+
+        table.push_back(name);
+    }
+
+    std::string rest;
+
+    if (!BinaryRecord::decodeString(block, offset, rest))
+    {
+        SWSS_LOG_THROW("corrupted binary recording, invalid token value");
+    }
+
+    return table[(size_t)index] + rest;
+}
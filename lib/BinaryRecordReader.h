@@ -0,0 +1,76 @@
+#pragma once
+
+#include "swss/sal.h"
+
+#include <string>
+#include <istream>
+#include <deque>
+#include <vector>
+
+#include <stdint.h>
+
+namespace sairedis
+{
+    /**
+     * @brief Reads binary recording and converts records back to text
+     * recording lines.
+     *
+     * Truncated last block (for example when recording process was killed
+     * while writing block) is treated as end of file, any other corruption
+     * throws.
+     */
+    class BinaryRecordReader
+    {
+        private:
+
+            BinaryRecordReader(const BinaryRecordReader&) = delete;
+            BinaryRecordReader& operator=(const BinaryRecordReader&) = delete;
+
+        public:
+
+            BinaryRecordReader(
+                    _In_ std::istream& stream);
+
+            virtual ~BinaryRecordReader() = default;
+
+        public:
+
+            /**
+             * @brief Get next text recording line including timestamp, same
+             * semantics as std::getline.
+             */
+            bool getline(
+                    _Out_ std::string& line);
+
+        private:
+
+            bool readBlock();
+
+            bool readVarint(
+                    _Out_ uint64_t& value);
+
+            void decodeBlock(
+                    _In_ const std::string& block,
+                    _In_ uint64_t records);
+
+            std::string decodeToken(
+                    _In_ const std::string& block,
+                    _Inout_ size_t& offset);
+
+            std::string decodeInterned(
+                    _In_ const std::string& block,
+                    _Inout_ size_t& offset,
+                    _Inout_ std::vector<std::string>& table,
+                    _In_ uint64_t index);
+
+        private:
+
+            std::istream& m_stream;
+
+            std::deque<std::string> m_lines;
+
+            std::vector<std::string> m_objectTypes;
+
+            std::vector<std::string> m_attributes;
+    };
+}
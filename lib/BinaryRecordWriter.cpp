@@ -0,0 +1,181 @@
+#include "BinaryRecordWriter.h"
+#include "BinaryRecord.h"
+
+#include "swss/logger.h"
+
+#include <zlib.h>
+
+#include <vector>
+
+using namespace sairedis;
+
+BinaryRecordWriter::BinaryRecordWriter(
+        _In_ std::ostream& stream):
+    m_stream(stream),
+    m_records(0),
+    m_lastTimestamp(0),
+    m_blockTimestamp(0)
+{
+    SWSS_LOG_ENTER();
+
+    m_block.reserve(BinaryRecord::BLOCK_SIZE * 2);
+}
+
+BinaryRecordWriter::~BinaryRecordWriter()
+{
+    SWSS_LOG_ENTER();
+
+    flush();
+}
+
+void BinaryRecordWriter::write(
+        _In_ uint64_t timestamp,
+        _In_ const std::string& line)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_records == 0)
+    {
+        m_blockTimestamp = timestamp;
+    }
+
+    auto tokens = BinaryRecord::tokenize(line);
+
+    BinaryRecord::encodeVarint(m_block, BinaryRecord::zigzagEncode((int64_t)(timestamp - m_lastTimestamp)));
+    BinaryRecord::encodeVarint(m_block, tokens.size());
+
+    for (auto& token: tokens)
+    {
+        encodeToken(token);
+    }
+
+    m_lastTimestamp = timestamp;
+
+    m_records++;
+
+    if (m_block.size() >= BinaryRecord::BLOCK_SIZE)
+    {
+        flush();
+    }
+    else
+    {
+        flushExpired(timestamp);
+    }
+}
+
+void BinaryRecordWriter::flushExpired(
+        _In_ uint64_t timestamp)
+{
+    SWSS_LOG_ENTER();
+
+    // when clock went backwards, block is written as well, so it's not held
+    // until clock catches up
+
+    if (m_records && (timestamp < m_blockTimestamp ||
+            timestamp - m_blockTimestamp >= BinaryRecord::BLOCK_FLUSH_INTERVAL))
+    {
+        flush();
+    }
+}
+
+void BinaryRecordWriter::encodeToken(
+        _In_ const std::string& token)
+{
+    SWSS_LOG_ENTER();
+
+    if (token.compare(0, 4, "SAI_") == 0)
+    {
+        size_t nameSize = token.find_first_of(":=");
+
+        if (nameSize == std::string::npos)
+        {
+            nameSize = token.size();
+        }
+
+        if (token.compare(0, 16, "SAI_OBJECT_TYPE_") == 0)
+        {
+            encodeInterned(BinaryRecord::TOKEN_OBJECT_TYPE, m_objectTypes, token, nameSize);
+        }
+        else
+        {
+            encodeInterned(BinaryRecord::TOKEN_ATTRIBUTE, m_attributes, token, nameSize);
+        }
+
+        return;
+    }
+
+    BinaryRecord::encodeVarint(m_block, BinaryRecord::TOKEN_RAW);
+    BinaryRecord::encodeString(m_block, token);
+}
+
+void BinaryRecordWriter::encodeInterned(
+        _In_ uint64_t kind,
+        _Inout_ std::unordered_map<std::string, uint64_t>& table,
+        _In_ const std::string& token,
+        _In_ size_t nameSize)
+{
+    SWSS_LOG_ENTER();
+
+    std::string name = token.substr(0, nameSize);
+
+    auto it = table.find(name);
+
+    if (it == table.end())
+    {
+        uint64_t index = table.size();
+
+        table[name] = index;
+
+        BinaryRecord::encodeVarint(m_block, (index << BinaryRecord::TOKEN_KIND_BITS) | kind);
+        BinaryRecord::encodeString(m_block, name);
+    }
+    else
+    {
+        BinaryRecord::encodeVarint(m_block, (it->second << BinaryRecord::TOKEN_KIND_BITS) | kind);
+    }
+
+    BinaryRecord::encodeString(m_block, token.substr(nameSize));
+}
+
+void BinaryRecordWriter::flush()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_records == 0)
+    {
+        return;
+    }
+
+    uLongf compressedSize = compressBound((uLong)m_block.size());
+
+    std::vector<Bytef> compressed(compressedSize);
+
+    int rc = compress2(compressed.data(), &compressedSize, (const Bytef*)m_block.data(), (uLong)m_block.size(), Z_BEST_SPEED);
+
+    if (rc != Z_OK)
+    {
+        SWSS_LOG_ERROR("failed to compress recording block of %zu bytes: %d, %lu records lost", m_block.size(), rc, m_records);
+    }
+    else
+    {
+        std::string header = BinaryRecord::BLOCK_MAGIC;
+
+        BinaryRecord::encodeVarint(header, m_records);
+        BinaryRecord::encodeVarint(header, m_block.size());
+        BinaryRecord::encodeVarint(header, compressedSize);
+
+        m_stream.write(header.data(), (std::streamsize)header.size());
+        m_stream.write((const char*)compressed.data(), (std::streamsize)compressedSize);
+        m_stream.flush();
+    }
+
+    // each block is self contained
+
+    m_block.clear();
+
+    m_records = 0;
+    m_lastTimestamp = 0;
+
+    m_objectTypes.clear();
+    m_attributes.clear();
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include "swss/sal.h"
+
+#include <string>
+#include <ostream>
+#include <unordered_map>
+
+#include <stdint.h>
+
+namespace sairedis
+{
+    /**
+     * @brief Writes recording lines in binary recording format.
+     *
+     * Records are collected into block which is compressed and written to
+     * stream when it reaches block size, when flush interval elapsed since
+     * first record in block, or when writer is flushed.
+     *
+     * Flush interval is checked on each record and by flushExpired, writer
+     * itself has no timer. Writer is not thread safe.
+     */
+    class BinaryRecordWriter
+    {
+        private:
+
+            BinaryRecordWriter(const BinaryRecordWriter&) = delete;
+            BinaryRecordWriter& operator=(const BinaryRecordWriter&) = delete;
+
+        public:
+
+            BinaryRecordWriter(
+                    _In_ std::ostream& stream);
+
+            virtual ~BinaryRecordWriter();
+
+        public:
+
+            /**
+             * @brief Write recording line.
+             *
+             * @param timestamp Microseconds since epoch.
+             * @param line Recording line without timestamp.
+             */
+            void write(
+                    _In_ uint64_t timestamp,
+                    _In_ const std::string& line);
+
+            /**
+             * @brief Write current block to stream.
+             */
+            void flush();
+
+            /**
+             * @brief Write current block to stream if flush interval elapsed
+             * since first record in block.
+             *
+             * @param timestamp Current time in microseconds since epoch.
+             */
+            void flushExpired(
+                    _In_ uint64_t timestamp);
+
+        private:
+
+            void encodeToken(
+                    _In_ const std::string& token);
+
+            void encodeInterned(
+                    _In_ uint64_t kind,
+                    _Inout_ std::unordered_map<std::string, uint64_t>& table,
+                    _In_ const std::string& token,
+                    _In_ size_t nameSize);
+
+        private:
+
+            std::ostream& m_stream;
+
+            std::string m_block;
+
+            uint64_t m_records;
+
+            uint64_t m_lastTimestamp;
+
+            uint64_t m_blockTimestamp;
+
+            std::unordered_map<std::string, uint64_t> m_objectTypes;
+
+            std::unordered_map<std::string, uint64_t> m_attributes;
+    };
+}
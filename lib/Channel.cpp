@@ -2,6 +2,8 @@
 
 #include "sairedis.h"
 
+#include "meta/sai_serialize.h"
+
 #include "swss/logger.h"
 
 using namespace sairedis;
@@ -9,7 +11,10 @@ using namespace sairedis;
 Channel::Channel(
         _In_ Callback callback):
     m_callback(callback),
-    m_responseTimeoutMs(SAI_REDIS_DEFAULT_SYNC_OPERATION_RESPONSE_TIMEOUT)
+    m_responseTimeoutMs(SAI_REDIS_DEFAULT_SYNC_OPERATION_RESPONSE_TIMEOUT),
+    m_pipelineDepth(0),
+    m_lastTicket(0),
+    m_outOfSync(false)
 {
     SWSS_LOG_ENTER();
 
@@ -37,3 +42,167 @@ uint64_t Channel::getResponseTimeout() const
 
     return m_responseTimeoutMs;
 }
+
+sai_status_t Channel::wait(
+        _In_ const std::string& command,
+        _Out_ swss::KeyOpFieldsValuesTuple& kco)
+{
+    SWSS_LOG_ENTER();
+
+    collectDeferredResponses();
+
+    if (m_outOfSync)
+    {
+        SWSS_LOG_ERROR("channel is out of sync, not waiting for %s", command.c_str());
+
+        return SAI_STATUS_FAILURE;
+    }
+
+    return receiveResponse(command, kco);
+}
+
+void Channel::setPipelineDepth(
+        _In_ uint32_t pipelineDepth)
+{
+    SWSS_LOG_ENTER();
+
+    collectDeferredResponses();
+
+    m_pipelineDepth = pipelineDepth;
+}
+
+uint32_t Channel::getPipelineDepth() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_pipelineDepth;
+}
+
+void Channel::setResponseCallback(
+        _In_ ResponseCallback responseCallback)
+{
+    SWSS_LOG_ENTER();
+
+    m_responseCallback = responseCallback;
+}
+
+uint64_t Channel::deferResponse(
+        _In_ const std::string& command)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_pipelineDepth == 0)
+    {
+        SWSS_LOG_THROW("pipelining is not enabled on channel");
+    }
+
+    uint64_t ticket = ++m_lastTicket;
+
+    if (m_outOfSync)
+    {
+        notifyDeferredResponse(ticket, command, SAI_STATUS_FAILURE);
+
+        return ticket;
+    }
+
+    m_deferredResponses.emplace_back(ticket, command);
+
+    while (m_deferredResponses.size() > m_pipelineDepth)
+    {
+        collectDeferredResponse();
+    }
+
+    return ticket;
+}
+
+void Channel::collectDeferredResponses()
+{
+    SWSS_LOG_ENTER();
+
+    while (m_deferredResponses.size())
+    {
+        collectDeferredResponse();
+    }
+}
+
+size_t Channel::getDeferredResponseCount() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_deferredResponses.size();
+}
+
+void Channel::collectDeferredResponse()
+{
+    SWSS_LOG_ENTER();
+
+    auto deferred = m_deferredResponses.front();
+
+    m_deferredResponses.pop_front();
+
+    swss::KeyOpFieldsValuesTuple kco;
+
+    auto status = receiveResponse(deferred.second, kco);
+
+    notifyDeferredResponse(deferred.first, deferred.second, status);
+
+    if (m_outOfSync)
+    {
+        // responses of outstanding requests can't be matched any more
+
+        while (m_deferredResponses.size())
+        {
+            deferred = m_deferredResponses.front();
+
+            m_deferredResponses.pop_front();
+
+            notifyDeferredResponse(deferred.first, deferred.second, SAI_STATUS_FAILURE);
+        }
+    }
+}
+
+void Channel::notifyDeferredResponse(
+        _In_ uint64_t ticket,
+        _In_ const std::string& command,
+        _In_ sai_status_t status)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_responseCallback)
+    {
+        m_responseCallback(ticket, status);
+    }
+    else if (status != SAI_STATUS_SUCCESS)
+    {
+        SWSS_LOG_ERROR("deferred %s ticket %lu failed: %s",
+                command.c_str(),
+                ticket,
+                sai_serialize_status(status).c_str());
+    }
+}
+
+bool Channel::isOutOfSync() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_outOfSync;
+}
+
+void Channel::markOutOfSync(
+        _In_ const std::string& command)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_pipelineDepth == 0 || m_outOfSync)
+    {
+        // without pipelining only single response is outstanding
+
+        return;
+    }
+
+    SWSS_LOG_ERROR("%s response timed out, channel is out of sync, failing %zu outstanding requests",
+            command.c_str(),
+            m_deferredResponses.size());
+
+    m_outOfSync = true;
+}
@@ -12,6 +12,7 @@ extern "C" {
 
 #include <memory>
 #include <functional>
+#include <deque>
 
 namespace sairedis
 {
@@ -21,6 +22,12 @@ namespace sairedis
 
             typedef std::function<void(const std::string&,const std::string&, const std::vector<swss::FieldValueTuple>&)> Callback;
 
+            /**
+             * @brief Deferred response callback, gets request ticket and
+             * response status.
+             */
+            typedef std::function<void(uint64_t, sai_status_t)> ResponseCallback;
+
         public:
 
             Channel(
@@ -51,20 +58,111 @@ namespace sairedis
                     _In_ const std::string& key,
                     _In_ const std::string& command) = 0;
 
+            /**
+             * @brief Wait for response of last sent request.
+             *
+             * All deferred responses are collected first, since responses
+             * arrive in the same order as requests were sent.
+             */
             virtual sai_status_t wait(
                     _In_ const std::string& command,
-                    _Out_ swss::KeyOpFieldsValuesTuple& kco) = 0;
+                    _Out_ swss::KeyOpFieldsValuesTuple& kco);
+
+        public: // pipeline
+
+            /**
+             * @brief Set maximum number of deferred responses, zero disables
+             * pipelining. Outstanding deferred responses are collected first.
+             */
+            virtual void setPipelineDepth(
+                    _In_ uint32_t pipelineDepth);
+
+            uint32_t getPipelineDepth() const;
+
+            void setResponseCallback(
+                    _In_ ResponseCallback responseCallback);
+
+            /**
+             * @brief Don't wait for response of last sent request.
+             *
+             * Response will be collected by next wait() or by
+             * collectDeferredResponses(), or when number of deferred responses
+             * exceeds pipeline depth. Status of each collected response is
+             * passed to response callback, when callback is not set failed
+             * responses are only logged.
+             *
+             * @return Request ticket, tickets start from 1 and are increased
+             * by one with each deferred request.
+             */
+            uint64_t deferResponse(
+                    _In_ const std::string& command);
+
+            void collectDeferredResponses();
+
+            size_t getDeferredResponseCount() const;
+
+            /**
+             * @brief Channel is out of sync when response was not received
+             * in time while pipelining.
+             *
+             * Responses are matched to requests by order, so late response
+             * would be taken as response of next request. When channel gets
+             * out of sync, all outstanding deferred requests fail, and all
+             * next requests fail without waiting for response.
+             */
+            bool isOutOfSync() const;
 
         protected:
 
             virtual void notificationThreadFunction() = 0;
 
+            /**
+             * @brief Receive next response from channel.
+             */
+            virtual sai_status_t receiveResponse(
+                    _In_ const std::string& command,
+                    _Out_ swss::KeyOpFieldsValuesTuple& kco) = 0;
+
+            void collectDeferredResponse();
+
+            /**
+             * @brief Called by receiveResponse when response timed out.
+             */
+            void markOutOfSync(
+                    _In_ const std::string& command);
+
+        private:
+
+            void notifyDeferredResponse(
+                    _In_ uint64_t ticket,
+                    _In_ const std::string& command,
+                    _In_ sai_status_t status);
+
         protected:
 
             Callback m_callback;
 
             uint64_t m_responseTimeoutMs;
 
+        protected: // pipeline
+
+            uint32_t m_pipelineDepth;
+
+            /**
+             * @brief Ticket of last deferred request.
+             */
+            uint64_t m_lastTicket;
+
+            /**
+             * @brief Deferred responses, ticket and command, in order in which
+             * requests were sent.
+             */
+            std::deque<std::pair<uint64_t, std::string>> m_deferredResponses;
+
+            ResponseCallback m_responseCallback;
+
+            bool m_outOfSync;
+
         protected: // notification
 
             /**
@@ -12,7 +12,8 @@ using namespace sairedis;
 
 ClientConfig::ClientConfig():
     m_zmqEndpoint("ipc:///tmp/saiServer"),
-    m_zmqNtfEndpoint("ipc:///tmp/saiServerNtf")
+    m_zmqNtfEndpoint("ipc:///tmp/saiServerNtf"),
+    m_pipelineDepth(0)
 {
     SWSS_LOG_ENTER();
 
@@ -57,9 +58,15 @@ std::shared_ptr<ClientConfig> ClientConfig::loadFromFile(
         cc->m_zmqEndpoint = j["zmq_endpoint"];
         cc->m_zmqNtfEndpoint = j["zmq_ntf_endpoint"];
 
-        SWSS_LOG_NOTICE("client config: %s, %s",
+        if (j.find("pipeline_depth") != j.end())
+        {
+            cc->m_pipelineDepth = j["pipeline_depth"];
+        }
+
+        SWSS_LOG_NOTICE("client config: %s, %s, pipeline_depth: %u",
                 cc->m_zmqEndpoint.c_str(),
-                cc->m_zmqNtfEndpoint.c_str());
+                cc->m_zmqNtfEndpoint.c_str(),
+                cc->m_pipelineDepth);
 
         SWSS_LOG_NOTICE("loaded %s client config", path);
 
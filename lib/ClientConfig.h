@@ -25,5 +25,15 @@ namespace sairedis
             std::string m_zmqEndpoint;
 
             std::string m_zmqNtfEndpoint;
+
+            /**
+             * @brief Maximum number of outstanding set/remove requests.
+             *
+             * When non zero, set and remove don't wait for server response,
+             * responses are collected later. Failures are passed to
+             * SAI_REDIS_SWITCH_ATTR_SYNC_PIPELINE_RESPONSE_NOTIFY callback and
+             * first one is returned by SAI_REDIS_SWITCH_ATTR_SYNC_PIPELINE_COLLECT.
+             */
+            uint32_t m_pipelineDepth;
     };
 }
@@ -38,6 +38,9 @@ ClientSai::ClientSai()
     SWSS_LOG_ENTER();
 
     m_apiInitialized = false;
+
+    m_pipelineResponseNotify = nullptr;
+    m_pipelineStatus = SAI_STATUS_SUCCESS;
 }
 
 ClientSai::~ClientSai()
@@ -84,7 +87,14 @@ sai_status_t ClientSai::apiInitialize(
     m_communicationChannel = std::make_shared<ZeroMQChannel>(
             cc->m_zmqEndpoint,
             cc->m_zmqNtfEndpoint,
-            std::bind(&ClientSai::handleNotification, this, _1, _2, _3));
+            std::bind(&ClientSai::handleNotification, this, _1, _2, _3),
+            cc->m_pipelineDepth);
+
+    m_communicationChannel->setResponseCallback(
+            std::bind(&ClientSai::handlePipelineResponse, this, _1, _2));
+
+    m_pipelineResponseNotify = nullptr;
+    m_pipelineStatus = SAI_STATUS_SUCCESS;
 
     m_apiInitialized = true;
 
@@ -98,6 +108,8 @@ sai_status_t ClientSai::apiUninitialize(void)
 
     SWSS_LOG_NOTICE("begin");
 
+    m_communicationChannel->flush();
+
     m_communicationChannel = nullptr;
 
     m_apiInitialized = false;
@@ -242,9 +254,7 @@ sai_status_t ClientSai::set(
 
     if (RedisRemoteSaiInterface::isRedisAttribute(objectType, attr))
     {
-        SWSS_LOG_ERROR("sairedis extension attributes are not supported in CLIENT mode");
-
-        return SAI_STATUS_FAILURE;
+        return setRedisExtensionAttribute(attr);
     }
 
     auto status = set(
@@ -505,6 +515,15 @@ sai_status_t ClientSai::remove(
 
     m_communicationChannel->set(key, {}, REDIS_ASIC_STATE_COMMAND_REMOVE);
 
+    if (m_communicationChannel->getPipelineDepth())
+    {
+        // status will be passed to response callback when collected
+
+        m_communicationChannel->deferResponse(REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
+
+        return SAI_STATUS_SUCCESS;
+    }
+
     auto status = waitForResponse(SAI_COMMON_API_REMOVE);
 
     return status;
@@ -531,6 +550,15 @@ sai_status_t ClientSai::set(
 
     m_communicationChannel->set(key, entry, REDIS_ASIC_STATE_COMMAND_SET);
 
+    if (m_communicationChannel->getPipelineDepth())
+    {
+        // status will be passed to response callback when collected
+
+        m_communicationChannel->deferResponse(REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
+
+        return SAI_STATUS_SUCCESS;
+    }
+
     auto status = waitForResponse(SAI_COMMON_API_SET);
 
     return status;
@@ -606,6 +634,61 @@ sai_status_t ClientSai::waitForResponse(
     return status;
 }
 
+sai_status_t ClientSai::setRedisExtensionAttribute(
+        _In_ const sai_attribute_t *attr)
+{
+    SWSS_LOG_ENTER();
+
+    switch (attr->id)
+    {
+        case SAI_REDIS_SWITCH_ATTR_SYNC_PIPELINE_RESPONSE_NOTIFY:
+
+            m_pipelineResponseNotify = (sai_redis_sync_pipeline_response_fn)attr->value.ptr;
+
+            return SAI_STATUS_SUCCESS;
+
+        case SAI_REDIS_SWITCH_ATTR_SYNC_PIPELINE_COLLECT:
+            {
+                m_communicationChannel->collectDeferredResponses();
+
+                sai_status_t status = m_pipelineStatus;
+
+                m_pipelineStatus = SAI_STATUS_SUCCESS;
+
+                return status;
+            }
+
+        default:
+            break;
+    }
+
+    SWSS_LOG_ERROR("sairedis extension attribute %d is not supported in CLIENT mode", attr->id);
+
+    return SAI_STATUS_FAILURE;
+}
+
+void ClientSai::handlePipelineResponse(
+        _In_ uint64_t ticket,
+        _In_ sai_status_t status)
+{
+    SWSS_LOG_ENTER();
+
+    if (status != SAI_STATUS_SUCCESS)
+    {
+        SWSS_LOG_ERROR("pipelined request ticket %lu failed: %s", ticket, sai_serialize_status(status).c_str());
+
+        if (m_pipelineStatus == SAI_STATUS_SUCCESS)
+        {
+            m_pipelineStatus = status;
+        }
+    }
+
+    if (m_pipelineResponseNotify)
+    {
+        m_pipelineResponseNotify(ticket, status);
+    }
+}
+
 sai_status_t ClientSai::waitForGetResponse(
         _In_ sai_object_type_t objectType,
         _In_ uint32_t attr_count,
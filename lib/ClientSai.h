@@ -1,8 +1,9 @@
 #pragma once
 
 #include "meta/SaiInterface.h"
-#include "Channel.h"
+#include "ZeroMQChannel.h"
 #include "SwitchContainer.h"
+#include "sairedis.h"
 
 #include "meta/Notification.h"
 
@@ -310,6 +311,20 @@ namespace sairedis
 
     private:
 
+            /**
+             * @brief Set sairedis extension attribute.
+             *
+             * Only pipeline response notify and collect are supported, they
+             * have the same meaning as synchronous pipeline attributes in
+             * sairedis.
+             */
+            sai_status_t setRedisExtensionAttribute(
+                    _In_ const sai_attribute_t *attr);
+
+            void handlePipelineResponse(
+                    _In_ uint64_t ticket,
+                    _In_ sai_status_t status);
+
             void handleNotification(
                     _In_ const std::string &name,
                     _In_ const std::string &serializedNotification,
@@ -326,7 +341,7 @@ namespace sairedis
 
             sai_service_method_table_t m_service_method_table;
 
-            std::shared_ptr<Channel> m_communicationChannel;
+            std::shared_ptr<ZeroMQChannel> m_communicationChannel;
 
             std::shared_ptr<SwitchContainer> m_switchContainer;
 
@@ -335,5 +350,12 @@ namespace sairedis
             std::function<sai_switch_notifications_t(std::shared_ptr<Notification>)> m_notificationCallback;
 
             std::vector<sai_object_id_t> m_lastCreateOids;
+
+            sai_redis_sync_pipeline_response_fn m_pipelineResponseNotify;
+
+            /**
+             * @brief First failure of pipelined request since last collect.
+             */
+            sai_status_t m_pipelineStatus;
     };
 }
@@ -4,6 +4,9 @@
 
 #include "meta/sai_serialize.h"
 
+#define POPULATE_METADATA_BATCH_SIZE 10000
+#define POPULATE_METADATA_MAX_PASSES 8
+
 using namespace sairedis;
 using namespace std::placeholders;
 
@@ -52,16 +55,62 @@ void Context::populateMetadata(
 {
     SWSS_LOG_ENTER();
 
-    auto& dump = m_redisSai->getTableDump();
+    SWSS_LOG_NOTICE("populate metadata for switch %s", sai_serialize_object_id(switchId).c_str());
 
-    SWSS_LOG_NOTICE("dump size: %zu", dump.size());
+    // ASIC view is streamed in batches, so whole table is never copied, and
+    // each batch is deserialized in parallel by meta
 
-    if (dump.size() == 0)
+    auto populate = [&](const swss::TableDump& dump)
     {
-        SWSS_LOG_NOTICE("skipping populate metadata for switch %s, (probably connecting to already existing switch)",
-                sai_serialize_object_id(switchId).c_str());
-        return;
+        SWSS_LOG_ENTER();
+
+        m_meta->populate(dump, switchId);
+    };
+
+    m_redisSai->scanAsicState(POPULATE_METADATA_BATCH_SIZE, populate);
+
+    populateMissingReferences(switchId);
+}
+
+void Context::populateMissingReferences(
+        _In_ sai_object_id_t switchId)
+{
+    SWSS_LOG_ENTER();
+
+    // scan is not atomic, objects created during scan may be missing while
+    // objects referencing them were returned, each pass reads referenced
+    // objects directly, which can reference further missing objects
+
+    for (int pass = 0; pass < POPULATE_METADATA_MAX_PASSES; pass++)
+    {
+        auto missing = m_meta->getMissingReferencedOids(switchId);
+
+        if (missing.empty())
+        {
+            return;
+        }
+
+        auto dump = m_redisSai->getAsicStateObjects(missing);
+
+        SWSS_LOG_NOTICE("populate %zu of %zu missing referenced objects", dump.size(), missing.size());
+
+        if (dump.empty())
+        {
+            break;
+        }
+
+        m_meta->populate(dump, switchId);
     }
 
-    m_meta->populate(dump.at(switchId));
+    // object removed during scan is missing as well, but objects referencing
+    // it were already returned by scan and were removed after it
+
+    auto missing = m_meta->getMissingReferencedOids(switchId);
+
+    if (missing.size())
+    {
+        SWSS_LOG_WARN("%zu referenced objects (first %s) are not present in ASIC view, metadata may contain stale objects",
+                missing.size(),
+                sai_serialize_object_id(missing.front()).c_str());
+    }
 }
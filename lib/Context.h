@@ -24,6 +24,15 @@ namespace sairedis
             void populateMetadata(
                     _In_ sai_object_id_t switchId);
 
+        private:
+
+            /**
+             * @brief Populate objects referenced by already populated objects
+             * which are missing in metadata.
+             */
+            void populateMissingReferences(
+                    _In_ sai_object_id_t switchId);
+
         private:
 
             sai_switch_notifications_t handle_notification(
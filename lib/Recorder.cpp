@@ -1,4 +1,5 @@
 #include "Recorder.h"
+#include "BinaryRecord.h"
 
 #include "meta/sai_serialize.h"
 #include "meta/SaiAttributeList.h"
@@ -35,6 +36,10 @@ Recorder::Recorder()
     m_enabled = false;
 
     m_recordStats = true;
+
+    m_recordingFormat = SAI_REDIS_RECORDING_FORMAT_TEXT;
+
+    m_flushThreadRun = false;
 }
 
 Recorder::~Recorder()
@@ -148,6 +153,49 @@ bool Recorder::setRecordingFilename(
     return true;
 }
 
+bool Recorder::setRecordingFormat(
+        _In_ const sai_attribute_t &attr)
+{
+    SWSS_LOG_ENTER();
+
+    auto format = (sai_redis_recording_format_t)attr.value.s32;
+
+    switch (format)
+    {
+        case SAI_REDIS_RECORDING_FORMAT_TEXT:
+        case SAI_REDIS_RECORDING_FORMAT_BINARY:
+            break;
+
+        default:
+
+            SWSS_LOG_ERROR("invalid recording format: %d", attr.value.s32);
+
+            return false;
+    }
+
+    if (format == m_recordingFormat)
+    {
+        return true;
+    }
+
+    if (m_enabled)
+    {
+        stopRecording();
+    }
+
+    m_recordingFormat = format;
+
+    SWSS_LOG_NOTICE("setting recording format: %s",
+            format == SAI_REDIS_RECORDING_FORMAT_BINARY ? "binary" : "text");
+
+    if (m_enabled)
+    {
+        startRecording();
+    }
+
+    return true;
+}
+
 void Recorder::enableRecording(
         _In_ bool enabled)
 {
@@ -175,7 +223,15 @@ void Recorder::recordLine(
         return;
     }
 
-    if (m_ofstream.is_open())
+    if (m_binaryWriter)
+    {
+        struct timeval tv;
+
+        gettimeofday(&tv, NULL);
+
+        m_binaryWriter->write((uint64_t)tv.tv_sec * 1000000 + (uint64_t)tv.tv_usec, line);
+    }
+    else if (m_ofstream.is_open())
     {
         m_ofstream << getTimestamp() << "|" << line << std::endl;
     }
@@ -198,7 +254,7 @@ void Recorder::recordingFileReopen()
 
     SWSS_LOG_ENTER();
 
-    m_ofstream.close();
+    closeRecordingFile();
 
     /*
      * On log rotate we will use the same file name, we are assuming that
@@ -206,34 +262,71 @@ void Recorder::recordingFileReopen()
      * empty file here.
      */
 
+    openRecordingFile();
+}
+
+void Recorder::openRecordingFile()
+{
+    SWSS_LOG_ENTER();
+
     m_recordingFile = m_recordingOutputDirectory + "/" + m_recordingFileName;
 
-    m_ofstream.open(m_recordingFile, std::ofstream::out | std::ofstream::app);
+    bool binary = (m_recordingFormat == SAI_REDIS_RECORDING_FORMAT_BINARY);
+
+    std::ios_base::openmode mode = std::ofstream::out | std::ofstream::app;
+
+    if (binary)
+    {
+        mode |= std::ofstream::binary;
+    }
+
+    m_ofstream.open(m_recordingFile, mode);
 
     if (!m_ofstream.is_open())
     {
         SWSS_LOG_ERROR("failed to open recording file %s: %s", m_recordingFile.c_str(), strerror(errno));
         return;
     }
+
+    if (binary)
+    {
+        // binary blocks are self contained, so they can be appended to existing file
+
+        m_binaryWriter = std::make_shared<BinaryRecordWriter>(m_ofstream);
+    }
 }
 
-void Recorder::startRecording()
+void Recorder::closeRecordingFile()
 {
     SWSS_LOG_ENTER();
 
-    m_recordingFile = m_recordingOutputDirectory + "/" + m_recordingFileName;
+    // writer destructor will write last not full block
+
+    m_binaryWriter = nullptr;
+
+    m_ofstream.close();
+}
+
+void Recorder::startRecording()
+{
+    SWSS_LOG_ENTER();
 
     {
         MUTEX();
-        m_ofstream.open(m_recordingFile, std::ofstream::out | std::ofstream::app);
+
+        openRecordingFile();
 
         if (!m_ofstream.is_open())
         {
-            SWSS_LOG_ERROR("failed to open recording file %s: %s", m_recordingFile.c_str(), strerror(errno));
             return;
         }
     }
 
+    if (m_recordingFormat == SAI_REDIS_RECORDING_FORMAT_BINARY)
+    {
+        startFlushThread();
+    }
+
     recordLine("#|recording on: " + m_recordingFile);
 
     SWSS_LOG_NOTICE("started recording: %s", m_recordingFileName.c_str());
@@ -241,35 +334,114 @@ void Recorder::startRecording()
 
 void Recorder::stopRecording()
 {
-    MUTEX();
-
     SWSS_LOG_ENTER();
 
+    // flush thread is using recorder mutex
+
+    stopFlushThread();
+
+    MUTEX();
+
     SWSS_LOG_NOTICE("stopped recording");
 
     if (m_ofstream.is_open())
     {
-        m_ofstream.close();
+        closeRecordingFile();
 
         SWSS_LOG_NOTICE("closed recording file: %s", m_recordingFileName.c_str());
     }
 }
 
+void Recorder::startFlushThread()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_flushThread)
+    {
+        return;
+    }
+
+    m_flushThreadRun = true;
+
+    m_flushThread = std::make_shared<std::thread>(&Recorder::flushThreadProc, this);
+}
+
+void Recorder::stopFlushThread()
+{
+    SWSS_LOG_ENTER();
+
+    if (!m_flushThread)
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_flushMutex);
+
+        m_flushThreadRun = false;
+    }
+
+    m_flushCv.notify_all();
+
+    m_flushThread->join();
+
+    m_flushThread = nullptr;
+}
+
+void Recorder::flushThreadProc()
+{
+    SWSS_LOG_ENTER();
+
+    std::unique_lock<std::mutex> lock(m_flushMutex);
+
+    while (m_flushThreadRun)
+    {
+        m_flushCv.wait_for(lock, std::chrono::microseconds(BinaryRecord::BLOCK_FLUSH_INTERVAL));
+
+        if (!m_flushThreadRun)
+        {
+            break;
+        }
+
+        MUTEX();
+
+        if (m_binaryWriter)
+        {
+            struct timeval tv;
+
+            gettimeofday(&tv, NULL);
+
+            m_binaryWriter->flushExpired((uint64_t)tv.tv_sec * 1000000 + (uint64_t)tv.tv_usec);
+        }
+    }
+}
+
 std::string Recorder::getTimestamp()
 {
     SWSS_LOG_ENTER();
 
-    char buffer[64];
     struct timeval tv;
 
     gettimeofday(&tv, NULL);
 
+    return getTimestamp((uint64_t)tv.tv_sec * 1000000 + (uint64_t)tv.tv_usec);
+}
+
+std::string Recorder::getTimestamp(
+        _In_ uint64_t timestamp)
+{
+    SWSS_LOG_ENTER();
+
+    char buffer[64];
+
+    time_t seconds = (time_t)(timestamp / 1000000);
+
     struct tm now;
-    localtime_r(&tv.tv_sec, &now);
+    localtime_r(&seconds, &now);
 
     size_t size = strftime(buffer, 32, "%Y-%m-%d.%T.", &now);
 
-    snprintf(&buffer[size], 32, "%06ld", tv.tv_usec);
+    snprintf(&buffer[size], 32, "%06ld", (long)(timestamp % 1000000));
 
     return std::string(buffer);
 }
@@ -1326,6 +1498,28 @@ void Recorder::recordGenericResponse(
     }
 }
 
+void Recorder::recordPipelinedRequest(
+        _In_ uint64_t ticket)
+{
+    SWSS_LOG_ENTER();
+
+    recordComment("pipeline ticket " + std::to_string(ticket));
+}
+
+void Recorder::recordPipelinedResponse(
+        _In_ uint64_t ticket,
+        _In_ sai_status_t status)
+{
+    SWSS_LOG_ENTER();
+
+    if (status != SAI_STATUS_SUCCESS)
+    {
+        // record only when response is not success
+
+        recordComment("pipeline ticket " + std::to_string(ticket) + " response " + sai_serialize_status(status));
+    }
+}
+
 void Recorder::recordBulkGenericResponse(
         _In_ sai_status_t status,
         _In_ uint32_t objectCount,
@@ -7,11 +7,16 @@ extern "C" {
 #include "swss/table.h"
 
 #include "sairedis.h"
+#include "BinaryRecordWriter.h"
 #include "meta/SaiInterface.h"
 
 #include <string>
 #include <fstream>
 #include <vector>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
 
 #define SAI_REDIS_RECORDER_DECLARE_RECORD_REMOVE(X,ot)   \
     void recordRemove(                                   \
@@ -161,6 +166,21 @@ namespace sairedis
             void recordGenericResponse(
                     _In_ sai_status_t status);
 
+            /**
+             * @brief Record ticket of pipelined request.
+             *
+             * Response of pipelined request is collected after next requests
+             * are recorded, so ticket is recorded as comment after request,
+             * and failed response is recorded as comment with the same
+             * ticket instead of response line.
+             */
+            void recordPipelinedRequest(
+                    _In_ uint64_t ticket);
+
+            void recordPipelinedResponse(
+                    _In_ uint64_t ticket,
+                    _In_ sai_status_t status);
+
         public: // create ENTRY
 
             SAIREDIS_DECLARE_EVERY_ENTRY(SAI_REDIS_RECORDER_DECLARE_RECORD_CREATE);
@@ -397,6 +417,9 @@ namespace sairedis
             bool setRecordingFilename(
                     _In_ const sai_attribute_t &attr);
 
+            bool setRecordingFormat(
+                    _In_ const sai_attribute_t &attr);
+
             void requestLogRotate();
 
             void recordComment(
@@ -406,6 +429,13 @@ namespace sairedis
 
             static std::string getTimestamp();
 
+            /**
+             * @brief Format timestamp in microseconds since epoch the same
+             * way as recording line timestamp.
+             */
+            static std::string getTimestamp(
+                    _In_ uint64_t timestamp);
+
             void recordStats(
                     _In_ bool enable);
 
@@ -434,6 +464,10 @@ namespace sairedis
 
         private:
 
+            void openRecordingFile();
+
+            void closeRecordingFile();
+
             void recordingFileReopen();
 
             void startRecording();
@@ -443,6 +477,17 @@ namespace sairedis
             void recordLine(
                     _In_ const std::string& line);
 
+            /**
+             * @brief Start thread which writes not full binary block when
+             * flush interval elapsed, so records are not held in memory
+             * when there are no new records.
+             */
+            void startFlushThread();
+
+            void stopFlushThread();
+
+            void flushThreadProc();
+
         private:
 
             bool m_performLogRotate;
@@ -459,6 +504,18 @@ namespace sairedis
 
             std::ofstream m_ofstream;
 
+            sai_redis_recording_format_t m_recordingFormat;
+
+            std::shared_ptr<BinaryRecordWriter> m_binaryWriter;
+
             std::mutex m_mutex;
+
+            std::shared_ptr<std::thread> m_flushThread;
+
+            bool m_flushThreadRun;
+
+            std::mutex m_flushMutex;
+
+            std::condition_variable m_flushCv;
     };
 }
@@ -24,6 +24,8 @@ RedisChannel::RedisChannel(
     m_asicState             = std::make_shared<swss::ProducerTable>(m_redisPipeline.get(), ASIC_STATE_TABLE, true);
     m_getConsumer           = std::make_shared<swss::ConsumerTable>(m_db.get(), REDIS_TABLE_GETRESPONSE);
 
+    m_getSelect.addSelectable(m_getConsumer.get());
+
     m_dbNtf                 = std::make_shared<swss::DBConnector>(dbAsic, 0);
     m_notificationConsumer  = std::make_shared<swss::NotificationConsumer>(m_dbNtf.get(), REDIS_TABLE_NOTIFICATIONS_PER_DB(dbAsic));
 
@@ -133,23 +135,19 @@ void RedisChannel::del(
     m_asicState->del(key, command);
 }
 
-sai_status_t RedisChannel::wait(
+sai_status_t RedisChannel::receiveResponse(
         _In_ const std::string& command,
         _Out_ swss::KeyOpFieldsValuesTuple& kco)
 {
     SWSS_LOG_ENTER();
 
-    swss::Select s;
-
-    s.addSelectable(m_getConsumer.get());
-
     while (true)
     {
         SWSS_LOG_DEBUG("wait for %s response", command.c_str());
 
         swss::Selectable *sel;
 
-        int result = s.select(&sel, (int)m_responseTimeoutMs);
+        int result = m_getSelect.select(&sel, (int)m_responseTimeoutMs);
 
         if (result == swss::Select::OBJECT)
         {
@@ -160,6 +158,13 @@ sai_status_t RedisChannel::wait(
 
             SWSS_LOG_DEBUG("response: op = %s, key = %s", opkey.c_str(), op.c_str());
 
+            if (op.empty())
+            {
+                // response was already popped in batch with previous one
+
+                continue;
+            }
+
             if (op != command)
             {
                 SWSS_LOG_WARN("got not expected response: %s:%s", opkey.c_str(), op.c_str());
@@ -177,6 +182,8 @@ sai_status_t RedisChannel::wait(
         }
 
         SWSS_LOG_ERROR("SELECT operation result: %s on %s", swss::Select::resultToString(result).c_str(), command.c_str());
+
+        markOutOfSync(command);
         break;
     }
 
@@ -13,6 +13,7 @@
 #include "swss/consumertable.h"
 #include "swss/notificationconsumer.h"
 #include "swss/selectableevent.h"
+#include "swss/select.h"
 
 #include <memory>
 #include <functional>
@@ -48,14 +49,14 @@ namespace sairedis
                     _In_ const std::string& key,
                     _In_ const std::string& command) override;
 
-            virtual sai_status_t wait(
-                    _In_ const std::string& command,
-                    _Out_ swss::KeyOpFieldsValuesTuple& kco) override;
-
         protected:
 
             virtual void notificationThreadFunction() override;
 
+            virtual sai_status_t receiveResponse(
+                    _In_ const std::string& command,
+                    _Out_ swss::KeyOpFieldsValuesTuple& kco) override;
+
         private:
 
             std::string m_dbAsic;
@@ -74,6 +75,14 @@ namespace sairedis
              */
             std::shared_ptr<swss::ConsumerTable> m_getConsumer;
 
+            /**
+             * @brief Response waiter.
+             *
+             * Get consumer is registered only once, so responses of pipelined
+             * requests are matched in order on the same waiter.
+             */
+            swss::Select m_getSelect;
+
             std::shared_ptr<swss::DBConnector> m_db;
 
             std::shared_ptr<swss::RedisPipeline> m_redisPipeline;
@@ -15,16 +15,22 @@
 #include "meta/Globals.h"
 
 #include "swss/tokenize.h"
+#include "swss/redisapi.h"
 
 #include "config.h"
 
 #include <inttypes.h>
+#include <unordered_set>
+
+#include <nlohmann/json.hpp>
 
 using namespace sairedis;
 using namespace saimeta;
 using namespace sairediscommon;
 using namespace std::placeholders;
 
+using json = nlohmann::json;
+
 std::vector<swss::FieldValueTuple> serialize_counter_id_list(
         _In_ const sai_enum_metadata_t *stats_enum,
         _In_ uint32_t count,
@@ -77,6 +83,9 @@ sai_status_t RedisRemoteSaiInterface::apiInitialize(
     m_useTempView = false;
     m_syncMode = false;
     m_redisCommunicationMode = SAI_REDIS_COMMUNICATION_MODE_REDIS_ASYNC;
+    m_syncPipelineDepth = 0;
+    m_syncPipelineResponseNotify = nullptr;
+    m_syncPipelineStatus = SAI_STATUS_SUCCESS;
 
     if (m_contextConfig->m_zmqEnable)
     {
@@ -98,6 +107,8 @@ sai_status_t RedisRemoteSaiInterface::apiInitialize(
 
     m_responseTimeoutMs = m_communicationChannel->getResponseTimeout();
 
+    setupSyncPipeline();
+
     m_db = std::make_shared<swss::DBConnector>(m_contextConfig->m_dbAsic, 0);
 
     m_redisVidIndexGenerator = std::make_shared<RedisVidIndexGenerator>(m_db, REDIS_KEY_VIDCOUNTER);
@@ -124,6 +135,8 @@ sai_status_t RedisRemoteSaiInterface::apiUninitialize(void)
         return SAI_STATUS_FAILURE;
     }
 
+    m_communicationChannel->collectDeferredResponses();
+
     m_communicationChannel = nullptr; // will stop thread
 
     // clear local state after stopping threads
@@ -186,9 +199,7 @@ sai_status_t RedisRemoteSaiInterface::create(
                 return SAI_STATUS_SUCCESS;
             }
 
-            refreshTableDump();
-
-            if (m_tableDump.find(switchId) == m_tableDump.end())
+            if (!asicStateContainsSwitch(switchId))
             {
                 SWSS_LOG_ERROR("failed to find switch %s to connect (init=false)",
                         sai_serialize_object_id(switchId).c_str());
@@ -374,6 +385,8 @@ sai_status_t RedisRemoteSaiInterface::setRedisExtensionAttribute(
                 m_redisCommunicationMode = SAI_REDIS_COMMUNICATION_MODE_ZMQ_SYNC;
             }
 
+            m_communicationChannel->collectDeferredResponses();
+
             m_communicationChannel = nullptr;
 
             switch (m_redisCommunicationMode)
@@ -392,6 +405,8 @@ sai_status_t RedisRemoteSaiInterface::setRedisExtensionAttribute(
 
                     m_communicationChannel->setBuffered(true);
 
+                    setupSyncPipeline();
+
                     return SAI_STATUS_SUCCESS;
 
                 case SAI_REDIS_COMMUNICATION_MODE_REDIS_SYNC:
@@ -408,6 +423,8 @@ sai_status_t RedisRemoteSaiInterface::setRedisExtensionAttribute(
 
                     m_communicationChannel->setBuffered(false);
 
+                    setupSyncPipeline();
+
                     return SAI_STATUS_SUCCESS;
 
                 case SAI_REDIS_COMMUNICATION_MODE_ZMQ_SYNC:
@@ -432,6 +449,8 @@ sai_status_t RedisRemoteSaiInterface::setRedisExtensionAttribute(
 
                     m_communicationChannel->setBuffered(false);
 
+                    setupSyncPipeline();
+
                     return SAI_STATUS_SUCCESS;
 
                 default:
@@ -460,6 +479,33 @@ sai_status_t RedisRemoteSaiInterface::setRedisExtensionAttribute(
 
             return SAI_STATUS_SUCCESS;
 
+        case SAI_REDIS_SWITCH_ATTR_SYNC_PIPELINE_DEPTH:
+
+            m_syncPipelineDepth = attr->value.u32;
+
+            setupSyncPipeline();
+
+            SWSS_LOG_NOTICE("set sync pipeline depth to %u", m_syncPipelineDepth);
+
+            return SAI_STATUS_SUCCESS;
+
+        case SAI_REDIS_SWITCH_ATTR_SYNC_PIPELINE_RESPONSE_NOTIFY:
+
+            m_syncPipelineResponseNotify = (sai_redis_sync_pipeline_response_fn)attr->value.ptr;
+
+            return SAI_STATUS_SUCCESS;
+
+        case SAI_REDIS_SWITCH_ATTR_SYNC_PIPELINE_COLLECT:
+            {
+                m_communicationChannel->collectDeferredResponses();
+
+                sai_status_t status = m_syncPipelineStatus;
+
+                m_syncPipelineStatus = SAI_STATUS_SUCCESS;
+
+                return status;
+            }
+
         case SAI_REDIS_SWITCH_ATTR_RECORDING_OUTPUT_DIR:
 
             if (m_recorder)
@@ -478,6 +524,15 @@ sai_status_t RedisRemoteSaiInterface::setRedisExtensionAttribute(
 
             return SAI_STATUS_SUCCESS;
 
+        case SAI_REDIS_SWITCH_ATTR_RECORDING_FORMAT:
+
+            if (m_recorder && !m_recorder->setRecordingFormat(*attr))
+            {
+                return SAI_STATUS_INVALID_PARAMETER;
+            }
+
+            return SAI_STATUS_SUCCESS;
+
         case SAI_REDIS_SWITCH_ATTR_FLEX_COUNTER_GROUP:
             return notifyCounterGroupOperations(objectId,
                                                 reinterpret_cast<sai_redis_flex_counter_group_parameter_t*>(attr->value.ptr));
@@ -899,6 +954,17 @@ sai_status_t RedisRemoteSaiInterface::waitForResponse(
 {
     SWSS_LOG_ENTER();
 
+    if (m_syncMode && m_syncPipelineDepth)
+    {
+        // status will be passed to response callback when collected
+
+        auto ticket = m_communicationChannel->deferResponse(REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
+
+        m_recorder->recordPipelinedRequest(ticket);
+
+        return SAI_STATUS_SUCCESS;
+    }
+
     if (m_syncMode)
     {
         swss::KeyOpFieldsValuesTuple kco;
@@ -918,6 +984,40 @@ sai_status_t RedisRemoteSaiInterface::waitForResponse(
     return SAI_STATUS_SUCCESS;
 }
 
+void RedisRemoteSaiInterface::setupSyncPipeline()
+{
+    SWSS_LOG_ENTER();
+
+    m_communicationChannel->setPipelineDepth(m_syncPipelineDepth);
+
+    m_communicationChannel->setResponseCallback(
+            std::bind(&RedisRemoteSaiInterface::handleSyncPipelineResponse, this, _1, _2));
+}
+
+void RedisRemoteSaiInterface::handleSyncPipelineResponse(
+        _In_ uint64_t ticket,
+        _In_ sai_status_t status)
+{
+    SWSS_LOG_ENTER();
+
+    m_recorder->recordPipelinedResponse(ticket, status);
+
+    if (status != SAI_STATUS_SUCCESS)
+    {
+        SWSS_LOG_ERROR("pipelined request ticket %lu failed: %s", ticket, sai_serialize_status(status).c_str());
+
+        if (m_syncPipelineStatus == SAI_STATUS_SUCCESS)
+        {
+            m_syncPipelineStatus = status;
+        }
+    }
+
+    if (m_syncPipelineResponseNotify)
+    {
+        m_syncPipelineResponseNotify(ticket, status);
+    }
+}
+
 sai_status_t RedisRemoteSaiInterface::waitForGetResponse(
         _In_ sai_object_type_t objectType,
         _In_ uint32_t attr_count,
@@ -1663,7 +1763,8 @@ sai_status_t RedisRemoteSaiInterface::bulkGetStats(
 {
     SWSS_LOG_ENTER();
 
-    SWSS_LOG_ERROR("not implemented");
+    // callers probe bulk stats support and fall back to single object
+    // stats, so don't log error on each poll
 
     return SAI_STATUS_NOT_IMPLEMENTED;
 }
@@ -1680,7 +1781,8 @@ sai_status_t RedisRemoteSaiInterface::bulkClearStats(
 {
     SWSS_LOG_ENTER();
 
-    SWSS_LOG_ERROR("not implemented");
+    // callers probe bulk stats support and fall back to single object
+    // stats, so don't log error on each poll
 
     return SAI_STATUS_NOT_IMPLEMENTED;
 }
@@ -2401,45 +2503,154 @@ bool RedisRemoteSaiInterface::containsSwitch(
     return true;
 }
 
-const std::map<sai_object_id_t, swss::TableDump>& RedisRemoteSaiInterface::getTableDump() const
+bool RedisRemoteSaiInterface::asicStateContainsSwitch(
+        _In_ sai_object_id_t switchId)
 {
     SWSS_LOG_ENTER();
 
-    return m_tableDump;
+    auto key = std::string(ASIC_STATE_TABLE ":") + sai_serialize_object_type(SAI_OBJECT_TYPE_SWITCH) + ":" + sai_serialize_object_id(switchId);
+
+    return m_db->exists(key);
 }
 
-void RedisRemoteSaiInterface::refreshTableDump()
+void RedisRemoteSaiInterface::scanAsicState(
+        _In_ uint32_t batchSize,
+        _In_ const std::function<void(const swss::TableDump&)>& callback)
 {
     SWSS_LOG_ENTER();
 
-    SWSS_LOG_TIMER("get asic view from %s", ASIC_STATE_TABLE);
+    SWSS_LOG_TIMER("scan asic view from %s", ASIC_STATE_TABLE);
 
-    swss::Table table(m_db.get(), ASIC_STATE_TABLE);
+    // SCAN is not atomic, objects modified during scan can be seen in
+    // inconsistent state, so when whole database fits into single batch,
+    // take atomic dump instead
 
-    swss::TableDump dump;
+    swss::RedisReply size(m_db.get(), "DBSIZE", REDIS_REPLY_INTEGER);
+
+    if (size.getContext()->integer <= (long long)batchSize)
+    {
+        swss::Table table(m_db.get(), ASIC_STATE_TABLE);
 
-    table.dump(dump);
+        swss::TableDump dump;
+
+        table.dump(dump);
+
+        SWSS_LOG_NOTICE("%s objects count: %zu in single dump", ASIC_STATE_TABLE, dump.size());
+
+        if (dump.size())
+        {
+            callback(dump);
+        }
+
+        return;
+    }
 
-    auto& map = m_tableDump;
+    // single SCAN iteration and HGETALL of returned keys are executed on
+    // server side, so each batch requires only one round trip
 
-    map.clear();
+    static const std::string scanLuaScript =
+        "local res = redis.call('SCAN', ARGV[1], 'MATCH', KEYS[1] .. ':*', 'COUNT', ARGV[2])\n"
+        "local dump = {}\n"
+        "for i, k in ipairs(res[2]) do\n"
+        "    local fvs = redis.call('HGETALL', k)\n"
+        "    local hash = {}\n"
+        "    for j = 1, #fvs, 2 do\n"
+        "        hash[fvs[j]] = fvs[j + 1]\n"
+        "    end\n"
+        "    dump[string.sub(k, string.len(KEYS[1]) + 2)] = hash\n"
+        "end\n"
+        "return cjson.encode({res[1], dump})\n";
 
-    for (auto& key: dump)
+    if (m_scanAsicStateSha.empty())
     {
-        sai_object_meta_key_t mk;
-        sai_deserialize_object_meta_key(key.first, mk);
+        m_scanAsicStateSha = swss::loadRedisScript(m_db.get(), scanLuaScript);
+    }
+
+    // SCAN can return the same key more than once, while keys are modified
+    // during iteration, keep only names of already returned keys
+
+    std::unordered_set<std::string> seen;
+
+    std::string cursor = "0";
+
+    size_t batches = 0;
+
+    do
+    {
+        swss::RedisCommand command;
 
-        auto switchVID = switchIdQuery(mk.objectkey.key.object_id);
+        command.format(
+                "EVALSHA %s 1 %s %s %u",
+                m_scanAsicStateSha.c_str(),
+                ASIC_STATE_TABLE,
+                cursor.c_str(),
+                batchSize);
 
-        map[switchVID][key.first] = key.second;
+        swss::RedisReply r(m_db.get(), command, REDIS_REPLY_STRING);
+
+        auto j = json::parse(r.getContext()->str);
+
+        cursor = j.at(0).get<std::string>();
+
+        swss::TableDump dump;
+
+        if (j.at(1).is_object())
+        {
+            for (auto it = j.at(1).begin(); it != j.at(1).end(); it++)
+            {
+                if (!seen.insert(it.key()).second)
+                {
+                    continue;
+                }
+
+                auto& hash = dump[it.key()];
+
+                for (auto fv = it.value().begin(); fv != it.value().end(); fv++)
+                {
+                    hash[fv.key()] = fv.value().get<std::string>();
+                }
+            }
+        }
+
+        batches++;
+
+        if (dump.size())
+        {
+            callback(dump);
+        }
     }
+    while (cursor != "0");
+
+    SWSS_LOG_NOTICE("%s objects count: %zu in %zu batches", ASIC_STATE_TABLE, seen.size(), batches);
+}
+
+swss::TableDump RedisRemoteSaiInterface::getAsicStateObjects(
+        _In_ const std::vector<sai_object_id_t>& objectIds)
+{
+    SWSS_LOG_ENTER();
 
-    SWSS_LOG_NOTICE("%s switch count: %zu:", ASIC_STATE_TABLE, map.size());
+    swss::Table table(m_db.get(), ASIC_STATE_TABLE);
 
-    for (auto& kvp: map)
+    swss::TableDump dump;
+
+    std::vector<swss::FieldValueTuple> values;
+
+    for (auto oid: objectIds)
     {
-        SWSS_LOG_NOTICE("%s: objects count: %zu",
-                sai_serialize_object_id(kvp.first).c_str(),
-                kvp.second.size());
+        auto key = sai_serialize_object_type(objectTypeQuery(oid)) + ":" + sai_serialize_object_id(oid);
+
+        if (!table.get(key, values))
+        {
+            continue;
+        }
+
+        auto& hash = dump[key];
+
+        for (auto& fv: values)
+        {
+            hash[fvField(fv)] = fvValue(fv);
+        }
     }
+
+    return dump;
 }
@@ -230,7 +230,30 @@ namespace sairedis
             sai_switch_notifications_t syncProcessNotification(
                     _In_ std::shared_ptr<Notification> notification);
 
-            const std::map<sai_object_id_t, swss::TableDump>& getTableDump() const;
+            /**
+             * @brief Read ASIC view in batches of approximately batch size
+             * objects using redis SCAN, without copying whole table.
+             *
+             * Each object is passed to callback exactly once, objects of all
+             * switches are returned.
+             *
+             * SCAN is not atomic, when ASIC view is modified during scan,
+             * object created during scan can be missing while objects
+             * referencing it are returned, caller should validate references
+             * using getAsicStateObjects. When database is not larger than
+             * single batch, atomic dump is used instead and callback is
+             * called once.
+             */
+            void scanAsicState(
+                    _In_ uint32_t batchSize,
+                    _In_ const std::function<void(const swss::TableDump&)>& callback);
+
+            /**
+             * @brief Read given objects from ASIC view, objects which are not
+             * present are not returned.
+             */
+            swss::TableDump getAsicStateObjects(
+                    _In_ const std::vector<sai_object_id_t>& objectIds);
 
             bool containsSwitch(
                     _In_ sai_object_id_t switchId) const;
@@ -415,6 +438,18 @@ namespace sairedis
                     _In_ sai_object_id_t objectId,
                     _In_ const sai_redis_flex_counter_parameter_t *flexCounterParam);
 
+        private: // synchronous pipeline
+
+            /**
+             * @brief Apply synchronous pipeline depth and response callback
+             * to current communication channel.
+             */
+            void setupSyncPipeline();
+
+            void handleSyncPipelineResponse(
+                    _In_ uint64_t ticket,
+                    _In_ sai_status_t status);
+
         private:
 
             sai_status_t sai_redis_notify_syncd(
@@ -426,7 +461,8 @@ namespace sairedis
             sai_switch_notifications_t processNotification(
                     _In_ std::shared_ptr<Notification> notification);
 
-            void refreshTableDump();
+            bool asicStateContainsSwitch(
+                    _In_ sai_object_id_t switchId);
 
         private:
 
@@ -460,8 +496,25 @@ namespace sairedis
 
             uint64_t m_responseTimeoutMs;
 
+            /**
+             * @brief Maximum number of outstanding create/remove/set requests
+             * in synchronous mode, zero disables pipelining.
+             */
+            uint32_t m_syncPipelineDepth;
+
+            sai_redis_sync_pipeline_response_fn m_syncPipelineResponseNotify;
+
+            /**
+             * @brief Status of first failed pipelined request since last
+             * collect.
+             */
+            sai_status_t m_syncPipelineStatus;
+
             std::function<sai_switch_notifications_t(std::shared_ptr<Notification>)> m_notificationCallback;
 
-            std::map<sai_object_id_t, swss::TableDump> m_tableDump;
+            /**
+             * @brief SHA of ASIC view scan script, loaded on first use.
+             */
+            std::string m_scanAsicStateSha;
     };
 }
@@ -12,7 +12,8 @@ using namespace sairedis;
 
 ServerConfig::ServerConfig():
     m_zmqEndpoint("ipc:///tmp/saiServer"),
-    m_zmqNtfEndpoint("ipc:///tmp/saiServerNtf")
+    m_zmqNtfEndpoint("ipc:///tmp/saiServerNtf"),
+    m_workerThreads(0)
 {
     SWSS_LOG_ENTER();
 
@@ -57,9 +58,15 @@ std::shared_ptr<ServerConfig> ServerConfig::loadFromFile(
         cc->m_zmqEndpoint = j["zmq_endpoint"];
         cc->m_zmqNtfEndpoint = j["zmq_ntf_endpoint"];
 
-        SWSS_LOG_NOTICE("server config: %s, %s",
+        if (j.find("worker_threads") != j.end())
+        {
+            cc->m_workerThreads = j["worker_threads"];
+        }
+
+        SWSS_LOG_NOTICE("server config: %s, %s, worker_threads: %u",
                 cc->m_zmqEndpoint.c_str(),
-                cc->m_zmqNtfEndpoint.c_str());
+                cc->m_zmqNtfEndpoint.c_str(),
+                cc->m_workerThreads);
 
         SWSS_LOG_NOTICE("loaded %s server config", path);
 
@@ -25,5 +25,15 @@ namespace sairedis
             std::string m_zmqEndpoint;
 
             std::string m_zmqNtfEndpoint;
+
+            /**
+             * @brief Number of request worker threads.
+             *
+             * When zero, server uses single REP socket and processes requests
+             * one by one in server thread. When non zero, server uses ROUTER
+             * socket and serves multiple clients, read only requests are
+             * executed concurrently.
+             */
+            uint32_t m_workerThreads;
     };
 }
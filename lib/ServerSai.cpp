@@ -7,6 +7,7 @@
 #include "meta/sai_serialize.h"
 #include "meta/SaiAttributeList.h"
 #include "meta/ZeroMQSelectableChannel.h"
+#include "meta/ZeroMQRouterSelectableChannel.h"
 
 #include "swss/logger.h"
 #include "swss/select.h"
@@ -24,6 +25,12 @@ using namespace std::placeholders;
         SWSS_LOG_ERROR("%s: api not initialized", __PRETTY_FUNCTION__);     \
         return SAI_STATUS_FAILURE; }
 
+/*
+ * Identity of client which request is processed by current worker thread,
+ * responses are routed back to that client.
+ */
+static thread_local const std::string* g_clientIdentity = nullptr;
+
 ServerSai::ServerSai()
 {
     SWSS_LOG_ENTER();
@@ -31,6 +38,21 @@ ServerSai::ServerSai()
     m_apiInitialized = false;
 
     m_runServerThread = false;
+
+    m_runWorkers = false;
+}
+
+ServerSai::ServerSai(
+        _In_ std::shared_ptr<SaiInterface> sai):
+    m_backendSai(sai)
+{
+    SWSS_LOG_ENTER();
+
+    m_apiInitialized = false;
+
+    m_runServerThread = false;
+
+    m_runWorkers = false;
 }
 
 ServerSai::~ServerSai()
@@ -77,7 +99,14 @@ sai_status_t ServerSai::apiInitialize(
 
     memcpy(&m_service_method_table, service_method_table, sizeof(m_service_method_table));
 
-    m_sai = std::make_shared<Sai>(); // actual SAI to talk to syncd
+    if (m_backendSai)
+    {
+        m_sai = m_backendSai;
+    }
+    else
+    {
+        m_sai = std::make_shared<Sai>(); // actual SAI to talk to syncd
+    }
 
     auto status = m_sai->apiInitialize(flags, service_method_table);
 
@@ -89,7 +118,18 @@ sai_status_t ServerSai::apiInitialize(
 
         auto cc = ServerConfig::loadFromFile(serverConfig);
 
-        m_selectableChannel = std::make_shared<ZeroMQSelectableChannel>(cc->m_zmqEndpoint);
+        if (cc->m_workerThreads)
+        {
+            m_routerChannel = std::make_shared<ZeroMQRouterSelectableChannel>(cc->m_zmqEndpoint);
+
+            m_selectableChannel = m_routerChannel;
+
+            startWorkers(cc->m_workerThreads);
+        }
+        else
+        {
+            m_selectableChannel = std::make_shared<ZeroMQSelectableChannel>(cc->m_zmqEndpoint);
+        }
 
         SWSS_LOG_NOTICE("starting server thread");
 
@@ -125,6 +165,12 @@ sai_status_t ServerSai::apiUninitialize(void)
         SWSS_LOG_NOTICE("end server thread end");
     }
 
+    stopWorkers();
+
+    m_routerChannel = nullptr;
+
+    m_selectableChannel = nullptr;
+
     m_sai = nullptr;
 
     SWSS_LOG_NOTICE("end");
@@ -711,7 +757,14 @@ void ServerSai::serverThreadFunction()
 
         if (result == swss::Select::OBJECT)
         {
-            processEvent(*m_selectableChannel.get());
+            if (m_routerChannel)
+            {
+                dispatchEvents();
+            }
+            else
+            {
+                processEvent(*m_selectableChannel.get());
+            }
         }
         else
         {
@@ -746,6 +799,202 @@ void ServerSai::processEvent(
     while (!consumer.empty());
 }
 
+void ServerSai::sendResponse(
+        _In_ const std::string& key,
+        _In_ const std::vector<swss::FieldValueTuple>& values,
+        _In_ const std::string& op)
+{
+    SWSS_LOG_ENTER();
+
+    if (g_clientIdentity && m_routerChannel)
+    {
+        m_routerChannel->send(*g_clientIdentity, key, values, op);
+    }
+    else
+    {
+        m_selectableChannel->set(key, values, op);
+    }
+}
+
+void ServerSai::startWorkers(
+        _In_ uint32_t workerThreads)
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_NOTICE("starting %u worker threads", workerThreads);
+
+    m_runWorkers = true;
+
+    for (uint32_t i = 0; i < workerThreads; i++)
+    {
+        m_workers.push_back(std::make_shared<std::thread>(&ServerSai::workerThreadFunction, this));
+    }
+}
+
+void ServerSai::stopWorkers()
+{
+    SWSS_LOG_ENTER();
+
+    {
+        std::lock_guard<std::mutex> lock(m_sessionMutex);
+
+        m_runWorkers = false;
+    }
+
+    m_sessionCond.notify_all();
+
+    for (auto& worker: m_workers)
+    {
+        worker->join();
+    }
+
+    m_workers.clear();
+
+    // requests not processed yet are dropped, clients will time out
+
+    m_sessions.clear();
+    m_readySessions.clear();
+}
+
+void ServerSai::dispatchEvents()
+{
+    SWSS_LOG_ENTER();
+
+    while (!m_routerChannel->empty())
+    {
+        swss::KeyOpFieldsValuesTuple kco;
+
+        std::string identity;
+
+        m_routerChannel->pop(kco, identity);
+
+        std::lock_guard<std::mutex> lock(m_sessionMutex);
+
+        auto& session = m_sessions[identity];
+
+        session.m_requests.push_back(std::move(kco));
+
+        if (!session.m_scheduled)
+        {
+            session.m_scheduled = true;
+
+            m_readySessions.push_back(identity);
+
+            m_sessionCond.notify_one();
+        }
+    }
+}
+
+void ServerSai::workerThreadFunction()
+{
+    SWSS_LOG_ENTER();
+
+    std::unique_lock<std::mutex> lock(m_sessionMutex);
+
+    while (true)
+    {
+        m_sessionCond.wait(lock, [&]{ return !m_runWorkers || !m_readySessions.empty(); });
+
+        if (!m_runWorkers)
+            break;
+
+        std::string identity = std::move(m_readySessions.front());
+
+        m_readySessions.pop_front();
+
+        // session stays scheduled while processed, so other workers will not
+        // pick it up, and map references are stable on insert
+
+        auto& session = m_sessions.at(identity);
+
+        auto kco = std::move(session.m_requests.front());
+
+        session.m_requests.pop_front();
+
+        lock.unlock();
+
+        processClientRequest(identity, kco);
+
+        lock.lock();
+
+        if (session.m_requests.empty())
+        {
+            m_sessions.erase(identity);
+        }
+        else
+        {
+            // one request per turn, so busy client will not starve others
+
+            m_readySessions.push_back(identity);
+
+            m_sessionCond.notify_one();
+        }
+    }
+}
+
+void ServerSai::processClientRequest(
+        _In_ const std::string& identity,
+        _In_ const swss::KeyOpFieldsValuesTuple& kco)
+{
+    SWSS_LOG_ENTER();
+
+    g_clientIdentity = &identity;
+
+    try
+    {
+        if (isReadOnlyOperation(kfvOp(kco)))
+        {
+            std::shared_lock<std::shared_timed_mutex> lock(m_operationMutex);
+
+            processSingleEvent(kco);
+        }
+        else
+        {
+            std::unique_lock<std::shared_timed_mutex> lock(m_operationMutex);
+
+            MUTEX();
+
+            processSingleEvent(kco);
+        }
+    }
+    catch (const std::exception& e)
+    {
+        SWSS_LOG_ERROR("failed to process %s: %s", kfvOp(kco).c_str(), e.what());
+
+        // client is waiting for response, otherwise it would time out
+
+        static const std::map<std::string, std::string> responses = {
+            { REDIS_ASIC_STATE_COMMAND_FLUSH, REDIS_ASIC_STATE_COMMAND_FLUSHRESPONSE },
+            { REDIS_ASIC_STATE_COMMAND_ATTR_CAPABILITY_QUERY, REDIS_ASIC_STATE_COMMAND_ATTR_CAPABILITY_RESPONSE },
+            { REDIS_ASIC_STATE_COMMAND_ATTR_ENUM_VALUES_CAPABILITY_QUERY, REDIS_ASIC_STATE_COMMAND_ATTR_ENUM_VALUES_CAPABILITY_RESPONSE },
+            { REDIS_ASIC_STATE_COMMAND_OBJECT_TYPE_GET_AVAILABILITY_QUERY, REDIS_ASIC_STATE_COMMAND_OBJECT_TYPE_GET_AVAILABILITY_RESPONSE },
+            { REDIS_ASIC_STATE_COMMAND_STATS_CAPABILITY_QUERY, REDIS_ASIC_STATE_COMMAND_STATS_CAPABILITY_RESPONSE },
+            { REDIS_ASIC_STATE_COMMAND_STATS_ST_CAPABILITY_QUERY, REDIS_ASIC_STATE_COMMAND_STATS_ST_CAPABILITY_RESPONSE },
+        };
+
+        auto it = responses.find(kfvOp(kco));
+
+        sendResponse(sai_serialize_status(SAI_STATUS_FAILURE), {},
+                it == responses.end() ? REDIS_ASIC_STATE_COMMAND_GETRESPONSE : it->second);
+    }
+
+    g_clientIdentity = nullptr;
+}
+
+bool ServerSai::isReadOnlyOperation(
+        _In_ const std::string& op)
+{
+    SWSS_LOG_ENTER();
+
+    return op == REDIS_ASIC_STATE_COMMAND_GET ||
+        op == REDIS_ASIC_STATE_COMMAND_GET_STATS ||
+        op == REDIS_ASIC_STATE_COMMAND_ATTR_CAPABILITY_QUERY ||
+        op == REDIS_ASIC_STATE_COMMAND_ATTR_ENUM_VALUES_CAPABILITY_QUERY ||
+        op == REDIS_ASIC_STATE_COMMAND_OBJECT_TYPE_GET_AVAILABILITY_QUERY ||
+        op == REDIS_ASIC_STATE_COMMAND_STATS_CAPABILITY_QUERY ||
+        op == REDIS_ASIC_STATE_COMMAND_STATS_ST_CAPABILITY_QUERY;
+}
+
 sai_status_t ServerSai::processSingleEvent(
         _In_ const swss::KeyOpFieldsValuesTuple &kco)
 {
@@ -954,7 +1203,7 @@ void ServerSai::sendApiResponse(
             sai_serialize_common_api(api).c_str(),
             strStatus.c_str());
 
-    m_selectableChannel->set(strStatus, entry, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
+    sendResponse(strStatus, entry, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
 }
 
 void ServerSai::sendGetResponse(
@@ -1016,7 +1265,7 @@ void ServerSai::sendGetResponse(
      * response will not put any data to table, only queue is used.
      */
 
-    m_selectableChannel->set(strStatus, entry, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
+    sendResponse(strStatus, entry, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
 
     SWSS_LOG_INFO("response for GET api was send");
 }
@@ -1938,7 +2187,7 @@ void ServerSai::sendBulkApiResponse(
             sai_serialize_common_api(api).c_str(),
             strStatus.c_str());
 
-    m_selectableChannel->set(strStatus, entry, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
+    sendResponse(strStatus, entry, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
 }
 
 sai_status_t ServerSai::processAttrCapabilityQuery(
@@ -1957,7 +2206,7 @@ sai_status_t ServerSai::processAttrCapabilityQuery(
     {
         SWSS_LOG_ERROR("Invalid input: expected 2 arguments, received %zu", values.size());
 
-        m_selectableChannel->set(sai_serialize_status(SAI_STATUS_INVALID_PARAMETER), {}, REDIS_ASIC_STATE_COMMAND_ATTR_CAPABILITY_RESPONSE);
+        sendResponse(sai_serialize_status(SAI_STATUS_INVALID_PARAMETER), {}, REDIS_ASIC_STATE_COMMAND_ATTR_CAPABILITY_RESPONSE);
 
         return SAI_STATUS_INVALID_PARAMETER;
     }
@@ -1987,7 +2236,7 @@ sai_status_t ServerSai::processAttrCapabilityQuery(
             capability.create_implemented, capability.set_implemented, capability.get_implemented);
     }
 
-    m_selectableChannel->set(sai_serialize_status(status), entry, REDIS_ASIC_STATE_COMMAND_ATTR_CAPABILITY_RESPONSE);
+    sendResponse(sai_serialize_status(status), entry, REDIS_ASIC_STATE_COMMAND_ATTR_CAPABILITY_RESPONSE);
 
     return status;
 }
@@ -2008,7 +2257,7 @@ sai_status_t ServerSai::processAttrEnumValuesCapabilityQuery(
     {
         SWSS_LOG_ERROR("Invalid input: expected 3 arguments, received %zu", values.size());
 
-        m_selectableChannel->set(sai_serialize_status(SAI_STATUS_INVALID_PARAMETER), {}, REDIS_ASIC_STATE_COMMAND_ATTR_ENUM_VALUES_CAPABILITY_RESPONSE);
+        sendResponse(sai_serialize_status(SAI_STATUS_INVALID_PARAMETER), {}, REDIS_ASIC_STATE_COMMAND_ATTR_ENUM_VALUES_CAPABILITY_RESPONSE);
 
         return SAI_STATUS_INVALID_PARAMETER;
     }
@@ -2052,7 +2301,7 @@ sai_status_t ServerSai::processAttrEnumValuesCapabilityQuery(
         SWSS_LOG_DEBUG("Sending response: capabilities = '%s', count = %d", strCap.c_str(), enumCapList.count);
     }
 
-    m_selectableChannel->set(sai_serialize_status(status), entry, REDIS_ASIC_STATE_COMMAND_ATTR_ENUM_VALUES_CAPABILITY_RESPONSE);
+    sendResponse(sai_serialize_status(status), entry, REDIS_ASIC_STATE_COMMAND_ATTR_ENUM_VALUES_CAPABILITY_RESPONSE);
 
     return status;
 }
@@ -2101,7 +2350,7 @@ sai_status_t ServerSai::processObjectTypeGetAvailabilityQuery(
         SWSS_LOG_DEBUG("Sending response: count = %lu", count);
     }
 
-    m_selectableChannel->set(sai_serialize_status(status), entry, REDIS_ASIC_STATE_COMMAND_OBJECT_TYPE_GET_AVAILABILITY_RESPONSE);
+    sendResponse(sai_serialize_status(status), entry, REDIS_ASIC_STATE_COMMAND_OBJECT_TYPE_GET_AVAILABILITY_RESPONSE);
 
     return status;
 }
@@ -2122,7 +2371,7 @@ sai_status_t ServerSai::processStatsCapabilityQuery(
     {
         SWSS_LOG_ERROR("Invalid input: expected 2 arguments, received %zu", values.size());
 
-        m_selectableChannel->set(sai_serialize_status(SAI_STATUS_INVALID_PARAMETER), {}, REDIS_ASIC_STATE_COMMAND_STATS_CAPABILITY_RESPONSE);
+        sendResponse(sai_serialize_status(SAI_STATUS_INVALID_PARAMETER), {}, REDIS_ASIC_STATE_COMMAND_STATS_CAPABILITY_RESPONSE);
 
         return SAI_STATUS_INVALID_PARAMETER;
     }
@@ -2182,7 +2431,7 @@ sai_status_t ServerSai::processStatsCapabilityQuery(
         SWSS_LOG_DEBUG("Sending response: count = %u", statCapList.count);
     }
 
-    m_selectableChannel->set(sai_serialize_status(status), entry, REDIS_ASIC_STATE_COMMAND_STATS_CAPABILITY_RESPONSE);
+    sendResponse(sai_serialize_status(status), entry, REDIS_ASIC_STATE_COMMAND_STATS_CAPABILITY_RESPONSE);
 
     return status;
 }
@@ -2203,7 +2452,7 @@ sai_status_t ServerSai::processStatsStCapabilityQuery(
     {
         SWSS_LOG_ERROR("Invalid input: expected 2 arguments, received %zu", values.size());
 
-        m_selectableChannel->set(sai_serialize_status(SAI_STATUS_INVALID_PARAMETER), {}, REDIS_ASIC_STATE_COMMAND_STATS_ST_CAPABILITY_RESPONSE);
+        sendResponse(sai_serialize_status(SAI_STATUS_INVALID_PARAMETER), {}, REDIS_ASIC_STATE_COMMAND_STATS_ST_CAPABILITY_RESPONSE);
 
         return SAI_STATUS_INVALID_PARAMETER;
     }
@@ -2266,7 +2515,7 @@ sai_status_t ServerSai::processStatsStCapabilityQuery(
         SWSS_LOG_DEBUG("Sending response: count = %u", statCapList.count);
     }
 
-    m_selectableChannel->set(sai_serialize_status(status), entry, REDIS_ASIC_STATE_COMMAND_STATS_ST_CAPABILITY_RESPONSE);
+    sendResponse(sai_serialize_status(status), entry, REDIS_ASIC_STATE_COMMAND_STATS_ST_CAPABILITY_RESPONSE);
 
     return status;
 }
@@ -2296,7 +2545,7 @@ sai_status_t ServerSai::processFdbFlush(
 
     sai_status_t status = m_sai->flushFdbEntries(switchOid, attr_count, attr_list);
 
-    m_selectableChannel->set(sai_serialize_status(status), {} , REDIS_ASIC_STATE_COMMAND_FLUSHRESPONSE);
+    sendResponse(sai_serialize_status(status), {} , REDIS_ASIC_STATE_COMMAND_FLUSHRESPONSE);
 
     return status;
 }
@@ -2334,7 +2583,7 @@ sai_status_t ServerSai::processClearStatsEvent(
             (uint32_t)counter_ids.size(),
             counter_ids.data());
 
-    m_selectableChannel->set(sai_serialize_status(status), {}, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
+    sendResponse(sai_serialize_status(status), {}, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
 
     return status;
 }
@@ -2393,7 +2642,7 @@ sai_status_t ServerSai::processGetStatsEvent(
         }
     }
 
-    m_selectableChannel->set(sai_serialize_status(status), entry, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
+    sendResponse(sai_serialize_status(status), entry, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
 
     return status;
 }
@@ -3,12 +3,17 @@
 #include "meta/SaiInterface.h"
 #include "meta/SaiAttributeList.h"
 #include "meta/SelectableChannel.h"
+#include "meta/ZeroMQRouterSelectableChannel.h"
 
 #include "swss/selectableevent.h"
 
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
+#include <condition_variable>
 #include <thread>
+#include <deque>
+#include <map>
 
 namespace sairedis
 {
@@ -19,6 +24,13 @@ namespace sairedis
 
             ServerSai();
 
+            /**
+             * @brief Server forwarding requests to given SAI instead of
+             * creating sairedis SAI (for example vslib SAI).
+             */
+            ServerSai(
+                    _In_ std::shared_ptr<SaiInterface> sai);
+
             virtual ~ServerSai();
 
         public:
@@ -199,6 +211,29 @@ namespace sairedis
             sai_status_t processSingleEvent(
                     _In_ const swss::KeyOpFieldsValuesTuple &kco);
 
+            void sendResponse(
+                    _In_ const std::string& key,
+                    _In_ const std::vector<swss::FieldValueTuple>& values,
+                    _In_ const std::string& op);
+
+            // ROUTER mode
+
+            void startWorkers(
+                    _In_ uint32_t workerThreads);
+
+            void stopWorkers();
+
+            void dispatchEvents();
+
+            void workerThreadFunction();
+
+            void processClientRequest(
+                    _In_ const std::string& identity,
+                    _In_ const swss::KeyOpFieldsValuesTuple& kco);
+
+            static bool isReadOnlyOperation(
+                    _In_ const std::string& op);
+
             // QUAD API
 
             sai_status_t processQuadEvent(
@@ -315,6 +350,46 @@ namespace sairedis
 
             swss::SelectableEvent m_serverThreadThreadShouldEndEvent;
 
+            std::shared_ptr<SaiInterface> m_backendSai;
+
+        private: // ROUTER mode
+
+            /**
+             * @brief Pending requests of single client.
+             *
+             * Session is processed by only one worker at a time, so client
+             * requests are executed and responded in order they were sent.
+             */
+            struct ClientSession
+            {
+                std::deque<swss::KeyOpFieldsValuesTuple> m_requests;
+
+                bool m_scheduled = false;
+            };
+
+            std::shared_ptr<ZeroMQRouterSelectableChannel> m_routerChannel;
+
+            std::map<std::string, ClientSession> m_sessions;
+
+            /**
+             * @brief Identities of sessions waiting for worker.
+             */
+            std::deque<std::string> m_readySessions;
+
+            std::mutex m_sessionMutex;
+
+            std::condition_variable m_sessionCond;
+
+            bool m_runWorkers;
+
+            std::vector<std::shared_ptr<std::thread>> m_workers;
+
+            /**
+             * @brief Read only operations hold shared lock, all other
+             * operations hold exclusive lock.
+             */
+            std::shared_timed_mutex m_operationMutex;
+
         protected:
 
             sai_status_t processStatsCapabilityQuery(
@@ -18,7 +18,8 @@ using namespace sairedis;
 ZeroMQChannel::ZeroMQChannel(
         _In_ const std::string& endpoint,
         _In_ const std::string& ntfEndpoint,
-        _In_ Channel::Callback callback):
+        _In_ Channel::Callback callback,
+        _In_ uint32_t pipelineDepth):
     Channel(callback),
     m_endpoint(endpoint),
     m_ntfEndpoint(ntfEndpoint),
@@ -31,22 +32,13 @@ ZeroMQChannel::ZeroMQChannel(
 
     m_buffer.resize(ZMQ_RESPONSE_BUFFER_SIZE);
 
+    m_pipelineDepth = pipelineDepth;
+
     // configure ZMQ for main communication
 
     m_context = zmq_ctx_new();
 
-    m_socket = zmq_socket(m_context, ZMQ_REQ);
-
-    SWSS_LOG_NOTICE("opening zmq main endpoint: %s", endpoint.c_str());
-
-    int rc = zmq_connect(m_socket, endpoint.c_str());
-
-    if (rc != 0)
-    {
-        SWSS_LOG_THROW("failed to open zmq main endpoint %s, zmqerrno: %d",
-                endpoint.c_str(),
-                zmq_errno());
-    }
+    openSocket();
 
     // configure ZMQ notification endpoint
 
@@ -56,7 +48,7 @@ ZeroMQChannel::ZeroMQChannel(
 
     SWSS_LOG_NOTICE("opening zmq ntf endpoint: %s", ntfEndpoint.c_str());
 
-    rc = zmq_bind(m_ntfSocket, ntfEndpoint.c_str());
+    int rc = zmq_bind(m_ntfSocket, ntfEndpoint.c_str());
 
     if (rc != 0)
     {
@@ -200,7 +192,7 @@ void ZeroMQChannel::flush()
 {
     SWSS_LOG_ENTER();
 
-    // not supported
+    collectDeferredResponses();
 }
 
 void ZeroMQChannel::set(
@@ -220,6 +212,30 @@ void ZeroMQChannel::set(
 
     SWSS_LOG_DEBUG("sending: %s", msg.c_str());
 
+    if (m_pipelineDepth)
+    {
+        // DEALER socket must add empty delimiter frame which REQ socket adds
+        // implicitly
+
+        for (int i = 0; true ; ++i)
+        {
+            int rc = zmq_send(m_socket, "", 0, ZMQ_SNDMORE);
+
+            if (rc < 0 && zmq_errno() == EINTR && i < ZMQ_MAX_RETRY)
+            {
+                continue;
+            }
+            if (rc < 0)
+            {
+                SWSS_LOG_THROW("zmq_send failed, on endpoint %s, zmqerrno: %d: %s",
+                        m_endpoint.c_str(),
+                        zmq_errno(),
+                        zmq_strerror(zmq_errno()));
+            }
+            break;
+        }
+    }
+
     for (int i = 0; true ; ++i)
     {
         int rc = zmq_send(m_socket, msg.c_str(), msg.length(), 0);
@@ -250,7 +266,75 @@ void ZeroMQChannel::del(
     set(key, values, command);
 }
 
-sai_status_t ZeroMQChannel::wait(
+void ZeroMQChannel::openSocket()
+{
+    SWSS_LOG_ENTER();
+
+    // DEALER allows multiple outstanding requests, REQ enforces strict
+    // send/receive order
+
+    m_socket = zmq_socket(m_context, m_pipelineDepth ? ZMQ_DEALER : ZMQ_REQ);
+
+    SWSS_LOG_NOTICE("opening zmq main endpoint: %s, pipeline depth: %u", m_endpoint.c_str(), m_pipelineDepth);
+
+    int rc = zmq_connect(m_socket, m_endpoint.c_str());
+
+    if (rc != 0)
+    {
+        SWSS_LOG_THROW("failed to open zmq main endpoint %s, zmqerrno: %d",
+                m_endpoint.c_str(),
+                zmq_errno());
+    }
+}
+
+void ZeroMQChannel::setPipelineDepth(
+        _In_ uint32_t pipelineDepth)
+{
+    SWSS_LOG_ENTER();
+
+    bool reopen = (m_pipelineDepth == 0) != (pipelineDepth == 0);
+
+    // collects all deferred responses, so there is no outstanding request
+    // and socket can be safely replaced
+
+    Channel::setPipelineDepth(pipelineDepth);
+
+    if (reopen)
+    {
+        zmq_close(m_socket);
+
+        openSocket();
+    }
+}
+
+int ZeroMQChannel::receive()
+{
+    SWSS_LOG_ENTER();
+
+    for (int i = 0; true ; ++i)
+    {
+        int rc = zmq_recv(m_socket, m_buffer.data(), ZMQ_RESPONSE_BUFFER_SIZE, 0);
+
+        if (rc < 0 && zmq_errno() == EINTR && i < ZMQ_MAX_RETRY)
+        {
+            continue;
+        }
+        if (rc < 0)
+        {
+            SWSS_LOG_THROW("zmq_recv failed, zmqerrno: %d", zmq_errno());
+        }
+        if (rc >= ZMQ_RESPONSE_BUFFER_SIZE)
+        {
+            SWSS_LOG_THROW("zmq_recv message was truncated (over %d bytes, received %d), increase buffer size, message DROPPED",
+                    ZMQ_RESPONSE_BUFFER_SIZE,
+                    rc);
+        }
+
+        return rc;
+    }
+}
+
+sai_status_t ZeroMQChannel::receiveResponse(
         _In_ const std::string& command,
         _Out_ swss::KeyOpFieldsValuesTuple& kco)
 {
@@ -276,6 +360,8 @@ sai_status_t ZeroMQChannel::wait(
             // notice, at this point we could throw, since in REP/REQ pattern
             // we are forced to use send/recv in that specific order
 
+            markOutOfSync(command);
+
             return SAI_STATUS_FAILURE;
         }
         if (rc < 0 && zmq_errno() == EINTR && i < ZMQ_MAX_RETRY)
@@ -289,27 +375,15 @@ sai_status_t ZeroMQChannel::wait(
         break;
     }
 
-    for (int i = 0; true ; ++i)
+    if (m_pipelineDepth)
     {
-        rc = zmq_recv(m_socket, m_buffer.data(), ZMQ_RESPONSE_BUFFER_SIZE, 0);
+        // skip empty delimiter frame
 
-        if (rc < 0 && zmq_errno() == EINTR && i < ZMQ_MAX_RETRY)
-        {
-            continue;
-        }
-        if (rc < 0)
-        {
-            SWSS_LOG_THROW("zmq_recv failed, zmqerrno: %d", zmq_errno());
-        }
-        if (rc >= ZMQ_RESPONSE_BUFFER_SIZE)
-        {
-            SWSS_LOG_THROW("zmq_recv message was truncated (over %d bytes, received %d), increase buffer size, message DROPPED",
-                    ZMQ_RESPONSE_BUFFER_SIZE,
-                    rc);
-        }
-        break;
+        receive();
     }
 
+    rc = receive();
+
     m_buffer.at(rc) = 0; // make sure that we end string with zero before parse
 
     SWSS_LOG_DEBUG("response: %s", m_buffer.data());
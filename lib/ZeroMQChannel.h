@@ -20,7 +20,8 @@ namespace sairedis
             ZeroMQChannel(
                     _In_ const std::string& endpoint,
                     _In_ const std::string& ntfEndpoint,
-                    _In_ Channel::Callback callback);
+                    _In_ Channel::Callback callback,
+                    _In_ uint32_t pipelineDepth = 0);
 
             virtual ~ZeroMQChannel();
 
@@ -40,14 +41,32 @@ namespace sairedis
                     _In_ const std::string& key,
                     _In_ const std::string& command) override;
 
-            virtual sai_status_t wait(
-                    _In_ const std::string& command,
-                    _Out_ swss::KeyOpFieldsValuesTuple& kco) override;
+        public:
+
+            /**
+             * @brief Set pipeline depth.
+             *
+             * When non zero, DEALER socket is used instead of REQ, so multiple
+             * requests can be sent before receiving responses. Main socket is
+             * reopened when socket type changes.
+             */
+            virtual void setPipelineDepth(
+                    _In_ uint32_t pipelineDepth) override;
 
         protected:
 
             virtual void notificationThreadFunction() override;
 
+            virtual sai_status_t receiveResponse(
+                    _In_ const std::string& command,
+                    _Out_ swss::KeyOpFieldsValuesTuple& kco) override;
+
+        private:
+
+            void openSocket();
+
+            int receive();
+
         private:
 
             std::string m_endpoint;
@@ -86,6 +86,43 @@ typedef enum _sai_redis_communication_mode_t
 
 } sai_redis_communication_mode_t;
 
+typedef enum _sai_redis_recording_format_t
+{
+    /**
+     * @brief Human readable text lines.
+     */
+    SAI_REDIS_RECORDING_FORMAT_TEXT,
+
+    /**
+     * @brief Compressed binary blocks.
+     *
+     * Records are buffered until block is full, recording file is closed or
+     * rotated, or one second elapsed since first record in block. Elapsed
+     * time is checked on each record and by recorder thread once a second,
+     * so when there are no new records, block is written in at most two
+     * seconds. Recording can be converted to text format by sairecconv tool,
+     * saiplayer can replay both formats.
+     */
+    SAI_REDIS_RECORDING_FORMAT_BINARY,
+
+} sai_redis_recording_format_t;
+
+/**
+ * @brief Synchronous pipeline response callback.
+ *
+ * Called when response of pipelined create, remove or set request is
+ * collected, from the thread which is calling SAI API, so SAI API must not be
+ * called from this callback.
+ *
+ * @param[in] ticket Request ticket, tickets start from 1 and are increased by
+ * one with each pipelined request, counter is reset when communication mode is
+ * changed.
+ * @param[in] status Actual request status.
+ */
+typedef void (*sai_redis_sync_pipeline_response_fn)(
+        _In_ uint64_t ticket,
+        _In_ sai_status_t status);
+
 /**
  * @brief Use Redis communication channel to handle counters.
  *
@@ -364,6 +401,71 @@ typedef enum _sai_redis_switch_attr_t
      */
     SAI_REDIS_SWITCH_ATTR_FLEX_COUNTER,
 
+    /**
+     * @brief Recording file format.
+     *
+     * Changing format while recording is enabled will reopen recording file.
+     * Binary format should be used with different file name than text format,
+     * since recording file is opened in append mode.
+     *
+     * @type sai_redis_recording_format_t
+     * @flags CREATE_AND_SET
+     * @default SAI_REDIS_RECORDING_FORMAT_TEXT
+     */
+    SAI_REDIS_SWITCH_ATTR_RECORDING_FORMAT,
+
+    /**
+     * @brief Synchronous pipeline depth.
+     *
+     * Only used in synchronous communication modes. When non zero, create,
+     * remove and set API will return SAI_STATUS_SUCCESS right after request
+     * is sent, like in asynchronous mode, and actual status is collected
+     * later. At most this number of responses are outstanding, older
+     * responses are collected when window is full and all of them are
+     * collected before any other synchronous API, like GET or bulk API.
+     *
+     * Each collected status is passed to
+     * SAI_REDIS_SWITCH_ATTR_SYNC_PIPELINE_RESPONSE_NOTIFY callback. Setting
+     * this attribute collects all outstanding responses.
+     *
+     * Responses are matched to requests by order. When response times out,
+     * channel is out of sync, all outstanding requests fail and all next
+     * requests fail without waiting for response.
+     *
+     * In recording, ticket of each pipelined request is recorded as comment
+     * after request, and failed response is recorded as comment with the
+     * same ticket.
+     *
+     * In client mode depth is taken from "pipeline_depth" of client config,
+     * and response notify and collect attributes are also supported.
+     *
+     * @type sai_uint32_t
+     * @flags CREATE_AND_SET
+     * @default 0
+     */
+    SAI_REDIS_SWITCH_ATTR_SYNC_PIPELINE_DEPTH,
+
+    /**
+     * @brief Synchronous pipeline response callback.
+     *
+     * @type sai_pointer_t sai_redis_sync_pipeline_response_fn
+     * @flags CREATE_AND_SET
+     * @default NULL
+     */
+    SAI_REDIS_SWITCH_ATTR_SYNC_PIPELINE_RESPONSE_NOTIFY,
+
+    /**
+     * @brief Collect all outstanding synchronous pipeline responses.
+     *
+     * This is action attribute. Set fails when any pipelined request since
+     * last collect failed.
+     *
+     * @type bool
+     * @flags CREATE_AND_SET
+     * @default false
+     */
+    SAI_REDIS_SWITCH_ATTR_SYNC_PIPELINE_COLLECT,
+
 } sai_redis_switch_attr_t;
 
 /**
@@ -11,11 +11,16 @@
 #include <boost/algorithm/string/join.hpp>
 
 #include <set>
+#include <thread>
+#include <algorithm>
 
 // TODO add validation for all oids belong to the same switch
 
 #define MAX_LIST_COUNT (0x1<<24) // 16M
 
+#define POPULATE_MAX_SHARDS 16
+#define POPULATE_MIN_SHARD_SIZE 1000
+
 #define CHECK_STATUS_SUCCESS(s) { if ((s) != SAI_STATUS_SUCCESS) return (s); }
 
 #define CHECK_STATUS_SUCCESS_MODE(s,m)                                                          \
@@ -1018,6 +1023,35 @@ sai_status_t Meta::meta_validate_stats(
     return SAI_STATUS_SUCCESS;
 }
 
+sai_status_t Meta::meta_validate_bulk_stats(
+        _In_ sai_object_type_t object_type,
+        _In_ uint32_t object_count,
+        _In_ const sai_object_key_t *object_key,
+        _In_ uint32_t number_of_counters,
+        _In_ const sai_stat_id_t *counter_ids,
+        _In_ sai_stats_mode_t mode,
+        _In_ const uint64_t *counters,
+        _In_ const sai_status_t *object_statuses)
+{
+    SWSS_LOG_ENTER();
+
+    PARAMETER_CHECK_POSITIVE(object_count);
+    PARAMETER_CHECK_IF_NOT_NULL(object_key);
+    PARAMETER_CHECK_IF_NOT_NULL(object_statuses);
+    PARAMETER_CHECK_IF_NOT_NULL(counters);
+
+    uint64_t counter;
+
+    for (uint32_t idx = 0; idx < object_count; idx++)
+    {
+        auto status = meta_validate_stats(object_type, object_key[idx].key.object_id, number_of_counters, counter_ids, &counter, mode);
+
+        CHECK_STATUS_SUCCESS(status);
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
 sai_status_t Meta::getStats(
         _In_ sai_object_type_t object_type,
         _In_ sai_object_id_t object_id,
@@ -1154,7 +1188,15 @@ sai_status_t Meta::bulkGetStats(
 {
     SWSS_LOG_ENTER();
 
-    return SAI_STATUS_NOT_IMPLEMENTED;
+    auto status = meta_validate_bulk_stats(object_type, object_count, object_key, number_of_counters, counter_ids, mode, counters, object_statuses);
+
+    CHECK_STATUS_SUCCESS(status);
+
+    status = m_implementation->bulkGetStats(switchId, object_type, object_count, object_key, number_of_counters, counter_ids, mode, object_statuses, counters);
+
+    // no post validation required
+
+    return status;
 }
 
 sai_status_t Meta::bulkClearStats(
@@ -1169,7 +1211,16 @@ sai_status_t Meta::bulkClearStats(
 {
     SWSS_LOG_ENTER();
 
-    return SAI_STATUS_NOT_IMPLEMENTED;
+    uint64_t counters;
+    auto status = meta_validate_bulk_stats(object_type, object_count, object_key, number_of_counters, counter_ids, mode, &counters, object_statuses);
+
+    CHECK_STATUS_SUCCESS(status);
+
+    status = m_implementation->bulkClearStats(switchId, object_type, object_count, object_key, number_of_counters, counter_ids, mode, object_statuses);
+
+    // no post validation required
+
+    return status;
 }
 
 // for bulk operations actually we could make copy of current db and actually
@@ -1722,13 +1773,13 @@ bool Meta::meta_is_object_in_default_state(
         return false;
     }
 
-    auto attrs = m_saiObjectCollection.getObject(meta_key)->getAttributes();
+    auto obj = m_saiObjectCollection.getObject(meta_key);
 
-    for (const auto& attr: attrs)
+    for (size_t idx = 0; idx < obj->getAttrCount(); idx++)
     {
-        auto &md = *attr->getSaiAttrMetadata();
+        auto &md = *obj->getSaiAttrMetadataAt(idx);
 
-        auto *a = attr->getSaiAttr();
+        auto *a = obj->getSaiAttrAt(idx);
 
         if (md.isreadonly)
             continue;
@@ -1874,9 +1925,11 @@ void Meta::meta_generic_validation_post_remove(
 
     // get all attributes that was set
 
-    for (auto&it: m_saiObjectCollection.getObject(meta_key)->getAttributes())
+    auto obj = m_saiObjectCollection.getObject(meta_key);
+
+    for (size_t idx = 0; idx < obj->getAttrCount(); idx++)
     {
-        const sai_attribute_t* attr = it->getSaiAttr();
+        const sai_attribute_t* attr = obj->getSaiAttrAt(idx);
 
         auto mdp = sai_metadata_get_attr_metadata(meta_key.objecttype, attr->id);
 
@@ -3918,7 +3971,7 @@ sai_status_t Meta::meta_generic_validation_create(
                 }
                 else
                 {
-                    mode = (sai_buffer_pool_threshold_mode_t)prev->getSaiAttr()->value.s32;
+                    mode = (sai_buffer_pool_threshold_mode_t)prev->value.s32;
                 }
 
                 if ((mode == SAI_BUFFER_POOL_THRESHOLD_MODE_DYNAMIC && md.attrid == SAI_BUFFER_PROFILE_ATTR_SHARED_DYNAMIC_TH) ||
@@ -4438,7 +4491,7 @@ sai_status_t Meta::meta_generic_validation_set(
         // check if it was set on local DB
         // (this will not respect create_only with default)
 
-        if (get_object_previous_attr(meta_key, md) == NULL)
+        if (!m_saiObjectCollection.hasObjectAttr(meta_key, md.attrid))
         {
             META_LOG_WARN(md, "set for conditional, but not found in local db, object %s created on switch ?",
                     sai_serialize_object_meta_key(meta_key).c_str());
@@ -4570,7 +4623,7 @@ sai_status_t Meta::meta_generic_validation_get(
 
             // check if it was set on local DB
             // (this will not respect create_only with default)
-            if (get_object_previous_attr(meta_key, md) == NULL)
+            if (!m_saiObjectCollection.hasObjectAttr(meta_key, md.attrid))
             {
                 // XXX produces too much noise
                 // META_LOG_WARN(md, "get for conditional, but not found in local db, object %s created on switch ?",
@@ -5384,13 +5437,13 @@ sai_object_id_t Meta::meta_extract_switch_id(
     }
 }
 
-std::shared_ptr<SaiAttrWrapper> Meta::get_object_previous_attr(
+const sai_attribute_t* Meta::get_object_previous_attr(
         _In_ const sai_object_meta_key_t& metaKey,
         _In_ const sai_attr_metadata_t& md)
 {
     SWSS_LOG_ENTER();
 
-    return m_saiObjectCollection.getObjectAttr(metaKey, md.attrid);
+    return m_saiObjectCollection.getObjectSaiAttr(metaKey, md.attrid);
 }
 
 std::vector<const sai_attr_metadata_t*> Meta::get_attributes_metadata(
@@ -5500,7 +5553,7 @@ void Meta::meta_generic_validation_post_get_objlist(
 
     if (!SAI_HAS_FLAG_READ_ONLY(md.flags) && md.isoidattribute)
     {
-        if (get_object_previous_attr(meta_key, md) == NULL)
+        if (!m_saiObjectCollection.hasObjectAttr(meta_key, md.attrid))
         {
             // XXX produces too much noise
             // META_LOG_WARN(md, "post get, not in local db, FIX snoop!: %s",
@@ -5969,7 +6022,7 @@ void Meta::meta_generic_validation_post_set(
 
     if (!SAI_HAS_FLAG_READ_ONLY(md.flags) && md.isoidattribute)
     {
-        if ((get_object_previous_attr(meta_key, md) == NULL) &&
+        if (!m_saiObjectCollection.hasObjectAttr(meta_key, md.attrid) &&
                 (md.defaultvaluetype != SAI_DEFAULT_VALUE_TYPE_CONST &&
                  md.defaultvaluetype != SAI_DEFAULT_VALUE_TYPE_EMPTY_LIST))
         {
@@ -6012,7 +6065,7 @@ void Meta::meta_generic_validation_post_set(
                 if (prev != NULL)
                 {
                     // decrease previous if it was set
-                    m_oids.objectReferenceDecrement(prev->getSaiAttr()->value.oid);
+                    m_oids.objectReferenceDecrement(prev->value.oid);
                 }
 
                 m_oids.objectReferenceIncrement(value.oid);
@@ -6028,7 +6081,7 @@ void Meta::meta_generic_validation_post_set(
                 if (prev != NULL)
                 {
                     // decrease previous if it was set
-                    m_oids.objectReferenceDecrement(prev->getSaiAttr()->value.objlist);
+                    m_oids.objectReferenceDecrement(prev->value.objlist);
                 }
 
                 m_oids.objectReferenceIncrement(value.objlist);
@@ -6061,8 +6114,8 @@ void Meta::meta_generic_validation_post_set(
                 if (prev)
                 {
                     // decrease previous if it was set
-                    if (prev->getSaiAttr()->value.aclfield.enable)
-                        m_oids.objectReferenceDecrement(prev->getSaiAttr()->value.aclfield.data.oid);
+                    if (prev->value.aclfield.enable)
+                        m_oids.objectReferenceDecrement(prev->value.aclfield.data.oid);
                 }
 
                 if (value.aclfield.enable)
@@ -6079,8 +6132,8 @@ void Meta::meta_generic_validation_post_set(
                 if (prev)
                 {
                     // decrease previous if it was set
-                    if (prev->getSaiAttr()->value.aclfield.enable)
-                        m_oids.objectReferenceDecrement(prev->getSaiAttr()->value.aclfield.data.objlist);
+                    if (prev->value.aclfield.enable)
+                        m_oids.objectReferenceDecrement(prev->value.aclfield.data.objlist);
                 }
 
                 if (value.aclfield.enable)
@@ -6114,8 +6167,8 @@ void Meta::meta_generic_validation_post_set(
                 if (prev)
                 {
                     // decrease previous if it was set
-                    if (prev->getSaiAttr()->value.aclaction.enable)
-                        m_oids.objectReferenceDecrement(prev->getSaiAttr()->value.aclaction.parameter.oid);
+                    if (prev->value.aclaction.enable)
+                        m_oids.objectReferenceDecrement(prev->value.aclaction.parameter.oid);
                 }
 
                 if (value.aclaction.enable)
@@ -6131,8 +6184,8 @@ void Meta::meta_generic_validation_post_set(
                 if (prev)
                 {
                     // decrease previous if it was set
-                    if (prev->getSaiAttr()->value.aclaction.enable)
-                        m_oids.objectReferenceDecrement(prev->getSaiAttr()->value.aclaction.parameter.objlist);
+                    if (prev->value.aclaction.enable)
+                        m_oids.objectReferenceDecrement(prev->value.aclaction.parameter.objlist);
                 }
 
                 if (value.aclaction.enable)
@@ -6289,7 +6342,7 @@ void Meta::meta_sai_on_fdb_flush_event_consolidated(
 
     for (auto& fdb: fdbEntries)
     {
-        auto fdbTypeAttr = fdb->getAttr(SAI_FDB_ENTRY_ATTR_TYPE);
+        auto fdbTypeAttr = fdb->getSaiAttr(SAI_FDB_ENTRY_ATTR_TYPE);
 
         if (!fdbTypeAttr)
         {
@@ -6298,7 +6351,7 @@ void Meta::meta_sai_on_fdb_flush_event_consolidated(
             continue;
         }
 
-        if (fdbTypeAttr->getSaiAttr()->value.s32 != type->value.s32)
+        if (fdbTypeAttr->value.s32 != type->value.s32)
         {
             // entry type is not matching on this fdb entry
             continue;
@@ -6308,7 +6361,7 @@ void Meta::meta_sai_on_fdb_flush_event_consolidated(
         // since vendor can add this attribute to fdb_entry with NULL value
         if (bpid != NULL && bpid->value.oid != SAI_NULL_OBJECT_ID)
         {
-            auto bpidAttr = fdb->getAttr(SAI_FDB_ENTRY_ATTR_BRIDGE_PORT_ID);
+            auto bpidAttr = fdb->getSaiAttr(SAI_FDB_ENTRY_ATTR_BRIDGE_PORT_ID);
 
             if (!bpidAttr)
             {
@@ -6316,7 +6369,7 @@ void Meta::meta_sai_on_fdb_flush_event_consolidated(
                 continue;
             }
 
-            if (bpidAttr->getSaiAttr()->value.oid != bpid->value.oid)
+            if (bpidAttr->value.oid != bpid->value.oid)
             {
                 // bridge port is not matching this fdb entry
                 continue;
@@ -7237,165 +7290,282 @@ bool Meta::objectExists(
     return m_saiObjectCollection.objectExists(mk);
 }
 
-void Meta::populate(
-        _In_ const swss::TableDump& dump)
+size_t Meta::populate(
+        _In_ const swss::TableDump& dump,
+        _In_ sai_object_id_t switchId,
+        _In_ size_t maxShards)
 {
     SWSS_LOG_ENTER();
 
     SWSS_LOG_TIMER("table dump populate");
 
-    // table dump contains only 1 switch the one that user wanted to connect
-    // using init=false
+    std::vector<swss::TableDump::const_iterator> keys;
 
-    for (const auto &key: dump)
+    keys.reserve(dump.size());
+
+    for (auto it = dump.begin(); it != dump.end(); it++)
     {
-        sai_object_meta_key_t mk;
-        sai_deserialize_object_meta_key(key.first, mk);
+        keys.push_back(it);
+    }
 
-        std::unordered_map<std::string, std::string> hash;
+    std::vector<PopulateEntry> entries(keys.size());
 
-        for (const auto &field: key.second)
-        {
-            hash[field.first] = field.second;
-        }
+    // deserialize keys and attributes in parallel, each worker fills its own
+    // range of entries, so no locking is needed
 
-        SaiAttributeList alist(mk.objecttype, hash, false);
+    size_t shards = maxShards ? maxShards : std::thread::hardware_concurrency();
 
-        auto attr_count = alist.get_attr_count();
-        auto attr_list = alist.get_attr_list();
+    shards = std::min<size_t>(std::max<size_t>(shards, 1), POPULATE_MAX_SHARDS);
 
-        // make references and objects from object id
+    shards = std::max<size_t>(std::min(shards, keys.size() / POPULATE_MIN_SHARD_SIZE), 1);
 
-        if (!m_saiObjectCollection.objectExists(mk))
-            m_saiObjectCollection.createObject(mk);
+    std::vector<std::exception_ptr> exceptions(shards);
+
+    std::vector<std::thread> workers;
+
+    for (size_t shard = 1; shard < shards; shard++)
+    {
+        workers.emplace_back(&Meta::populateShard, this,
+                std::cref(keys),
+                keys.size() * shard / shards,
+                keys.size() * (shard + 1) / shards,
+                std::ref(entries),
+                std::ref(exceptions[shard]));
+    }
 
-        auto info = sai_metadata_get_object_type_info(mk.objecttype);
+    populateShard(keys, 0, keys.size() / shards, entries, exceptions[0]);
 
-        if (info->isnonobjectid)
+    for (auto& worker: workers)
+    {
+        worker.join();
+    }
+
+    for (auto& exception: exceptions)
+    {
+        if (exception)
         {
-            /*
-             * Increase object reference count for all object ids in non object id
-             * members.
-             */
+            std::rethrow_exception(exception);
+        }
+    }
 
-            for (size_t j = 0; j < info->structmemberscount; ++j)
-            {
-                const sai_struct_member_info_t *m = info->structmembers[j];
+    SWSS_LOG_NOTICE("deserialized %zu objects using %zu shards", entries.size(), shards);
 
-                if (m->membervaluetype != SAI_ATTR_VALUE_TYPE_OBJECT_ID)
-                {
-                    continue;
-                }
+    // apply reference counts and object collection updates in single pass
 
-                if (!m_oids.objectReferenceExists(m->getoid(&mk)))
-                    m_oids.objectReferenceInsert(m->getoid(&mk));
+    for (auto& entry: entries)
+    {
+        const auto& mk = entry.first;
 
-                m_oids.objectReferenceIncrement(m->getoid(&mk));
-            }
+        if (switchId != SAI_NULL_OBJECT_ID && switchIdQuery(mk.objectkey.key.object_id) != switchId)
+        {
+            continue;
         }
-        else
+
+        populateObject(mk, entry.second->get_attr_count(), entry.second->get_attr_list());
+    }
+
+    return shards;
+}
+
+std::vector<sai_object_id_t> Meta::getMissingReferencedOids(
+        _In_ sai_object_id_t switchId)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<sai_object_id_t> missing;
+
+    for (auto& kvp: m_oids.getAllReferences())
+    {
+        auto oid = kvp.first;
+
+        if (oid == SAI_NULL_OBJECT_ID)
+            continue;
+
+        sai_object_meta_key_t mk = { .objecttype = objectTypeQuery(oid), .objectkey = { .key = { .object_id = oid } } };
+
+        if (mk.objecttype == SAI_OBJECT_TYPE_NULL)
+            continue;
+
+        if (switchId != SAI_NULL_OBJECT_ID && switchIdQuery(oid) != switchId)
+            continue;
+
+        if (!m_saiObjectCollection.objectExists(mk))
         {
-            if (!m_oids.objectReferenceExists(mk.objectkey.key.object_id))
-                m_oids.objectReferenceInsert(mk.objectkey.key.object_id);
+            missing.push_back(oid);
         }
+    }
+
+    return missing;
+}
 
-        bool haskeys = false;
+void Meta::populateShard(
+        _In_ const std::vector<swss::TableDump::const_iterator>& keys,
+        _In_ size_t begin,
+        _In_ size_t end,
+        _Out_ std::vector<PopulateEntry>& entries,
+        _Out_ std::exception_ptr& exception)
+{
+    SWSS_LOG_ENTER();
 
-        for (uint32_t idx = 0; idx < attr_count; ++idx)
+    try
+    {
+        std::vector<swss::FieldValueTuple> values;
+
+        for (size_t idx = begin; idx < end; idx++)
         {
-            const sai_attribute_t* attr = &attr_list[idx];
+            auto& key = *keys[idx];
 
-            auto mdp = sai_metadata_get_attr_metadata(mk.objecttype, attr->id);
+            sai_deserialize_object_meta_key(key.first, entries[idx].first);
 
-            const sai_attribute_value_t& value = attr->value;
+            values.assign(key.second.begin(), key.second.end());
 
-            const sai_attr_metadata_t& md = *mdp;
+            entries[idx].second = std::make_shared<SaiAttributeList>(entries[idx].first.objecttype, values, false);
+        }
+    }
+    catch (...)
+    {
+        exception = std::current_exception();
+    }
+}
 
-            if (SAI_HAS_FLAG_KEY(md.flags))
+void Meta::populateObject(
+        _In_ const sai_object_meta_key_t& mk,
+        _In_ uint32_t attr_count,
+        _In_ const sai_attribute_t* attr_list)
+{
+    SWSS_LOG_ENTER();
+
+    // make references and objects from object id
+
+    if (!m_saiObjectCollection.objectExists(mk))
+        m_saiObjectCollection.createObject(mk);
+
+    auto info = sai_metadata_get_object_type_info(mk.objecttype);
+
+    if (info->isnonobjectid)
+    {
+        /*
+         * Increase object reference count for all object ids in non object id
+         * members.
+         */
+
+        for (size_t j = 0; j < info->structmemberscount; ++j)
+        {
+            const sai_struct_member_info_t *m = info->structmembers[j];
+
+            if (m->membervaluetype != SAI_ATTR_VALUE_TYPE_OBJECT_ID)
             {
-                haskeys = true;
-                META_LOG_DEBUG(md, "attr is key");
+                continue;
             }
 
-            // increase reference on object id types
+            if (!m_oids.objectReferenceExists(m->getoid(&mk)))
+                m_oids.objectReferenceInsert(m->getoid(&mk));
 
-            uint32_t count = 0;
-            const sai_object_id_t *list;
+            m_oids.objectReferenceIncrement(m->getoid(&mk));
+        }
+    }
+    else
+    {
+        if (!m_oids.objectReferenceExists(mk.objectkey.key.object_id))
+            m_oids.objectReferenceInsert(mk.objectkey.key.object_id);
+    }
 
-            switch (md.attrvaluetype)
-            {
-                case SAI_ATTR_VALUE_TYPE_OBJECT_ID:
-                    count = 1;
-                    list = &value.oid;
-                    break;
+    bool haskeys = false;
 
-                case SAI_ATTR_VALUE_TYPE_OBJECT_LIST:
-                    count = value.objlist.count;
-                    list = value.objlist.list;
-                    break;
+    for (uint32_t idx = 0; idx < attr_count; ++idx)
+    {
+        const sai_attribute_t* attr = &attr_list[idx];
 
-                case SAI_ATTR_VALUE_TYPE_ACL_FIELD_DATA_OBJECT_ID:
-                    if (value.aclfield.enable)
-                    {
-                        count = 1;
-                        list = &value.aclfield.data.oid;
-                    }
-                    break;
+        auto mdp = sai_metadata_get_attr_metadata(mk.objecttype, attr->id);
 
-                case SAI_ATTR_VALUE_TYPE_ACL_FIELD_DATA_OBJECT_LIST:
-                    if (value.aclfield.enable)
-                    {
-                        count = value.aclfield.data.objlist.count;
-                        list = value.aclfield.data.objlist.list;
-                    }
-                    break;
+        const sai_attribute_value_t& value = attr->value;
 
-                case SAI_ATTR_VALUE_TYPE_ACL_ACTION_DATA_OBJECT_ID:
-                    if (value.aclaction.enable)
-                    {
-                        count = 1;
-                        list = &value.aclaction.parameter.oid;
-                    }
-                    break;
+        const sai_attr_metadata_t& md = *mdp;
 
-                case SAI_ATTR_VALUE_TYPE_ACL_ACTION_DATA_OBJECT_LIST:
-                    if (value.aclaction.enable)
-                    {
-                        count = value.aclaction.parameter.objlist.count;
-                        list = value.aclaction.parameter.objlist.list;
-                    }
-                    break;
+        if (SAI_HAS_FLAG_KEY(md.flags))
+        {
+            haskeys = true;
+            META_LOG_DEBUG(md, "attr is key");
+        }
 
-                default:
+        // increase reference on object id types
 
-                    if (md.isoidattribute)
-                    {
-                        META_LOG_THROW(md, "missing process of oid attribute, FIXME");
-                    }
-                    break;
-            }
+        uint32_t count = 0;
+        const sai_object_id_t *list;
 
-            for (uint32_t index = 0; index < count; index++)
-            {
-                if (!m_oids.objectReferenceExists(list[index]))
-                    m_oids.objectReferenceInsert(list[index]);
+        switch (md.attrvaluetype)
+        {
+            case SAI_ATTR_VALUE_TYPE_OBJECT_ID:
+                count = 1;
+                list = &value.oid;
+                break;
 
-                m_oids.objectReferenceIncrement(list[index]);
-            }
+            case SAI_ATTR_VALUE_TYPE_OBJECT_LIST:
+                count = value.objlist.count;
+                list = value.objlist.list;
+                break;
+
+            case SAI_ATTR_VALUE_TYPE_ACL_FIELD_DATA_OBJECT_ID:
+                if (value.aclfield.enable)
+                {
+                    count = 1;
+                    list = &value.aclfield.data.oid;
+                }
+                break;
+
+            case SAI_ATTR_VALUE_TYPE_ACL_FIELD_DATA_OBJECT_LIST:
+                if (value.aclfield.enable)
+                {
+                    count = value.aclfield.data.objlist.count;
+                    list = value.aclfield.data.objlist.list;
+                }
+                break;
+
+            case SAI_ATTR_VALUE_TYPE_ACL_ACTION_DATA_OBJECT_ID:
+                if (value.aclaction.enable)
+                {
+                    count = 1;
+                    list = &value.aclaction.parameter.oid;
+                }
+                break;
+
+            case SAI_ATTR_VALUE_TYPE_ACL_ACTION_DATA_OBJECT_LIST:
+                if (value.aclaction.enable)
+                {
+                    count = value.aclaction.parameter.objlist.count;
+                    list = value.aclaction.parameter.objlist.list;
+                }
+                break;
+
+            default:
 
-            m_saiObjectCollection.setObjectAttr(mk, md, attr);
+                if (md.isoidattribute)
+                {
+                    META_LOG_THROW(md, "missing process of oid attribute, FIXME");
+                }
+                break;
         }
 
-        if (haskeys)
+        for (uint32_t index = 0; index < count; index++)
         {
-            auto mKey = sai_serialize_object_meta_key(mk);
+            if (!m_oids.objectReferenceExists(list[index]))
+                m_oids.objectReferenceInsert(list[index]);
 
-            auto switchId = switchIdQuery(mk.objectkey.key.object_id);
+            m_oids.objectReferenceIncrement(list[index]);
+        }
 
-            auto attrKey = AttrKeyMap::constructKey(switchId, mk, attr_count, attr_list);
+        m_saiObjectCollection.setObjectAttr(mk, md, attr);
+    }
 
-            m_attrKeys.insert(mKey, attrKey);
-        }
+    if (haskeys)
+    {
+        auto mKey = sai_serialize_object_meta_key(mk);
+
+        auto switchId = switchIdQuery(mk.objectkey.key.object_id);
+
+        auto attrKey = AttrKeyMap::constructKey(switchId, mk, attr_count, attr_list);
+
+        m_attrKeys.insert(mKey, attrKey);
     }
 }
 
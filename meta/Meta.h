@@ -7,12 +7,14 @@
 #include "PortRelatedSet.h"
 #include "AttrKeyMap.h"
 #include "OidRefCounter.h"
+#include "SaiAttributeList.h"
 
 #include "swss/table.h"
 
 #include <vector>
 #include <memory>
 #include <set>
+#include <exception>
 
 #define DEFAULT_VLAN_NUMBER 1
 #define MINIMUM_VLAN_NUMBER 1
@@ -324,7 +326,7 @@ namespace saimeta
                     _In_ const sai_object_meta_key_t& meta_key,
                     _In_ sai_object_id_t switch_id);
 
-            std::shared_ptr<SaiAttrWrapper> get_object_previous_attr(
+            const sai_attribute_t* get_object_previous_attr(
                     _In_ const sai_object_meta_key_t& metaKey,
                     _In_ const sai_attr_metadata_t& md);
 
@@ -496,6 +498,16 @@ namespace saimeta
                     _Out_ uint64_t *counters,
                     _In_ sai_stats_mode_t mode);
 
+            sai_status_t meta_validate_bulk_stats(
+                    _In_ sai_object_type_t object_type,
+                    _In_ uint32_t object_count,
+                    _In_ const sai_object_key_t *object_key,
+                    _In_ uint32_t number_of_counters,
+                    _In_ const sai_stat_id_t *counter_ids,
+                    _In_ sai_stats_mode_t mode,
+                    _In_ const uint64_t *counters,
+                    _In_ const sai_status_t *object_statuses);
+
         private: // validate OID
 
             sai_status_t meta_sai_validate_oid(
@@ -625,8 +637,54 @@ namespace saimeta
 
             void meta_warm_boot_notify();
 
-            void populate(
-                    _In_ const swss::TableDump& dump);
+            /**
+             * @brief Populate local metadata from ASIC view dump.
+             *
+             * Keys and attributes are deserialized in parallel worker shards,
+             * then reference counts and object collection are updated in
+             * single merge pass. Can be called multiple times with chunks of
+             * ASIC view, each object must be present only in one chunk.
+             *
+             * When switch id is not null, objects which don't belong to that
+             * switch are skipped.
+             *
+             * Max shards limits number of worker shards, zero means number
+             * of hardware threads. Returns number of shards used.
+             */
+            size_t populate(
+                    _In_ const swss::TableDump& dump,
+                    _In_ sai_object_id_t switchId = SAI_NULL_OBJECT_ID,
+                    _In_ size_t maxShards = 0);
+
+            /**
+             * @brief Get object ids referenced by populated objects, which
+             * are not present in local metadata.
+             *
+             * Populate don't validate references, so when ASIC view is read
+             * by non atomic scan, object created during scan can be missing
+             * while objects referencing it are present.
+             *
+             * When switch id is not null, only object ids of that switch are
+             * returned.
+             */
+            std::vector<sai_object_id_t> getMissingReferencedOids(
+                    _In_ sai_object_id_t switchId = SAI_NULL_OBJECT_ID);
+
+        private: // populate
+
+            typedef std::pair<sai_object_meta_key_t, std::shared_ptr<SaiAttributeList>> PopulateEntry;
+
+            void populateShard(
+                    _In_ const std::vector<swss::TableDump::const_iterator>& keys,
+                    _In_ size_t begin,
+                    _In_ size_t end,
+                    _Out_ std::vector<PopulateEntry>& entries,
+                    _Out_ std::exception_ptr& exception);
+
+            void populateObject(
+                    _In_ const sai_object_meta_key_t& mk,
+                    _In_ uint32_t attr_count,
+                    _In_ const sai_attribute_t* attr_list);
 
         private:
 
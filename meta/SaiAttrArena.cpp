@@ -0,0 +1,151 @@
+#include "SaiAttrArena.h"
+
+#include "swss/logger.h"
+
+using namespace saimeta;
+
+constexpr size_t SaiAttrArena::DEFAULT_CHUNK_SIZE;
+constexpr size_t SaiAttrArena::MIN_BLOCK_SIZE;
+constexpr size_t SaiAttrArena::MAX_BLOCK_SIZE;
+constexpr size_t SaiAttrArena::SIZE_CLASSES;
+
+SaiAttrArena::SaiAttrArena(
+        _In_ size_t chunkSize):
+    m_chunkSize(chunkSize),
+    m_current(nullptr),
+    m_currentLeft(0),
+    m_usedBytes(0),
+    m_largeBytes(0)
+{
+    SWSS_LOG_ENTER();
+
+    if (chunkSize < MAX_BLOCK_SIZE)
+    {
+        SWSS_LOG_THROW("chunk size %zu is smaller than max block size %zu", chunkSize, MAX_BLOCK_SIZE);
+    }
+
+    for (size_t idx = 0; idx < SIZE_CLASSES; idx++)
+    {
+        m_freeLists[idx] = nullptr;
+    }
+}
+
+SaiAttrArena::~SaiAttrArena()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_usedBytes)
+    {
+        SWSS_LOG_WARN("arena destroyed with %zu bytes still in use", m_usedBytes);
+    }
+}
+
+size_t SaiAttrArena::getSizeClass(
+        _In_ size_t size)
+{
+    SWSS_LOG_ENTER();
+
+    size_t idx = 0;
+
+    for (size_t blockSize = MIN_BLOCK_SIZE; blockSize < size; blockSize <<= 1)
+    {
+        idx++;
+    }
+
+    return idx;
+}
+
+void* SaiAttrArena::allocate(
+        _In_ size_t size)
+{
+    SWSS_LOG_ENTER();
+
+    if (size == 0)
+    {
+        return nullptr;
+    }
+
+    if (size > MAX_BLOCK_SIZE)
+    {
+        m_largeBytes += size;
+
+        return ::operator new(size);
+    }
+
+    size_t idx = getSizeClass(size);
+
+    size_t blockSize = MIN_BLOCK_SIZE << idx;
+
+    m_usedBytes += blockSize;
+
+    if (m_freeLists[idx])
+    {
+        FreeBlock* block = m_freeLists[idx];
+
+        m_freeLists[idx] = block->m_next;
+
+        return block;
+    }
+
+    if (m_currentLeft < blockSize)
+    {
+        // rest of current chunk is lost, it's smaller than max block size
+
+        m_chunks.emplace_back(new uint8_t[m_chunkSize]);
+
+        m_current = m_chunks.back().get();
+        m_currentLeft = m_chunkSize;
+    }
+
+    void* ptr = m_current;
+
+    m_current += blockSize;
+    m_currentLeft -= blockSize;
+
+    return ptr;
+}
+
+void SaiAttrArena::deallocate(
+        _In_ void* ptr,
+        _In_ size_t size)
+{
+    SWSS_LOG_ENTER();
+
+    if (ptr == nullptr || size == 0)
+    {
+        return;
+    }
+
+    if (size > MAX_BLOCK_SIZE)
+    {
+        m_largeBytes -= size;
+
+        ::operator delete(ptr);
+
+        return;
+    }
+
+    size_t idx = getSizeClass(size);
+
+    m_usedBytes -= (MIN_BLOCK_SIZE << idx);
+
+    FreeBlock* block = static_cast<FreeBlock*>(ptr);
+
+    block->m_next = m_freeLists[idx];
+
+    m_freeLists[idx] = block;
+}
+
+size_t SaiAttrArena::getUsedBytes() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_usedBytes + m_largeBytes;
+}
+
+size_t SaiAttrArena::getReservedBytes() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_chunks.size() * m_chunkSize + m_largeBytes;
+}
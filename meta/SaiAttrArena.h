@@ -0,0 +1,103 @@
+#pragma once
+
+#include "swss/sal.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace saimeta
+{
+    /**
+     * @brief Attribute list arena.
+     *
+     * Holds list values (object lists, vlan lists, etc.) of attributes of
+     * single object type. Memory is carved from large chunks and released
+     * blocks are kept on free lists per size class, so setting and removing
+     * list attributes don't call malloc for each list, and there is no
+     * allocator header per list.
+     *
+     * Arena is not thread safe, same as SaiObjectCollection which owns it.
+     */
+    class SaiAttrArena
+    {
+        public:
+
+            SaiAttrArena(
+                    _In_ size_t chunkSize = DEFAULT_CHUNK_SIZE);
+
+            virtual ~SaiAttrArena();
+
+        private:
+
+            SaiAttrArena(const SaiAttrArena&) = delete;
+            SaiAttrArena& operator=(const SaiAttrArena&) = delete;
+
+        public:
+
+            /**
+             * @brief Allocate memory for list of given size in bytes.
+             *
+             * Returns nullptr when size is zero.
+             */
+            void* allocate(
+                    _In_ size_t size);
+
+            /**
+             * @brief Release memory, size must be the same as passed to allocate.
+             */
+            void deallocate(
+                    _In_ void* ptr,
+                    _In_ size_t size);
+
+            /**
+             * @brief Bytes currently allocated by arena users, rounded to size class.
+             */
+            size_t getUsedBytes() const;
+
+            /**
+             * @brief Bytes reserved by arena chunks and large blocks.
+             */
+            size_t getReservedBytes() const;
+
+        public:
+
+            static constexpr size_t DEFAULT_CHUNK_SIZE = 64 * 1024;
+
+            static constexpr size_t MIN_BLOCK_SIZE = 16;
+
+            /**
+             * @brief Blocks larger than this are allocated directly.
+             */
+            static constexpr size_t MAX_BLOCK_SIZE = 4096;
+
+        private:
+
+            static size_t getSizeClass(
+                    _In_ size_t size);
+
+        private:
+
+            struct FreeBlock
+            {
+                FreeBlock* m_next;
+            };
+
+            static constexpr size_t SIZE_CLASSES = 9; // 16 .. 4096
+
+            size_t m_chunkSize;
+
+            std::vector<std::unique_ptr<uint8_t[]>> m_chunks;
+
+            uint8_t* m_current;
+
+            size_t m_currentLeft;
+
+            FreeBlock* m_freeLists[SIZE_CLASSES];
+
+            size_t m_usedBytes;
+
+            size_t m_largeBytes;
+    };
+}
@@ -21,6 +21,13 @@ SaiAttrWrapper::SaiAttrWrapper(
 
     m_attr.id = attr.id;
 
+    if (meta->isprimitive)
+    {
+        // primitive value don't contain any pointers, copy is enough
+
+        return;
+    }
+
     /*
      * We are making serialize and deserialize to get copy of attribute, it may
      * be a list so we need to allocate new memory.
@@ -44,6 +51,11 @@ SaiAttrWrapper::~SaiAttrWrapper()
      * memory on attribute value.
      */
 
+    if (m_meta->isprimitive)
+    {
+        return;
+    }
+
     sai_deserialize_free_attribute_value(m_meta->attrvaluetype, m_attr);
 }
 
@@ -4,11 +4,149 @@
 
 #include "sai_serialize.h"
 
+#include <algorithm>
+
+#include <string.h>
+
 using namespace saimeta;
 
+/**
+ * @brief Call function on each list of flat list attribute value.
+ *
+ * Flat lists hold elements without any further pointers, so they can be
+ * copied with memcpy. Returns false if value type is not a flat list.
+ */
+template <typename F>
+static bool for_each_flat_list(
+        _In_ sai_attr_value_type_t type,
+        _Inout_ sai_attribute_value_t& value,
+        _In_ F fun)
+{
+    SWSS_LOG_ENTER();
+
+    switch (type)
+    {
+        case SAI_ATTR_VALUE_TYPE_OBJECT_LIST:
+            fun(value.objlist);
+            return true;
+
+        case SAI_ATTR_VALUE_TYPE_UINT8_LIST:
+            fun(value.u8list);
+            return true;
+
+        case SAI_ATTR_VALUE_TYPE_INT8_LIST:
+            fun(value.s8list);
+            return true;
+
+        case SAI_ATTR_VALUE_TYPE_UINT32_LIST:
+            fun(value.u32list);
+            return true;
+
+        case SAI_ATTR_VALUE_TYPE_INT32_LIST:
+            fun(value.s32list);
+            return true;
+
+        case SAI_ATTR_VALUE_TYPE_UINT16_RANGE_LIST:
+            fun(value.u16rangelist);
+            return true;
+
+        case SAI_ATTR_VALUE_TYPE_VLAN_LIST:
+            fun(value.vlanlist);
+            return true;
+
+        case SAI_ATTR_VALUE_TYPE_QOS_MAP_LIST:
+            fun(value.qosmap);
+            return true;
+
+        case SAI_ATTR_VALUE_TYPE_MAP_LIST:
+            fun(value.maplist);
+            return true;
+
+        case SAI_ATTR_VALUE_TYPE_ACL_RESOURCE_LIST:
+            fun(value.aclresource);
+            return true;
+
+        case SAI_ATTR_VALUE_TYPE_IP_ADDRESS_LIST:
+            fun(value.ipaddrlist);
+            return true;
+
+        case SAI_ATTR_VALUE_TYPE_IP_PREFIX_LIST:
+            fun(value.ipprefixlist);
+            return true;
+
+        case SAI_ATTR_VALUE_TYPE_SEGMENT_LIST:
+            fun(value.segmentlist);
+            return true;
+
+        case SAI_ATTR_VALUE_TYPE_PORT_LANE_LATCH_STATUS_LIST:
+            fun(value.portlanelatchstatuslist);
+            return true;
+
+        case SAI_ATTR_VALUE_TYPE_SYSTEM_PORT_CONFIG_LIST:
+            fun(value.sysportconfiglist);
+            return true;
+
+        case SAI_ATTR_VALUE_TYPE_ACL_FIELD_DATA_OBJECT_LIST:
+            fun(value.aclfield.data.objlist);
+            return true;
+
+        case SAI_ATTR_VALUE_TYPE_ACL_FIELD_DATA_UINT8_LIST:
+            fun(value.aclfield.mask.u8list);
+            fun(value.aclfield.data.u8list);
+            return true;
+
+        case SAI_ATTR_VALUE_TYPE_ACL_ACTION_DATA_OBJECT_LIST:
+            fun(value.aclaction.parameter.objlist);
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+template <typename T>
+static void arena_copy_list(
+        _In_ SaiAttrArena& arena,
+        _Inout_ T& list)
+{
+    SWSS_LOG_ENTER();
+
+    if (list.list == nullptr)
+    {
+        // count only value
+
+        return;
+    }
+
+    size_t size = list.count * sizeof(*list.list);
+
+    auto dst = static_cast<decltype(list.list)>(arena.allocate(size));
+
+    if (size)
+    {
+        memcpy(dst, list.list, size);
+    }
+
+    list.list = dst;
+}
+
+template <typename T>
+static void arena_release_list(
+        _In_ SaiAttrArena& arena,
+        _Inout_ T& list)
+{
+    SWSS_LOG_ENTER();
+
+    arena.deallocate(list.list, list.count * sizeof(*list.list));
+
+    list.list = nullptr;
+}
+
 SaiObject::SaiObject(
-        _In_ const sai_object_meta_key_t& metaKey):
-    m_metaKey(metaKey)
+        _In_ const sai_object_meta_key_t& metaKey,
+        _In_ std::shared_ptr<SaiAttrArena> arena):
+    m_metaKey(metaKey),
+    m_arena(arena)
 {
     SWSS_LOG_ENTER();
 
@@ -18,6 +156,92 @@ SaiObject::SaiObject(
     }
 }
 
+SaiObject::~SaiObject()
+{
+    SWSS_LOG_ENTER();
+
+    for (auto& slot: m_attrs)
+    {
+        releaseSlot(slot);
+    }
+}
+
+void SaiObject::copyValue(
+        _In_ const sai_attr_metadata_t* md,
+        _Inout_ sai_attribute_t& attr)
+{
+    SWSS_LOG_ENTER();
+
+    if (md->isprimitive)
+    {
+        return;
+    }
+
+    bool flat = for_each_flat_list(md->attrvaluetype, attr.value, [this](auto& list) {
+
+        if (!m_arena)
+        {
+            m_arena = std::make_shared<SaiAttrArena>();
+        }
+
+        arena_copy_list(*m_arena, list);
+    });
+
+    if (flat)
+    {
+        return;
+    }
+
+    /*
+     * Value contains pointers to nested data, so we need to allocate new
+     * memory, same as SaiAttrWrapper does.
+     */
+
+    std::string str = sai_serialize_attr_value(*md, attr, false);
+
+    sai_deserialize_attr_value(str, *md, attr, false);
+}
+
+void SaiObject::releaseSlot(
+        _Inout_ AttrSlot& slot)
+{
+    SWSS_LOG_ENTER();
+
+    if (slot.m_meta->isprimitive)
+    {
+        return;
+    }
+
+    bool flat = for_each_flat_list(slot.m_meta->attrvaluetype, slot.m_attr.value, [this](auto& list) {
+
+        if (list.list)
+        {
+            arena_release_list(*m_arena, list);
+        }
+    });
+
+    if (flat)
+    {
+        return;
+    }
+
+    sai_deserialize_free_attribute_value(slot.m_meta->attrvaluetype, slot.m_attr);
+}
+
+std::vector<SaiObject::AttrSlot>::const_iterator SaiObject::findSlot(
+        _In_ sai_attr_id_t id) const
+{
+    SWSS_LOG_ENTER();
+
+    auto it = std::lower_bound(m_attrs.begin(), m_attrs.end(), id,
+            [](const AttrSlot& slot, sai_attr_id_t attrId) { return slot.m_attr.id < attrId; });
+
+    if (it != m_attrs.end() && it->m_attr.id == id)
+        return it;
+
+    return m_attrs.end();
+}
+
 sai_object_type_t SaiObject::getObjectType() const
 {
     SWSS_LOG_ENTER();
@@ -30,7 +254,7 @@ bool SaiObject::hasAttr(
 {
     SWSS_LOG_ENTER();
 
-    return m_attrs.find(id) != m_attrs.end();
+    return findSlot(id) != m_attrs.end();
 }
 
 const sai_object_meta_key_t& SaiObject::getMetaKey() const
@@ -46,7 +270,31 @@ void SaiObject::setAttr(
 {
     SWSS_LOG_ENTER();
 
-    m_attrs[attr->id] = std::make_shared<SaiAttrWrapper>(md, *attr);
+    if (!md)
+    {
+        SWSS_LOG_THROW("metadata can't be null");
+    }
+
+    sai_attribute_t copy = *attr;
+
+    // copy is made before release, so attr can point to this object
+
+    copyValue(md, copy);
+
+    auto it = std::lower_bound(m_attrs.begin(), m_attrs.end(), attr->id,
+            [](const AttrSlot& slot, sai_attr_id_t attrId) { return slot.m_attr.id < attrId; });
+
+    if (it != m_attrs.end() && it->m_attr.id == attr->id)
+    {
+        releaseSlot(*it);
+
+        it->m_meta = md;
+        it->m_attr = copy;
+
+        return;
+    }
+
+    m_attrs.insert(it, AttrSlot{md, copy});
 }
 
 void SaiObject::setAttr(
@@ -54,7 +302,43 @@ void SaiObject::setAttr(
 {
     SWSS_LOG_ENTER();
 
-    m_attrs[attr->getAttrId()] = attr;
+    setAttr(attr->getSaiAttrMetadata(), attr->getSaiAttr());
+}
+
+const sai_attribute_t* SaiObject::getSaiAttr(
+        _In_ sai_attr_id_t id) const
+{
+    SWSS_LOG_ENTER();
+
+    auto it = findSlot(id);
+
+    if (it != m_attrs.end())
+        return &it->m_attr;
+
+    return nullptr;
+}
+
+size_t SaiObject::getAttrCount() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_attrs.size();
+}
+
+const sai_attribute_t* SaiObject::getSaiAttrAt(
+        _In_ size_t index) const
+{
+    SWSS_LOG_ENTER();
+
+    return &m_attrs.at(index).m_attr;
+}
+
+const sai_attr_metadata_t* SaiObject::getSaiAttrMetadataAt(
+        _In_ size_t index) const
+{
+    SWSS_LOG_ENTER();
+
+    return m_attrs.at(index).m_meta;
 }
 
 std::shared_ptr<SaiAttrWrapper> SaiObject::getAttr(
@@ -62,10 +346,10 @@ std::shared_ptr<SaiAttrWrapper> SaiObject::getAttr(
 {
     SWSS_LOG_ENTER();
 
-    auto it = m_attrs.find(id);
+    auto it = findSlot(id);
 
     if (it != m_attrs.end())
-        return it->second;
+        return std::make_shared<SaiAttrWrapper>(it->m_meta, it->m_attr);
 
     return nullptr;
 }
@@ -76,8 +360,10 @@ std::vector<std::shared_ptr<SaiAttrWrapper>> SaiObject::getAttributes() const
 
     std::vector<std::shared_ptr<SaiAttrWrapper>> values;
 
-    for (auto&kvp: m_attrs)
-        values.push_back(kvp.second);
+    values.reserve(m_attrs.size());
+
+    for (auto& slot: m_attrs)
+        values.push_back(std::make_shared<SaiAttrWrapper>(slot.m_meta, slot.m_attr));
 
     return values;
 }
@@ -1,9 +1,9 @@
 #pragma once
 
 #include "SaiAttrWrapper.h"
+#include "SaiAttrArena.h"
 
 #include <memory>
-#include <unordered_map>
 #include <vector>
 
 namespace saimeta
@@ -12,10 +12,19 @@ namespace saimeta
     {
         public:
 
+            /**
+             * @brief Create object.
+             *
+             * List attribute values are kept in given arena, which is
+             * usually shared by all objects of the same object type. When
+             * arena is not provided, object will create own on first list
+             * attribute.
+             */
             SaiObject(
-                    _In_ const sai_object_meta_key_t& metaKey);
+                    _In_ const sai_object_meta_key_t& metaKey,
+                    _In_ std::shared_ptr<SaiAttrArena> arena = nullptr);
 
-            virtual ~SaiObject() = default;
+            virtual ~SaiObject();
 
         private:
 
@@ -38,15 +47,74 @@ namespace saimeta
             void setAttr(
                     _In_ std::shared_ptr<SaiAttrWrapper> attr);
 
+            /**
+             * @brief Get attribute view, returns nullptr if attribute is not present.
+             *
+             * Returned attribute is not a copy, it points to object memory
+             * and it's valid until next setAttr on this object.
+             */
+            const sai_attribute_t* getSaiAttr(
+                    _In_ sai_attr_id_t id) const;
+
+            size_t getAttrCount() const;
+
+            /**
+             * @brief Get attribute view by index, attributes are sorted by id.
+             */
+            const sai_attribute_t* getSaiAttrAt(
+                    _In_ size_t index) const;
+
+            const sai_attr_metadata_t* getSaiAttrMetadataAt(
+                    _In_ size_t index) const;
+
+            /**
+             * @brief Get attribute copy, returns nullptr if attribute is not present.
+             *
+             * Copy stays valid when object attribute is changed, but it
+             * requires allocation, use getSaiAttr when possible.
+             */
             std::shared_ptr<SaiAttrWrapper> getAttr(
                     _In_ sai_attr_id_t id) const;
 
             std::vector<std::shared_ptr<SaiAttrWrapper>> getAttributes() const;
 
+        private:
+
+            /**
+             * @brief Attribute value stored inline. List values of known flat
+             * list types live in arena, other non primitive values own
+             * memory allocated by deserialize.
+             */
+            struct AttrSlot
+            {
+                const sai_attr_metadata_t* m_meta;
+
+                sai_attribute_t m_attr;
+            };
+
+            std::vector<AttrSlot>::const_iterator findSlot(
+                    _In_ sai_attr_id_t id) const;
+
+            void copyValue(
+                    _In_ const sai_attr_metadata_t* md,
+                    _Inout_ sai_attribute_t& attr);
+
+            void releaseSlot(
+                    _Inout_ AttrSlot& slot);
+
         private:
 
             sai_object_meta_key_t m_metaKey;
 
-            std::unordered_map<sai_attr_id_t, std::shared_ptr<SaiAttrWrapper>> m_attrs;
+            std::shared_ptr<SaiAttrArena> m_arena;
+
+            /**
+             * @brief Attributes sorted by attribute id.
+             *
+             * Objects have usually only few attributes, so sorted vector
+             * without per attribute allocation is more compact and faster
+             * than hash map of shared wrappers.
+             */
+            std::vector<AttrSlot> m_attrs;
     };
 }
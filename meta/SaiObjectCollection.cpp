@@ -9,6 +9,10 @@ void SaiObjectCollection::clear()
     SWSS_LOG_ENTER();
 
     m_objects.clear();
+
+    // arenas are kept alive by objects still referenced outside collection
+
+    m_arenas.clear();
 }
 
 bool SaiObjectCollection::objectExists(
@@ -26,14 +30,21 @@ void SaiObjectCollection::createObject(
 {
     SWSS_LOG_ENTER();
 
-    auto obj = std::make_shared<SaiObject>(metaKey);
-
     if (objectExists(metaKey))
     {
         SWSS_LOG_THROW("FATAL: object %s already exists",
                 sai_serialize_object_meta_key(metaKey).c_str());
     }
 
+    auto& arena = m_arenas[metaKey.objecttype];
+
+    if (!arena)
+    {
+        arena = std::make_shared<SaiAttrArena>();
+    }
+
+    auto obj = std::make_shared<SaiObject>(metaKey, arena);
+
     m_objects[metaKey] = obj;
 }
 
@@ -67,9 +78,8 @@ void SaiObjectCollection::setObjectAttr(
     m_objects[metaKey]->setAttr(&md, attr);
 }
 
-std::shared_ptr<SaiAttrWrapper> SaiObjectCollection::getObjectAttr(
-        _In_ const sai_object_meta_key_t& metaKey,
-        _In_ sai_attr_id_t id)
+const SaiObject* SaiObjectCollection::findObject(
+        _In_ const sai_object_meta_key_t& metaKey) const
 {
     SWSS_LOG_ENTER();
 
@@ -89,7 +99,48 @@ std::shared_ptr<SaiAttrWrapper> SaiObjectCollection::getObjectAttr(
         return nullptr;
     }
 
-    return it->second->getAttr(id);
+    return it->second.get();
+}
+
+std::shared_ptr<SaiAttrWrapper> SaiObjectCollection::getObjectAttr(
+        _In_ const sai_object_meta_key_t& metaKey,
+        _In_ sai_attr_id_t id)
+{
+    SWSS_LOG_ENTER();
+
+    auto obj = findObject(metaKey);
+
+    return obj ? obj->getAttr(id) : nullptr;
+}
+
+bool SaiObjectCollection::hasObjectAttr(
+        _In_ const sai_object_meta_key_t& metaKey,
+        _In_ sai_attr_id_t id) const
+{
+    SWSS_LOG_ENTER();
+
+    auto obj = findObject(metaKey);
+
+    return obj && obj->hasAttr(id);
+}
+
+const sai_attribute_t* SaiObjectCollection::getObjectSaiAttr(
+        _In_ const sai_object_meta_key_t& metaKey,
+        _In_ sai_attr_id_t id) const
+{
+    SWSS_LOG_ENTER();
+
+    auto obj = findObject(metaKey);
+
+    return obj ? obj->getSaiAttr(id) : nullptr;
+}
+
+std::vector<std::shared_ptr<SaiAttrWrapper>> SaiObjectCollection::getObjectAttributes(
+        _In_ const sai_object_meta_key_t& metaKey) const
+{
+    SWSS_LOG_ENTER();
+
+    return getObject(metaKey)->getAttributes();
 }
 
 std::vector<std::shared_ptr<SaiObject>> SaiObjectCollection::getObjectsByObjectType(
@@ -5,6 +5,7 @@
 #include "MetaKeyHasher.h"
 
 #include <string>
+#include <map>
 #include <unordered_map>
 #include <memory>
 #include <vector>
@@ -45,6 +46,20 @@ namespace saimeta
                     _In_ const sai_object_meta_key_t& metaKey,
                     _In_ sai_attr_id_t id);
 
+            bool hasObjectAttr(
+                    _In_ const sai_object_meta_key_t& metaKey,
+                    _In_ sai_attr_id_t id) const;
+
+            /**
+             * @brief Get object attribute view without making copy.
+             *
+             * Returns nullptr if object or attribute don't exist. Returned
+             * attribute is valid until object attribute is modified.
+             */
+            const sai_attribute_t* getObjectSaiAttr(
+                    _In_ const sai_object_meta_key_t& metaKey,
+                    _In_ sai_attr_id_t id) const;
+
             std::vector<std::shared_ptr<SaiAttrWrapper>> getObjectAttributes(
                     _In_ const sai_object_meta_key_t& metaKey) const;
 
@@ -56,9 +71,19 @@ namespace saimeta
 
             std::vector<sai_object_meta_key_t> getAllKeys() const;
 
+        private:
+
+            const SaiObject* findObject(
+                    _In_ const sai_object_meta_key_t& metaKey) const;
+
         private:
 
             std::unordered_map<sai_object_meta_key_t, std::shared_ptr<SaiObject>, MetaKeyHasher, MetaKeyHasher> m_objects;
 
+            /**
+             * @brief List attribute arenas per object type.
+             */
+            std::map<sai_object_type_t, std::shared_ptr<SaiAttrArena>> m_arenas;
+
     };
 }
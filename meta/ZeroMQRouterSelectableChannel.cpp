@@ -0,0 +1,363 @@
+#include "ZeroMQRouterSelectableChannel.h"
+
+#include "swss/logger.h"
+#include "swss/json.h"
+
+#include <zmq.h>
+#include <unistd.h>
+#include <sys/eventfd.h>
+
+#include <cstring>
+
+#define ZMQ_POLL_TIMEOUT (1000)
+
+using namespace sairedis;
+
+ZeroMQRouterSelectableChannel::ZeroMQRouterSelectableChannel(
+        _In_ const std::string& endpoint):
+    m_endpoint(endpoint),
+    m_context(nullptr),
+    m_socket(nullptr),
+    m_sendEventFd(-1),
+    m_runThread(true)
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_NOTICE("binding router on %s", endpoint.c_str());
+
+    m_context = zmq_ctx_new();
+
+    m_socket = zmq_socket(m_context, ZMQ_ROUTER);
+
+    int rc = zmq_bind(m_socket, endpoint.c_str());
+
+    if (rc != 0)
+    {
+        zmq_close(m_socket);
+        zmq_ctx_destroy(m_context);
+
+        SWSS_LOG_THROW("zmq_bind failed on endpoint: %s, zmqerrno: %d",
+                endpoint.c_str(),
+                zmq_errno());
+    }
+
+    m_sendEventFd = eventfd(0, EFD_NONBLOCK);
+
+    if (m_sendEventFd < 0)
+    {
+        zmq_close(m_socket);
+        zmq_ctx_destroy(m_context);
+
+        SWSS_LOG_THROW("eventfd failed: %s", strerror(errno));
+    }
+
+    m_zmqPollThread = std::make_shared<std::thread>(&ZeroMQRouterSelectableChannel::zmqPollThread, this);
+}
+
+ZeroMQRouterSelectableChannel::~ZeroMQRouterSelectableChannel()
+{
+    SWSS_LOG_ENTER();
+
+    m_runThread = false;
+
+    uint64_t value = 1;
+
+    if (write(m_sendEventFd, &value, sizeof(value)) != sizeof(value))
+    {
+        SWSS_LOG_ERROR("failed to wake up zmq poll thread: %s", strerror(errno));
+    }
+
+    SWSS_LOG_NOTICE("ending zmq poll thread for channel %s", m_endpoint.c_str());
+
+    m_zmqPollThread->join();
+
+    SWSS_LOG_NOTICE("ended zmq poll thread for channel %s", m_endpoint.c_str());
+
+    close(m_sendEventFd);
+
+    zmq_close(m_socket);
+    zmq_ctx_destroy(m_context);
+}
+
+void ZeroMQRouterSelectableChannel::zmqPollThread()
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_NOTICE("begin");
+
+    while (m_runThread)
+    {
+        zmq_pollitem_t items [2] = { };
+
+        items[0].socket = m_socket;
+        items[0].events = ZMQ_POLLIN;
+
+        items[1].fd = m_sendEventFd;
+        items[1].events = ZMQ_POLLIN;
+
+        int rc = zmq_poll(items, 2, ZMQ_POLL_TIMEOUT);
+
+        if (m_runThread == false)
+        {
+            SWSS_LOG_NOTICE("ending poll thread, since run is false");
+            break;
+        }
+
+        if (rc < 0)
+        {
+            if (zmq_errno() == EINTR)
+                continue;
+
+            SWSS_LOG_ERROR("zmq_poll failed, zmqerrno: %d", zmq_errno());
+            break;
+        }
+
+        if (items[1].revents & ZMQ_POLLIN)
+        {
+            uint64_t value;
+
+            if (read(m_sendEventFd, &value, sizeof(value)) < 0 && errno != EAGAIN)
+            {
+                SWSS_LOG_ERROR("failed to read send event: %s", strerror(errno));
+            }
+        }
+
+        // always flush responses, they could be queued while we were polling
+
+        sendMessages();
+
+        if (items[0].revents & ZMQ_POLLIN)
+        {
+            receiveMessages();
+        }
+    }
+
+    SWSS_LOG_NOTICE("end");
+}
+
+void ZeroMQRouterSelectableChannel::receiveMessages()
+{
+    SWSS_LOG_ENTER();
+
+    bool received = false;
+
+    while (true)
+    {
+        // message format: [identity][empty delimiter][payload]
+
+        std::vector<std::string> frames;
+
+        int more = 1;
+
+        while (more)
+        {
+            zmq_msg_t msg;
+
+            zmq_msg_init(&msg);
+
+            int rc = zmq_msg_recv(&msg, m_socket, frames.empty() ? ZMQ_DONTWAIT : 0);
+
+            if (rc < 0)
+            {
+                zmq_msg_close(&msg);
+
+                if (frames.empty() && (zmq_errno() == EAGAIN || zmq_errno() == EINTR))
+                {
+                    if (received)
+                    {
+                        m_selectableEvent.notify(); // will release epoll
+                    }
+
+                    return;
+                }
+
+                SWSS_LOG_ERROR("zmq_msg_recv failed, zmqerrno: %d", zmq_errno());
+                return;
+            }
+
+            frames.emplace_back((const char*)zmq_msg_data(&msg), zmq_msg_size(&msg));
+
+            more = zmq_msg_more(&msg);
+
+            zmq_msg_close(&msg);
+        }
+
+        if (frames.size() < 2)
+        {
+            SWSS_LOG_ERROR("expected at least 2 frames, got %zu, message DROPPED", frames.size());
+            continue;
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_queue.emplace_back(frames.front(), frames.back());
+
+        received = true;
+    }
+}
+
+void ZeroMQRouterSelectableChannel::sendMessages()
+{
+    SWSS_LOG_ENTER();
+
+    std::deque<Message> messages;
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        messages.swap(m_sendQueue);
+    }
+
+    for (auto& msg: messages)
+    {
+        const std::string& identity = msg.first;
+        const std::string& payload = msg.second;
+
+        if (zmq_send(m_socket, identity.c_str(), identity.length(), ZMQ_SNDMORE) < 0 ||
+                zmq_send(m_socket, "", 0, ZMQ_SNDMORE) < 0 ||
+                zmq_send(m_socket, payload.c_str(), payload.length(), 0) < 0)
+        {
+            SWSS_LOG_ERROR("zmq_send failed, on endpoint %s, zmqerrno: %d: %s",
+                    m_endpoint.c_str(),
+                    zmq_errno(),
+                    zmq_strerror(zmq_errno()));
+        }
+    }
+}
+
+void ZeroMQRouterSelectableChannel::pop(
+        _Out_ swss::KeyOpFieldsValuesTuple& kco,
+        _Out_ std::string& identity)
+{
+    SWSS_LOG_ENTER();
+
+    std::string msg;
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (m_queue.empty())
+        {
+            SWSS_LOG_THROW("queue is empty, can't pop");
+        }
+
+        identity = std::move(m_queue.front().first);
+        msg = std::move(m_queue.front().second);
+
+        m_queue.pop_front();
+    }
+
+    auto& values = kfvFieldsValues(kco);
+
+    values.clear();
+
+    swss::JSon::readJson(msg, values);
+
+    swss::FieldValueTuple fvt = values.at(0);
+
+    kfvKey(kco) = fvField(fvt);
+    kfvOp(kco) = fvValue(fvt);
+
+    values.erase(values.begin());
+}
+
+void ZeroMQRouterSelectableChannel::send(
+        _In_ const std::string& identity,
+        _In_ const std::string& key,
+        _In_ const std::vector<swss::FieldValueTuple>& values,
+        _In_ const std::string& op)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<swss::FieldValueTuple> copy = values;
+
+    swss::FieldValueTuple opdata(key, op);
+
+    copy.insert(copy.begin(), opdata);
+
+    std::string msg = swss::JSon::buildJson(copy);
+
+    SWSS_LOG_DEBUG("sending: %s", msg.c_str());
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_sendQueue.emplace_back(identity, std::move(msg));
+    }
+
+    uint64_t value = 1;
+
+    if (write(m_sendEventFd, &value, sizeof(value)) != sizeof(value))
+    {
+        SWSS_LOG_THROW("failed to signal send event: %s", strerror(errno));
+    }
+}
+
+// SelectableChannel overrides
+
+bool ZeroMQRouterSelectableChannel::empty()
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_queue.empty();
+}
+
+void ZeroMQRouterSelectableChannel::pop(
+        _Out_ swss::KeyOpFieldsValuesTuple& kco,
+        _In_ bool initViewMode)
+{
+    SWSS_LOG_ENTER();
+
+    pop(kco, m_lastIdentity);
+}
+
+void ZeroMQRouterSelectableChannel::set(
+        _In_ const std::string& key,
+        _In_ const std::vector<swss::FieldValueTuple>& values,
+        _In_ const std::string& op)
+{
+    SWSS_LOG_ENTER();
+
+    send(m_lastIdentity, key, values, op);
+}
+
+// Selectable overrides
+
+int ZeroMQRouterSelectableChannel::getFd()
+{
+    SWSS_LOG_ENTER();
+
+    return m_selectableEvent.getFd();
+}
+
+uint64_t ZeroMQRouterSelectableChannel::readData()
+{
+    SWSS_LOG_ENTER();
+
+    // clear selectable event so it could be triggered in next select(),
+    // messages are already queued by poll thread
+
+    m_selectableEvent.readData();
+
+    return 0;
+}
+
+bool ZeroMQRouterSelectableChannel::hasData()
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_queue.size() > 0;
+}
+
+bool ZeroMQRouterSelectableChannel::hasCachedData()
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_queue.size() > 1;
+}
@@ -0,0 +1,112 @@
+#pragma once
+
+#include "SelectableChannel.h"
+
+#include "swss/table.h"
+#include "swss/selectableevent.h"
+
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <memory>
+
+namespace sairedis
+{
+    /**
+     * @brief ZeroMQ ROUTER based selectable channel.
+     *
+     * Unlike ZeroMQSelectableChannel (REP socket) this channel can have
+     * multiple outstanding requests from multiple clients (REQ or DEALER
+     * sockets). Each received request carries client identity, and response
+     * must be sent back using that identity. Socket itself is only accessed
+     * from internal poll thread, so send() can be called from any thread.
+     */
+    class ZeroMQRouterSelectableChannel:
+        public SelectableChannel
+    {
+        public:
+
+            ZeroMQRouterSelectableChannel(
+                    _In_ const std::string& endpoint);
+
+            virtual ~ZeroMQRouterSelectableChannel();
+
+        public:
+
+            /**
+             * @brief Pop request together with client identity.
+             */
+            void pop(
+                    _Out_ swss::KeyOpFieldsValuesTuple& kco,
+                    _Out_ std::string& identity);
+
+            /**
+             * @brief Send response to specific client, thread safe.
+             */
+            void send(
+                    _In_ const std::string& identity,
+                    _In_ const std::string& key,
+                    _In_ const std::vector<swss::FieldValueTuple>& values,
+                    _In_ const std::string& op);
+
+        public: // SelectableChannel overrides
+
+            virtual bool empty() override;
+
+            virtual void pop(
+                    _Out_ swss::KeyOpFieldsValuesTuple& kco,
+                    _In_ bool initViewMode) override;
+
+            /**
+             * @brief Send response to client of last popped request.
+             */
+            virtual void set(
+                    _In_ const std::string& key,
+                    _In_ const std::vector<swss::FieldValueTuple>& values,
+                    _In_ const std::string& op) override;
+
+        public: // Selectable overrides
+
+            virtual int getFd() override;
+
+            virtual uint64_t readData() override;
+
+            virtual bool hasData() override;
+
+            virtual bool hasCachedData() override;
+
+        private:
+
+            void zmqPollThread();
+
+            void receiveMessages();
+
+            void sendMessages();
+
+        private:
+
+            typedef std::pair<std::string, std::string> Message; // identity, payload
+
+            std::string m_endpoint;
+
+            void* m_context;
+
+            void* m_socket;
+
+            int m_sendEventFd;
+
+            std::mutex m_mutex;
+
+            std::deque<Message> m_queue;
+
+            std::deque<Message> m_sendQueue;
+
+            std::string m_lastIdentity;
+
+            volatile bool m_runThread;
+
+            std::shared_ptr<std::thread> m_zmqPollThread;
+
+            swss::SelectableEvent m_selectableEvent;
+    };
+}
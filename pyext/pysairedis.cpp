@@ -5,6 +5,10 @@
 
 #include "meta/sai_serialize.h"
 
+#include <string.h>
+
+#include <vector>
+
 static std::map<std::string, std::string> g_profileMap;
 static std::map<std::string, std::string>::iterator g_profileMapIterator = g_profileMap.begin();
 
@@ -337,3 +341,650 @@ sai_pointer_t sai_get_notification_pointer(
 
     SWSS_LOG_THROW("notification attr id %d not supported", id);
 }
+
+// bulk helpers
+
+static bool py_get_string(
+        _In_ PyObject* obj,
+        _Out_ std::string& value)
+{
+    SWSS_LOG_ENTER();
+
+#if PY_MAJOR_VERSION >= 3
+    if (PyUnicode_Check(obj))
+    {
+        Py_ssize_t size;
+
+        const char* data = PyUnicode_AsUTF8AndSize(obj, &size);
+
+        if (data == NULL)
+        {
+            return false;
+        }
+
+        value.assign(data, (size_t)size);
+
+        return true;
+    }
+#endif
+
+    if (PyBytes_Check(obj))
+    {
+        value.assign(PyBytes_AsString(obj), (size_t)PyBytes_Size(obj));
+
+        return true;
+    }
+
+    PyErr_SetString(PyExc_TypeError, "expected string");
+
+    return false;
+}
+
+static bool py_get_strings(
+        _In_ PyObject* obj,
+        _Out_ std::vector<std::string>& values)
+{
+    SWSS_LOG_ENTER();
+
+    PyObject* seq = PySequence_Fast(obj, "expected sequence of strings");
+
+    if (seq == NULL)
+    {
+        return false;
+    }
+
+    Py_ssize_t size = PySequence_Fast_GET_SIZE(seq);
+
+    PyObject** items = PySequence_Fast_ITEMS(seq);
+
+    values.resize((size_t)size);
+
+    for (Py_ssize_t i = 0; i < size; i++)
+    {
+        if (!py_get_string(items[i], values[i]))
+        {
+            Py_DECREF(seq);
+            return false;
+        }
+    }
+
+    Py_DECREF(seq);
+
+    return true;
+}
+
+static bool py_get_oid(
+        _In_ PyObject* obj,
+        _Out_ sai_object_id_t& oid)
+{
+    SWSS_LOG_ENTER();
+
+    PyObject* number = PyNumber_Long(obj);
+
+    if (number == NULL)
+    {
+        return false;
+    }
+
+    oid = PyLong_AsUnsignedLongLong(number);
+
+    Py_DECREF(number);
+
+    return PyErr_Occurred() == NULL;
+}
+
+/**
+ * @brief Get object ids from python object.
+ *
+ * If count is zero, count is determined by python object, otherwise python
+ * object must have count items or be single integer.
+ */
+static bool py_get_oids(
+        _In_ PyObject* obj,
+        _In_ size_t count,
+        _Out_ std::vector<sai_object_id_t>& oids)
+{
+    SWSS_LOG_ENTER();
+
+    if (count && PyIndex_Check(obj))
+    {
+        sai_object_id_t oid;
+
+        if (!py_get_oid(obj, oid))
+        {
+            return false;
+        }
+
+        oids.assign(count, oid);
+
+        return true;
+    }
+
+    if (PyObject_CheckBuffer(obj))
+    {
+        Py_buffer view;
+
+        if (PyObject_GetBuffer(obj, &view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) != 0)
+        {
+            return false;
+        }
+
+        const char* format = view.format ? view.format : "B";
+
+        if (*format == '@' || *format == '=' || *format == '<')
+        {
+            format++;
+        }
+
+        bool valid = view.itemsize == (Py_ssize_t)sizeof(sai_object_id_t) && *format && strchr("QqLlNn", *format) && format[1] == 0;
+
+        if (valid)
+        {
+            oids.resize((size_t)(view.len / view.itemsize));
+
+            memcpy(oids.data(), view.buf, oids.size() * sizeof(sai_object_id_t));
+        }
+
+        PyBuffer_Release(&view);
+
+        if (!valid)
+        {
+            PyErr_SetString(PyExc_TypeError, "expected buffer of 64 bit integers");
+            return false;
+        }
+    }
+    else
+    {
+        PyObject* seq = PySequence_Fast(obj, "expected integer or sequence of integers");
+
+        if (seq == NULL)
+        {
+            return false;
+        }
+
+        Py_ssize_t size = PySequence_Fast_GET_SIZE(seq);
+
+        PyObject** items = PySequence_Fast_ITEMS(seq);
+
+        oids.resize((size_t)size);
+
+        for (Py_ssize_t i = 0; i < size; i++)
+        {
+            if (!py_get_oid(items[i], oids[i]))
+            {
+                Py_DECREF(seq);
+                return false;
+            }
+        }
+
+        Py_DECREF(seq);
+    }
+
+    if (count && oids.size() != count)
+    {
+        PyErr_Format(PyExc_ValueError, "expected %zu object ids, got %zu", count, oids.size());
+        return false;
+    }
+
+    return true;
+}
+
+static bool py_get_fdb_entries(
+        _In_ sai_object_id_t switch_id,
+        _In_ sai_object_id_t bv_id,
+        _In_ PyObject* macs,
+        _Out_ std::vector<sai_fdb_entry_t>& entries)
+{
+    SWSS_LOG_ENTER();
+
+    sai_fdb_entry_t entry;
+
+    memset(&entry, 0, sizeof(entry));
+
+    entry.switch_id = switch_id;
+    entry.bv_id = bv_id;
+
+    if (PyObject_CheckBuffer(macs))
+    {
+        // packed 6 byte addresses
+
+        Py_buffer view;
+
+        if (PyObject_GetBuffer(macs, &view, PyBUF_C_CONTIGUOUS) != 0)
+        {
+            return false;
+        }
+
+        bool valid = (view.len % sizeof(sai_mac_t)) == 0;
+
+        if (valid)
+        {
+            entries.assign((size_t)view.len / sizeof(sai_mac_t), entry);
+
+            for (size_t i = 0; i < entries.size(); i++)
+            {
+                memcpy(entries[i].mac_address, (const uint8_t*)view.buf + i * sizeof(sai_mac_t), sizeof(sai_mac_t));
+            }
+        }
+
+        PyBuffer_Release(&view);
+
+        if (!valid)
+        {
+            PyErr_SetString(PyExc_ValueError, "buffer size must be multiple of 6");
+        }
+
+        return valid;
+    }
+
+    std::vector<std::string> strings;
+
+    if (!py_get_strings(macs, strings))
+    {
+        return false;
+    }
+
+    entries.assign(strings.size(), entry);
+
+    try
+    {
+        for (size_t i = 0; i < strings.size(); i++)
+        {
+            sai_deserialize_mac(strings[i], entries[i].mac_address);
+        }
+    }
+    catch (const std::exception& e)
+    {
+        PyErr_SetString(PyExc_ValueError, e.what());
+        return false;
+    }
+
+    return true;
+}
+
+static bool py_get_route_entries(
+        _In_ sai_object_id_t switch_id,
+        _In_ sai_object_id_t vr_id,
+        _In_ PyObject* prefixes,
+        _Out_ std::vector<sai_route_entry_t>& entries)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<std::string> strings;
+
+    if (!py_get_strings(prefixes, strings))
+    {
+        return false;
+    }
+
+    sai_route_entry_t entry;
+
+    memset(&entry, 0, sizeof(entry));
+
+    entry.switch_id = switch_id;
+    entry.vr_id = vr_id;
+
+    entries.assign(strings.size(), entry);
+
+    try
+    {
+        for (size_t i = 0; i < strings.size(); i++)
+        {
+            sai_deserialize_ip_prefix(strings[i], entries[i].destination);
+        }
+    }
+    catch (const std::exception& e)
+    {
+        PyErr_SetString(PyExc_ValueError, e.what());
+        return false;
+    }
+
+    return true;
+}
+
+static bool py_get_ip_addresses(
+        _In_ PyObject* ips,
+        _Out_ std::vector<sai_ip_address_t>& addresses)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<std::string> strings;
+
+    if (!py_get_strings(ips, strings))
+    {
+        return false;
+    }
+
+    addresses.resize(strings.size());
+
+    try
+    {
+        for (size_t i = 0; i < strings.size(); i++)
+        {
+            sai_deserialize_ip_address(strings[i], addresses[i]);
+        }
+    }
+    catch (const std::exception& e)
+    {
+        PyErr_SetString(PyExc_ValueError, e.what());
+        return false;
+    }
+
+    return true;
+}
+
+static bool py_api_query(
+        _In_ sai_api_t api,
+        _Out_ void** api_method_table)
+{
+    SWSS_LOG_ENTER();
+
+    sai_status_t status = sai_api_query(api, api_method_table);
+
+    if (status != SAI_STATUS_SUCCESS)
+    {
+        PyErr_Format(PyExc_RuntimeError, "sai_api_query for %s failed: %s",
+                sai_serialize_api(api).c_str(),
+                sai_serialize_status(status).c_str());
+
+        return false;
+    }
+
+    return true;
+}
+
+static PyObject* py_build_statuses(
+        _In_ const std::vector<sai_status_t>& statuses)
+{
+    SWSS_LOG_ENTER();
+
+    PyObject* list = PyList_New((Py_ssize_t)statuses.size());
+
+    if (list == NULL)
+    {
+        return NULL;
+    }
+
+    for (size_t i = 0; i < statuses.size(); i++)
+    {
+        PyList_SET_ITEM(list, (Py_ssize_t)i, PyLong_FromLong(statuses[i]));
+    }
+
+    return list;
+}
+
+static PyObject* py_build_oids(
+        _In_ const std::vector<sai_object_id_t>& oids)
+{
+    SWSS_LOG_ENTER();
+
+    PyObject* list = PyList_New((Py_ssize_t)oids.size());
+
+    if (list == NULL)
+    {
+        return NULL;
+    }
+
+    for (size_t i = 0; i < oids.size(); i++)
+    {
+        PyList_SET_ITEM(list, (Py_ssize_t)i, PyLong_FromUnsignedLongLong(oids[i]));
+    }
+
+    return list;
+}
+
+PyObject* sai_bulk_create_route_entries(
+        _In_ sai_object_id_t switch_id,
+        _In_ sai_object_id_t vr_id,
+        _In_ PyObject* prefixes,
+        _In_ PyObject* next_hops,
+        _In_ sai_bulk_op_error_mode_t mode)
+{
+    SWSS_LOG_ENTER();
+
+    sai_route_api_t* route_api;
+
+    std::vector<sai_route_entry_t> entries;
+    std::vector<sai_object_id_t> nhs;
+
+    if (!py_api_query(SAI_API_ROUTE, (void**)&route_api) ||
+            !py_get_route_entries(switch_id, vr_id, prefixes, entries) ||
+            !py_get_oids(next_hops, entries.size(), nhs))
+    {
+        return NULL;
+    }
+
+    size_t count = entries.size();
+
+    std::vector<sai_attribute_t> attrs(count);
+    std::vector<const sai_attribute_t*> attr_list(count);
+    std::vector<uint32_t> attr_count(count, 1);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        // null next hop creates drop route
+
+        if (nhs[i] == SAI_NULL_OBJECT_ID)
+        {
+            attrs[i].id = SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION;
+            attrs[i].value.s32 = SAI_PACKET_ACTION_DROP;
+        }
+        else
+        {
+            attrs[i].id = SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID;
+            attrs[i].value.oid = nhs[i];
+        }
+
+        attr_list[i] = &attrs[i];
+    }
+
+    std::vector<sai_status_t> statuses(count);
+
+    sai_status_t status = route_api->create_route_entries((uint32_t)count, entries.data(), attr_count.data(), attr_list.data(), mode, statuses.data());
+
+    return Py_BuildValue("(iN)", status, py_build_statuses(statuses));
+}
+
+PyObject* sai_bulk_set_route_entries_next_hop(
+        _In_ sai_object_id_t switch_id,
+        _In_ sai_object_id_t vr_id,
+        _In_ PyObject* prefixes,
+        _In_ PyObject* next_hops,
+        _In_ sai_bulk_op_error_mode_t mode)
+{
+    SWSS_LOG_ENTER();
+
+    sai_route_api_t* route_api;
+
+    std::vector<sai_route_entry_t> entries;
+    std::vector<sai_object_id_t> nhs;
+
+    if (!py_api_query(SAI_API_ROUTE, (void**)&route_api) ||
+            !py_get_route_entries(switch_id, vr_id, prefixes, entries) ||
+            !py_get_oids(next_hops, entries.size(), nhs))
+    {
+        return NULL;
+    }
+
+    size_t count = entries.size();
+
+    std::vector<sai_attribute_t> attrs(count);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        attrs[i].id = SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID;
+        attrs[i].value.oid = nhs[i];
+    }
+
+    std::vector<sai_status_t> statuses(count);
+
+    sai_status_t status = route_api->set_route_entries_attribute((uint32_t)count, entries.data(), attrs.data(), mode, statuses.data());
+
+    return Py_BuildValue("(iN)", status, py_build_statuses(statuses));
+}
+
+PyObject* sai_bulk_remove_route_entries(
+        _In_ sai_object_id_t switch_id,
+        _In_ sai_object_id_t vr_id,
+        _In_ PyObject* prefixes,
+        _In_ sai_bulk_op_error_mode_t mode)
+{
+    SWSS_LOG_ENTER();
+
+    sai_route_api_t* route_api;
+
+    std::vector<sai_route_entry_t> entries;
+
+    if (!py_api_query(SAI_API_ROUTE, (void**)&route_api) ||
+            !py_get_route_entries(switch_id, vr_id, prefixes, entries))
+    {
+        return NULL;
+    }
+
+    std::vector<sai_status_t> statuses(entries.size());
+
+    sai_status_t status = route_api->remove_route_entries((uint32_t)entries.size(), entries.data(), mode, statuses.data());
+
+    return Py_BuildValue("(iN)", status, py_build_statuses(statuses));
+}
+
+PyObject* sai_bulk_create_fdb_entries(
+        _In_ sai_object_id_t switch_id,
+        _In_ sai_object_id_t bv_id,
+        _In_ PyObject* macs,
+        _In_ PyObject* bridge_port_ids,
+        _In_ sai_bulk_op_error_mode_t mode)
+{
+    SWSS_LOG_ENTER();
+
+    sai_fdb_api_t* fdb_api;
+
+    std::vector<sai_fdb_entry_t> entries;
+    std::vector<sai_object_id_t> bps;
+
+    if (!py_api_query(SAI_API_FDB, (void**)&fdb_api) ||
+            !py_get_fdb_entries(switch_id, bv_id, macs, entries) ||
+            !py_get_oids(bridge_port_ids, entries.size(), bps))
+    {
+        return NULL;
+    }
+
+    size_t count = entries.size();
+
+    std::vector<sai_attribute_t> attrs(count * 2);
+    std::vector<const sai_attribute_t*> attr_list(count);
+    std::vector<uint32_t> attr_count(count, 2);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        attrs[2 * i].id = SAI_FDB_ENTRY_ATTR_TYPE;
+        attrs[2 * i].value.s32 = SAI_FDB_ENTRY_TYPE_STATIC;
+
+        attrs[2 * i + 1].id = SAI_FDB_ENTRY_ATTR_BRIDGE_PORT_ID;
+        attrs[2 * i + 1].value.oid = bps[i];
+
+        attr_list[i] = &attrs[2 * i];
+    }
+
+    std::vector<sai_status_t> statuses(count);
+
+    sai_status_t status = fdb_api->create_fdb_entries((uint32_t)count, entries.data(), attr_count.data(), attr_list.data(), mode, statuses.data());
+
+    return Py_BuildValue("(iN)", status, py_build_statuses(statuses));
+}
+
+PyObject* sai_bulk_remove_fdb_entries(
+        _In_ sai_object_id_t switch_id,
+        _In_ sai_object_id_t bv_id,
+        _In_ PyObject* macs,
+        _In_ sai_bulk_op_error_mode_t mode)
+{
+    SWSS_LOG_ENTER();
+
+    sai_fdb_api_t* fdb_api;
+
+    std::vector<sai_fdb_entry_t> entries;
+
+    if (!py_api_query(SAI_API_FDB, (void**)&fdb_api) ||
+            !py_get_fdb_entries(switch_id, bv_id, macs, entries))
+    {
+        return NULL;
+    }
+
+    std::vector<sai_status_t> statuses(entries.size());
+
+    sai_status_t status = fdb_api->remove_fdb_entries((uint32_t)entries.size(), entries.data(), mode, statuses.data());
+
+    return Py_BuildValue("(iN)", status, py_build_statuses(statuses));
+}
+
+PyObject* sai_bulk_create_next_hops(
+        _In_ sai_object_id_t switch_id,
+        _In_ PyObject* ips,
+        _In_ PyObject* router_interface_ids,
+        _In_ sai_bulk_op_error_mode_t mode)
+{
+    SWSS_LOG_ENTER();
+
+    sai_next_hop_api_t* next_hop_api;
+
+    std::vector<sai_ip_address_t> addresses;
+    std::vector<sai_object_id_t> rifs;
+
+    if (!py_api_query(SAI_API_NEXT_HOP, (void**)&next_hop_api) ||
+            !py_get_ip_addresses(ips, addresses) ||
+            !py_get_oids(router_interface_ids, addresses.size(), rifs))
+    {
+        return NULL;
+    }
+
+    size_t count = addresses.size();
+
+    std::vector<sai_attribute_t> attrs(count * 3);
+    std::vector<const sai_attribute_t*> attr_list(count);
+    std::vector<uint32_t> attr_count(count, 3);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        attrs[3 * i].id = SAI_NEXT_HOP_ATTR_TYPE;
+        attrs[3 * i].value.s32 = SAI_NEXT_HOP_TYPE_IP;
+
+        attrs[3 * i + 1].id = SAI_NEXT_HOP_ATTR_IP;
+        attrs[3 * i + 1].value.ipaddr = addresses[i];
+
+        attrs[3 * i + 2].id = SAI_NEXT_HOP_ATTR_ROUTER_INTERFACE_ID;
+        attrs[3 * i + 2].value.oid = rifs[i];
+
+        attr_list[i] = &attrs[3 * i];
+    }
+
+    std::vector<sai_object_id_t> oids(count, SAI_NULL_OBJECT_ID);
+    std::vector<sai_status_t> statuses(count);
+
+    sai_status_t status = next_hop_api->create_next_hops(switch_id, (uint32_t)count, attr_count.data(), attr_list.data(), mode, oids.data(), statuses.data());
+
+    return Py_BuildValue("(iNN)", status, py_build_statuses(statuses), py_build_oids(oids));
+}
+
+PyObject* sai_bulk_remove_next_hops(
+        _In_ PyObject* next_hop_ids,
+        _In_ sai_bulk_op_error_mode_t mode)
+{
+    SWSS_LOG_ENTER();
+
+    sai_next_hop_api_t* next_hop_api;
+
+    std::vector<sai_object_id_t> oids;
+
+    if (!py_api_query(SAI_API_NEXT_HOP, (void**)&next_hop_api) ||
+            !py_get_oids(next_hop_ids, 0, oids))
+    {
+        return NULL;
+    }
+
+    std::vector<sai_status_t> statuses(oids.size());
+
+    sai_status_t status = next_hop_api->remove_next_hops((uint32_t)oids.size(), oids.data(), mode, statuses.data());
+
+    return Py_BuildValue("(iN)", status, py_build_statuses(statuses));
+}
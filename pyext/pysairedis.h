@@ -16,3 +16,58 @@ sai_status_t sai_api_initialize(
 sai_pointer_t sai_get_notification_pointer(
         sai_attr_id_t id,
         PyObject*callback);
+
+// bulk helpers
+//
+// Entries are built natively from python sequences, so bulk apis can be used
+// without creating wrapped arrays element by element. Object ids can be
+// passed as sequence of integers, object supporting buffer protocol with 64
+// bit items (like array.array('Q')) or single integer which is used for all
+// entries. MAC addresses can be passed as sequence of
+// strings or buffer of packed 6 byte addresses.
+//
+// Each function returns tuple of bulk api status and list of object
+// statuses, next hop create returns also list of created object ids.
+
+PyObject* sai_bulk_create_route_entries(
+        sai_object_id_t switch_id,
+        sai_object_id_t vr_id,
+        PyObject* prefixes,
+        PyObject* next_hops,
+        sai_bulk_op_error_mode_t mode = SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR);
+
+PyObject* sai_bulk_set_route_entries_next_hop(
+        sai_object_id_t switch_id,
+        sai_object_id_t vr_id,
+        PyObject* prefixes,
+        PyObject* next_hops,
+        sai_bulk_op_error_mode_t mode = SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR);
+
+PyObject* sai_bulk_remove_route_entries(
+        sai_object_id_t switch_id,
+        sai_object_id_t vr_id,
+        PyObject* prefixes,
+        sai_bulk_op_error_mode_t mode = SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR);
+
+PyObject* sai_bulk_create_fdb_entries(
+        sai_object_id_t switch_id,
+        sai_object_id_t bv_id,
+        PyObject* macs,
+        PyObject* bridge_port_ids,
+        sai_bulk_op_error_mode_t mode = SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR);
+
+PyObject* sai_bulk_remove_fdb_entries(
+        sai_object_id_t switch_id,
+        sai_object_id_t bv_id,
+        PyObject* macs,
+        sai_bulk_op_error_mode_t mode = SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR);
+
+PyObject* sai_bulk_create_next_hops(
+        sai_object_id_t switch_id,
+        PyObject* ips,
+        PyObject* router_interface_ids,
+        sai_bulk_op_error_mode_t mode = SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR);
+
+PyObject* sai_bulk_remove_next_hops(
+        PyObject* next_hop_ids,
+        sai_bulk_op_error_mode_t mode = SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR);
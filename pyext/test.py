@@ -341,5 +341,27 @@ print "packet action: " + str(attr.value.s32)
 status = route_api.remove_route_entry(re)
 print "remove route entry: " + str(status)
 
+# bulk helpers, entries are created natively from python lists
+
+ips = [ "10.1.%d.%d" % (n >> 8, n & 255) for n in range(0, 16) ]
+
+(status, statuses, nexthops) = pysairedis.sai_bulk_create_next_hops(swid, ips, rifid)
+print "bulk create next hops: " + str(status) + " nexthops: " + str(len(nexthops))
+
+prefixes = [ "20.%d.%d.0/24" % (n >> 8, n & 255) for n in range(0, 1000) ]
+routenexthops = [ nexthops[n % len(nexthops)] for n in range(0, 1000) ]
+
+(status, statuses) = pysairedis.sai_bulk_create_route_entries(swid, vrid, prefixes, routenexthops)
+print "bulk create route entries: " + str(status) + " failed: " + str(len([s for s in statuses if s != pysairedis.SAI_STATUS_SUCCESS]))
+
+(status, statuses) = pysairedis.sai_bulk_set_route_entries_next_hop(swid, vrid, prefixes, nexthopid)
+print "bulk set route entries next hop: " + str(status)
+
+(status, statuses) = pysairedis.sai_bulk_remove_route_entries(swid, vrid, prefixes)
+print "bulk remove route entries: " + str(status)
+
+(status, statuses) = pysairedis.sai_bulk_remove_next_hops(nexthops)
+print "bulk remove next hops: " + str(status)
+
 status = pysairedis.sai_api_uninitialize()
 print "uninitialize: " + str(status)
@@ -0,0 +1,180 @@
+#include "RdbJsonSaxHandler.h"
+#include "swss/logger.h"
+#include <stdexcept>
+
+using namespace syncd;
+
+RdbJsonSaxHandler::RdbJsonSaxHandler(KeyCallback keyCallback, ItemCallback itemCallback):
+    m_keyCallback(keyCallback),
+    m_itemCallback(itemCallback),
+    m_itemSelected(false)
+{
+    SWSS_LOG_ENTER();
+}
+
+bool RdbJsonSaxHandler::push(Frame frame)
+{
+    SWSS_LOG_ENTER();
+
+    m_stack.push_back(frame);
+    return true;
+}
+
+bool RdbJsonSaxHandler::scalar(const char* type)
+{
+    SWSS_LOG_ENTER();
+
+    // item fields are converted to string, same as json tree conversion would fail on other types
+    if (!m_stack.empty() && m_stack.back() == Frame::ITEM && m_field != "NULL")
+    {
+        throw std::runtime_error(std::string("type must be string, but is ") + type);
+    }
+
+    return true;
+}
+
+bool RdbJsonSaxHandler::null()
+{
+    SWSS_LOG_ENTER();
+    return scalar("null");
+}
+
+bool RdbJsonSaxHandler::boolean(bool val)
+{
+    SWSS_LOG_ENTER();
+    return scalar("boolean");
+}
+
+bool RdbJsonSaxHandler::number_integer(number_integer_t val)
+{
+    SWSS_LOG_ENTER();
+    return scalar("number");
+}
+
+bool RdbJsonSaxHandler::number_unsigned(number_unsigned_t val)
+{
+    SWSS_LOG_ENTER();
+    return scalar("number");
+}
+
+bool RdbJsonSaxHandler::number_float(number_float_t val, const string_t& s)
+{
+    SWSS_LOG_ENTER();
+    return scalar("number");
+}
+
+bool RdbJsonSaxHandler::binary(binary_t& val)
+{
+    SWSS_LOG_ENTER();
+    return scalar("binary");
+}
+
+bool RdbJsonSaxHandler::string(string_t& val)
+{
+    SWSS_LOG_ENTER();
+
+    if (!m_stack.empty() && m_stack.back() == Frame::ITEM && m_field != "NULL")
+    {
+        m_map[m_field] = std::move(val);
+    }
+
+    return true;
+}
+
+bool RdbJsonSaxHandler::start_object(std::size_t elements)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_stack.empty() || m_stack.back() == Frame::ARRAY)
+    {
+        return push(Frame::TABLE);
+    }
+
+    switch (m_stack.back())
+    {
+        case Frame::TABLE:
+            if (m_itemSelected)
+            {
+                m_map.clear();
+                return push(Frame::ITEM);
+            }
+            return push(Frame::SKIP);
+
+        case Frame::ITEM:
+            scalar("object");
+            return push(Frame::SKIP);
+
+        default:
+            return push(Frame::SKIP);
+    }
+}
+
+bool RdbJsonSaxHandler::start_array(std::size_t elements)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_stack.empty() || m_stack.back() == Frame::ARRAY)
+    {
+        return push(Frame::ARRAY);
+    }
+
+    if (m_stack.back() == Frame::ITEM)
+    {
+        scalar("array");
+    }
+
+    // item values other than objects are not traversed
+    return push(Frame::SKIP);
+}
+
+bool RdbJsonSaxHandler::key(string_t& val)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_stack.back() == Frame::TABLE)
+    {
+        m_itemKey = val;
+        m_itemSelected = m_keyCallback(m_itemKey);
+    }
+    else if (m_stack.back() == Frame::ITEM)
+    {
+        m_field = val;
+    }
+
+    return true;
+}
+
+bool RdbJsonSaxHandler::end_object()
+{
+    SWSS_LOG_ENTER();
+
+    Frame frame = m_stack.back();
+    m_stack.pop_back();
+
+    if (frame == Frame::ITEM)
+    {
+        m_itemCallback(m_itemKey, m_map);
+        m_map.clear();
+    }
+    else if (frame == Frame::TABLE)
+    {
+        m_itemSelected = false;
+    }
+
+    return true;
+}
+
+bool RdbJsonSaxHandler::end_array()
+{
+    SWSS_LOG_ENTER();
+
+    m_stack.pop_back();
+    return true;
+}
+
+bool RdbJsonSaxHandler::parse_error(std::size_t position, const std::string& last_token, const nlohmann::detail::exception& ex)
+{
+    SWSS_LOG_ENTER();
+
+    throw std::runtime_error(ex.what());
+}
@@ -0,0 +1,67 @@
+#pragma once
+#include "swss/table.h"
+#include <nlohmann/json.hpp>
+#include <functional>
+#include <vector>
+#include <string>
+
+namespace syncd
+{
+    /**
+     * @brief Streaming reader of RDB JSON file.
+     *
+     * Objects reachable through arrays are tables and their keys are items.
+     * File is parsed without building json tree, so memory usage depends
+     * only on size of single item.
+     *
+     * For each item key keyCallback is called, and if it returns true and
+     * item value is an object, itemCallback is called with item fields when
+     * the object ends. Field named "NULL" is skipped.
+     */
+    class RdbJsonSaxHandler:
+        public nlohmann::json_sax<nlohmann::json>
+    {
+        public:
+            typedef std::function<bool(const std::string& key)> KeyCallback;
+            typedef std::function<void(const std::string& key, const swss::TableMap& map)> ItemCallback;
+
+            RdbJsonSaxHandler(KeyCallback keyCallback, ItemCallback itemCallback);
+            virtual ~RdbJsonSaxHandler() = default;
+
+        public: // json_sax
+            bool null() override;
+            bool boolean(bool val) override;
+            bool number_integer(number_integer_t val) override;
+            bool number_unsigned(number_unsigned_t val) override;
+            bool number_float(number_float_t val, const string_t& s) override;
+            bool string(string_t& val) override;
+            bool binary(binary_t& val) override;
+            bool start_object(std::size_t elements) override;
+            bool key(string_t& val) override;
+            bool end_object() override;
+            bool start_array(std::size_t elements) override;
+            bool end_array() override;
+            bool parse_error(std::size_t position, const std::string& last_token, const nlohmann::detail::exception& ex) override;
+
+        private:
+            enum class Frame
+            {
+                ARRAY,
+                TABLE,
+                ITEM,
+                SKIP,
+            };
+
+            bool scalar(const char* type);
+            bool push(Frame frame);
+
+        private:
+            KeyCallback m_keyCallback;
+            ItemCallback m_itemCallback;
+            std::vector<Frame> m_stack;
+            std::string m_itemKey;
+            bool m_itemSelected;
+            std::string m_field;
+            swss::TableMap m_map;
+    };
+}
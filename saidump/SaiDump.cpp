@@ -1,4 +1,5 @@
 #include "SaiDump.h"
+#include "RdbJsonSaxHandler.h"
 extern "C" {
 #include <sai.h>
 }
@@ -411,76 +412,47 @@ void SaiDump::dumpGraphFun(const TableDump& td)
 
 #define SWSS_LOG_ERROR_AND_STDERR(format, ...) { fprintf(stderr, format"\n", ##__VA_ARGS__); SWSS_LOG_ERROR(format, ##__VA_ARGS__); }
 
-void SaiDump::traverseJson(const json & jsn)
+bool SaiDump::printRdbJsonItemName(const std::string& keystr)
 {
     SWSS_LOG_ENTER();
-    if (jsn.is_object())
-    {
-        for (auto it = jsn.begin(); it != jsn.end(); ++it)
-        {
-            std::string keystr = it.key();
-            std::string item_name = keystr;
-            size_t pos = keystr.find_first_of(":");
 
-            if (pos != std::string::npos)
-            {
-                if(ASIC_STATE_TABLE != keystr.substr(0, pos))  // filter out non "ASIC_STATE" items
-                {
-                    continue;
-                }
+    size_t pos = keystr.find_first_of(":");
 
-                item_name = keystr.substr(pos + 1);
+    if (pos == std::string::npos)
+    {
+        return false;
+    }
 
-                if (item_name.find(":") != std::string::npos)
-                {
-                    item_name.replace(item_name.find_first_of(":"), 1, " ");
-                }
-            }
-            else
-            {
-                continue;
-            }
+    if(ASIC_STATE_TABLE != keystr.substr(0, pos))  // filter out non "ASIC_STATE" items
+    {
+        return false;
+    }
 
-            std::cout << item_name << " " << std::endl;
-            json jsn_sub = it.value();
+    std::string item_name = keystr.substr(pos + 1);
 
-            if (!it->is_object())
-            {
-                continue;
-            }
+    if (item_name.find(":") != std::string::npos)
+    {
+        item_name.replace(item_name.find_first_of(":"), 1, " ");
+    }
 
-            TableMap map;
+    std::cout << item_name << " " << std::endl;
+    return true;
+}
 
-            for (auto it_sub = jsn_sub.begin(); it_sub != jsn_sub.end(); ++it_sub)
-            {
-                if (it_sub.key() != "NULL")
-                {
-                    map[it_sub.key()] = it_sub.value();
-                }
-            }
+void SaiDump::printRdbJsonItem(const TableMap& map)
+{
+    SWSS_LOG_ENTER();
 
-            constexpr size_t LINE_IDENT = 4;
-            size_t max_len = getMaxAttrLen(map);
-            std::string str_indent = padString("", LINE_IDENT);
+    constexpr size_t LINE_IDENT = 4;
+    size_t max_len = getMaxAttrLen(map);
+    std::string str_indent = padString("", LINE_IDENT);
 
-            for (const auto&field: map)
-            {
-                std::cout << str_indent << padString(field.first, max_len) << " : ";
-                std::cout << field.second << std::endl;
-            }
-            std::cout << std::endl;
-        }
-    }
-    else if(jsn.is_array())
+    for (const auto&field: map)
     {
-        for (const auto& element : jsn)
-        {
-            if (element.is_object() || element.is_array())
-            {
-                traverseJson(element);
-            }
-        }
+        std::cout << str_indent << padString(field.first, max_len) << " : ";
+        std::cout << field.second << std::endl;
     }
+    std::cout << std::endl;
 }
 
 sai_status_t SaiDump::dumpFromRedisRdbJson()
@@ -497,10 +469,12 @@ sai_status_t SaiDump::dumpFromRedisRdbJson()
 
     try
     {
-        // Parse the JSON data from the file (validation)
-        json jsonData;
-        input_file >> jsonData;
-        traverseJson(jsonData);
+        // Stream items from the file one by one, memory usage doesn't depend on file size
+        RdbJsonSaxHandler handler(
+                [this](const std::string& key) { return printRdbJsonItemName(key); },
+                [this](const std::string& key, const TableMap& map) { printRdbJsonItem(map); });
+
+        json::sax_parse(input_file, &handler);
         return SAI_STATUS_SUCCESS;
     }
     catch (std::exception &ex)
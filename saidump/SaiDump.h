@@ -14,7 +14,6 @@ namespace syncd
             void dumpFromRedisDb(int argc, char **argv);
             void printUsage();
             sai_status_t dumpFromRedisRdbJson();
-            void traverseJson(const nlohmann::json & jsn);
             void dumpGraphFun(const swss::TableDump& td);
             void printAttributes(size_t indent, const swss::TableMap& map);
             void dumpGraphTable(const swss::TableDump &dump);
@@ -32,5 +31,7 @@ namespace syncd
         private:
             size_t getMaxAttrLen(const swss::TableMap& map);
             std::string padString(std::string s, size_t pad);
+            bool printRdbJsonItemName(const std::string& key);
+            void printRdbJsonItem(const swss::TableMap& map);
     };
 }
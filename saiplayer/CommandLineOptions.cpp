@@ -21,11 +21,18 @@ CommandLineOptions::CommandLineOptions()
     m_sleep = false;
     m_syncMode = false;
     m_enableRecording = false;
+    m_benchmark = false;
+
+    m_speed = 0;
+
+    m_autoBulkSize = 0;
 
     m_redisCommunicationMode = SAI_REDIS_COMMUNICATION_MODE_REDIS_ASYNC;
 
     m_profileMapFile = "";
     m_contextConfig = "";
+    m_benchmarkReport = "";
+    m_benchmarkBaseline = "";
 }
 
 std::string CommandLineOptions::getCommandLineString() const
@@ -44,6 +51,11 @@ std::string CommandLineOptions::getCommandLineString() const
     ss << " EnableRecording=" << (m_enableRecording ? "YES" : "NO");
     ss << " ProfileMapFile=" << m_profileMapFile;
     ss << " ContextConfig=" << m_contextConfig;
+    ss << " Benchmark=" << (m_benchmark ? "YES" : "NO");
+    ss << " Speed=" << m_speed;
+    ss << " BenchmarkReport=" << m_benchmarkReport;
+    ss << " BenchmarkBaseline=" << m_benchmarkBaseline;
+    ss << " AutoBulkSize=" << m_autoBulkSize;
 
     return ss.str();
 }
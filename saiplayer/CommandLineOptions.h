@@ -43,6 +43,32 @@ namespace saiplayer
 
             std::string m_contextConfig;
 
+            /**
+             * @brief Benchmark mode, lines are read by separate thread and
+             * latency report is generated at the end of replay.
+             */
+            bool m_benchmark;
+
+            /**
+             * @brief Replay speed factor relative to recorded timestamps,
+             * 0 means as fast as possible.
+             */
+            double m_speed;
+
+            std::string m_benchmarkReport;
+
+            /**
+             * @brief Benchmark report of previous replay, current replay
+             * latencies are compared against it.
+             */
+            std::string m_benchmarkBaseline;
+
+            /**
+             * @brief Maximum number of single create/remove/set operations
+             * merged into one bulk call, 0 disables auto bulk.
+             */
+            uint32_t m_autoBulkSize;
+
             std::vector<std::string> m_files;
     };
 }
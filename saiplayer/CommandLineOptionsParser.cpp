@@ -5,6 +5,8 @@
 #include "swss/logger.h"
 
 #include <getopt.h>
+#include <stdlib.h>
+#include <stdint.h>
 
 #include <iostream>
 
@@ -18,7 +20,7 @@ std::shared_ptr<CommandLineOptions> CommandLineOptionsParser::parseCommandLine(
 
     auto options = std::make_shared<CommandLineOptions>();
 
-    const char* const optstring = "uiCdsmz:rp:x:h";
+    const char* const optstring = "uiCdsmz:rp:x:bS:o:B:a:h";
 
     while (true)
     {
@@ -34,6 +36,11 @@ std::shared_ptr<CommandLineOptions> CommandLineOptionsParser::parseCommandLine(
             { "enableRecording",        no_argument,       0, 'r' },
             { "profile",                required_argument, 0, 'p' },
             { "contextContig",          required_argument, 0, 'x' },
+            { "benchmark",              no_argument,       0, 'b' },
+            { "speed",                  required_argument, 0, 'S' },
+            { "benchmarkReport",        required_argument, 0, 'o' },
+            { "benchmarkBaseline",      required_argument, 0, 'B' },
+            { "autoBulk",               required_argument, 0, 'a' },
             { "help",                   no_argument,       0, 'h' },
         };
 
@@ -85,6 +92,48 @@ std::shared_ptr<CommandLineOptions> CommandLineOptionsParser::parseCommandLine(
                 options->m_contextConfig = std::string(optarg);
                 break;
 
+            case 'b':
+                options->m_benchmark = true;
+                break;
+
+            case 'S':
+                {
+                    char *end = nullptr;
+
+                    options->m_speed = strtod(optarg, &end);
+
+                    if (end == optarg || *end != 0 || !(options->m_speed >= 0))
+                    {
+                        SWSS_LOG_ERROR("invalid speed factor: %s", optarg);
+                        exit(EXIT_FAILURE);
+                    }
+                }
+                break;
+
+            case 'o':
+                options->m_benchmarkReport = std::string(optarg);
+                break;
+
+            case 'B':
+                options->m_benchmarkBaseline = std::string(optarg);
+                break;
+
+            case 'a':
+                {
+                    char *end = nullptr;
+
+                    unsigned long size = strtoul(optarg, &end, 10);
+
+                    if (end == optarg || *end != 0 || size > UINT32_MAX)
+                    {
+                        SWSS_LOG_ERROR("invalid auto bulk size: %s", optarg);
+                        exit(EXIT_FAILURE);
+                    }
+
+                    options->m_autoBulkSize = (uint32_t)size;
+                }
+                break;
+
             case 'h':
                 printUsage();
                 exit(EXIT_SUCCESS);
@@ -123,7 +172,7 @@ void CommandLineOptionsParser::printUsage()
 {
     SWSS_LOG_ENTER();
 
-    std::cout << "Usage: saiplayer [-u] [-i] [-C] [-d] [-s] [-m] [-z mode] [-r] [-p profile] [-x contextConfig] [-h] recordfile" << std::endl << std::endl;
+    std::cout << "Usage: saiplayer [-u] [-i] [-C] [-d] [-s] [-m] [-z mode] [-r] [-p profile] [-x contextConfig] [-b] [-S speed] [-o report] [-B baseline] [-a size] [-h] recordfile" << std::endl << std::endl;
 
     std::cout << "    -u --useTempView:" << std::endl;
     std::cout << "        Enable temporary view between init and apply" << std::endl << std::endl;
@@ -145,6 +194,16 @@ void CommandLineOptionsParser::printUsage()
     std::cout << "        Provide profile map file" << std::endl << std::endl;
     std::cout << "    -x --contextConfig" << std::endl;
     std::cout << "        Context configuration file" << std::endl << std::endl;
+    std::cout << "    -b --benchmark:" << std::endl;
+    std::cout << "        Read recording on separate thread and print latency report at the end" << std::endl << std::endl;
+    std::cout << "    -S --speed speed" << std::endl;
+    std::cout << "        Replay speed relative to recorded timestamps, 0 is as fast as possible, default: 0" << std::endl << std::endl;
+    std::cout << "    -o --benchmarkReport report" << std::endl;
+    std::cout << "        Benchmark JSON report file, default: standard output" << std::endl << std::endl;
+    std::cout << "    -B --benchmarkBaseline baseline" << std::endl;
+    std::cout << "        Benchmark JSON report of previous replay, speedup against it is added to report" << std::endl << std::endl;
+    std::cout << "    -a --autoBulk size" << std::endl;
+    std::cout << "        Replay runs of single create/remove/set operations as bulk calls of up to size objects, default: 0 (disabled)" << std::endl << std::endl;
     std::cout << "    -h --help:" << std::endl;
     std::cout << "        Print out this message" << std::endl << std::endl;
 }
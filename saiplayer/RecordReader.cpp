@@ -0,0 +1,223 @@
+#include "RecordReader.h"
+
+#include "BinaryRecord.h"
+
+#include "swss/logger.h"
+
+#include <time.h>
+#include <stdio.h>
+
+using namespace saiplayer;
+
+RecordReader::RecordReader(
+        _In_ const std::string& filename,
+        _In_ bool useThread,
+        _In_ size_t queueSize):
+    m_file(filename, std::ifstream::in | std::ifstream::binary),
+    m_useThread(useThread),
+    m_queueSize(queueSize),
+    m_eof(false),
+    m_stop(false)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_queueSize == 0)
+    {
+        SWSS_LOG_THROW("queue size must be positive");
+    }
+
+    if (m_file.is_open() && sairedis::BinaryRecord::isBinary(m_file))
+    {
+        SWSS_LOG_NOTICE("reading binary recording %s", filename.c_str());
+
+        m_binaryReader = std::make_shared<sairedis::BinaryRecordReader>(m_file);
+    }
+
+    if (m_useThread && m_file.is_open())
+    {
+        m_thread = std::make_shared<std::thread>(&RecordReader::threadFun, this);
+    }
+}
+
+RecordReader::~RecordReader()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_thread)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            m_stop = true;
+        }
+
+        m_cvNotFull.notify_all();
+
+        m_thread->join();
+    }
+}
+
+bool RecordReader::isOpen() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_file.is_open();
+}
+
+bool RecordReader::getline(
+        _Out_ std::string& line)
+{
+    SWSS_LOG_ENTER();
+
+    if (!m_useThread)
+    {
+        return readLine(line);
+    }
+
+    if (m_lines.empty())
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        m_cvNotEmpty.wait(lock, [&]{ return m_eof || !m_queue.empty(); });
+
+        if (m_queue.empty())
+        {
+            if (m_exception)
+            {
+                std::rethrow_exception(m_exception);
+            }
+
+            return false;
+        }
+
+        m_lines.swap(m_queue);
+
+        lock.unlock();
+
+        m_cvNotFull.notify_one();
+    }
+
+    line = std::move(m_lines.front());
+
+    m_lines.pop_front();
+
+    return true;
+}
+
+bool RecordReader::readLine(
+        _Out_ std::string& line)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_binaryReader)
+    {
+        return m_binaryReader->getline(line);
+    }
+
+    return (bool)std::getline(m_file, line);
+}
+
+void RecordReader::threadFun()
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_NOTICE("reader thread started");
+
+    std::vector<std::string> chunk;
+
+    chunk.reserve(READ_CHUNK_SIZE);
+
+    bool eof = false;
+
+    while (!eof)
+    {
+        std::string line;
+
+        while (chunk.size() < READ_CHUNK_SIZE)
+        {
+            try
+            {
+                if (!readLine(line))
+                {
+                    eof = true;
+                    break;
+                }
+            }
+            catch (const std::exception& e)
+            {
+                SWSS_LOG_ERROR("failed to read recording: %s", e.what());
+
+                // will be thrown to caller after already read lines
+
+                m_exception = std::current_exception();
+
+                eof = true;
+                break;
+            }
+
+            chunk.push_back(std::move(line));
+        }
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        m_cvNotFull.wait(lock, [&]{ return m_stop || m_queue.size() < m_queueSize; });
+
+        if (m_stop)
+        {
+            break;
+        }
+
+        for (auto& l: chunk)
+        {
+            m_queue.push_back(std::move(l));
+        }
+
+        chunk.clear();
+
+        m_eof = eof;
+
+        lock.unlock();
+
+        m_cvNotEmpty.notify_one();
+    }
+
+    SWSS_LOG_NOTICE("reader thread ended");
+}
+
+bool RecordReader::parseTimestamp(
+        _In_ const std::string& line,
+        _Out_ uint64_t& timestamp)
+{
+    SWSS_LOG_ENTER();
+
+    // 2017-04-19.22:34:16.946880|c|...
+
+    struct tm tm = {};
+
+    unsigned int usec = 0;
+
+    int n = 0;
+
+    if (sscanf(line.c_str(), "%4d-%2d-%2d.%2d:%2d:%2d.%6u%n",
+                &tm.tm_year, &tm.tm_mon, &tm.tm_mday,
+                &tm.tm_hour, &tm.tm_min, &tm.tm_sec, &usec, &n) != 7 || line[n] != '|')
+    {
+        return false;
+    }
+
+    tm.tm_year -= 1900;
+    tm.tm_mon -= 1;
+
+    // converted as UTC to not depend on daylight saving time changes
+
+    time_t seconds = timegm(&tm);
+
+    if (seconds == (time_t)-1)
+    {
+        return false;
+    }
+
+    timestamp = (uint64_t)seconds * 1000000 + usec;
+
+    return true;
+}
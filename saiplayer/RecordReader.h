@@ -0,0 +1,119 @@
+#pragma once
+
+#include "swss/sal.h"
+
+#include "BinaryRecordReader.h"
+
+#include <fstream>
+#include <string>
+#include <deque>
+#include <vector>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+
+namespace saiplayer
+{
+    /**
+     * @brief Recording file line reader.
+     *
+     * In synchronous mode lines are read directly from file by caller. In
+     * threaded mode lines are read by separate reader thread into bounded
+     * queue, so file reading and line splitting is overlapped with SAI calls
+     * executed by caller.
+     *
+     * Binary recording format is detected by content and converted to text
+     * lines, so caller is not aware of recording format.
+     */
+    class RecordReader
+    {
+        private:
+
+            RecordReader(const RecordReader&) = delete;
+            RecordReader& operator=(const RecordReader&) = delete;
+
+        public:
+
+            static constexpr size_t DEFAULT_QUEUE_SIZE = 16384;
+
+            /**
+             * @brief Number of lines reader thread is pushing to queue at once.
+             */
+            static constexpr size_t READ_CHUNK_SIZE = 256;
+
+        public:
+
+            RecordReader(
+                    _In_ const std::string& filename,
+                    _In_ bool useThread,
+                    _In_ size_t queueSize = DEFAULT_QUEUE_SIZE);
+
+            virtual ~RecordReader();
+
+        public:
+
+            bool isOpen() const;
+
+            /**
+             * @brief Get next line, same semantics as std::getline.
+             */
+            bool getline(
+                    _Out_ std::string& line);
+
+        public:
+
+            /**
+             * @brief Parse recording line timestamp to microseconds.
+             *
+             * Timestamp is in format written by recorder and it's only used
+             * to compute intervals between lines.
+             */
+            static bool parseTimestamp(
+                    _In_ const std::string& line,
+                    _Out_ uint64_t& timestamp);
+
+        private:
+
+            bool readLine(
+                    _Out_ std::string& line);
+
+            void threadFun();
+
+        private:
+
+            std::ifstream m_file;
+
+            std::shared_ptr<sairedis::BinaryRecordReader> m_binaryReader;
+
+            bool m_useThread;
+
+            size_t m_queueSize;
+
+            /**
+             * @brief Lines already taken from shared queue, used only by
+             * caller thread.
+             */
+            std::deque<std::string> m_lines;
+
+            std::deque<std::string> m_queue;
+
+            bool m_eof;
+
+            bool m_stop;
+
+            /**
+             * @brief Exception thrown while reading in reader thread.
+             */
+            std::exception_ptr m_exception;
+
+            std::mutex m_mutex;
+
+            std::condition_variable m_cvNotEmpty;
+
+            std::condition_variable m_cvNotFull;
+
+            std::shared_ptr<std::thread> m_thread;
+    };
+}
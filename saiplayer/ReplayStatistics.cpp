@@ -0,0 +1,336 @@
+#include "ReplayStatistics.h"
+
+#include "swss/logger.h"
+
+#include <nlohmann/json.hpp>
+
+#include <string.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <fstream>
+
+using namespace saiplayer;
+
+using json = nlohmann::json;
+
+ReplayStatistics::ReplayStatistics():
+    m_maxLag(0),
+    m_autoBulkOperations(0),
+    m_autoBulkCalls(0),
+    m_baselineLoaded(false),
+    m_baselineElapsed(0)
+{
+    SWSS_LOG_ENTER();
+
+    m_start = std::chrono::steady_clock::now();
+    m_stop = m_start;
+}
+
+void ReplayStatistics::start()
+{
+    SWSS_LOG_ENTER();
+
+    m_entries.clear();
+
+    m_maxLag = 0;
+
+    m_autoBulkOperations = 0;
+    m_autoBulkCalls = 0;
+
+    m_start = std::chrono::steady_clock::now();
+    m_stop = m_start;
+}
+
+void ReplayStatistics::stop()
+{
+    SWSS_LOG_ENTER();
+
+    m_stop = std::chrono::steady_clock::now();
+}
+
+size_t ReplayStatistics::getBucket(
+        _In_ uint64_t latency)
+{
+    SWSS_LOG_ENTER();
+
+    size_t bucket = 0;
+
+    while (latency > 1 && bucket < BUCKET_COUNT - 1)
+    {
+        latency >>= 1;
+        bucket++;
+    }
+
+    return bucket;
+}
+
+uint64_t ReplayStatistics::getBucketUpperBound(
+        _In_ size_t bucket)
+{
+    SWSS_LOG_ENTER();
+
+    return ((uint64_t)2 << bucket) - 1;
+}
+
+void ReplayStatistics::record(
+        _In_ const std::string& api,
+        _In_ const std::string& objectType,
+        _In_ uint64_t objectCount,
+        _In_ uint64_t latency)
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_entries.find(std::make_pair(api, objectType));
+
+    if (it == m_entries.end())
+    {
+        Entry entry;
+
+        memset(&entry, 0, sizeof(entry));
+
+        entry.m_min = UINT64_MAX;
+
+        it = m_entries.emplace(std::make_pair(api, objectType), entry).first;
+    }
+
+    Entry& entry = it->second;
+
+    entry.m_calls++;
+    entry.m_objects += objectCount;
+    entry.m_total += latency;
+    entry.m_min = std::min(entry.m_min, latency);
+    entry.m_max = std::max(entry.m_max, latency);
+    entry.m_buckets[getBucket(latency)]++;
+}
+
+void ReplayStatistics::recordAutoBulk(
+        _In_ uint64_t operations)
+{
+    SWSS_LOG_ENTER();
+
+    m_autoBulkOperations += operations;
+    m_autoBulkCalls++;
+}
+
+uint64_t ReplayStatistics::getAutoBulkOperations() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_autoBulkOperations;
+}
+
+uint64_t ReplayStatistics::getAutoBulkCalls() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_autoBulkCalls;
+}
+
+void ReplayStatistics::recordLag(
+        _In_ uint64_t lag)
+{
+    SWSS_LOG_ENTER();
+
+    m_maxLag = std::max(m_maxLag, lag);
+}
+
+std::string ReplayStatistics::getOperation(
+        _In_ const std::string& api)
+{
+    SWSS_LOG_ENTER();
+
+    const std::string bulk = "BULK_";
+
+    auto pos = api.find(bulk);
+
+    if (pos == std::string::npos)
+    {
+        return api;
+    }
+
+    return api.substr(0, pos) + api.substr(pos + bulk.size());
+}
+
+void ReplayStatistics::loadBaseline(
+        _In_ const std::string& file)
+{
+    SWSS_LOG_ENTER();
+
+    std::ifstream ifs(file);
+
+    if (!ifs.is_open())
+    {
+        SWSS_LOG_THROW("failed to open baseline report %s", file.c_str());
+    }
+
+    m_baseline.clear();
+
+    try
+    {
+        json report = json::parse(ifs);
+
+        m_baselineElapsed = report.at("summary").at("elapsed_us").get<uint64_t>();
+
+        for (auto& j: report.at("apis"))
+        {
+            auto key = std::make_pair(
+                    getOperation(j.at("api").get<std::string>()),
+                    j.at("object_type").get<std::string>());
+
+            auto& value = m_baseline[key];
+
+            value.first += j.at("total_us").get<uint64_t>();
+            value.second += j.at("objects").get<uint64_t>();
+        }
+    }
+    catch (const std::exception& e)
+    {
+        SWSS_LOG_THROW("failed to parse baseline report %s: %s", file.c_str(), e.what());
+    }
+
+    m_baselineLoaded = true;
+
+    SWSS_LOG_NOTICE("loaded baseline report %s with %zu operations", file.c_str(), m_baseline.size());
+}
+
+uint64_t ReplayStatistics::getPercentile(
+        _In_ const Entry& entry,
+        _In_ double percentile)
+{
+    SWSS_LOG_ENTER();
+
+    uint64_t rank = (uint64_t)((double)entry.m_calls * percentile);
+
+    uint64_t count = 0;
+
+    for (size_t i = 0; i < BUCKET_COUNT; i++)
+    {
+        count += entry.m_buckets[i];
+
+        if (count > rank)
+        {
+            return std::min(entry.m_max, getBucketUpperBound(i));
+        }
+    }
+
+    return entry.m_max;
+}
+
+std::string ReplayStatistics::getReport(
+        _In_ double speed) const
+{
+    SWSS_LOG_ENTER();
+
+    uint64_t elapsed = (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(m_stop - m_start).count();
+
+    uint64_t calls = 0;
+    uint64_t objects = 0;
+
+    json apis = json::array();
+
+    for (auto& kvp: m_entries)
+    {
+        const Entry& entry = kvp.second;
+
+        calls += entry.m_calls;
+        objects += entry.m_objects;
+
+        json histogram = json::array();
+
+        for (size_t i = 0; i < BUCKET_COUNT; i++)
+        {
+            if (entry.m_buckets[i])
+            {
+                histogram.push_back({ { "le_us", getBucketUpperBound(i) }, { "count", entry.m_buckets[i] } });
+            }
+        }
+
+        json j;
+
+        j["api"] = kvp.first.first;
+        j["object_type"] = kvp.first.second;
+        j["calls"] = entry.m_calls;
+        j["objects"] = entry.m_objects;
+        j["total_us"] = entry.m_total;
+        j["min_us"] = entry.m_min;
+        j["max_us"] = entry.m_max;
+        j["mean_us"] = (double)entry.m_total / (double)entry.m_calls;
+        j["mean_per_object_us"] = entry.m_objects ? (double)entry.m_total / (double)entry.m_objects : 0.0;
+        j["p50_us"] = getPercentile(entry, 0.50);
+        j["p90_us"] = getPercentile(entry, 0.90);
+        j["p99_us"] = getPercentile(entry, 0.99);
+        j["histogram"] = histogram;
+
+        apis.push_back(j);
+    }
+
+    double seconds = (double)elapsed / 1000000.0;
+
+    json summary;
+
+    summary["speed"] = speed;
+    summary["elapsed_us"] = elapsed;
+    summary["calls"] = calls;
+    summary["objects"] = objects;
+    summary["calls_per_sec"] = elapsed ? (double)calls / seconds : 0.0;
+    summary["objects_per_sec"] = elapsed ? (double)objects / seconds : 0.0;
+    summary["max_lag_us"] = m_maxLag;
+    summary["auto_bulk_operations"] = m_autoBulkOperations;
+    summary["auto_bulk_calls"] = m_autoBulkCalls;
+
+    json report;
+
+    report["summary"] = summary;
+    report["apis"] = apis;
+
+    if (m_baselineLoaded)
+    {
+        std::map<std::pair<std::string, std::string>, std::pair<uint64_t, uint64_t>> current;
+
+        for (auto& kvp: m_entries)
+        {
+            auto& value = current[std::make_pair(getOperation(kvp.first.first), kvp.first.second)];
+
+            value.first += kvp.second.m_total;
+            value.second += kvp.second.m_objects;
+        }
+
+        uint64_t baselineTotal = 0;
+        uint64_t currentTotal = 0;
+
+        json speedup = json::array();
+
+        for (auto& kvp: current)
+        {
+            auto it = m_baseline.find(kvp.first);
+
+            if (it == m_baseline.end() || it->second.second == 0 || kvp.second.second == 0 || kvp.second.first == 0)
+            {
+                continue;
+            }
+
+            baselineTotal += it->second.first;
+            currentTotal += kvp.second.first;
+
+            double baselinePerObject = (double)it->second.first / (double)it->second.second;
+            double currentPerObject = (double)kvp.second.first / (double)kvp.second.second;
+
+            json j;
+
+            j["operation"] = kvp.first.first;
+            j["object_type"] = kvp.first.second;
+            j["baseline_per_object_us"] = baselinePerObject;
+            j["per_object_us"] = currentPerObject;
+            j["speedup"] = baselinePerObject / currentPerObject;
+
+            speedup.push_back(j);
+        }
+
+        report["summary"]["api_speedup"] = currentTotal ? (double)baselineTotal / (double)currentTotal : 0.0;
+        report["summary"]["elapsed_speedup"] = elapsed ? (double)m_baselineElapsed / (double)elapsed : 0.0;
+        report["speedup"] = speedup;
+    }
+
+    return report.dump(4);
+}
@@ -0,0 +1,147 @@
+#pragma once
+
+#include "swss/sal.h"
+
+#include <string>
+#include <map>
+#include <chrono>
+
+namespace saiplayer
+{
+    /**
+     * @brief Replay latency and throughput statistics.
+     *
+     * Latencies are collected per (api, object type) pair into histogram
+     * with power of 2 microsecond buckets, so percentiles in report are
+     * upper bounds of bucket they fall into.
+     *
+     * When baseline report is loaded, per object latency of each operation
+     * is compared with baseline, single and bulk api of the same operation
+     * are compared with each other, so gain of bulk api can be measured by
+     * replaying the same recording with and without auto bulk.
+     */
+    class ReplayStatistics
+    {
+        public:
+
+            /**
+             * @brief Number of histogram buckets, bucket N holds latencies
+             * in range [2^N, 2^(N+1)) microseconds, bucket 0 holds also 0.
+             */
+            static constexpr size_t BUCKET_COUNT = 32;
+
+        public:
+
+            ReplayStatistics();
+
+            virtual ~ReplayStatistics() = default;
+
+        public:
+
+            void start();
+
+            void stop();
+
+            /**
+             * @brief Record single API call.
+             *
+             * @param api API name.
+             * @param objectType Object type name.
+             * @param objectCount Number of objects processed, greater than 1 for bulk API.
+             * @param latency Call latency in microseconds.
+             */
+            void record(
+                    _In_ const std::string& api,
+                    _In_ const std::string& objectType,
+                    _In_ uint64_t objectCount,
+                    _In_ uint64_t latency);
+
+            /**
+             * @brief Record single operations merged into one bulk call.
+             */
+            void recordAutoBulk(
+                    _In_ uint64_t operations);
+
+            uint64_t getAutoBulkOperations() const;
+
+            uint64_t getAutoBulkCalls() const;
+
+            /**
+             * @brief Record how much replay is behind recorded schedule.
+             */
+            void recordLag(
+                    _In_ uint64_t lag);
+
+            /**
+             * @brief Get report as JSON string.
+             */
+            std::string getReport(
+                    _In_ double speed) const;
+
+            /**
+             * @brief Load report generated by previous replay as baseline.
+             */
+            void loadBaseline(
+                    _In_ const std::string& file);
+
+        public:
+
+            static size_t getBucket(
+                    _In_ uint64_t latency);
+
+            static uint64_t getBucketUpperBound(
+                    _In_ size_t bucket);
+
+            /**
+             * @brief Get operation name of api, bulk api has the same
+             * operation as single api.
+             */
+            static std::string getOperation(
+                    _In_ const std::string& api);
+
+        private:
+
+            struct Entry
+            {
+                uint64_t m_calls;
+
+                uint64_t m_objects;
+
+                uint64_t m_total;
+
+                uint64_t m_min;
+
+                uint64_t m_max;
+
+                uint64_t m_buckets[BUCKET_COUNT];
+            };
+
+            static uint64_t getPercentile(
+                    _In_ const Entry& entry,
+                    _In_ double percentile);
+
+        private:
+
+            std::map<std::pair<std::string, std::string>, Entry> m_entries;
+
+            uint64_t m_maxLag;
+
+            uint64_t m_autoBulkOperations;
+
+            uint64_t m_autoBulkCalls;
+
+            /**
+             * @brief Baseline total latency and object count by operation
+             * and object type.
+             */
+            std::map<std::pair<std::string, std::string>, std::pair<uint64_t, uint64_t>> m_baseline;
+
+            bool m_baselineLoaded;
+
+            uint64_t m_baselineElapsed;
+
+            std::chrono::time_point<std::chrono::steady_clock> m_start;
+
+            std::chrono::time_point<std::chrono::steady_clock> m_stop;
+    };
+}
@@ -20,6 +20,7 @@
 #include <stdexcept>
 #include <sstream>
 #include <string>
+#include <thread>
 
 /*
  * Since this is player, we record actions from orchagent.  No special case
@@ -64,7 +65,12 @@ SaiPlayer::SaiPlayer(
         _In_ std::shared_ptr<sairedis::SaiInterface> sai,
         _In_ std::shared_ptr<CommandLineOptions> cmd):
     m_sai(sai),
-    m_commandLineOptions(cmd)
+    m_commandLineOptions(cmd),
+    m_paceStarted(false),
+    m_paceFirstTimestamp(0),
+    m_autoBulkApi(SAI_COMMON_API_CREATE),
+    m_autoBulkObjectType(SAI_OBJECT_TYPE_NULL),
+    m_autoBulkSwitchId(SAI_NULL_OBJECT_ID)
 {
     SWSS_LOG_ENTER();
 
@@ -2579,9 +2585,11 @@ sai_status_t SaiPlayer::handle_bulk_object(
                                             ids.data(),
                                             statuses.data());
 
-            if (status == SAI_STATUS_SUCCESS)
+            for (uint32_t it = 0; it < object_count; it++)
             {
-                for (uint32_t it = 0; it < object_count; it++)
+                // with ignore error mode some objects may be created even if bulk failed
+
+                if (statuses[it] == SAI_STATUS_SUCCESS && ids[it] != SAI_NULL_OBJECT_ID)
                 {
                     match_redis_with_rec(ids[it], local_ids[it]);
 
@@ -2671,6 +2679,57 @@ sai_status_t SaiPlayer::handle_bulk_object(
     return status;
 }
 
+sai_status_t SaiPlayer::execute_bulk(
+        _In_ sai_object_type_t object_type,
+        _In_ const std::vector<std::string> &object_ids,
+        _In_ sai_common_api_t api,
+        _In_ const std::vector<std::shared_ptr<SaiAttributeList>> &attributes,
+        _Out_ std::vector<sai_status_t> &statuses)
+{
+    SWSS_LOG_ENTER();
+
+    sai_status_t status = SAI_STATUS_SUCCESS;
+
+    auto info = sai_metadata_get_object_type_info(object_type);
+
+    auto callStart = std::chrono::steady_clock::now();
+
+    switch ((int)object_type)
+    {
+        case SAI_OBJECT_TYPE_ROUTE_ENTRY:
+        case SAI_OBJECT_TYPE_NEIGHBOR_ENTRY:
+        case SAI_OBJECT_TYPE_FDB_ENTRY:
+        case SAI_OBJECT_TYPE_NAT_ENTRY:
+        case SAI_OBJECT_TYPE_DIRECTION_LOOKUP_ENTRY:
+        case SAI_OBJECT_TYPE_ENI_ETHER_ADDRESS_MAP_ENTRY:
+        case SAI_OBJECT_TYPE_VIP_ENTRY:
+        case SAI_OBJECT_TYPE_INBOUND_ROUTING_ENTRY:
+        case SAI_OBJECT_TYPE_PA_VALIDATION_ENTRY:
+        case SAI_OBJECT_TYPE_OUTBOUND_ROUTING_ENTRY:
+        case SAI_OBJECT_TYPE_OUTBOUND_CA_TO_PA_ENTRY:
+        case SAI_OBJECT_TYPE_OUTBOUND_PORT_MAP_PORT_RANGE_ENTRY:
+        case SAI_OBJECT_TYPE_GLOBAL_TRUSTED_VNI_ENTRY:
+        case SAI_OBJECT_TYPE_ENI_TRUSTED_VNI_ENTRY:
+            status = handle_bulk_entry(object_ids, object_type, api, attributes, statuses);
+            break;
+
+        default:
+
+            if (info->isnonobjectid)
+            {
+                SWSS_LOG_THROW("object %s is non object id, but not handled, FIXME",
+                        sai_serialize_object_type(object_type).c_str());
+            }
+
+            status = handle_bulk_object(object_type, object_ids, api, attributes, statuses);
+            break;
+    }
+
+    recordLatency(sai_serialize_common_api(api), object_type, object_ids.size(), callStart);
+
+    return status;
+}
+
 void SaiPlayer::processBulk(
         _In_ sai_common_api_t api,
         _In_ const std::string &line)
@@ -2761,40 +2820,7 @@ void SaiPlayer::processBulk(
         attributes.push_back(list);
     }
 
-    sai_status_t status = SAI_STATUS_SUCCESS;
-
-    auto info = sai_metadata_get_object_type_info(object_type);
-
-    switch ((int)object_type)
-    {
-        case SAI_OBJECT_TYPE_ROUTE_ENTRY:
-        case SAI_OBJECT_TYPE_NEIGHBOR_ENTRY:
-        case SAI_OBJECT_TYPE_FDB_ENTRY:
-        case SAI_OBJECT_TYPE_NAT_ENTRY:
-        case SAI_OBJECT_TYPE_DIRECTION_LOOKUP_ENTRY:
-        case SAI_OBJECT_TYPE_ENI_ETHER_ADDRESS_MAP_ENTRY:
-        case SAI_OBJECT_TYPE_VIP_ENTRY:
-        case SAI_OBJECT_TYPE_INBOUND_ROUTING_ENTRY:
-        case SAI_OBJECT_TYPE_PA_VALIDATION_ENTRY:
-        case SAI_OBJECT_TYPE_OUTBOUND_ROUTING_ENTRY:
-        case SAI_OBJECT_TYPE_OUTBOUND_CA_TO_PA_ENTRY:
-        case SAI_OBJECT_TYPE_OUTBOUND_PORT_MAP_PORT_RANGE_ENTRY:
-        case SAI_OBJECT_TYPE_GLOBAL_TRUSTED_VNI_ENTRY:
-        case SAI_OBJECT_TYPE_ENI_TRUSTED_VNI_ENTRY:
-            status = handle_bulk_entry(object_ids, object_type, api, attributes, statuses);
-            break;
-
-        default:
-
-            if (info->isnonobjectid)
-            {
-                SWSS_LOG_THROW("object %s is non object id, but not handled, FIXME",
-                        sai_serialize_object_type(object_type).c_str());
-            }
-
-            status = handle_bulk_object(object_type, object_ids, api, attributes, statuses);
-            break;
-    }
+    sai_status_t status = execute_bulk(object_type, object_ids, api, attributes, statuses);
 
     if (api == SAI_COMMON_API_BULK_GET)
     {
@@ -2803,7 +2829,7 @@ void SaiPlayer::processBulk(
         do
         {
             // this line may be notification, we need to skip
-            std::getline(m_infile, response);
+            m_reader->getline(response);
         }
         while (response[response.find_first_of("|") + 1] == 'n');
 
@@ -2892,6 +2918,398 @@ void SaiPlayer::processBulk(
     }
 }
 
+bool SaiPlayer::is_auto_bulk_supported(
+        _In_ sai_common_api_t api,
+        _In_ sai_object_type_t object_type)
+{
+    SWSS_LOG_ENTER();
+
+    if (api != SAI_COMMON_API_CREATE &&
+            api != SAI_COMMON_API_REMOVE &&
+            api != SAI_COMMON_API_SET)
+    {
+        return false;
+    }
+
+    switch ((int)object_type)
+    {
+        case SAI_OBJECT_TYPE_SWITCH:
+
+            // switch create and set need notification pointers update
+            return false;
+
+        case SAI_OBJECT_TYPE_PORT:
+        case SAI_OBJECT_TYPE_SCHEDULER_GROUP:
+        case SAI_OBJECT_TYPE_INGRESS_PRIORITY_GROUP:
+
+            // bulk api on those is not supported by syncd in init view mode
+            return false;
+
+        case SAI_OBJECT_TYPE_ROUTE_ENTRY:
+        case SAI_OBJECT_TYPE_NEIGHBOR_ENTRY:
+        case SAI_OBJECT_TYPE_FDB_ENTRY:
+        case SAI_OBJECT_TYPE_NAT_ENTRY:
+        case SAI_OBJECT_TYPE_DIRECTION_LOOKUP_ENTRY:
+        case SAI_OBJECT_TYPE_ENI_ETHER_ADDRESS_MAP_ENTRY:
+        case SAI_OBJECT_TYPE_VIP_ENTRY:
+        case SAI_OBJECT_TYPE_INBOUND_ROUTING_ENTRY:
+        case SAI_OBJECT_TYPE_PA_VALIDATION_ENTRY:
+        case SAI_OBJECT_TYPE_OUTBOUND_ROUTING_ENTRY:
+        case SAI_OBJECT_TYPE_OUTBOUND_CA_TO_PA_ENTRY:
+        case SAI_OBJECT_TYPE_OUTBOUND_PORT_MAP_PORT_RANGE_ENTRY:
+        case SAI_OBJECT_TYPE_GLOBAL_TRUSTED_VNI_ENTRY:
+        case SAI_OBJECT_TYPE_ENI_TRUSTED_VNI_ENTRY:
+            return true;
+
+        default:
+            break;
+    }
+
+    auto info = sai_metadata_get_object_type_info(object_type);
+
+    return info != NULL && info->isobjectid;
+}
+
+bool SaiPlayer::references_objects(
+        _In_ sai_object_type_t object_type,
+        _In_ uint32_t attr_count,
+        _In_ const sai_attribute_t *attr_list,
+        _In_ const std::set<sai_object_id_t> &objects)
+{
+    SWSS_LOG_ENTER();
+
+    if (objects.empty())
+    {
+        return false;
+    }
+
+    for (uint32_t i = 0; i < attr_count; i++)
+    {
+        const sai_attribute_t &attr = attr_list[i];
+
+        auto meta = sai_metadata_get_attr_metadata(object_type, attr.id);
+
+        if (meta == NULL || !meta->isoidattribute)
+        {
+            continue;
+        }
+
+        uint32_t count = 0;
+
+        const sai_object_id_t *list = NULL;
+
+        switch (meta->attrvaluetype)
+        {
+            case SAI_ATTR_VALUE_TYPE_OBJECT_ID:
+                count = 1;
+                list = &attr.value.oid;
+                break;
+
+            case SAI_ATTR_VALUE_TYPE_OBJECT_LIST:
+                count = attr.value.objlist.count;
+                list = attr.value.objlist.list;
+                break;
+
+            case SAI_ATTR_VALUE_TYPE_ACL_FIELD_DATA_OBJECT_ID:
+                if (attr.value.aclfield.enable)
+                {
+                    count = 1;
+                    list = &attr.value.aclfield.data.oid;
+                }
+                break;
+
+            case SAI_ATTR_VALUE_TYPE_ACL_FIELD_DATA_OBJECT_LIST:
+                if (attr.value.aclfield.enable)
+                {
+                    count = attr.value.aclfield.data.objlist.count;
+                    list = attr.value.aclfield.data.objlist.list;
+                }
+                break;
+
+            case SAI_ATTR_VALUE_TYPE_ACL_ACTION_DATA_OBJECT_ID:
+                if (attr.value.aclaction.enable)
+                {
+                    count = 1;
+                    list = &attr.value.aclaction.parameter.oid;
+                }
+                break;
+
+            case SAI_ATTR_VALUE_TYPE_ACL_ACTION_DATA_OBJECT_LIST:
+                if (attr.value.aclaction.enable)
+                {
+                    count = attr.value.aclaction.parameter.objlist.count;
+                    list = attr.value.aclaction.parameter.objlist.list;
+                }
+                break;
+
+            default:
+
+                // unknown oid attribute, assume dependency
+                return true;
+        }
+
+        for (uint32_t idx = 0; idx < count; idx++)
+        {
+            if (objects.find(list[idx]) != objects.end())
+            {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+bool SaiPlayer::auto_bulk_add(
+        _In_ sai_common_api_t api,
+        _In_ const std::string &line)
+{
+    SWSS_LOG_ENTER();
+
+    // timestamp|action|objecttype:objectid|attrid=value,...
+    auto fields = swss::tokenize(line, '|');
+
+    // objecttype:objectid (object id may contain ':')
+    auto start = fields.at(2).find_first_of(":");
+
+    auto str_object_type = fields[2].substr(0, start);
+    auto str_object_id  = fields[2].substr(start + 1);
+
+    sai_object_type_t object_type = deserialize_object_type(str_object_type);
+
+    if (!is_auto_bulk_supported(api, object_type))
+    {
+        auto_bulk_flush();
+
+        return false;
+    }
+
+    auto list = std::make_shared<SaiAttributeList>(object_type, get_values(fields), false);
+
+    sai_object_id_t local_id = SAI_NULL_OBJECT_ID;
+    sai_object_id_t switch_id = SAI_NULL_OBJECT_ID;
+
+    if (api == SAI_COMMON_API_CREATE && sai_metadata_get_object_type_info(object_type)->isobjectid)
+    {
+        // bulk create of object ids requires all objects on the same switch
+
+        sai_deserialize_object_id(str_object_id, local_id);
+
+        switch_id = m_sai->switchIdQuery(local_id);
+    }
+
+    if (m_autoBulkObjectIds.size() &&
+            (api != m_autoBulkApi ||
+             object_type != m_autoBulkObjectType ||
+             switch_id != m_autoBulkSwitchId ||
+             m_autoBulkObjectIds.size() >= m_commandLineOptions->m_autoBulkSize ||
+             m_autoBulkPendingIds.find(str_object_id) != m_autoBulkPendingIds.end() ||
+             references_objects(object_type, list->get_attr_count(), list->get_attr_list(), m_autoBulkCreated)))
+    {
+        auto_bulk_flush();
+    }
+
+    // all referenced objects are created at this point
+
+    translate_local_to_redis(object_type, list->get_attr_count(), list->get_attr_list());
+
+    m_autoBulkApi = api;
+    m_autoBulkObjectType = object_type;
+    m_autoBulkSwitchId = switch_id;
+
+    m_autoBulkObjectIds.push_back(str_object_id);
+    m_autoBulkAttributes.push_back(list);
+    m_autoBulkPendingIds.insert(str_object_id);
+
+    // status is recorded only when operation failed
+
+    m_autoBulkRecordedStatuses.push_back(SAI_STATUS_SUCCESS);
+
+    if (local_id != SAI_NULL_OBJECT_ID)
+    {
+        m_autoBulkCreated.insert(local_id);
+    }
+
+    return true;
+}
+
+void SaiPlayer::auto_bulk_status(
+        _In_ const std::string &line)
+{
+    SWSS_LOG_ENTER();
+
+    // timestamp|E|status
+
+    auto fields = swss::tokenize(line, '|');
+
+    if (m_autoBulkRecordedStatuses.empty() || fields.size() < 3)
+    {
+        SWSS_LOG_THROW("unexpected status line %s", line.c_str());
+    }
+
+    sai_deserialize_status(fields[2], m_autoBulkRecordedStatuses.back());
+}
+
+void SaiPlayer::auto_bulk_flush()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_autoBulkObjectIds.empty())
+    {
+        return;
+    }
+
+    sai_common_api_t api;
+
+    switch (m_autoBulkApi)
+    {
+        case SAI_COMMON_API_CREATE:
+            api = SAI_COMMON_API_BULK_CREATE;
+            break;
+
+        case SAI_COMMON_API_REMOVE:
+            api = SAI_COMMON_API_BULK_REMOVE;
+            break;
+
+        case SAI_COMMON_API_SET:
+            api = SAI_COMMON_API_BULK_SET;
+            break;
+
+        default:
+            SWSS_LOG_THROW("api %s is not supported by auto bulk",
+                    sai_serialize_common_api(m_autoBulkApi).c_str());
+    }
+
+    SWSS_LOG_INFO("executing auto bulk %s %s, count = %zu",
+            sai_serialize_common_api(api).c_str(),
+            sai_serialize_object_type(m_autoBulkObjectType).c_str(),
+            m_autoBulkObjectIds.size());
+
+    std::vector<sai_status_t> statuses(m_autoBulkObjectIds.size());
+
+    sai_status_t status = execute_bulk(m_autoBulkObjectType, m_autoBulkObjectIds, api, m_autoBulkAttributes, statuses);
+
+    m_statistics.recordAutoBulk(m_autoBulkObjectIds.size());
+
+    // even if API will fail, we need to compare all statuses for each entry
+
+    for (size_t i = 0; i < statuses.size(); ++i)
+    {
+        if (statuses[i] != m_autoBulkRecordedStatuses[i])
+        {
+            SWSS_LOG_THROW("recorded status is %s but returned is %s on %s:%s",
+                    sai_serialize_status(m_autoBulkRecordedStatuses[i]).c_str(),
+                    sai_serialize_status(statuses[i]).c_str(),
+                    sai_serialize_object_type(m_autoBulkObjectType).c_str(),
+                    m_autoBulkObjectIds[i].c_str());
+        }
+    }
+
+    if (status != SAI_STATUS_SUCCESS)
+    {
+        SWSS_LOG_NOTICE("auto bulk returned %s, but object statuses match recording",
+                sai_serialize_status(status).c_str());
+    }
+
+    m_autoBulkObjectIds.clear();
+    m_autoBulkAttributes.clear();
+    m_autoBulkRecordedStatuses.clear();
+    m_autoBulkCreated.clear();
+    m_autoBulkPendingIds.clear();
+}
+
+void SaiPlayer::pace(
+        _In_ const std::string& line)
+{
+    SWSS_LOG_ENTER();
+
+    double speed = m_commandLineOptions->m_speed;
+
+    if (speed <= 0)
+    {
+        return;
+    }
+
+    uint64_t timestamp;
+
+    if (!RecordReader::parseTimestamp(line, timestamp))
+    {
+        SWSS_LOG_WARN("failed to parse timestamp on line %s, not pacing", line.c_str());
+        return;
+    }
+
+    auto now = std::chrono::steady_clock::now();
+
+    if (!m_paceStarted || timestamp < m_paceFirstTimestamp)
+    {
+        // first line or recording clock went backwards, start new schedule
+
+        m_paceStarted = true;
+        m_paceFirstTimestamp = timestamp;
+        m_paceStart = now;
+        return;
+    }
+
+    auto offset = (double)(timestamp - m_paceFirstTimestamp) / speed;
+
+    auto deadline = m_paceStart + std::chrono::microseconds((uint64_t)offset);
+
+    if (deadline > now)
+    {
+        std::this_thread::sleep_until(deadline);
+    }
+    else
+    {
+        auto lag = std::chrono::duration_cast<std::chrono::microseconds>(now - deadline).count();
+
+        m_statistics.recordLag((uint64_t)lag);
+    }
+}
+
+void SaiPlayer::recordLatency(
+        _In_ const std::string& api,
+        _In_ sai_object_type_t objectType,
+        _In_ uint64_t objectCount,
+        _In_ const std::chrono::time_point<std::chrono::steady_clock>& start)
+{
+    SWSS_LOG_ENTER();
+
+    if (!m_commandLineOptions->m_benchmark)
+    {
+        return;
+    }
+
+    auto latency = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+    m_statistics.record(api, sai_serialize_object_type(objectType), objectCount, (uint64_t)latency);
+}
+
+void SaiPlayer::writeBenchmarkReport()
+{
+    SWSS_LOG_ENTER();
+
+    auto report = m_statistics.getReport(m_commandLineOptions->m_speed);
+
+    auto& file = m_commandLineOptions->m_benchmarkReport;
+
+    if (file.empty())
+    {
+        std::cout << report << std::endl;
+        return;
+    }
+
+    std::ofstream ofs(file);
+
+    if (!ofs.is_open())
+    {
+        SWSS_LOG_THROW("failed to open benchmark report file %s", file.c_str());
+    }
+
+    ofs << report << std::endl;
+
+    SWSS_LOG_NOTICE("benchmark report written to %s", file.c_str());
+}
+
 int SaiPlayer::replay()
 {
     //swss::Logger::getInstance().setMinPrio(swss::Logger::SWSS_DEBUG);
@@ -2909,17 +3327,26 @@ int SaiPlayer::replay()
 
     SWSS_LOG_NOTICE("using file: %s", filename.c_str());
 
-    m_infile = std::ifstream{filename};
+    m_reader = std::make_shared<RecordReader>(filename, m_commandLineOptions->m_benchmark);
 
-    if (!m_infile.is_open())
+    if (!m_reader->isOpen())
     {
         SWSS_LOG_ERROR("failed to open file %s", filename.c_str());
         return -1;
     }
 
+    m_paceStarted = false;
+
+    if (m_commandLineOptions->m_benchmarkBaseline.size())
+    {
+        m_statistics.loadBaseline(m_commandLineOptions->m_benchmarkBaseline);
+    }
+
+    m_statistics.start();
+
     std::string line;
 
-    while (std::getline(m_infile, line))
+    while (m_reader->getline(line))
     {
         // std::cout << "processing " << line << std::endl;
 
@@ -2929,6 +3356,36 @@ int SaiPlayer::replay()
 
         char op = line[p+1];
 
+        if (op && strchr("afcrsgBSCR", op))
+        {
+            pace(line);
+        }
+
+        if (m_commandLineOptions->m_autoBulkSize)
+        {
+            if (op == 'E' && m_autoBulkObjectIds.size())
+            {
+                auto_bulk_status(line);
+                continue;
+            }
+
+            if (op == 'c' && auto_bulk_add(SAI_COMMON_API_CREATE, line))
+                continue;
+
+            if (op == 'r' && auto_bulk_add(SAI_COMMON_API_REMOVE, line))
+                continue;
+
+            if (op == 's' && auto_bulk_add(SAI_COMMON_API_SET, line))
+                continue;
+
+            if (op != '#' && op != 'n' && op != 'q' && op != 'Q' && op != 'p')
+            {
+                // this operation may depend on pending operations
+
+                auto_bulk_flush();
+            }
+        }
+
         switch (op)
         {
             case 'a':
@@ -2938,14 +3395,18 @@ int SaiPlayer::replay()
                     do
                     {
                         // this line may be notification, we need to skip
-                        if (!std::getline(m_infile, response))
+                        if (!m_reader->getline(response))
                         {
                             SWSS_LOG_THROW("failed to read next file from file, previous: %s", line.c_str());
                         }
                     }
                     while (response[response.find_first_of("|") + 1] == 'n');
 
+                    auto callStart = std::chrono::steady_clock::now();
+
                     performNotifySyncd(line, response);
+
+                    recordLatency("NOTIFY_SYNCD", SAI_OBJECT_TYPE_SWITCH, 1, callStart);
                 }
                 continue;
 
@@ -2956,14 +3417,18 @@ int SaiPlayer::replay()
                     do
                     {
                         // this line may be notification, we need to skip
-                        if (!std::getline(m_infile, response))
+                        if (!m_reader->getline(response))
                         {
                             SWSS_LOG_THROW("failed to read next file from file, previous: %s", line.c_str());
                         }
                     }
                     while (response[response.find_first_of("|") + 1] == 'n');
 
+                    auto callStart = std::chrono::steady_clock::now();
+
                     performFdbFlush(line, response);
+
+                    recordLatency("FLUSH", SAI_OBJECT_TYPE_FDB_FLUSH, 1, callStart);
                 }
                 continue;
 
@@ -3041,6 +3506,8 @@ int SaiPlayer::replay()
 
         auto info = sai_metadata_get_object_type_info(object_type);
 
+        auto callStart = std::chrono::steady_clock::now();
+
         switch ((int)object_type)
         {
             case SAI_OBJECT_TYPE_FDB_ENTRY:
@@ -3112,6 +3579,8 @@ int SaiPlayer::replay()
                 break;
         }
 
+        recordLatency(sai_serialize_common_api(api), object_type, 1, callStart);
+
         if (status != SAI_STATUS_SUCCESS)
         {
             if (api == SAI_COMMON_API_GET)
@@ -3129,7 +3598,7 @@ int SaiPlayer::replay()
             do
             {
                 // this line may be notification, we need to skip
-                std::getline(m_infile, response);
+                m_reader->getline(response);
             }
             while (response[response.find_first_of("|") + 1] == 'n');
 
@@ -3174,10 +3643,26 @@ int SaiPlayer::replay()
         }
     }
 
-    m_infile.close();
+    auto_bulk_flush();
+
+    m_reader = nullptr;
+
+    m_statistics.stop();
+
+    if (m_commandLineOptions->m_autoBulkSize)
+    {
+        SWSS_LOG_NOTICE("auto bulk replayed %" PRIu64 " single operations in %" PRIu64 " bulk calls",
+                m_statistics.getAutoBulkOperations(),
+                m_statistics.getAutoBulkCalls());
+    }
 
     SWSS_LOG_NOTICE("finished replaying %s with SUCCESS", filename.c_str());
 
+    if (m_commandLineOptions->m_benchmark)
+    {
+        writeBenchmarkReport();
+    }
+
     if (m_commandLineOptions->m_sleep)
     {
         fprintf(stderr, "Reply SUCCESS, sleeping, watching for notifications\n");
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "CommandLineOptions.h"
+#include "RecordReader.h"
+#include "ReplayStatistics.h"
 
 #include "meta/SaiInterface.h"
 #include "meta/SaiAttributeList.h"
@@ -9,7 +11,9 @@
 
 #include <fstream>
 #include <memory>
+#include <chrono>
 #include <map>
+#include <set>
 
 namespace saiplayer
 {
@@ -36,10 +40,66 @@ namespace saiplayer
 
             int replay();
 
+            /**
+             * @brief Wait until line should be executed according to its
+             * recorded timestamp and replay speed.
+             */
+            void pace(
+                    _In_ const std::string& line);
+
+            void recordLatency(
+                    _In_ const std::string& api,
+                    _In_ sai_object_type_t objectType,
+                    _In_ uint64_t objectCount,
+                    _In_ const std::chrono::time_point<std::chrono::steady_clock>& start);
+
+            void writeBenchmarkReport();
+
             void processBulk(
                     _In_ sai_common_api_t api,
                     _In_ const std::string &line);
 
+            sai_status_t execute_bulk(
+                    _In_ sai_object_type_t object_type,
+                    _In_ const std::vector<std::string> &object_ids,
+                    _In_ sai_common_api_t api,
+                    _In_ const std::vector<std::shared_ptr<saimeta::SaiAttributeList>> &attributes,
+                    _Out_ std::vector<sai_status_t> &statuses);
+
+            /**
+             * @brief Add single create/remove/set operation to auto bulk.
+             *
+             * Pending operations are flushed when operation can't be merged
+             * with them, because of different api, object type or switch,
+             * because it references object created by pending operations, or
+             * because its object is already used by pending operation.
+             *
+             * @return False if operation object type is not supported by
+             * bulk, in that case pending operations are flushed and
+             * operation must be executed as single operation.
+             */
+            bool auto_bulk_add(
+                    _In_ sai_common_api_t api,
+                    _In_ const std::string &line);
+
+            /**
+             * @brief Set recorded status of last pending auto bulk operation.
+             */
+            void auto_bulk_status(
+                    _In_ const std::string &line);
+
+            void auto_bulk_flush();
+
+            bool is_auto_bulk_supported(
+                    _In_ sai_common_api_t api,
+                    _In_ sai_object_type_t object_type);
+
+            bool references_objects(
+                    _In_ sai_object_type_t object_type,
+                    _In_ uint32_t attr_count,
+                    _In_ const sai_attribute_t *attr_list,
+                    _In_ const std::set<sai_object_id_t> &objects);
+
             sai_status_t handle_bulk_route(
                     _In_ const std::vector<std::string> &object_ids,
                     _In_ sai_common_api_t api,
@@ -290,7 +350,45 @@ namespace saiplayer
 
             std::shared_ptr<CommandLineOptions> m_commandLineOptions;
 
-            std::ifstream m_infile;
+            std::shared_ptr<RecordReader> m_reader;
+
+            ReplayStatistics m_statistics;
+
+            bool m_paceStarted;
+
+            uint64_t m_paceFirstTimestamp;
+
+            std::chrono::time_point<std::chrono::steady_clock> m_paceStart;
+
+            /*
+             * Pending auto bulk operations, all have the same api, object
+             * type and switch.
+             */
+
+            sai_common_api_t m_autoBulkApi;
+
+            sai_object_type_t m_autoBulkObjectType;
+
+            sai_object_id_t m_autoBulkSwitchId;
+
+            std::vector<std::string> m_autoBulkObjectIds;
+
+            std::vector<std::shared_ptr<saimeta::SaiAttributeList>> m_autoBulkAttributes;
+
+            std::vector<sai_status_t> m_autoBulkRecordedStatuses;
+
+            /**
+             * @brief Local object ids created by pending operations.
+             */
+            std::set<sai_object_id_t> m_autoBulkCreated;
+
+            /**
+             * @brief Serialized object ids of pending operations.
+             *
+             * Bulk api don't define order of operations on the same object,
+             * so second operation on pending object starts new bulk.
+             */
+            std::set<std::string> m_autoBulkPendingIds;
 
             std::map<sai_object_id_t,sai_object_id_t> m_local_to_redis;
             std::map<sai_object_id_t,sai_object_id_t> m_redis_to_local;
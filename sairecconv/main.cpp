@@ -0,0 +1,246 @@
+#include "BinaryRecord.h"
+#include "BinaryRecordReader.h"
+#include "BinaryRecordWriter.h"
+
+#include "swss/logger.h"
+
+#include <getopt.h>
+#include <time.h>
+#include <stdio.h>
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace sairedis;
+
+void print_usage()
+{
+    SWSS_LOG_ENTER();
+
+    std::cerr << "Usage: sairecconv [-b] [-o output] file [file ...]" << std::endl << std::endl;
+    std::cerr << "    Converts binary sairedis recording to text format. Multiple files" << std::endl;
+    std::cerr << "    (for example rotated recordings) are converted in given order." << std::endl << std::endl;
+    std::cerr << "    -b --binary:" << std::endl;
+    std::cerr << "        Convert text recording to binary format" << std::endl;
+    std::cerr << "    -o --output:" << std::endl;
+    std::cerr << "        Output file, default is standard output" << std::endl;
+    std::cerr << "    -h --help:" << std::endl;
+    std::cerr << "        Print out this message" << std::endl;
+}
+
+/**
+ * @brief Parse text recording line timestamp as local time.
+ *
+ * Timestamp is converted back to the same value that recorder had, except
+ * hour repeated when daylight saving time ends, which is ambiguous.
+ */
+bool parse_timestamp(
+        _In_ const std::string& line,
+        _Out_ uint64_t& timestamp,
+        _Out_ size_t& size)
+{
+    SWSS_LOG_ENTER();
+
+    struct tm tm = {};
+
+    unsigned int usec = 0;
+
+    int n = 0;
+
+    if (sscanf(line.c_str(), "%4d-%2d-%2d.%2d:%2d:%2d.%6u%n",
+                &tm.tm_year, &tm.tm_mon, &tm.tm_mday,
+                &tm.tm_hour, &tm.tm_min, &tm.tm_sec, &usec, &n) != 7 || line[n] != '|')
+    {
+        return false;
+    }
+
+    tm.tm_year -= 1900;
+    tm.tm_mon -= 1;
+    tm.tm_isdst = -1;
+
+    time_t seconds = mktime(&tm);
+
+    if (seconds == (time_t)-1)
+    {
+        return false;
+    }
+
+    timestamp = (uint64_t)seconds * 1000000 + usec;
+
+    size = (size_t)n;
+
+    return true;
+}
+
+bool convert_to_text(
+        _In_ const std::string& file,
+        _In_ std::ostream& out)
+{
+    SWSS_LOG_ENTER();
+
+    std::ifstream in(file, std::ifstream::in | std::ifstream::binary);
+
+    if (!in.is_open())
+    {
+        std::cerr << "failed to open " << file << std::endl;
+        return false;
+    }
+
+    if (!BinaryRecord::isBinary(in))
+    {
+        std::cerr << file << " is not binary recording" << std::endl;
+        return false;
+    }
+
+    BinaryRecordReader reader(in);
+
+    std::string line;
+
+    while (reader.getline(line))
+    {
+        out << line << "\n";
+    }
+
+    return true;
+}
+
+bool convert_to_binary(
+        _In_ const std::string& file,
+        _In_ BinaryRecordWriter& writer)
+{
+    SWSS_LOG_ENTER();
+
+    std::ifstream in(file);
+
+    if (!in.is_open())
+    {
+        std::cerr << "failed to open " << file << std::endl;
+        return false;
+    }
+
+    if (BinaryRecord::isBinary(in))
+    {
+        std::cerr << file << " is already binary recording" << std::endl;
+        return false;
+    }
+
+    std::string line;
+
+    size_t lineNumber = 0;
+
+    while (std::getline(in, line))
+    {
+        lineNumber++;
+
+        uint64_t timestamp;
+        size_t size;
+
+        if (!parse_timestamp(line, timestamp, size))
+        {
+            std::cerr << file << ":" << lineNumber << ": invalid timestamp" << std::endl;
+            return false;
+        }
+
+        writer.write(timestamp, line.substr(size + 1));
+    }
+
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    swss::Logger::getInstance().setMinPrio(swss::Logger::SWSS_NOTICE);
+
+    SWSS_LOG_ENTER();
+
+    static struct option longOptions[] =
+    {
+        { "binary", no_argument,       0, 'b' },
+        { "output", required_argument, 0, 'o' },
+        { "help",   no_argument,       0, 'h' },
+        { 0,        0,                 0,  0  }
+    };
+
+    bool binary = false;
+
+    std::string output;
+
+    int c = 0;
+
+    while ((c = getopt_long(argc, argv, "bo:h", longOptions, NULL)) != -1)
+    {
+        switch (c)
+        {
+            case 'b':
+                binary = true;
+                break;
+
+            case 'o':
+                output = optarg;
+                break;
+
+            case 'h':
+                print_usage();
+                return EXIT_SUCCESS;
+
+            default:
+                print_usage();
+                return EXIT_FAILURE;
+        }
+    }
+
+    if (optind >= argc)
+    {
+        print_usage();
+        return EXIT_FAILURE;
+    }
+
+    std::ofstream ofs;
+
+    if (output.size())
+    {
+        ofs.open(output, std::ofstream::out | std::ofstream::trunc | std::ofstream::binary);
+
+        if (!ofs.is_open())
+        {
+            std::cerr << "failed to open " << output << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    std::ostream& out = output.size() ? ofs : std::cout;
+
+    bool success = true;
+
+    try
+    {
+        if (binary)
+        {
+            BinaryRecordWriter writer(out);
+
+            for (int i = optind; i < argc && success; i++)
+            {
+                success = convert_to_binary(argv[i], writer);
+            }
+        }
+        else
+        {
+            for (int i = optind; i < argc && success; i++)
+            {
+                success = convert_to_text(argv[i], out);
+            }
+        }
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "conversion failed: " << e.what() << std::endl;
+
+        success = false;
+    }
+
+    out.flush();
+
+    return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,556 @@
+#include "AsicAuditor.h"
+
+#include "meta/sai_serialize.h"
+
+#include "swss/logger.h"
+
+#include <algorithm>
+
+#define STATE_ASIC_AUDIT_TABLE_NAME "ASIC_AUDIT_TABLE"
+#define STATE_ASIC_AUDIT_DRIFT_TABLE_NAME "ASIC_AUDIT_DRIFT_TABLE"
+
+#define ASIC_AUDIT_SUMMARY_KEY "summary"
+
+#define ASIC_AUDIT_MIN_SLICE_INTERVAL_MS 100
+
+using namespace syncd;
+using namespace saimeta;
+
+AsicAuditor::AsicAuditor(
+        _In_ std::shared_ptr<RedisClient> client,
+        _In_ std::shared_ptr<VirtualOidTranslator> translator,
+        _In_ std::shared_ptr<sairedis::SaiInterface> vendorSai,
+        _In_ std::shared_ptr<swss::DBConnector> dbState,
+        _In_ uint32_t objectsPerSecond):
+    m_client(client),
+    m_translator(translator),
+    m_vendorSai(vendorSai),
+    m_objectsPerSecond(objectsPerSecond),
+    m_scanFinished(false),
+    m_sweepPosition(0),
+    m_sweepActive(false),
+    m_sweeps(0),
+    m_objects(0),
+    m_attributes(0),
+    m_driftedAttributes(0),
+    m_getFailures(0),
+    m_vanishedObjects(0),
+    m_lastSweepDurationMs(0)
+{
+    SWSS_LOG_ENTER();
+
+    if (objectsPerSecond == 0)
+    {
+        SWSS_LOG_THROW("asic auditor rate must be non zero");
+    }
+
+    // low rates use longer interval with single object per slice, high rates
+    // split budget into slices of minimum interval
+
+    uint64_t intervalMs = std::max<uint64_t>(ASIC_AUDIT_MIN_SLICE_INTERVAL_MS, 1000 / objectsPerSecond);
+
+    m_sliceSize = (uint32_t)std::max<uint64_t>(1, objectsPerSecond * intervalMs / 1000);
+
+    m_summaryTable = std::make_shared<swss::Table>(dbState.get(), STATE_ASIC_AUDIT_TABLE_NAME);
+
+    m_driftTable = std::make_shared<swss::Table>(dbState.get(), STATE_ASIC_AUDIT_DRIFT_TABLE_NAME);
+
+    // drift reported by previous syncd instance is no longer valid
+
+    std::vector<std::string> keys;
+
+    m_driftTable->getKeys(keys);
+
+    for (auto& key: keys)
+    {
+        m_driftTable->del(key);
+    }
+
+    timespec interval;
+
+    interval.tv_sec = (time_t)(intervalMs / 1000);
+    interval.tv_nsec = (long)((intervalMs % 1000) * 1000000);
+
+    m_timer = std::make_shared<swss::SelectableTimer>(interval);
+
+    m_timer->start();
+
+    SWSS_LOG_NOTICE("asic auditor rate %u objects/s, slice %u objects every %lu ms",
+            objectsPerSecond,
+            m_sliceSize,
+            intervalMs);
+}
+
+AsicAuditor::~AsicAuditor()
+{
+    SWSS_LOG_ENTER();
+
+    m_timer->stop();
+}
+
+swss::Selectable* AsicAuditor::getSelectable()
+{
+    SWSS_LOG_ENTER();
+
+    return m_timer.get();
+}
+
+void AsicAuditor::restartSweep()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_sweepActive)
+    {
+        SWSS_LOG_NOTICE("restarting asic audit sweep at %zu/%zu", m_sweepPosition, m_sweepKeys.size());
+    }
+
+    m_sweepActive = false;
+
+    m_sweepKeys.clear();
+
+    m_pendingKeys.clear();
+
+    m_sweepPosition = 0;
+}
+
+void AsicAuditor::startSweep()
+{
+    SWSS_LOG_ENTER();
+
+    m_scanCursor = "0";
+
+    m_scanFinished = false;
+
+    m_sweepKeys.clear();
+
+    m_pendingKeys.clear();
+
+    m_sweepPosition = 0;
+
+    m_sweepActive = true;
+
+    m_sweepStart = std::chrono::steady_clock::now();
+
+    SWSS_LOG_INFO("starting asic audit sweep");
+}
+
+void AsicAuditor::scanKeys()
+{
+    SWSS_LOG_ENTER();
+
+    // SCAN examines approximately count slots of key space, so its cost is
+    // bounded by slice size, even when it returns no ASIC_STATE keys
+
+    std::vector<std::string> keys;
+
+    m_scanCursor = m_client->scanAsicStateKeys(m_scanCursor, m_sliceSize, keys);
+
+    m_scanFinished = (m_scanCursor == "0");
+
+    for (auto& key: keys)
+    {
+        if (m_sweepKeys.insert(key).second)
+        {
+            m_pendingKeys.push_back(key);
+        }
+    }
+}
+
+void AsicAuditor::finishSweep()
+{
+    SWSS_LOG_ENTER();
+
+    m_sweeps++;
+
+    m_sweepActive = false;
+
+    // SCAN returns all keys present during whole sweep, objects not returned
+    // were removed and will not be audited again
+
+    for (auto it = m_driftedKeys.begin(); it != m_driftedKeys.end(); )
+    {
+        if (m_sweepKeys.find(*it) != m_sweepKeys.end())
+        {
+            it++;
+            continue;
+        }
+
+        m_driftTable->del(*it);
+
+        it = m_driftedKeys.erase(it);
+    }
+
+    m_lastSweepDurationMs = (uint64_t)std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - m_sweepStart).count();
+
+    SWSS_LOG_NOTICE("asic audit sweep %lu finished in %lu ms: %zu objects, %zu drifted",
+            m_sweeps,
+            m_lastSweepDurationMs,
+            m_sweepKeys.size(),
+            m_driftedKeys.size());
+
+    m_sweepKeys.clear();
+
+    m_pendingKeys.clear();
+
+    m_sweepPosition = 0;
+}
+
+void AsicAuditor::auditSlice()
+{
+    SWSS_LOG_ENTER();
+
+    if (!m_sweepActive)
+    {
+        startSweep();
+    }
+
+    // single SCAN iteration per slice, keys returned above slice size are
+    // examined in next slices
+
+    if (m_pendingKeys.size() < m_sliceSize && !m_scanFinished)
+    {
+        scanKeys();
+    }
+
+    // every examined key counts towards budget, since each requires ASIC_DB
+    // read even when there is nothing to audit on it
+
+    std::vector<std::string> keys;
+
+    while (keys.size() < m_sliceSize && m_pendingKeys.size())
+    {
+        keys.push_back(m_pendingKeys.front());
+
+        m_pendingKeys.pop_front();
+    }
+
+    // sorting groups objects of the same type together for bulk get
+
+    std::sort(keys.begin(), keys.end());
+
+    std::vector<AuditObject> objects;
+
+    for (auto& key: keys)
+    {
+        AuditObject object;
+
+        m_sweepPosition++;
+
+        if (loadObject(key, object))
+        {
+            objects.push_back(object);
+        }
+    }
+
+    readObjects(objects);
+
+    for (auto& object: objects)
+    {
+        compareObject(object);
+    }
+
+    if (m_scanFinished && m_pendingKeys.empty())
+    {
+        finishSweep();
+    }
+
+    updateSummary();
+}
+
+bool AsicAuditor::loadObject(
+        _In_ const std::string& key,
+        _Out_ AuditObject& object)
+{
+    SWSS_LOG_ENTER();
+
+    // ASIC_STATE:objecttype:objectid (object id may contain ':')
+
+    auto start = key.find_first_of(":");
+
+    if (start == std::string::npos)
+    {
+        SWSS_LOG_ERROR("invalid ASIC_STATE_TABLE %s: no start :", key.c_str());
+        return false;
+    }
+
+    object.key = key;
+
+    object.status = SAI_STATUS_NOT_EXECUTED;
+
+    try
+    {
+        sai_deserialize_object_meta_key(key.substr(start + 1), object.metaKey);
+
+        auto hash = m_client->getAttributesFromAsicKey(key);
+
+        if (hash.empty())
+        {
+            // object was removed after sweep started
+
+            m_vanishedObjects++;
+
+            clearDrift(key);
+
+            return false;
+        }
+
+        std::vector<swss::FieldValueTuple> values;
+
+        for (auto& kv: hash)
+        {
+            auto* meta = (kv.first == "NULL") ? nullptr : sai_metadata_get_attr_metadata_by_attr_id_name(kv.first.c_str());
+
+            // pointers are valid only in process which set them
+
+            if (meta && meta->attrvaluetype == SAI_ATTR_VALUE_TYPE_POINTER)
+            {
+                continue;
+            }
+
+            values.emplace_back(kv.first, kv.second);
+        }
+
+        object.dbAttributes = std::make_shared<SaiAttributeList>(object.metaKey.objecttype, values, false);
+
+        if (object.dbAttributes->get_attr_count() == 0)
+        {
+            // TODO: how to check ASIC on ASIC DB key with NULL:NULL hash
+            // just ignore for now
+
+            return false;
+        }
+
+        object.asicAttributes = std::make_shared<SaiAttributeList>(object.metaKey.objecttype, values, false);
+
+        m_translator->translateVidToRid(object.metaKey);
+
+        m_translator->translateVidToRid(
+                object.metaKey.objecttype,
+                object.dbAttributes->get_attr_count(),
+                object.dbAttributes->get_attr_list());
+    }
+    catch (const std::exception& e)
+    {
+        SWSS_LOG_ERROR("failed to load %s for audit: %s", key.c_str(), e.what());
+
+        m_getFailures++;
+
+        return false;
+    }
+
+    return true;
+}
+
+void AsicAuditor::readObjects(
+        _Inout_ std::vector<AuditObject>& objects)
+{
+    SWSS_LOG_ENTER();
+
+    // slice keys are sorted, so objects of the same type are next to each other
+
+    size_t begin = 0;
+
+    while (begin < objects.size())
+    {
+        auto objectType = objects[begin].metaKey.objecttype;
+
+        size_t end = begin + 1;
+
+        while (end < objects.size() && objects[end].metaKey.objecttype == objectType)
+        {
+            end++;
+        }
+
+        auto info = sai_metadata_get_object_type_info(objectType);
+
+        if (info->isnonobjectid || end - begin == 1 || m_bulkUnsupported.find(objectType) != m_bulkUnsupported.end())
+        {
+            for (size_t idx = begin; idx < end; idx++)
+            {
+                readObject(objects[idx]);
+            }
+        }
+        else
+        {
+            readObjectsBulk(objects, begin, end);
+        }
+
+        begin = end;
+    }
+}
+
+void AsicAuditor::readObjectsBulk(
+        _Inout_ std::vector<AuditObject>& objects,
+        _In_ size_t begin,
+        _In_ size_t end)
+{
+    SWSS_LOG_ENTER();
+
+    auto objectType = objects[begin].metaKey.objecttype;
+
+    uint32_t count = (uint32_t)(end - begin);
+
+    std::vector<sai_object_id_t> objectIds(count);
+    std::vector<uint32_t> attrCounts(count);
+    std::vector<sai_attribute_t*> attrLists(count);
+    std::vector<sai_status_t> statuses(count, SAI_STATUS_NOT_EXECUTED);
+
+    for (uint32_t idx = 0; idx < count; idx++)
+    {
+        auto& object = objects[begin + idx];
+
+        objectIds[idx] = object.metaKey.objectkey.key.object_id;
+        attrCounts[idx] = object.asicAttributes->get_attr_count();
+        attrLists[idx] = object.asicAttributes->get_attr_list();
+    }
+
+    sai_status_t status = m_vendorSai->bulkGet(
+            objectType,
+            count,
+            objectIds.data(),
+            attrCounts.data(),
+            attrLists.data(),
+            SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR,
+            statuses.data());
+
+    if (status == SAI_STATUS_NOT_IMPLEMENTED || status == SAI_STATUS_NOT_SUPPORTED)
+    {
+        SWSS_LOG_NOTICE("bulk get not supported on %s, auditing objects one by one",
+                sai_serialize_object_type(objectType).c_str());
+
+        m_bulkUnsupported.insert(objectType);
+
+        for (size_t idx = begin; idx < end; idx++)
+        {
+            readObject(objects[idx]);
+        }
+
+        return;
+    }
+
+    for (uint32_t idx = 0; idx < count; idx++)
+    {
+        objects[begin + idx].status = statuses[idx];
+    }
+}
+
+void AsicAuditor::readObject(
+        _Inout_ AuditObject& object)
+{
+    SWSS_LOG_ENTER();
+
+    object.status = m_vendorSai->get(
+            object.metaKey,
+            object.asicAttributes->get_attr_count(),
+            object.asicAttributes->get_attr_list());
+}
+
+void AsicAuditor::compareObject(
+        _In_ const AuditObject& object)
+{
+    SWSS_LOG_ENTER();
+
+    m_objects++;
+
+    if (object.status != SAI_STATUS_SUCCESS)
+    {
+        SWSS_LOG_WARN("failed to audit %s, get status: %s",
+                object.key.c_str(),
+                sai_serialize_status(object.status).c_str());
+
+        m_getFailures++;
+
+        return;
+    }
+
+    uint32_t attrCount = object.asicAttributes->get_attr_count();
+
+    const sai_attribute_t* asicAttrList = object.asicAttributes->get_attr_list();
+    const sai_attribute_t* dbAttrList = object.dbAttributes->get_attr_list();
+
+    std::vector<swss::FieldValueTuple> drift;
+
+    for (uint32_t idx = 0; idx < attrCount; idx++)
+    {
+        auto meta = sai_metadata_get_attr_metadata(object.metaKey.objecttype, asicAttrList[idx].id);
+
+        if (meta == NULL)
+        {
+            SWSS_LOG_ERROR("FATAL: failed to find metadata for object type %s and attr id %d",
+                    sai_serialize_object_type(object.metaKey.objecttype).c_str(),
+                    asicAttrList[idx].id);
+            break;
+        }
+
+        m_attributes++;
+
+        auto asicValue = sai_serialize_attr_value(*meta, asicAttrList[idx], false);
+
+        auto dbValue = sai_serialize_attr_value(*meta, dbAttrList[idx], false);
+
+        if (asicValue == dbValue)
+        {
+            continue;
+        }
+
+        SWSS_LOG_ERROR("asic audit: %s ASIC_DB value '%s' differs from ASIC value '%s' on %s",
+                meta->attridname,
+                dbValue.c_str(),
+                asicValue.c_str(),
+                object.key.c_str());
+
+        m_driftedAttributes++;
+
+        drift.emplace_back(std::string(meta->attridname) + ":db", dbValue);
+        drift.emplace_back(std::string(meta->attridname) + ":asic", asicValue);
+    }
+
+    if (drift.empty())
+    {
+        clearDrift(object.key);
+        return;
+    }
+
+    // replace previous drift, since set attributes may change between sweeps
+
+    m_driftTable->del(object.key);
+
+    m_driftTable->set(object.key, drift);
+
+    m_driftedKeys.insert(object.key);
+}
+
+void AsicAuditor::clearDrift(
+        _In_ const std::string& key)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_driftedKeys.erase(key))
+    {
+        SWSS_LOG_NOTICE("asic audit: drift on %s is resolved", key.c_str());
+
+        m_driftTable->del(key);
+    }
+}
+
+void AsicAuditor::updateSummary()
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<swss::FieldValueTuple> values;
+
+    values.emplace_back("objects_per_second", std::to_string(m_objectsPerSecond));
+    values.emplace_back("sweeps", std::to_string(m_sweeps));
+    values.emplace_back("sweep_position", std::to_string(m_sweepPosition));
+    values.emplace_back("sweep_size", std::to_string(m_sweepKeys.size()));
+    values.emplace_back("last_sweep_duration_ms", std::to_string(m_lastSweepDurationMs));
+    values.emplace_back("audited_objects", std::to_string(m_objects));
+    values.emplace_back("audited_attributes", std::to_string(m_attributes));
+    values.emplace_back("drifted_objects", std::to_string(m_driftedKeys.size()));
+    values.emplace_back("drifted_attributes", std::to_string(m_driftedAttributes));
+    values.emplace_back("get_failures", std::to_string(m_getFailures));
+    values.emplace_back("vanished_objects", std::to_string(m_vanishedObjects));
+
+    m_summaryTable->set(ASIC_AUDIT_SUMMARY_KEY, values);
+}
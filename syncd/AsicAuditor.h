@@ -0,0 +1,196 @@
+#pragma once
+
+#include "meta/SaiInterface.h"
+#include "meta/SaiAttributeList.h"
+#include "VirtualOidTranslator.h"
+#include "RedisClient.h"
+
+#include "swss/dbconnector.h"
+#include "swss/table.h"
+#include "swss/selectabletimer.h"
+
+#include <string>
+#include <vector>
+#include <set>
+#include <deque>
+#include <unordered_set>
+#include <memory>
+#include <chrono>
+
+namespace syncd
+{
+    /**
+     * @brief Background ASIC vs ASIC_DB consistency auditor.
+     *
+     * Unlike inspect ASIC, which is one shot serial sweep, auditor walks
+     * ASIC_DB incrementally using SCAN cursor and examines at most configured
+     * number of objects per second, split into slices. Each slice runs at most
+     * one SCAN iteration, so whole key space is never read at once under
+     * syncd mutex. Attributes of objects of the same type in slice are read
+     * from vendor SAI using single bulk get. Slices are executed from syncd
+     * main loop when auditor timer fires, so all other events are processed
+     * between slices.
+     *
+     * Audit counters and attributes which differ between ASIC and ASIC_DB are
+     * reported to STATE_DB.
+     */
+    class AsicAuditor
+    {
+        private:
+
+            typedef struct _AuditObject
+            {
+                std::string key;
+
+                sai_object_meta_key_t metaKey;
+
+                /**
+                 * @brief Attributes from ASIC_DB translated to RIDs.
+                 */
+                std::shared_ptr<saimeta::SaiAttributeList> dbAttributes;
+
+                /**
+                 * @brief Attributes read from ASIC.
+                 */
+                std::shared_ptr<saimeta::SaiAttributeList> asicAttributes;
+
+                sai_status_t status;
+
+            } AuditObject;
+
+        public:
+
+            AsicAuditor(
+                    _In_ std::shared_ptr<RedisClient> client,
+                    _In_ std::shared_ptr<VirtualOidTranslator> translator,
+                    _In_ std::shared_ptr<sairedis::SaiInterface> vendorSai,
+                    _In_ std::shared_ptr<swss::DBConnector> dbState,
+                    _In_ uint32_t objectsPerSecond);
+
+            virtual ~AsicAuditor();
+
+        public:
+
+            swss::Selectable* getSelectable();
+
+            /**
+             * @brief Audit next slice of objects, called from syncd main loop
+             * when selectable fires, with syncd mutex held.
+             */
+            void auditSlice();
+
+            /**
+             * @brief Drop current sweep, next slice will start new one.
+             *
+             * Should be called when ASIC view was replaced, for example after
+             * apply view.
+             */
+            void restartSweep();
+
+        private:
+
+            void startSweep();
+
+            void finishSweep();
+
+            void scanKeys();
+
+            bool loadObject(
+                    _In_ const std::string& key,
+                    _Out_ AuditObject& object);
+
+            void readObjects(
+                    _Inout_ std::vector<AuditObject>& objects);
+
+            void readObjectsBulk(
+                    _Inout_ std::vector<AuditObject>& objects,
+                    _In_ size_t begin,
+                    _In_ size_t end);
+
+            void readObject(
+                    _Inout_ AuditObject& object);
+
+            void compareObject(
+                    _In_ const AuditObject& object);
+
+            void clearDrift(
+                    _In_ const std::string& key);
+
+            void updateSummary();
+
+        private:
+
+            std::shared_ptr<RedisClient> m_client;
+
+            std::shared_ptr<VirtualOidTranslator> m_translator;
+
+            std::shared_ptr<sairedis::SaiInterface> m_vendorSai;
+
+            std::shared_ptr<swss::Table> m_summaryTable;
+
+            std::shared_ptr<swss::Table> m_driftTable;
+
+            std::shared_ptr<swss::SelectableTimer> m_timer;
+
+            uint32_t m_objectsPerSecond;
+
+            /**
+             * @brief Maximum number of ASIC_DB keys examined in single slice.
+             */
+            uint32_t m_sliceSize;
+
+            /**
+             * @brief SCAN cursor of current sweep.
+             */
+            std::string m_scanCursor;
+
+            bool m_scanFinished;
+
+            /**
+             * @brief Keys returned by SCAN which were not examined yet.
+             */
+            std::deque<std::string> m_pendingKeys;
+
+            /**
+             * @brief Keys returned by SCAN in current sweep, SCAN can return
+             * the same key more than once.
+             */
+            std::unordered_set<std::string> m_sweepKeys;
+
+            /**
+             * @brief Number of keys examined in current sweep.
+             */
+            size_t m_sweepPosition;
+
+            bool m_sweepActive;
+
+            std::chrono::time_point<std::chrono::steady_clock> m_sweepStart;
+
+            /**
+             * @brief Object types on which vendor bulk get is not supported,
+             * those are read one by one.
+             */
+            std::set<sai_object_type_t> m_bulkUnsupported;
+
+            /**
+             * @brief ASIC_DB keys currently reported in drift table.
+             */
+            std::set<std::string> m_driftedKeys;
+
+        private: // counters
+
+            uint64_t m_sweeps;
+
+            uint64_t m_objects;
+
+            uint64_t m_attributes;
+
+            uint64_t m_driftedAttributes;
+
+            uint64_t m_getFailures;
+
+            uint64_t m_vanishedObjects;
+
+            uint64_t m_lastSweepDurationMs;
+    };
+}
@@ -47,6 +47,12 @@ CommandLineOptions::CommandLineOptions()
     m_supportingBulkCounterGroups = "";
 
     m_enableAttrVersionCheck = false;
+
+    m_hardReinitBulkSize = 0;
+
+    m_vendorLockPolicy = "";
+
+    m_asicAuditRate = 0;
 }
 
 std::string CommandLineOptions::getCommandLineString() const
@@ -71,6 +77,9 @@ std::string CommandLineOptions::getCommandLineString() const
     ss << " WatchdogWarnTimeSpan=" << m_watchdogWarnTimeSpan;
     ss << " SupportingBulkCounters=" << m_supportingBulkCounterGroups;
     ss << " EnableAttrVersionCheck=" << (m_enableAttrVersionCheck ? "YES" : "NO");
+    ss << " HardReinitBulkSize=" << m_hardReinitBulkSize;
+    ss << " VendorLockPolicy=" << m_vendorLockPolicy;
+    ss << " AsicAuditRate=" << m_asicAuditRate;
 
 #ifdef SAITHRIFT
 
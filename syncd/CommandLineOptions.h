@@ -101,5 +101,24 @@ namespace syncd
             std::string m_supportingBulkCounterGroups;
 
             bool m_enableAttrVersionCheck;
+
+            /**
+             * Maximum number of objects created in single vendor bulk call
+             * during hard reinit. When set to 0 objects are created one by
+             * one.
+             */
+            uint32_t m_hardReinitBulkSize;
+
+            /**
+             * Vendor SAI lock policy per API class, for example
+             * "stats:separate,query:none". Overrides profile value.
+             */
+            std::string m_vendorLockPolicy;
+
+            /**
+             * Number of ASIC_DB objects per second audited against ASIC in
+             * background. When set to 0 background audit is disabled.
+             */
+            uint32_t m_asicAuditRate;
     };
 }
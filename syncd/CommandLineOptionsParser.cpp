@@ -19,9 +19,9 @@ std::shared_ptr<CommandLineOptions> CommandLineOptionsParser::parseCommandLine(
     auto options = std::make_shared<CommandLineOptions>();
 
 #ifdef SAITHRIFT
-    const char* const optstring = "dp:t:g:x:b:B:aw:uSUCsz:lrm:h";
+    const char* const optstring = "dp:t:g:x:b:B:aH:L:A:w:uSUCsz:lrm:h";
 #else
-    const char* const optstring = "dp:t:g:x:b:B:aw:uSUCsz:lh";
+    const char* const optstring = "dp:t:g:x:b:B:aH:L:A:w:uSUCsz:lh";
 #endif // SAITHRIFT
 
     while (true)
@@ -44,6 +44,9 @@ std::shared_ptr<CommandLineOptions> CommandLineOptionsParser::parseCommandLine(
             { "watchdogWarnTimeSpan",    optional_argument, 0, 'w' },
             { "supportingBulkCounters",  required_argument, 0, 'B' },
             { "enableAttrVersionCheck",  no_argument,       0, 'a' },
+            { "hardReinitBulkSize",      required_argument, 0, 'H' },
+            { "vendorLockPolicy",        required_argument, 0, 'L' },
+            { "asicAuditRate",           required_argument, 0, 'A' },
 #ifdef SAITHRIFT
             { "rpcserver",               no_argument,       0, 'r' },
             { "portmap",                 required_argument, 0, 'm' },
@@ -143,6 +146,18 @@ std::shared_ptr<CommandLineOptions> CommandLineOptionsParser::parseCommandLine(
                 options->m_enableAttrVersionCheck = true;
                 break;
 
+            case 'H':
+                options->m_hardReinitBulkSize = (uint32_t)std::stoul(optarg);
+                break;
+
+            case 'L':
+                options->m_vendorLockPolicy = std::string(optarg);
+                break;
+
+            case 'A':
+                options->m_asicAuditRate = (uint32_t)std::stoul(optarg);
+                break;
+
             case 'h':
                 printUsage();
                 exit(EXIT_SUCCESS);
@@ -166,9 +181,9 @@ void CommandLineOptionsParser::printUsage()
     SWSS_LOG_ENTER();
 
 #ifdef SAITHRIFT
-    std::cout << "Usage: syncd [-d] [-p profile] [-t type] [-u] [-S] [-U] [-C] [-s] [-z mode] [-l] [-g idx] [-x contextConfig] [-b breakConfig] [-B supportingBulkCounters] [-r] [-m portmap] [-h]" << std::endl;
+    std::cout << "Usage: syncd [-d] [-p profile] [-t type] [-u] [-S] [-U] [-C] [-s] [-z mode] [-l] [-g idx] [-x contextConfig] [-b breakConfig] [-B supportingBulkCounters] [-H bulkSize] [-L lockPolicy] [-A auditRate] [-r] [-m portmap] [-h]" << std::endl;
 #else
-    std::cout << "Usage: syncd [-d] [-p profile] [-t type] [-u] [-S] [-U] [-C] [-s] [-z mode] [-l] [-g idx] [-x contextConfig] [-b breakConfig] [-B supportingBulkCounters] [-h]" << std::endl;
+    std::cout << "Usage: syncd [-d] [-p profile] [-t type] [-u] [-S] [-U] [-C] [-s] [-z mode] [-l] [-g idx] [-x contextConfig] [-b breakConfig] [-B supportingBulkCounters] [-H bulkSize] [-L lockPolicy] [-A auditRate] [-h]" << std::endl;
 #endif // SAITHRIFT
 
     std::cout << "    -d --diag" << std::endl;
@@ -203,6 +218,12 @@ void CommandLineOptionsParser::printUsage()
     std::cout << "        Counter groups those support bulk polling" << std::endl;
     std::cout << "    -a --enableAttrVersionCheck" << std::endl;
     std::cout << "        Enable attribute SAI version check when performing SAI discovery" << std::endl;
+    std::cout << "    -H --hardReinitBulkSize bulkSize" << std::endl;
+    std::cout << "        Create objects in vendor bulk calls of given size during hard reinit, default: 0 (disabled)" << std::endl;
+    std::cout << "    -L --vendorLockPolicy lockPolicy" << std::endl;
+    std::cout << "        Vendor SAI lock per API class (config|stats|query):(global|separate|none), e.g. stats:separate,query:none" << std::endl;
+    std::cout << "    -A --asicAuditRate auditRate" << std::endl;
+    std::cout << "        Audit given number of ASIC_DB objects per second against ASIC in background, default: 0 (disabled)" << std::endl;
 
 #ifdef SAITHRIFT
 
@@ -0,0 +1,172 @@
+#include "ConcurrentOidMap.h"
+
+#include "swss/logger.h"
+
+#include <mutex>
+#include <vector>
+
+using namespace syncd;
+
+constexpr size_t ConcurrentOidMap::SHARD_COUNT;
+
+size_t ConcurrentOidMap::getShardIndex(
+        _In_ sai_object_id_t key)
+{
+    SWSS_LOG_ENTER();
+
+    // VID index is in lower bits and object type and switch index in upper
+    // bits, RID layout is vendor specific, so mix all bits
+
+    uint64_t hash = key ^ (key >> 32);
+
+    hash *= 0x9E3779B97F4A7C15ULL;
+
+    return (size_t)(hash >> 58) % SHARD_COUNT;
+}
+
+bool ConcurrentOidMap::find(
+        _In_ sai_object_id_t key,
+        _Out_ sai_object_id_t& value) const
+{
+    SWSS_LOG_ENTER();
+
+    auto& shard = m_shards[getShardIndex(key)];
+
+    std::shared_lock<std::shared_timed_mutex> lock(shard.m_mutex);
+
+    auto it = shard.m_map.find(key);
+
+    if (it == shard.m_map.end())
+    {
+        return false;
+    }
+
+    value = it->second;
+
+    return true;
+}
+
+size_t ConcurrentOidMap::find(
+        _In_ size_t count,
+        _In_ const sai_object_id_t* keys,
+        _Out_ sai_object_id_t* values) const
+{
+    SWSS_LOG_ENTER();
+
+    std::array<std::vector<size_t>, SHARD_COUNT> indexes;
+
+    for (size_t idx = 0; idx < count; idx++)
+    {
+        indexes[getShardIndex(keys[idx])].push_back(idx);
+    }
+
+    size_t found = 0;
+
+    for (size_t shardIdx = 0; shardIdx < SHARD_COUNT; shardIdx++)
+    {
+        if (indexes[shardIdx].empty())
+        {
+            continue;
+        }
+
+        auto& shard = m_shards[shardIdx];
+
+        std::shared_lock<std::shared_timed_mutex> lock(shard.m_mutex);
+
+        for (auto idx: indexes[shardIdx])
+        {
+            auto it = shard.m_map.find(keys[idx]);
+
+            if (it == shard.m_map.end())
+            {
+                values[idx] = SAI_NULL_OBJECT_ID;
+                continue;
+            }
+
+            values[idx] = it->second;
+            found++;
+        }
+    }
+
+    return found;
+}
+
+void ConcurrentOidMap::insert(
+        _In_ sai_object_id_t key,
+        _In_ sai_object_id_t value)
+{
+    SWSS_LOG_ENTER();
+
+    auto& shard = m_shards[getShardIndex(key)];
+
+    std::unique_lock<std::shared_timed_mutex> lock(shard.m_mutex);
+
+    shard.m_map[key] = value;
+}
+
+void ConcurrentOidMap::insert(
+        _In_ const std::unordered_map<sai_object_id_t, sai_object_id_t>& map)
+{
+    SWSS_LOG_ENTER();
+
+    std::array<std::vector<std::pair<sai_object_id_t, sai_object_id_t>>, SHARD_COUNT> items;
+
+    for (auto& kvp: map)
+    {
+        items[getShardIndex(kvp.first)].push_back(kvp);
+    }
+
+    for (size_t shardIdx = 0; shardIdx < SHARD_COUNT; shardIdx++)
+    {
+        auto& shard = m_shards[shardIdx];
+
+        std::unique_lock<std::shared_timed_mutex> lock(shard.m_mutex);
+
+        shard.m_map.reserve(shard.m_map.size() + items[shardIdx].size());
+
+        for (auto& kvp: items[shardIdx])
+        {
+            shard.m_map[kvp.first] = kvp.second;
+        }
+    }
+}
+
+void ConcurrentOidMap::erase(
+        _In_ sai_object_id_t key)
+{
+    SWSS_LOG_ENTER();
+
+    auto& shard = m_shards[getShardIndex(key)];
+
+    std::unique_lock<std::shared_timed_mutex> lock(shard.m_mutex);
+
+    shard.m_map.erase(key);
+}
+
+void ConcurrentOidMap::clear()
+{
+    SWSS_LOG_ENTER();
+
+    for (auto& shard: m_shards)
+    {
+        std::unique_lock<std::shared_timed_mutex> lock(shard.m_mutex);
+
+        shard.m_map.clear();
+    }
+}
+
+size_t ConcurrentOidMap::size() const
+{
+    SWSS_LOG_ENTER();
+
+    size_t size = 0;
+
+    for (auto& shard: m_shards)
+    {
+        std::shared_lock<std::shared_timed_mutex> lock(shard.m_mutex);
+
+        size += shard.m_map.size();
+    }
+
+    return size;
+}
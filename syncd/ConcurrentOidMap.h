@@ -0,0 +1,84 @@
+#pragma once
+
+extern "C" {
+#include "saimetadata.h"
+}
+
+#include "swss/sal.h"
+
+#include <shared_mutex>
+#include <unordered_map>
+#include <array>
+
+namespace syncd
+{
+    /**
+     * @brief Concurrent object id map.
+     *
+     * Map is split into shards, each guarded by its own reader/writer lock,
+     * so lookups from main loop, notification thread and flex counter
+     * thread don't serialize on single mutex.
+     */
+    class ConcurrentOidMap
+    {
+        public:
+
+            ConcurrentOidMap() = default;
+
+            virtual ~ConcurrentOidMap() = default;
+
+        public:
+
+            bool find(
+                    _In_ sai_object_id_t key,
+                    _Out_ sai_object_id_t& value) const;
+
+            /**
+             * @brief Find values for multiple keys.
+             *
+             * Each shard is locked once per call. Keys not found are
+             * mapped to SAI_NULL_OBJECT_ID.
+             *
+             * @return Number of keys found.
+             */
+            size_t find(
+                    _In_ size_t count,
+                    _In_ const sai_object_id_t* keys,
+                    _Out_ sai_object_id_t* values) const;
+
+            void insert(
+                    _In_ sai_object_id_t key,
+                    _In_ sai_object_id_t value);
+
+            void insert(
+                    _In_ const std::unordered_map<sai_object_id_t, sai_object_id_t>& map);
+
+            void erase(
+                    _In_ sai_object_id_t key);
+
+            void clear();
+
+            size_t size() const;
+
+        private:
+
+            static size_t getShardIndex(
+                    _In_ sai_object_id_t key);
+
+        private:
+
+            static constexpr size_t SHARD_COUNT = 64;
+
+            struct Shard
+            {
+                mutable std::shared_timed_mutex m_mutex;
+
+                std::unordered_map<sai_object_id_t, sai_object_id_t> m_map;
+            };
+
+            std::array<Shard, SHARD_COUNT> m_shards;
+
+            ConcurrentOidMap(const ConcurrentOidMap&) = delete;
+            ConcurrentOidMap& operator=(const ConcurrentOidMap&) = delete;
+    };
+}
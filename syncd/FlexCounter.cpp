@@ -1,5 +1,6 @@
 #include <inttypes.h>
 #include <unordered_map>
+#include <unordered_set>
 #include <map>
 #include <vector>
 #include <string>
@@ -87,11 +88,83 @@ const std::map<std::tuple<sai_object_type_t, std::string>, std::string> FlexCoun
     {{SAI_OBJECT_TYPE_SWITCH, SWITCH_COUNTER_ID_LIST}, COUNTER_TYPE_SWITCH},
 };
 
+const std::map<sai_object_type_t, std::vector<std::string>> FlexCounter::m_objectType2CounterTypes = {
+    {SAI_OBJECT_TYPE_PORT, {COUNTER_TYPE_PORT, COUNTER_TYPE_PORT_DEBUG, COUNTER_TYPE_WRED_ECN_PORT}},
+    {SAI_OBJECT_TYPE_QUEUE, {COUNTER_TYPE_QUEUE, COUNTER_TYPE_WRED_ECN_QUEUE, ATTR_TYPE_QUEUE}},
+    {SAI_OBJECT_TYPE_INGRESS_PRIORITY_GROUP, {COUNTER_TYPE_PG, ATTR_TYPE_PG}},
+    {SAI_OBJECT_TYPE_ROUTER_INTERFACE, {COUNTER_TYPE_RIF}},
+    {SAI_OBJECT_TYPE_BUFFER_POOL, {COUNTER_TYPE_BUFFER_POOL}},
+    {SAI_OBJECT_TYPE_SWITCH, {COUNTER_TYPE_SWITCH_DEBUG, COUNTER_TYPE_SWITCH}},
+    {SAI_OBJECT_TYPE_MACSEC_FLOW, {COUNTER_TYPE_MACSEC_FLOW}},
+    {SAI_OBJECT_TYPE_MACSEC_SA, {COUNTER_TYPE_MACSEC_SA, ATTR_TYPE_MACSEC_SA}},
+    {SAI_OBJECT_TYPE_ACL_COUNTER, {ATTR_TYPE_ACL_COUNTER}},
+    {SAI_OBJECT_TYPE_TUNNEL, {COUNTER_TYPE_TUNNEL}},
+    {(sai_object_type_t)SAI_OBJECT_TYPE_ENI, {COUNTER_TYPE_ENI, COUNTER_TYPE_METER_BUCKET}},
+    {SAI_OBJECT_TYPE_COUNTER, {COUNTER_TYPE_FLOW, COUNTER_TYPE_SRV6}},
+    {SAI_OBJECT_TYPE_POLICER, {COUNTER_TYPE_POLICER}},
+};
+
 BaseCounterContext::BaseCounterContext(const std::string &name, const std::string &instance):
 m_name(name),
-m_instanceId(instance)
+m_instanceId(instance),
+m_pollInterrupted(false)
+{
+    SWSS_LOG_ENTER();
+}
+
+void BaseCounterContext::markRemoved(
+    _In_ const std::vector<sai_object_id_t>& vids)
+{
+    SWSS_LOG_ENTER();
+
+    // poll thread holds this lock during each vendor call
+    std::lock_guard<std::mutex> lock(m_pollMtx);
+
+    for (auto vid: vids)
+    {
+        m_removedVids[vid]++;
+    }
+}
+
+void BaseCounterContext::unmarkRemoved(
+    _In_ const std::vector<sai_object_id_t>& vids)
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_pollMtx);
+
+    for (auto vid: vids)
+    {
+        auto it = m_removedVids.find(vid);
+
+        if (it != m_removedVids.end() && --it->second == 0)
+        {
+            m_removedVids.erase(it);
+        }
+    }
+}
+
+void BaseCounterContext::interruptPoll(
+    _In_ bool interrupt)
+{
+    SWSS_LOG_ENTER();
+
+    m_pollInterrupted = interrupt;
+}
+
+bool BaseCounterContext::isPollInterrupted() const
 {
     SWSS_LOG_ENTER();
+
+    return m_pollInterrupted;
+}
+
+bool BaseCounterContext::isPollable(
+    _In_ sai_object_id_t vid) const
+{
+    SWSS_LOG_ENTER();
+
+    return !m_pollInterrupted && m_removedVids.find(vid) == m_removedVids.end();
 }
 
 void BaseCounterContext::addPlugins(
@@ -134,6 +207,17 @@ void BaseCounterContext::setBulkChunkSizePerPrefix(
     m_bulkChunkSizePerPrefix = bulkChunkSizePerPrefix;
 }
 
+void BaseCounterContext::bulkRemoveObject(
+    _In_ const std::vector<sai_object_id_t>& vids)
+{
+    SWSS_LOG_ENTER();
+
+    for (auto vid: vids)
+    {
+        removeObject(vid);
+    }
+}
+
 template <typename StatType,
           typename Enable = void>
 struct CounterIds
@@ -517,6 +601,18 @@ public:
         SWSS_LOG_ENTER();
     }
 
+    void validateIds(
+            _In_ const std::vector<std::string>& idStrings) const override
+    {
+        SWSS_LOG_ENTER();
+
+        for (const auto &str : idStrings)
+        {
+            StatType stat;
+            deserializeStat(str.c_str(), &stat);
+        }
+    }
+
     // For those object type who support per object stats mode, e.g. buffer pool.
     virtual void addObject(
             _In_ sai_object_id_t vid,
@@ -1103,6 +1199,36 @@ public:
         }
     }
 
+    void bulkRemoveObject(
+            _In_ const std::vector<sai_object_id_t>& vids) override
+    {
+        SWSS_LOG_ENTER();
+
+        std::unordered_set<sai_object_id_t> toRemove(vids.begin(), vids.end());
+
+        std::unordered_set<sai_object_id_t> removed;
+
+        for (auto vid: toRemove)
+        {
+            if (m_objectIdsMap.erase(vid))
+            {
+                removed.insert(vid);
+            }
+        }
+
+        removeBulkStatsContext(toRemove, removed);
+
+        for (auto vid: toRemove)
+        {
+            if (removed.find(vid) == removed.end())
+            {
+                SWSS_LOG_NOTICE("Trying to remove nonexisting %s %s",
+                                sai_serialize_object_type(m_objectType).c_str(),
+                                sai_serialize_object_id(vid).c_str());
+            }
+        }
+    }
+
     virtual void collectData(
             _In_ swss::Table &countersTable) override
     {
@@ -1122,9 +1248,19 @@ public:
             }
 
             std::vector<uint64_t> stats(statIds.size());
-            if (!collectData(rid, statIds, effective_stats_mode, true, stats))
+
             {
-                continue;
+                std::lock_guard<std::mutex> lock(m_pollMtx);
+
+                if (!isPollable(vid))
+                {
+                    continue;
+                }
+
+                if (!collectData(rid, statIds, effective_stats_mode, true, stats))
+                {
+                    continue;
+                }
             }
 
             std::vector<swss::FieldValueTuple> values;
@@ -1288,16 +1424,17 @@ private:
 
         while (current < size)
         {
-            sai_status_t status = m_vendorSai->bulkGetStats(
-                SAI_NULL_OBJECT_ID,
-                m_objectType,
-                bulk_chunk_size,
-                ctx.object_keys.data() + current,
-                static_cast<uint32_t>(ctx.counter_ids.size()),
-                reinterpret_cast<const sai_stat_id_t *>(ctx.counter_ids.data()),
-                statsMode,
-                ctx.object_statuses.data() + current,
-                ctx.counters.data() + current * ctx.counter_ids.size());
+            std::unique_lock<std::mutex> lock(m_pollMtx);
+
+            if (m_pollInterrupted)
+            {
+                return;
+            }
+
+            sai_status_t status = bulkGetStatsChunk(ctx, current, bulk_chunk_size, statsMode);
+
+            lock.unlock();
+
             if (SAI_STATUS_SUCCESS != status)
             {
                 SWSS_LOG_WARN("Failed to bulk get stats for %s %s %s %s starting object %u bulk chunk size %u: %d",
@@ -1317,15 +1454,24 @@ private:
 
         auto time_stamp = std::chrono::steady_clock::now().time_since_epoch().count();
 
+        std::lock_guard<std::mutex> lock(m_pollMtx);
+
         std::vector<swss::FieldValueTuple> values;
         for (size_t i = 0; i < ctx.object_keys.size(); i++)
         {
+            const auto &vid = ctx.object_vids[i];
+
+            if (!isPollable(vid))
+            {
+                // removed during poll cycle
+                continue;
+            }
+
             if (SAI_STATUS_SUCCESS != ctx.object_statuses[i])
             {
                 SWSS_LOG_ERROR("Failed to get stats of %s 0x%" PRIx64 " 0x%" PRIx64 ": %d", m_name.c_str(), ctx.object_vids[i], ctx.object_keys[i].key.object_id, ctx.object_statuses[i]);
                 continue;
             }
-            const auto &vid = ctx.object_vids[i];
 
             for (size_t j = 0; j < ctx.counter_ids.size(); j++)
             {
@@ -1346,6 +1492,85 @@ private:
         SWSS_LOG_DEBUG("After pushing db %s %s %s", m_instanceId.c_str(), m_name.c_str(), ctx.name.c_str());
     }
 
+    sai_status_t bulkGetStatsChunk(
+        _Inout_ BulkContextType &ctx,
+        _In_ uint32_t current,
+        _In_ uint32_t count,
+        _In_ sai_stats_mode_t statsMode)
+    {
+        SWSS_LOG_ENTER();
+
+        // must be called with m_pollMtx held
+
+        size_t countersPerObject = ctx.counter_ids.size();
+
+        std::vector<uint32_t> indexes;
+
+        if (!m_removedVids.empty())
+        {
+            for (uint32_t idx = current; idx < current + count; idx++)
+            {
+                if (isPollable(ctx.object_vids[idx]))
+                {
+                    indexes.push_back(idx);
+                }
+            }
+        }
+
+        if (m_removedVids.empty() || indexes.size() == count)
+        {
+            return m_vendorSai->bulkGetStats(
+                SAI_NULL_OBJECT_ID,
+                m_objectType,
+                count,
+                ctx.object_keys.data() + current,
+                static_cast<uint32_t>(countersPerObject),
+                reinterpret_cast<const sai_stat_id_t *>(ctx.counter_ids.data()),
+                statsMode,
+                ctx.object_statuses.data() + current,
+                ctx.counters.data() + current * countersPerObject);
+        }
+
+        if (indexes.empty())
+        {
+            return SAI_STATUS_SUCCESS;
+        }
+
+        // objects removed during poll cycle are left out of bulk call
+
+        std::vector<sai_object_key_t> keys;
+
+        for (auto idx: indexes)
+        {
+            keys.push_back(ctx.object_keys[idx]);
+        }
+
+        std::vector<sai_status_t> statuses(keys.size());
+        std::vector<uint64_t> counters(keys.size() * countersPerObject);
+
+        sai_status_t status = m_vendorSai->bulkGetStats(
+            SAI_NULL_OBJECT_ID,
+            m_objectType,
+            static_cast<uint32_t>(keys.size()),
+            keys.data(),
+            static_cast<uint32_t>(countersPerObject),
+            reinterpret_cast<const sai_stat_id_t *>(ctx.counter_ids.data()),
+            statsMode,
+            statuses.data(),
+            counters.data());
+
+        for (size_t i = 0; i < indexes.size(); i++)
+        {
+            ctx.object_statuses[indexes[i]] = statuses[i];
+
+            std::copy(counters.begin() + i * countersPerObject,
+                      counters.begin() + (i + 1) * countersPerObject,
+                      ctx.counters.begin() + indexes[i] * countersPerObject);
+        }
+
+        return status;
+    }
+
     auto getBulkStatsContext(
         _In_ const std::vector<StatType>& counterIds,
         _In_ const std::string& name,
@@ -1457,6 +1682,50 @@ private:
         return found;
     }
 
+    // Remove all given objects from all bulk contexts, each context is
+    // compacted in one pass instead of one erase per object
+    void removeBulkStatsContext(
+        _In_    const std::unordered_set<sai_object_id_t>& vids,
+        _Inout_ std::unordered_set<sai_object_id_t>& removed)
+    {
+        SWSS_LOG_ENTER();
+        std::set<std::vector<StatType>> bulkContextsToBeRemoved;
+        for (auto iter = m_bulkContexts.begin(); iter != m_bulkContexts.end(); iter++)
+        {
+            auto &ctx = *iter->second.get();
+            size_t count = 0;
+            for (size_t idx = 0; idx < ctx.object_vids.size(); idx++)
+            {
+                if (vids.find(ctx.object_vids[idx]) != vids.end())
+                {
+                    removed.insert(ctx.object_vids[idx]);
+                    continue;
+                }
+                ctx.object_vids[count] = ctx.object_vids[idx];
+                ctx.object_keys[count] = ctx.object_keys[idx];
+                count++;
+            }
+            if (count == ctx.object_vids.size())
+            {
+                continue;
+            }
+            if (count == 0)
+            {
+                bulkContextsToBeRemoved.insert(iter->first);
+                continue;
+            }
+            ctx.object_vids.resize(count);
+            ctx.object_keys.resize(count);
+            ctx.object_statuses.resize(count);
+            ctx.counters.resize(ctx.counter_ids.size() * count);
+        }
+
+        for (auto iter : bulkContextsToBeRemoved)
+        {
+            m_bulkContexts.erase(iter);
+        }
+    }
+
     bool checkBulkCapability(
             _In_ sai_object_id_t vid,
             _In_ sai_object_id_t rid,
@@ -1611,6 +1880,18 @@ public:
         SWSS_LOG_ENTER();
     }
 
+    void validateIds(
+            _In_ const std::vector<std::string>& idStrings) const override
+    {
+        SWSS_LOG_ENTER();
+
+        for (const auto &str : idStrings)
+        {
+            AttrType attr;
+            deserializeAttr(str, attr);
+        }
+    }
+
     void addObject(
             _In_ sai_object_id_t vid,
             _In_ sai_object_id_t rid,
@@ -1670,6 +1951,13 @@ public:
                 attrs[i].id = attrIds[i];
             }
 
+            std::unique_lock<std::mutex> lock(Base::m_pollMtx);
+
+            if (!Base::isPollable(vid))
+            {
+                continue;
+            }
+
             // Get attr
             sai_status_t status = Base::m_vendorSai->get(
                     Base::m_objectType,
@@ -1677,6 +1965,8 @@ public:
                     static_cast<uint32_t>(attrIds.size()),
                     attrs.data());
 
+            lock.unlock();
+
             if (status != SAI_STATUS_SUCCESS)
             {
                 SWSS_LOG_ERROR("Failed to get attr of %s 0x%" PRIx64 ": %d",
@@ -1790,11 +2080,30 @@ public:
         m_bulkMeterContexts.erase(it);
     }
 
+    void validateIds(
+            _In_ const std::vector<std::string>& idStrings) const override
+    {
+        SWSS_LOG_ENTER();
+
+        for (const auto &str : idStrings)
+        {
+            sai_meter_bucket_entry_stat_t stat;
+            deserializeStat(str.c_str(), &stat);
+        }
+    }
+
     void collectData(_In_ swss::Table &countersTable) override
     {
         SWSS_LOG_ENTER();
         for (auto &kv : m_bulkMeterContexts)
         {
+            std::lock_guard<std::mutex> lock(m_pollMtx);
+
+            if (!isPollable(kv.first))
+            {
+                continue;
+            }
+
             bulkCollectData(countersTable, kv.second);
         }
     }
@@ -2070,16 +2379,18 @@ FlexCounter::FlexCounter(
         _In_ const std::string& dbCounters,
         _In_ const bool noDoubleCheckBulkCapability):
     m_readyToPoll(false),
+    m_polling(false),
+    m_commandErrors(0),
     m_pollInterval(0),
     m_instanceId(instanceId),
     m_vendorSai(vendorSai),
     m_dbCounters(dbCounters),
+    m_isDiscarded(false),
     m_noDoubleCheckBulkCapability(noDoubleCheckBulkCapability)
 {
     SWSS_LOG_ENTER();
 
     m_enable = false;
-    m_isDiscarded = false;
 
     startFlexCounterThread();
 }
@@ -2148,46 +2459,67 @@ void FlexCounter::setStatsMode(
 }
 
 void FlexCounter::removeDataFromCountersDB(
-        _In_ sai_object_id_t vid,
+        _In_ const std::vector<sai_object_id_t>& vids,
         _In_ const std::string &ratePrefix)
 {
     SWSS_LOG_ENTER();
     swss::DBConnector db(m_dbCounters, 0);
     swss::RedisPipeline pipeline(&db);
-    swss::Table countersTable(&pipeline, COUNTERS_TABLE, false);
+    swss::Table countersTable(&pipeline, COUNTERS_TABLE, true);
+    swss::Table ratesTable(&pipeline, RATES_TABLE, true);
 
-    std::string vidStr = sai_serialize_object_id(vid);
-    countersTable.del(vidStr);
-    if (!ratePrefix.empty())
+    for (auto vid: vids)
     {
-        swss::Table ratesTable(&pipeline, RATES_TABLE, false);
-        ratesTable.del(vidStr);
-        ratesTable.del(vidStr + ratePrefix);
+        std::string vidStr = sai_serialize_object_id(vid);
+        countersTable.del(vidStr);
+        if (!ratePrefix.empty())
+        {
+            ratesTable.del(vidStr);
+            ratesTable.del(vidStr + ratePrefix);
+        }
     }
+
+    // all deletes are sent in one round trip
+    pipeline.flush();
 }
 
 void FlexCounter::removeCounterPlugins()
 {
-    MUTEX;
+    SWSS_LOG_ENTER();
 
+    m_isDiscarded = true;
+
+    runCommand([=]() { applyRemoveCounterPlugins(); }, {});
+}
+
+void FlexCounter::applyRemoveCounterPlugins()
+{
     SWSS_LOG_ENTER();
 
     for (const auto &kv : m_counterContext)
     {
         kv.second->removePlugins();
     }
-
-    m_isDiscarded = true;
 }
 
 void FlexCounter::addCounterPlugin(
         _In_ const std::vector<swss::FieldValueTuple>& values)
 {
-    MUTEX;
-
     SWSS_LOG_ENTER();
 
     m_isDiscarded = false;
+
+    runCommand([=]() { applyAddCounterPlugin(values); }, {});
+
+    // notify thread to start polling
+    notifyPoll();
+}
+
+void FlexCounter::applyAddCounterPlugin(
+        _In_ const std::vector<swss::FieldValueTuple>& values)
+{
+    SWSS_LOG_ENTER();
+
     uint32_t bulkChunkSize = 0;
     std::string bulkChunkSizePerPrefix;
 
@@ -2271,17 +2603,18 @@ void FlexCounter::addCounterPlugin(
             }
         }
     }
-
-    // notify thread to start polling
-    notifyPoll();
 }
 
 bool FlexCounter::isEmpty()
 {
-    MUTEX;
-
     SWSS_LOG_ENTER();
 
+    std::unique_lock<std::mutex> cmdLock(m_cmdMtx);
+
+    waitPollInterrupted(cmdLock);
+
+    MUTEX;
+
     return allIdsEmpty() && allPluginsEmpty();
 }
 
@@ -2289,7 +2622,21 @@ bool FlexCounter::isDiscarded()
 {
     SWSS_LOG_ENTER();
 
-    return isEmpty() && m_isDiscarded;
+    if (!m_isDiscarded)
+    {
+        return false;
+    }
+
+    // instance is about to be removed, so poll cycle in progress is
+    // interrupted to get exact answer
+
+    std::unique_lock<std::mutex> cmdLock(m_cmdMtx);
+
+    waitPollInterrupted(cmdLock);
+
+    MUTEX;
+
+    return allIdsEmpty() && allPluginsEmpty();
 }
 
 bool FlexCounter::allIdsEmpty() const
@@ -2536,6 +2883,11 @@ void FlexCounter::runPlugins(
 
     for (const auto &it : m_counterContext)
     {
+        if (it.second->isPollInterrupted())
+        {
+            continue;
+        }
+
         it.second->runPlugin(counters_db, argv);
     }
 }
@@ -2550,12 +2902,22 @@ void FlexCounter::flexCounterThreadRunFunction()
 
     while (m_runFlexCounterThread)
     {
+        std::unique_lock<std::mutex> cmdLock(m_cmdMtx);
+
         MUTEX;
 
+        applyCommands();
+
         if (m_enable && !allIdsEmpty() && (m_pollInterval > 0))
         {
             auto start = std::chrono::steady_clock::now();
 
+            // counter changes are queued until poll cycle ends
+
+            m_polling = true;
+
+            cmdLock.unlock();
+
             collectCounters(countersTable);
 
             runPlugins(db);
@@ -2567,6 +2929,25 @@ void FlexCounter::flexCounterThreadRunFunction()
 
             uint32_t correction = delay % m_pollInterval;
             correction = m_pollInterval - correction;
+
+            // callers don't wait for m_mtx while m_polling is set, so
+            // taking m_cmdMtx here can't deadlock
+
+            cmdLock.lock();
+
+            m_polling = false;
+
+            applyCommands();
+
+            for (const auto &it : m_counterContext)
+            {
+                it.second->interruptPoll(false);
+            }
+
+            cmdLock.unlock();
+
+            m_pollEndCond.notify_all();
+
             MUTEX_UNLOCK; // explicit unlock
 
             SWSS_LOG_DEBUG("End of flex counter thread FC %s, took %d ms", m_instanceId.c_str(), delay);
@@ -2580,6 +2961,8 @@ void FlexCounter::flexCounterThreadRunFunction()
 
         MUTEX_UNLOCK; // explicit unlock
 
+        cmdLock.unlock();
+
         // nothing to collect, wait until notified
         waitPoll();
     }
@@ -2627,151 +3010,206 @@ void FlexCounter::endFlexCounterThread(void)
     SWSS_LOG_INFO("Flex Counter thread ended");
 }
 
-void FlexCounter::removeCounter(
-        _In_ sai_object_id_t vid)
+void FlexCounter::runCommand(
+        _In_ const std::function<void()>& command,
+        _In_ const std::vector<sai_object_id_t>& removedVids)
 {
-    MUTEX;
-
     SWSS_LOG_ENTER();
 
-    auto objectType = VidManager::objectTypeQuery(vid);
+    std::unique_lock<std::mutex> cmdLock(m_cmdMtx);
 
-    if (objectType == SAI_OBJECT_TYPE_PORT)
+    if (m_polling)
     {
-        if (hasCounterContext(COUNTER_TYPE_PORT))
-        {
-            getCounterContext(COUNTER_TYPE_PORT)->removeObject(vid);
-        }
-        if (hasCounterContext(COUNTER_TYPE_PORT_DEBUG))
-        {
-            getCounterContext(COUNTER_TYPE_PORT_DEBUG)->removeObject(vid);
-        }
-        if (hasCounterContext(COUNTER_TYPE_WRED_ECN_PORT))
-        {
-            getCounterContext(COUNTER_TYPE_WRED_ECN_PORT)->removeObject(vid);
-        }
+        markRemoved(removedVids);
+
+        m_commands.push_back(command);
     }
-    else if (objectType == SAI_OBJECT_TYPE_QUEUE)
+    else
     {
-        if (hasCounterContext(COUNTER_TYPE_QUEUE))
-        {
-            getCounterContext(COUNTER_TYPE_QUEUE)->removeObject(vid);
-        }
-        if (hasCounterContext(COUNTER_TYPE_WRED_ECN_QUEUE))
-        {
-            getCounterContext(COUNTER_TYPE_WRED_ECN_QUEUE)->removeObject(vid);
-        }
-        if (hasCounterContext(ATTR_TYPE_QUEUE))
-        {
-            getCounterContext(ATTR_TYPE_QUEUE)->removeObject(vid);
-        }
+        // poll thread can't start poll cycle while m_cmdMtx is held
+
+        MUTEX;
+
+        command();
     }
-    else if (objectType == SAI_OBJECT_TYPE_INGRESS_PRIORITY_GROUP)
+}
+
+void FlexCounter::applyCommands()
+{
+    SWSS_LOG_ENTER();
+
+    for (auto& command: m_commands)
     {
-        if (hasCounterContext(COUNTER_TYPE_PG))
+        // commands are applied on poll thread after caller returned, so
+        // failure can't be reported to request which queued the command,
+        // don't let it end thread and don't throw it from unrelated call
+
+        try
         {
-            getCounterContext(COUNTER_TYPE_PG)->removeObject(vid);
+            command();
         }
-        if (hasCounterContext(ATTR_TYPE_PG))
+        catch (const std::exception& e)
         {
-            getCounterContext(ATTR_TYPE_PG)->removeObject(vid);
+            m_commandErrors++;
+
+            SWSS_LOG_ERROR("failed to apply queued counter command on %s (%" PRIu64 " failures): %s",
+                    m_instanceId.c_str(),
+                    m_commandErrors,
+                    e.what());
         }
     }
-    else if (objectType == SAI_OBJECT_TYPE_ROUTER_INTERFACE)
+
+    m_commands.clear();
+}
+
+void FlexCounter::waitPollInterrupted(
+        _Inout_ std::unique_lock<std::mutex>& cmdLock)
+{
+    SWSS_LOG_ENTER();
+
+    if (!m_polling)
     {
-        if (hasCounterContext(COUNTER_TYPE_RIF))
-        {
-            removeDataFromCountersDB(vid, ":RIF");
-            getCounterContext(COUNTER_TYPE_RIF)->removeObject(vid);
-        }
+        return;
     }
-    else if (objectType == SAI_OBJECT_TYPE_BUFFER_POOL)
+
+    for (const auto &it : m_counterContext)
     {
-        if (hasCounterContext(COUNTER_TYPE_BUFFER_POOL))
-        {
-            getCounterContext(COUNTER_TYPE_BUFFER_POOL)->removeObject(vid);
-        }
+        it.second->interruptPoll(true);
     }
-    else if (objectType == SAI_OBJECT_TYPE_SWITCH)
+
+    m_pollEndCond.wait(cmdLock, [&](){ return !m_polling; });
+}
+
+void FlexCounter::validateCounterIds(
+        _In_ sai_object_type_t objectType,
+        _In_ const std::vector<swss::FieldValueTuple>& values)
+{
+    SWSS_LOG_ENTER();
+
+    for (const auto& valuePair: values)
     {
-        if (hasCounterContext(COUNTER_TYPE_SWITCH_DEBUG))
+        const auto& field = fvField(valuePair);
+
+        std::string counterType;
+
+        const auto &counterGroupRef = m_objectTypeField2CounterType.find({objectType, field});
+
+        if (counterGroupRef != m_objectTypeField2CounterType.end())
         {
-            getCounterContext(COUNTER_TYPE_SWITCH_DEBUG)->removeObject(vid);
+            counterType = counterGroupRef->second;
         }
-        if (hasCounterContext(COUNTER_TYPE_SWITCH))
+        else if (objectType == SAI_OBJECT_TYPE_BUFFER_POOL && field == BUFFER_POOL_COUNTER_ID_LIST)
         {
-            getCounterContext(COUNTER_TYPE_SWITCH)->removeObject(vid);
+            counterType = COUNTER_TYPE_BUFFER_POOL;
         }
-    }
-    else if (objectType == SAI_OBJECT_TYPE_MACSEC_FLOW)
-    {
-        if (hasCounterContext(COUNTER_TYPE_MACSEC_FLOW))
+        else
         {
-            getCounterContext(COUNTER_TYPE_MACSEC_FLOW)->removeObject(vid);
+            continue;
         }
+
+        // temporary context, existing ones may be in use by poll thread
+
+        createCounterContext(counterType, m_instanceId)->validateIds(swss::tokenize(fvValue(valuePair), ','));
     }
-    else if (objectType == SAI_OBJECT_TYPE_MACSEC_SA)
+}
+
+void FlexCounter::markRemoved(
+        _In_ const std::vector<sai_object_id_t>& vids)
+{
+    SWSS_LOG_ENTER();
+
+    std::map<sai_object_type_t, std::vector<sai_object_id_t>> vidsPerType;
+
+    for (auto vid: vids)
     {
-        if (hasCounterContext(COUNTER_TYPE_MACSEC_SA))
-        {
-            getCounterContext(COUNTER_TYPE_MACSEC_SA)->removeObject(vid);
-        }
+        vidsPerType[VidManager::objectTypeQuery(vid)].push_back(vid);
+    }
+
+    for (auto& kvp: vidsPerType)
+    {
+        auto it = m_objectType2CounterTypes.find(kvp.first);
 
-        if (hasCounterContext(ATTR_TYPE_MACSEC_SA))
+        if (it == m_objectType2CounterTypes.end())
         {
-            getCounterContext(ATTR_TYPE_MACSEC_SA)->removeObject(vid);
+            continue;
         }
-    }
-    else if (objectType == SAI_OBJECT_TYPE_ACL_COUNTER)
-    {
-        if (hasCounterContext(ATTR_TYPE_ACL_COUNTER))
+
+        for (auto& counterType: it->second)
         {
-            getCounterContext(ATTR_TYPE_ACL_COUNTER)->removeObject(vid);
+            auto ctx = m_counterContext.find(counterType);
+
+            if (ctx != m_counterContext.end())
+            {
+                ctx->second->markRemoved(kvp.second);
+            }
         }
     }
-    else if (objectType == SAI_OBJECT_TYPE_TUNNEL)
+}
+
+void FlexCounter::removeCounter(
+        _In_ sai_object_id_t vid)
+{
+    SWSS_LOG_ENTER();
+
+    bulkRemoveCounter({vid});
+}
+
+void FlexCounter::bulkRemoveCounter(
+        _In_ const std::vector<sai_object_id_t>& vids)
+{
+    SWSS_LOG_ENTER();
+
+    runCommand([=]() { applyBulkRemoveCounter(vids); }, vids);
+}
+
+void FlexCounter::applyBulkRemoveCounter(
+        _In_ const std::vector<sai_object_id_t>& vids)
+{
+    SWSS_LOG_ENTER();
+
+    std::map<sai_object_type_t, std::vector<sai_object_id_t>> vidsPerType;
+
+    for (auto vid: vids)
     {
-        if (hasCounterContext(COUNTER_TYPE_TUNNEL))
-        {
-            getCounterContext(COUNTER_TYPE_TUNNEL)->removeObject(vid);
-        }
+        vidsPerType[VidManager::objectTypeQuery(vid)].push_back(vid);
     }
-    else if (objectType == (sai_object_type_t)SAI_OBJECT_TYPE_ENI)
+
+    for (auto& kvp: vidsPerType)
     {
-        if (hasCounterContext(COUNTER_TYPE_ENI))
-        {
-            getCounterContext(COUNTER_TYPE_ENI)->removeObject(vid);
-        }
-        if (hasCounterContext(COUNTER_TYPE_METER_BUCKET))
+        auto objectType = kvp.first;
+        auto& typeVids = kvp.second;
+
+        auto it = m_objectType2CounterTypes.find(objectType);
+
+        if (it == m_objectType2CounterTypes.end())
         {
-            getCounterContext(COUNTER_TYPE_METER_BUCKET)->removeObject(vid);
+            SWSS_LOG_ERROR("Object type for removal not supported, %s",
+                    sai_serialize_object_type(objectType).c_str());
+            continue;
         }
-    }
-    else if (objectType == SAI_OBJECT_TYPE_COUNTER)
-    {
-        if (hasCounterContext(COUNTER_TYPE_FLOW))
+
+        for (auto& counterType: it->second)
         {
-            getCounterContext(COUNTER_TYPE_FLOW)->removeObject(vid);
-            removeDataFromCountersDB(vid, ":TRAP");
+            if (hasCounterContext(counterType))
+            {
+                auto context = getCounterContext(counterType);
+
+                context->bulkRemoveObject(typeVids);
+
+                // removal was marked if it was queued during poll cycle
+                context->unmarkRemoved(typeVids);
+            }
         }
 
-        if (hasCounterContext(COUNTER_TYPE_SRV6))
+        if (objectType == SAI_OBJECT_TYPE_ROUTER_INTERFACE && hasCounterContext(COUNTER_TYPE_RIF))
         {
-            getCounterContext(COUNTER_TYPE_SRV6)->removeObject(vid);
+            removeDataFromCountersDB(typeVids, ":RIF");
         }
-    }
-    else if (objectType == SAI_OBJECT_TYPE_POLICER)
-    {
-        if (hasCounterContext(COUNTER_TYPE_POLICER))
+        else if (objectType == SAI_OBJECT_TYPE_COUNTER && hasCounterContext(COUNTER_TYPE_FLOW))
         {
-            getCounterContext(COUNTER_TYPE_POLICER)->removeObject(vid);
+            removeDataFromCountersDB(typeVids, ":TRAP");
         }
     }
-    else
-    {
-        SWSS_LOG_ERROR("Object type for removal not supported, %s",
-                sai_serialize_object_type(objectType).c_str());
-    }
 }
 
 void FlexCounter::addCounter(
@@ -2779,8 +3217,21 @@ void FlexCounter::addCounter(
         _In_ sai_object_id_t rid,
         _In_ const std::vector<swss::FieldValueTuple>& values)
 {
-    MUTEX;
+    SWSS_LOG_ENTER();
+
+    validateCounterIds(VidManager::objectTypeQuery(vid), values);
 
+    runCommand([=]() { applyAddCounter(vid, rid, values); }, {});
+
+    // notify thread to start polling
+    notifyPoll();
+}
+
+void FlexCounter::applyAddCounter(
+        _In_ sai_object_id_t vid,
+        _In_ sai_object_id_t rid,
+        _In_ const std::vector<swss::FieldValueTuple>& values)
+{
     SWSS_LOG_ENTER();
 
     sai_object_type_t objectType = VidManager::objectTypeQuery(vid); // VID and RID will have the same object type
@@ -2831,19 +3282,30 @@ void FlexCounter::addCounter(
                 counterIds,
                 statsMode);
     }
+}
+
+void FlexCounter::bulkAddCounter(
+        _In_ sai_object_type_t objectType,
+        _In_ const std::vector<sai_object_id_t>& vids,
+        _In_ const std::vector<sai_object_id_t>& rids,
+        _In_ const std::vector<swss::FieldValueTuple>& values)
+{
+    SWSS_LOG_ENTER();
+
+    validateCounterIds(objectType, values);
+
+    runCommand([=]() { applyBulkAddCounter(objectType, vids, rids, values); }, {});
 
     // notify thread to start polling
     notifyPoll();
 }
 
-void FlexCounter::bulkAddCounter(
+void FlexCounter::applyBulkAddCounter(
         _In_ sai_object_type_t objectType,
         _In_ const std::vector<sai_object_id_t>& vids,
         _In_ const std::vector<sai_object_id_t>& rids,
         _In_ const std::vector<swss::FieldValueTuple>& values)
 {
-    MUTEX;
-
     SWSS_LOG_ENTER();
 
     std::vector<std::string> counterIds;
@@ -2892,9 +3354,6 @@ void FlexCounter::bulkAddCounter(
                 counterIds,
                 statsMode);
     }
-
-    // notify thread to start polling
-    notifyPoll();
 }
 
 void FlexCounter::waitPoll()
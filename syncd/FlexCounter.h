@@ -10,9 +10,12 @@ extern "C" {
 
 #include <vector>
 #include <set>
+#include <mutex>
 #include <condition_variable>
+#include <atomic>
 #include <unordered_map>
 #include <memory>
+#include <functional>
 #include <type_traits>
 
 namespace syncd
@@ -52,6 +55,12 @@ namespace syncd
         virtual void removeObject(
                 _In_ sai_object_id_t vid) = 0;
 
+        /**
+         * @brief Remove multiple objects, by default one by one.
+         */
+        virtual void bulkRemoveObject(
+                _In_ const std::vector<sai_object_id_t>& vids);
+
         virtual void collectData(
                 _In_ swss::Table &countersTable) = 0;
 
@@ -61,12 +70,63 @@ namespace syncd
 
         virtual bool hasObject() const = 0;
 
+        /**
+         * @brief Throw if any of counter or attribute names is invalid.
+         */
+        virtual void validateIds(
+                _In_ const std::vector<std::string>& idStrings) const = 0;
+
+        /**
+         * @brief Mark objects as removed, so poll cycle in progress will
+         * skip them.
+         *
+         * Returns when there is no vendor call in progress on any of
+         * those objects.
+         */
+        void markRemoved(
+                _In_ const std::vector<sai_object_id_t>& vids);
+
+        /**
+         * @brief Clear removed mark, after objects were removed from context.
+         */
+        void unmarkRemoved(
+                _In_ const std::vector<sai_object_id_t>& vids);
+
+        /**
+         * @brief Skip all remaining vendor calls of poll cycle in progress.
+         */
+        void interruptPoll(
+                _In_ bool interrupt);
+
+        bool isPollInterrupted() const;
+
+    protected:
+
+        /**
+         * @brief Check if object can be polled.
+         *
+         * Must be called with m_pollMtx held, and lock must be kept during
+         * vendor call on that object.
+         */
+        bool isPollable(
+                _In_ sai_object_id_t vid) const;
+
     protected:
         std::string m_name;
         std::string m_instanceId;
         std::set<std::string> m_plugins;
         std::string m_bulkChunkSizePerPrefix;
 
+        std::mutex m_pollMtx;
+
+        /**
+         * @brief Objects with pending removal, with number of pending
+         * removals per object.
+         */
+        std::unordered_map<sai_object_id_t, uint32_t> m_removedVids;
+
+        std::atomic_bool m_pollInterrupted;
+
     public:
         bool always_check_supported_counters = false;
         bool use_sai_stats_capa_query = true;
@@ -110,10 +170,78 @@ namespace syncd
             void removeCounter(
                     _In_ sai_object_id_t vid);
 
+            void bulkRemoveCounter(
+                    _In_ const std::vector<sai_object_id_t>& vids);
+
             bool isEmpty();
 
             bool isDiscarded();
 
+        private: // counter membership commands
+
+            /**
+             * @brief Run counter membership change.
+             *
+             * When poll cycle is not in progress, command is applied right
+             * away and its exceptions are thrown to caller. Otherwise
+             * command is queued and applied by poll thread when cycle ends,
+             * so caller never waits for poll cycle. Removed objects are
+             * marked right away, so they are not polled after this call
+             * returns. Failure of queued command is logged and counted by
+             * poll thread.
+             */
+            void runCommand(
+                    _In_ const std::function<void()>& command,
+                    _In_ const std::vector<sai_object_id_t>& removedVids);
+
+            /**
+             * @brief Apply all queued commands, must be called with m_cmdMtx
+             * and m_mtx held.
+             */
+            void applyCommands();
+
+            /**
+             * @brief Wait until poll cycle in progress ends, interrupting it.
+             *
+             * Must be called with m_cmdMtx held by lock.
+             */
+            void waitPollInterrupted(
+                    _Inout_ std::unique_lock<std::mutex>& cmdLock);
+
+            /**
+             * @brief Throw if counter or attribute names are not valid for
+             * given object type, without changing counter contexts.
+             */
+            void validateCounterIds(
+                    _In_ sai_object_type_t objectType,
+                    _In_ const std::vector<swss::FieldValueTuple>& values);
+
+            /**
+             * @brief Mark objects as removed in all their counter contexts,
+             * must be called with m_cmdMtx held.
+             */
+            void markRemoved(
+                    _In_ const std::vector<sai_object_id_t>& vids);
+
+            void applyAddCounterPlugin(
+                    _In_ const std::vector<swss::FieldValueTuple>& values);
+
+            void applyRemoveCounterPlugins();
+
+            void applyAddCounter(
+                    _In_ sai_object_id_t vid,
+                    _In_ sai_object_id_t rid,
+                    _In_ const std::vector<swss::FieldValueTuple>& values);
+
+            void applyBulkAddCounter(
+                    _In_ sai_object_type_t objectType,
+                    _In_ const std::vector<sai_object_id_t>& vids,
+                    _In_ const std::vector<sai_object_id_t>& rids,
+                    _In_ const std::vector<swss::FieldValueTuple>& values);
+
+            void applyBulkRemoveCounter(
+                    _In_ const std::vector<sai_object_id_t>& vids);
+
         private:
 
             void setPollInterval(
@@ -132,7 +260,7 @@ namespace syncd
 
         private: // remove counter
             void removeDataFromCountersDB(
-                    _In_ sai_object_id_t vid,
+                    _In_ const std::vector<sai_object_id_t>& vids,
                     _In_ const std::string &ratePrefix);
 
         private:
@@ -177,10 +305,27 @@ namespace syncd
 
             std::mutex m_mtx;
 
+            /**
+             * @brief Guards m_commands, m_polling and m_commandErrors, taken
+             * before m_mtx.
+             */
+            std::mutex m_cmdMtx;
+
+            std::vector<std::function<void()>> m_commands;
+
             std::condition_variable m_pollCond;
 
             bool m_readyToPoll;
 
+            bool m_polling;
+
+            std::condition_variable m_pollEndCond;
+
+            /**
+             * @brief Number of queued commands which failed on poll thread.
+             */
+            uint64_t m_commandErrors;
+
             uint32_t m_pollInterval;
 
             std::string m_instanceId;
@@ -193,7 +338,7 @@ namespace syncd
 
             std::string m_dbCounters;
 
-            bool m_isDiscarded;
+            std::atomic_bool m_isDiscarded;
 
             std::map<std::string, std::shared_ptr<BaseCounterContext>> m_counterContext;
 
@@ -202,5 +347,7 @@ namespace syncd
             static const std::map<std::string, std::string> m_plugIn2CounterType;
 
             static const std::map<std::tuple<sai_object_type_t, std::string>, std::string> m_objectTypeField2CounterType;
+
+            static const std::map<sai_object_type_t, std::vector<std::string>> m_objectType2CounterTypes;
     };
 }
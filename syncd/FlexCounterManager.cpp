@@ -137,3 +137,19 @@ void FlexCounterManager::removeCounter(
     }
 }
 
+void FlexCounterManager::bulkRemoveCounter(
+        _In_ const std::vector<sai_object_id_t>& vids,
+        _In_ const std::string& instanceId)
+{
+    SWSS_LOG_ENTER();
+
+    auto fc = getInstance(instanceId);
+
+    fc->bulkRemoveCounter(vids);
+
+    if (fc->isDiscarded())
+    {
+        removeInstance(instanceId);
+    }
+}
+
@@ -48,6 +48,10 @@ namespace syncd
                     _In_ sai_object_id_t vid,
                     _In_ const std::string& instanceId);
 
+            void bulkRemoveCounter(
+                    _In_ const std::vector<sai_object_id_t>& vids,
+                    _In_ const std::string& instanceId);
+
         private:
 
                 std::map<std::string, std::shared_ptr<FlexCounter>> m_flexCounters;
@@ -13,11 +13,13 @@ HardReiniter::HardReiniter(
         _In_ std::shared_ptr<RedisClient> client,
         _In_ std::shared_ptr<VirtualOidTranslator> translator,
         _In_ std::shared_ptr<sairedis::SaiInterface> sai,
-        _In_ std::shared_ptr<NotificationHandler> handler):
+        _In_ std::shared_ptr<NotificationHandler> handler,
+        _In_ uint32_t bulkSize):
     m_vendorSai(sai),
     m_translator(translator),
     m_client(client),
-    m_handler(handler)
+    m_handler(handler),
+    m_bulkSize(bulkSize)
 {
     SWSS_LOG_ENTER();
 
@@ -99,10 +101,13 @@ std::map<sai_object_id_t, std::shared_ptr<syncd::SaiSwitch>> HardReiniter::hardR
                 m_handler,
                 m_switchVidToRid.at(kvp.first),
                 m_switchRidToVid.at(kvp.first),
-                kvp.second);
+                kvp.second,
+                m_bulkSize);
 
         sr->hardReinit();
 
+        m_phaseTimes[kvp.first] = sr->getPhaseTimes();
+
         vec.push_back(sr);
     }
 
@@ -157,3 +162,10 @@ std::map<sai_object_id_t, std::shared_ptr<syncd::SaiSwitch>> HardReiniter::hardR
 
     return switches;
 }
+
+const std::map<sai_object_id_t, SingleReiniter::PhaseTimes>& HardReiniter::getPhaseTimes() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_phaseTimes;
+}
@@ -5,6 +5,7 @@
 #include "VirtualOidTranslator.h"
 #include "RedisClient.h"
 #include "NotificationHandler.h"
+#include "SingleReiniter.h"
 
 #include <string>
 #include <unordered_map>
@@ -27,7 +28,8 @@ namespace syncd
                     _In_ std::shared_ptr<RedisClient> client,
                     _In_ std::shared_ptr<VirtualOidTranslator> translator,
                     _In_ std::shared_ptr<sairedis::SaiInterface> sai,
-                    _In_ std::shared_ptr<NotificationHandler> handler);
+                    _In_ std::shared_ptr<NotificationHandler> handler,
+                    _In_ uint32_t bulkSize);
 
             virtual ~HardReiniter();
 
@@ -35,6 +37,11 @@ namespace syncd
 
             std::map<sai_object_id_t, std::shared_ptr<syncd::SaiSwitch>> hardReinit();
 
+            /**
+             * @brief Get hard reinit phase durations per switch VID.
+             */
+            const std::map<sai_object_id_t, SingleReiniter::PhaseTimes>& getPhaseTimes() const;
+
         private:
 
             void readAsicState();
@@ -59,5 +66,9 @@ namespace syncd
             std::shared_ptr<RedisClient> m_client;
 
             std::shared_ptr<NotificationHandler> m_handler;
+
+            uint32_t m_bulkSize;
+
+            std::map<sai_object_id_t, SingleReiniter::PhaseTimes> m_phaseTimes;
     };
 }
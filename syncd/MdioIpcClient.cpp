@@ -13,6 +13,8 @@
 #include <time.h>
 #include <pthread.h>
 #include <mutex>
+#include <vector>
+#include <algorithm>
 
 #include "MdioIpcClient.h"
 #include "MdioIpcCommon.h"
@@ -23,17 +25,26 @@ static std::mutex ipcMutex;
 
 /* Global variables */
 
-static int syncd_mdio_ipc_command(char *cmd, char *resp)
+static int sock = 0;
+static time_t timeout = 0;
+static struct sockaddr_un caddr;
+
+static void syncd_mdio_ipc_disconnect()
+{
+    // SWSS_LOG_ENTER(); // disabled
+
+    close(sock);
+    sock = 0;
+    unlink(caddr.sun_path);
+}
+
+static int syncd_mdio_ipc_connect()
 {
     // SWSS_LOG_ENTER(); // disabled
 
     int fd;
-    ssize_t ret;
-    size_t len;
-    struct sockaddr_un saddr, caddr;
-    static int sock = 0;
+    struct sockaddr_un saddr;
     static char path[128] = { 0 };
-    static time_t timeout = 0;
 
     if (timeout < time(NULL))
     {
@@ -94,14 +105,29 @@ static int syncd_mdio_ipc_command(char *cmd, char *resp)
         }
     }
 
+    return 0;
+}
+
+static int syncd_mdio_ipc_command(char *cmd, char *resp)
+{
+    // SWSS_LOG_ENTER(); // disabled
+
+    int rc;
+    ssize_t ret;
+    size_t len;
+
+    rc = syncd_mdio_ipc_connect();
+    if (rc != 0)
+    {
+        return rc;
+    }
+
     len = strlen(cmd);
     ret = send(sock, cmd, len, 0);
     if (ret < (ssize_t)len)
     {
         SWSS_LOG_ERROR("send failed, ret=%ld, expected=%ld\n", ret, len);
-        close(sock);
-        sock = 0;
-        unlink(caddr.sun_path);
+        syncd_mdio_ipc_disconnect();
         return -EIO;
     }
 
@@ -109,9 +135,7 @@ static int syncd_mdio_ipc_command(char *cmd, char *resp)
     if (ret <= 0)
     {
         SWSS_LOG_ERROR("recv failed, ret=%ld\n", ret);
-        close(sock);
-        sock = 0;
-        unlink(caddr.sun_path);
+        syncd_mdio_ipc_disconnect();
         return -EIO;
     }
 
@@ -119,6 +143,58 @@ static int syncd_mdio_ipc_command(char *cmd, char *resp)
     return (int)strtol(resp, NULL, 0);
 }
 
+static int syncd_mdio_ipc_batch(uint32_t count, syncd_mdio_ipc_batch_op_t *ops)
+{
+    // SWSS_LOG_ENTER(); // disabled
+
+    int rc;
+    ssize_t ret;
+    size_t len;
+    syncd_mdio_ipc_batch_hdr_t hdr;
+
+    rc = syncd_mdio_ipc_connect();
+    if (rc != 0)
+    {
+        return rc;
+    }
+
+    /* send header and operations in one message */
+    len = sizeof(hdr) + count * sizeof(syncd_mdio_ipc_batch_op_t);
+    std::vector<char> buf(len);
+    hdr.magic = SYNCD_IPC_BATCH_MAGIC;
+    hdr.count = count;
+    memcpy(buf.data(), &hdr, sizeof(hdr));
+    memcpy(buf.data() + sizeof(hdr), ops, count * sizeof(syncd_mdio_ipc_batch_op_t));
+
+    ret = send(sock, buf.data(), len, 0);
+    if (ret < (ssize_t)len)
+    {
+        SWSS_LOG_ERROR("send failed, ret=%ld, expected=%ld\n", ret, len);
+        syncd_mdio_ipc_disconnect();
+        return -EIO;
+    }
+
+    ret = recv(sock, buf.data(), len, MSG_WAITALL);
+    if (ret < (ssize_t)len)
+    {
+        SWSS_LOG_ERROR("recv failed, ret=%ld, expected=%ld\n", ret, len);
+        syncd_mdio_ipc_disconnect();
+        return -EIO;
+    }
+
+    memcpy(&hdr, buf.data(), sizeof(hdr));
+    if (hdr.magic != SYNCD_IPC_BATCH_MAGIC || hdr.count != count)
+    {
+        SWSS_LOG_ERROR("unexpected batch response, count=%u, expected=%u\n", hdr.count, count);
+        syncd_mdio_ipc_disconnect();
+        return -EIO;
+    }
+    memcpy(ops, buf.data() + sizeof(hdr), count * sizeof(syncd_mdio_ipc_batch_op_t));
+
+    timeout = time(NULL) + MDIO_CLIENT_TIMEOUT;
+    return 0;
+}
+
 
 /* Function to read data from MDIO interface */
 sai_status_t mdio_read(uint64_t platform_context, uint32_t mdio_addr, uint32_t reg_addr,
@@ -249,3 +325,45 @@ sai_status_t mdio_write_cl22(uint64_t platform_context, uint32_t mdio_addr, uint
     ipcMutex.unlock();
     return rc;
 }
+
+/* Function to execute batch of MDIO operations in one transaction */
+sai_status_t mdio_batch(uint64_t platform_context, uint32_t count, syncd_mdio_ipc_batch_op_t *ops)
+{
+    // SWSS_LOG_ENTER(); // disabled
+
+    int rc = SAI_STATUS_FAILURE;
+    uint32_t offset = 0;
+
+    ipcMutex.lock();
+
+    /* split into transactions of max. batch size */
+    while (offset < count)
+    {
+        uint32_t n = std::min(count - offset, (uint32_t)SYNCD_IPC_BATCH_MAX);
+
+        rc = syncd_mdio_ipc_batch(n, ops + offset);
+        if (rc != 0)
+        {
+            SWSS_LOG_ERROR("syncd_mdio_ipc_batch returns : %d\n", rc);
+            break;
+        }
+        offset += n;
+    }
+
+    ipcMutex.unlock();
+
+    if (rc != 0)
+    {
+        return SAI_STATUS_FAILURE;
+    }
+
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        if (ops[i].status != SAI_STATUS_SUCCESS)
+        {
+            return SAI_STATUS_FAILURE;
+        }
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
@@ -7,6 +7,8 @@ extern "C" {
 #include "sai.h"
 }
 
+#include "MdioIpcCommon.h"
+
 /* Function declarations */
 extern "C" {
 sai_status_t mdio_read(uint64_t platform_context, uint32_t mdio_addr, uint32_t reg_addr,
@@ -18,4 +20,11 @@ sai_status_t mdio_read_cl22(uint64_t platform_context, uint32_t mdio_addr, uint3
         uint32_t number_of_registers, uint32_t *data);
 sai_status_t mdio_write_cl22(uint64_t platform_context, uint32_t mdio_addr,
         uint32_t reg_addr, uint32_t number_of_registers, const uint32_t *data);
+
+/*
+ * Execute operations in order in one IPC round trip, per operation status
+ * and read values are returned in ops, returns failure if any operation
+ * failed.
+ */
+sai_status_t mdio_batch(uint64_t platform_context, uint32_t count, syncd_mdio_ipc_batch_op_t *ops);
 }
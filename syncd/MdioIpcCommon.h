@@ -1,3 +1,7 @@
+#pragma once
+
+#include <stdint.h>
+
 #define SYNCD_IPC_SOCK_SYNCD  "/var/run/sswsyncd"
 #define SYNCD_IPC_SOCK_HOST   "/var/run/docker-syncd"
 #define SYNCD_IPC_SOCK_FILE   "mdio-ipc"
@@ -5,5 +9,39 @@
 
 #define MDIO_SERVER_TIMEOUT   30     /* sec, connection timeout */
 #define MDIO_CLIENT_TIMEOUT   25     /* shorter than 30 sec on server side */
+#define MDIO_SERVER_RECV_TIMEOUT 1   /* sec, max. wait for rest of started request */
 
 #define MDIO_CONN_MAX         18     /* max. number of connections */
+
+/*
+ * Binary batch transaction
+ *
+ * Request:  syncd_mdio_ipc_batch_hdr_t followed by count operations
+ * Response: same header followed by the same operations with val and status
+ *           filled in, operations are executed in order
+ *
+ * Magic is not a printable character sequence, so server can tell batch
+ * message apart from text commands by its first 4 bytes.
+ */
+#define SYNCD_IPC_BATCH_MAGIC 0xB47C0001
+#define SYNCD_IPC_BATCH_MAX   1024   /* max. number of operations in batch */
+
+#define SYNCD_IPC_BATCH_OP_READ        0x0
+#define SYNCD_IPC_BATCH_OP_WRITE       0x1
+#define SYNCD_IPC_BATCH_OP_READ_CL22   0x2
+#define SYNCD_IPC_BATCH_OP_WRITE_CL22  0x3
+
+typedef struct syncd_mdio_ipc_batch_hdr_s
+{
+    uint32_t magic;
+    uint32_t count;
+} syncd_mdio_ipc_batch_hdr_t;
+
+typedef struct syncd_mdio_ipc_batch_op_s
+{
+    uint32_t op;
+    uint32_t mdio_addr;
+    uint32_t reg_addr;
+    uint32_t val;       /* value to write, or value read */
+    int32_t  status;    /* filled in by server */
+} syncd_mdio_ipc_batch_op_t;
@@ -5,10 +5,11 @@
 #include <errno.h>
 #include <string.h>
 #include <sys/types.h>
-#include <sys/select.h>
+#include <sys/epoll.h>
 #include <sys/socket.h>
 #include <sys/un.h>
 #include <time.h>
+#include <sys/time.h>
 #include <fcntl.h>
 #include <unistd.h>
 
@@ -22,6 +23,7 @@
 #include <boost/algorithm/string.hpp>
 #include <boost/algorithm/string/trim.hpp>
 #include <vector>
+#include <map>
 
 
 #ifndef COUNTOF
@@ -32,12 +34,6 @@ using namespace syncd;
 
 bool MdioIpcServer::m_syncdContext = true;
 
-typedef struct syncd_mdio_ipc_conn_s
-{
-    int    fd;
-    time_t timeout;
-} syncd_mdio_ipc_conn_t;
-
 MdioIpcServer::MdioIpcServer(
         _In_ std::shared_ptr<sairedis::SaiInterface> vendorSai,
         _In_ int globalContext):
@@ -196,23 +192,293 @@ sai_status_t MdioIpcServer::syncd_ipc_cmd_mdio_cl22(char *resp, int argc, char *
 #endif
 }
 
+/*
+ * Execute batch of operations in order, single pass in server thread so
+ * batch is not interleaved with operations of other IPC clients. Vendor SAI
+ * executes whole batch under single lock, so it's not interleaved with main
+ * loop and flex counter vendor calls either.
+ */
+sai_status_t MdioIpcServer::syncd_ipc_cmd_mdio_batch(uint32_t count, syncd_mdio_ipc_batch_op_t *ops)
+{
+    SWSS_LOG_ENTER();
+
+    auto vendorSai = std::dynamic_pointer_cast<VendorSai>(m_vendorSai);
+
+    if (vendorSai && m_switchRid != SAI_NULL_OBJECT_ID)
+    {
+        return vendorSai->switchMdioBatch(m_switchRid, count, ops);
+    }
+
+    // other SAI interfaces (unittests) don't share vendor lock, operations
+    // are executed one by one
+
+    sai_status_t rc = SAI_STATUS_SUCCESS;
+
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        syncd_mdio_ipc_batch_op_t& op = ops[i];
+
+        if (m_switchRid == SAI_NULL_OBJECT_ID)
+        {
+            op.status = SAI_STATUS_FAILURE;
+        }
+        else
+        {
+            switch (op.op)
+            {
+                case SYNCD_IPC_BATCH_OP_READ:
+                    op.status = m_vendorSai->switchMdioRead(m_switchRid, op.mdio_addr, op.reg_addr, 1, &op.val);
+                    break;
+
+                case SYNCD_IPC_BATCH_OP_WRITE:
+                    op.status = m_vendorSai->switchMdioWrite(m_switchRid, op.mdio_addr, op.reg_addr, 1, &op.val);
+                    break;
+
+#if (SAI_API_VERSION >= SAI_VERSION(1, 11, 0))
+                case SYNCD_IPC_BATCH_OP_READ_CL22:
+                    op.status = m_vendorSai->switchMdioCl22Read(m_switchRid, op.mdio_addr, op.reg_addr, 1, &op.val);
+                    break;
+
+                case SYNCD_IPC_BATCH_OP_WRITE_CL22:
+                    op.status = m_vendorSai->switchMdioCl22Write(m_switchRid, op.mdio_addr, op.reg_addr, 1, &op.val);
+                    break;
+#else
+                /* In this case, sai configuration should take care of mdio clause 22 */
+                case SYNCD_IPC_BATCH_OP_READ_CL22:
+                    op.status = m_vendorSai->switchMdioRead(m_switchRid, op.mdio_addr, op.reg_addr, 1, &op.val);
+                    break;
+
+                case SYNCD_IPC_BATCH_OP_WRITE_CL22:
+                    op.status = m_vendorSai->switchMdioWrite(m_switchRid, op.mdio_addr, op.reg_addr, 1, &op.val);
+                    break;
+#endif
+
+                default:
+                    op.status = SAI_STATUS_INVALID_PARAMETER;
+                    break;
+            }
+        }
+
+        if (op.status != SAI_STATUS_SUCCESS)
+        {
+            rc = SAI_STATUS_FAILURE;
+        }
+    }
+
+    if (m_switchRid == SAI_NULL_OBJECT_ID)
+    {
+        SWSS_LOG_ERROR("mdio switch id not initialized");
+    }
+
+    return rc;
+}
+
+/*
+ * Receive exactly len bytes, returns false if connection was closed, failed
+ * or client did not send the rest of the request within receive timeout set
+ * on accepted socket, so stalled client can't block the server.
+ */
+static bool syncd_ipc_recv_all(int sock, void *buf, size_t len)
+{
+    SWSS_LOG_ENTER();
+
+    size_t offset = 0;
+
+    while (offset < len)
+    {
+        ssize_t ret = recv(sock, (char *)buf + offset, len - offset, MSG_WAITALL);
+        if (ret <= 0)
+        {
+            if (ret < 0 && errno == EINTR)
+            {
+                continue;
+            }
+            if (ret < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+            {
+                SWSS_LOG_ERROR("socket %d: timeout, received %zu of %zu bytes", sock, offset, len);
+            }
+            return false;
+        }
+        offset += (size_t)ret;
+    }
+
+    return true;
+}
+
+bool MdioIpcServer::syncd_ipc_serve_batch(int sock_cli)
+{
+    SWSS_LOG_ENTER();
+
+    syncd_mdio_ipc_batch_hdr_t hdr;
+
+    if (!syncd_ipc_recv_all(sock_cli, &hdr, sizeof(hdr)))
+    {
+        return false;
+    }
+
+    if (hdr.count > SYNCD_IPC_BATCH_MAX)
+    {
+        /* stream is out of sync at this point, drop the connection */
+        SWSS_LOG_ERROR("batch of %u operations exceeds max %d", hdr.count, SYNCD_IPC_BATCH_MAX);
+        return false;
+    }
+
+    std::vector<syncd_mdio_ipc_batch_op_t> ops(hdr.count);
+
+    if (hdr.count && !syncd_ipc_recv_all(sock_cli, ops.data(), hdr.count * sizeof(syncd_mdio_ipc_batch_op_t)))
+    {
+        return false;
+    }
+
+    sai_status_t rc = syncd_ipc_cmd_mdio_batch(hdr.count, ops.data());
+    if (rc != SAI_STATUS_SUCCESS)
+    {
+        SWSS_LOG_ERROR("batch of %u operations returns %d", hdr.count, rc);
+    }
+
+    /* send header and operations in one message */
+    std::vector<char> resp(sizeof(hdr) + hdr.count * sizeof(syncd_mdio_ipc_batch_op_t));
+    memcpy(resp.data(), &hdr, sizeof(hdr));
+    if (hdr.count)
+    {
+        memcpy(resp.data() + sizeof(hdr), ops.data(), hdr.count * sizeof(syncd_mdio_ipc_batch_op_t));
+    }
+
+    if (send(sock_cli, resp.data(), resp.size(), 0) < (ssize_t)resp.size())
+    {
+        SWSS_LOG_ERROR("send() returns %d", errno);
+        return false;
+    }
+
+    return true;
+}
+
+bool MdioIpcServer::syncd_ipc_serve_text(int sock_cli)
+{
+    SWSS_LOG_ENTER();
+
+    int len;
+    char cmd[SYNCD_IPC_BUFF_SIZE], resp[SYNCD_IPC_BUFF_SIZE], *argv[64], *save;
+    int argc = 0;
+    sai_status_t rc = SAI_STATUS_NOT_SUPPORTED;
+
+    /* get the command message */
+    len = (int)recv(sock_cli, (void *)cmd, sizeof(cmd) - 1, 0);
+    if (len <= 0)
+    {
+        return false;
+    }
+    cmd[len] = 0;
+
+    /* tokenize the command string */
+    argc = 0;
+    std::string str(cmd);
+    boost::algorithm::trim(str);
+    boost::algorithm::to_lower(str);
+    std::vector<char>v(str.size()+1);
+    memcpy( &v.front(), str.c_str(), str.size() + 1 );
+    argv[argc++] = strtok_r(v.data(), " \t\r\n", &save);
+    while (argc < COUNTOF(argv))
+    {
+        argv[argc] = strtok_r(NULL, " \t\r\n", &save);
+        if (argv[argc] == NULL)
+            break;
+        ++argc;
+    }
+
+    /* command dispatch */
+    resp[0] = 0;
+    rc = SAI_STATUS_NOT_SUPPORTED;
+    if (argv[0] == NULL)
+    {
+        rc = SAI_STATUS_NOT_SUPPORTED;
+    }
+    else if (strcmp("mdio", argv[0]) == 0)
+    {
+        rc = MdioIpcServer::syncd_ipc_cmd_mdio(resp, argc, argv);
+        if (rc != 0)
+        {
+            SWSS_LOG_ERROR("command %s returns %d", cmd, rc);
+        }
+    }
+    else if (strcmp("mdio-cl22", argv[0]) == 0)
+    {
+        rc = MdioIpcServer::syncd_ipc_cmd_mdio_cl22(resp, argc, argv);
+        if (rc != 0)
+        {
+            SWSS_LOG_ERROR("command %s returns %d", cmd, rc);
+        }
+    }
+
+    /* build the error message */
+    if (rc != SAI_STATUS_SUCCESS)
+    {
+        sprintf(resp, "%d\n", rc);
+    }
+
+    /* send out the response */
+    len = (int)strlen(resp);
+    if (send(sock_cli, resp, len, 0) < len)
+    {
+        SWSS_LOG_ERROR("send() returns %d", errno);
+    }
+
+    return true;
+}
+
+bool MdioIpcServer::syncd_ipc_serve(int sock_cli)
+{
+    SWSS_LOG_ENTER();
+
+    uint32_t magic = 0;
+
+    /* peek at the first 4 bytes to tell batch from text command */
+    ssize_t ret = recv(sock_cli, &magic, sizeof(magic), MSG_PEEK);
+    if (ret <= 0)
+    {
+        return false;
+    }
+
+    if (ret < (ssize_t)sizeof(magic))
+    {
+        uint32_t batchMagic = SYNCD_IPC_BATCH_MAGIC;
+
+        if (memcmp(&magic, &batchMagic, (size_t)ret) == 0)
+        {
+            /* beginning of batch magic, wait for the rest of it */
+            ret = recv(sock_cli, &magic, sizeof(magic), MSG_PEEK | MSG_WAITALL);
+            if (ret < (ssize_t)sizeof(magic))
+            {
+                SWSS_LOG_ERROR("socket %d: incomplete batch header", sock_cli);
+                return false;
+            }
+        }
+        /* otherwise short text command */
+    }
+
+    if (ret == (ssize_t)sizeof(magic) && magic == SYNCD_IPC_BATCH_MAGIC)
+    {
+        return syncd_ipc_serve_batch(sock_cli);
+    }
+
+    return syncd_ipc_serve_text(sock_cli);
+}
+
 int MdioIpcServer::syncd_ipc_task_main()
 {
     SWSS_LOG_ENTER();
 
     int i;
+    int n;
     int fd;
-    int len;
-    int ret;
     int sock_srv;
     int sock_cli;
-    int sock_max;
-    syncd_mdio_ipc_conn_t conn[MDIO_CONN_MAX];
+    int epfd;
+    std::map<int, time_t> conn; /* socket descriptor to connection timeout */
     struct sockaddr_un addr;
+    struct epoll_event ev;
+    struct epoll_event events[MDIO_CONN_MAX + 1];
     char path[64];
-    fd_set rfds;
-    char cmd[SYNCD_IPC_BUFF_SIZE], resp[SYNCD_IPC_BUFF_SIZE], *argv[64], *save;
-    int argc = 0;
 
     strcpy(path, SYNCD_IPC_SOCK_SYNCD);
     fd = open(path, O_DIRECTORY);
@@ -257,53 +523,56 @@ int MdioIpcServer::syncd_ipc_task_main()
         return errno;
     }
 
+    epfd = epoll_create1(EPOLL_CLOEXEC);
+    if (epfd < 0)
+    {
+        SWSS_LOG_ERROR("epoll_create1() returns %d", errno);
+        unlink(addr.sun_path);
+        close(sock_srv);
+        return errno;
+    }
+
+    memset(&ev, 0, sizeof(ev));
+    ev.events = EPOLLIN;
+    ev.data.fd = sock_srv;
+    if (epoll_ctl(epfd, EPOLL_CTL_ADD, sock_srv, &ev) < 0)
+    {
+        SWSS_LOG_ERROR("epoll_ctl() returns %d", errno);
+        close(epfd);
+        unlink(addr.sun_path);
+        close(sock_srv);
+        return errno;
+    }
+
     SWSS_LOG_NOTICE("IPC service is online\n");
 
-    memset(conn, 0, sizeof(conn));
     while (m_taskAlive)
     {
         time_t now;
-        struct timeval timeout;
 
         /* garbage collection */
         now = time(NULL);
-        for (i = 0; i < MDIO_CONN_MAX; ++i)
+        for (auto it = conn.begin(); it != conn.end();)
         {
-            if ((conn[i].fd > 0) && (conn[i].timeout < now))
+            if (it->second < now)
             {
-                SWSS_LOG_NOTICE("socket %d: connection timeout\n", conn[i].fd);
-                close(conn[i].fd);
-                conn[i].fd = 0;
-                conn[i].timeout = 0;
+                SWSS_LOG_NOTICE("socket %d: connection timeout\n", it->first);
+                close(it->first); /* also removes it from epoll set */
+                it = conn.erase(it);
             }
-        }
-
-        /* reset read file descriptors */
-        FD_ZERO(&rfds);
-        FD_SET(sock_srv, &rfds);
-        sock_max = sock_srv;
-        for (i = 0; i < MDIO_CONN_MAX; ++i)
-        {
-            if (conn[i].fd <= 0)
-            {
-                continue;
-            }
-            FD_SET(conn[i].fd, &rfds);
-            if (sock_max < conn[i].fd)
+            else
             {
-                sock_max = conn[i].fd;
+                ++it;
             }
         }
 
         /* monitor the socket descriptors */
-        timeout.tv_sec = 1;
-        timeout.tv_usec = 0;
-        ret = select(sock_max + 1, &rfds, NULL, NULL, &timeout);
-        if (ret == 0)
+        n = epoll_wait(epfd, events, COUNTOF(events), 1000);
+        if (n == 0)
         {
             continue;
         }
-        else if (ret < 0)
+        else if (n < 0)
         {
             if (errno == EINTR)
             {
@@ -311,130 +580,82 @@ int MdioIpcServer::syncd_ipc_task_main()
             }
             else
             {
-                SWSS_LOG_ERROR("select() returns %d", errno);
+                SWSS_LOG_ERROR("epoll_wait() returns %d", errno);
                 break;
             }
         }
 
-        /* Accept the new connection */
-        now = time(NULL);
-        if (FD_ISSET(sock_srv, &rfds))
+        for (i = 0; i < n; ++i)
         {
-            sock_cli = accept(sock_srv, NULL, NULL);
-            if (sock_cli <= 0)
-            {
-                SWSS_LOG_ERROR("accept() returns %d", errno);
-                continue;
-            }
+            sock_cli = events[i].data.fd;
 
-            for (i = 0; i < MDIO_CONN_MAX; ++i)
+            /* Accept the new connection */
+            if (sock_cli == sock_srv)
             {
-                if (conn[i].fd <= 0)
+                sock_cli = accept(sock_srv, NULL, NULL);
+                if (sock_cli <= 0)
                 {
-                    break;
+                    SWSS_LOG_ERROR("accept() returns %d", errno);
+                    continue;
                 }
-            }
-            if (i < MDIO_CONN_MAX)
-            {
-                conn[i].fd = sock_cli;
-                conn[i].timeout = now + MDIO_SERVER_TIMEOUT;
-            }
-            else
-            {
-                SWSS_LOG_ERROR("too many connections!");
-                close(sock_cli);
-            }
-        }
-
-        /* Handle the client requests */
-        for (i = 0; i < MDIO_CONN_MAX; ++i)
-        {
-            sai_status_t rc = SAI_STATUS_NOT_SUPPORTED;
 
-            sock_cli = conn[i].fd;
-            if ((sock_cli <= 0) || !FD_ISSET(sock_cli, &rfds))
-            {
-                continue;
-            }
-
-            /* get the command message */
-            len = (int)recv(sock_cli, (void *)cmd, sizeof(cmd) - 1, 0);
-            if (len <= 0)
-            {
-                close(sock_cli);
-                conn[i].fd = 0;
-                conn[i].timeout = 0;
-                continue;
-            }
-            cmd[len] = 0;
-
-            /* tokenize the command string */
-            argc = 0;
-            std::string str(cmd);
-            boost::algorithm::trim(str);
-            boost::algorithm::to_lower(str);
-            std::vector<char>v(str.size()+1);
-            memcpy( &v.front(), str.c_str(), str.size() + 1 );
-            argv[argc++] = strtok_r(v.data(), " \t\r\n", &save);
-            while (argc < COUNTOF(argv))
-            {
-                argv[argc] = strtok_r(NULL, " \t\r\n", &save);
-                if (argv[argc] == NULL)
-                    break;
-                ++argc;
-            }
+                if (conn.size() >= MDIO_CONN_MAX)
+                {
+                    SWSS_LOG_ERROR("too many connections!");
+                    close(sock_cli);
+                    continue;
+                }
 
-            /* command dispatch */
-            resp[0] = 0;
-            rc = SAI_STATUS_NOT_SUPPORTED;
-            if (argv[0] == NULL)
-            {
-                rc = SAI_STATUS_NOT_SUPPORTED;
-            }
-            else if (strcmp("mdio", argv[0]) == 0)
-            {
-                rc = MdioIpcServer::syncd_ipc_cmd_mdio(resp, argc, argv);
-                if (rc != 0)
+                /* bound blocking reads of partially sent requests */
+                struct timeval tv;
+                tv.tv_sec = MDIO_SERVER_RECV_TIMEOUT;
+                tv.tv_usec = 0;
+                if (setsockopt(sock_cli, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv)) < 0)
                 {
-                    SWSS_LOG_ERROR("command %s returns %d", cmd, rc);
+                    SWSS_LOG_ERROR("setsockopt() returns %d", errno);
+                    close(sock_cli);
+                    continue;
                 }
-            }
-            else if (strcmp("mdio-cl22", argv[0]) == 0)
-            {
-                rc = MdioIpcServer::syncd_ipc_cmd_mdio_cl22(resp, argc, argv);
-                if (rc != 0)
+
+                memset(&ev, 0, sizeof(ev));
+                ev.events = EPOLLIN;
+                ev.data.fd = sock_cli;
+                if (epoll_ctl(epfd, EPOLL_CTL_ADD, sock_cli, &ev) < 0)
                 {
-                    SWSS_LOG_ERROR("command %s returns %d", cmd, rc);
+                    SWSS_LOG_ERROR("epoll_ctl() returns %d", errno);
+                    close(sock_cli);
+                    continue;
                 }
+
+                conn[sock_cli] = time(NULL) + MDIO_SERVER_TIMEOUT;
+                continue;
             }
 
-            /* build the error message */
-            if (rc != SAI_STATUS_SUCCESS)
+            if (conn.find(sock_cli) == conn.end())
             {
-                sprintf(resp, "%d\n", rc);
+                /* already closed by garbage collection */
+                continue;
             }
 
-            /* send out the response */
-            len = (int)strlen(resp);
-            if (send(sock_cli, resp, len, 0) < len)
+            /* Handle the client request */
+            if (!syncd_ipc_serve(sock_cli))
             {
-                SWSS_LOG_ERROR("send() returns %d", errno);
+                close(sock_cli);
+                conn.erase(sock_cli);
+                continue;
             }
 
             /* update the connection timeout counter */
-            conn[i].timeout = time(NULL) + MDIO_SERVER_TIMEOUT;
+            conn[sock_cli] = time(NULL) + MDIO_SERVER_TIMEOUT;
         }
     }
 
     /* close socket descriptors */
-    for (i = 0; i < MDIO_CONN_MAX; ++i)
+    for (auto& c: conn)
     {
-        if (conn[i].fd <= 0)
-        {
-            continue;
-        }
-        close(conn[i].fd);
+        close(c.first);
     }
+    close(epfd);
     close(sock_srv);
     unlink(addr.sun_path);
     return errno;
@@ -2,6 +2,7 @@
 
 #include <thread>
 #include "VendorSai.h"
+#include "MdioIpcCommon.h"
 
 extern "C" {
 #include <sai.h>
@@ -39,6 +40,14 @@ namespace syncd
 
             int syncd_ipc_task_main();
 
+            bool syncd_ipc_serve(int sock_cli);
+
+            bool syncd_ipc_serve_text(int sock_cli);
+
+            bool syncd_ipc_serve_batch(int sock_cli);
+
+            sai_status_t syncd_ipc_cmd_mdio_batch(uint32_t count, syncd_mdio_ipc_batch_op_t *ops);
+
             sai_status_t syncd_ipc_cmd_mdio_common(char *resp, int argc, char *argv[]);
 
 #if (SAI_API_VERSION >= SAI_VERSION(1, 11, 0))
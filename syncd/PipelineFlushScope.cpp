@@ -0,0 +1,30 @@
+#include "PipelineFlushScope.h"
+
+#include "swss/logger.h"
+
+using namespace syncd;
+
+PipelineFlushScope::PipelineFlushScope(
+        _In_ std::shared_ptr<swss::RedisPipeline> pipeline):
+    m_pipeline(pipeline)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+PipelineFlushScope::~PipelineFlushScope()
+{
+    SWSS_LOG_ENTER();
+
+    // destructor can be called during stack unwinding, so it must not throw
+
+    try
+    {
+        m_pipeline->flush();
+    }
+    catch (const std::exception& e)
+    {
+        SWSS_LOG_ERROR("failed to flush redis pipeline: %s", e.what());
+    }
+}
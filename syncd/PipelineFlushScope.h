@@ -0,0 +1,34 @@
+#pragma once
+
+#include "swss/sal.h"
+#include "swss/redispipeline.h"
+
+#include <memory>
+
+namespace syncd
+{
+    /**
+     * @brief Flushes redis pipeline when scope is left.
+     *
+     * Writes buffered on pipeline are sent to redis also when scope is left
+     * by exception, so they are not left unsent until some later flush.
+     */
+    class PipelineFlushScope
+    {
+        private:
+
+            PipelineFlushScope(const PipelineFlushScope&) = delete;
+            PipelineFlushScope& operator=(const PipelineFlushScope&) = delete;
+
+        public:
+
+            PipelineFlushScope(
+                    _In_ std::shared_ptr<swss::RedisPipeline> pipeline);
+
+            ~PipelineFlushScope();
+
+        private:
+
+            std::shared_ptr<swss::RedisPipeline> m_pipeline;
+    };
+}
@@ -679,6 +679,38 @@ std::vector<std::string> RedisClient::getAsicStateKeys() const
     return m_dbAsic->keys(ASIC_STATE_TABLE ":*");
 }
 
+std::string RedisClient::scanAsicStateKeys(
+        _In_ const std::string& cursor,
+        _In_ uint32_t count,
+        _Out_ std::vector<std::string>& keys) const
+{
+    SWSS_LOG_ENTER();
+
+    swss::RedisCommand command;
+
+    command.format("SCAN %s MATCH %s COUNT %u", cursor.c_str(), ASIC_STATE_TABLE ":*", count);
+
+    swss::RedisReply r(m_dbAsic.get(), command, REDIS_REPLY_ARRAY);
+
+    auto reply = r.getContext();
+
+    if (reply->elements != 2)
+    {
+        SWSS_LOG_THROW("invalid SCAN reply, expected 2 elements, got %zu", reply->elements);
+    }
+
+    auto array = reply->element[1];
+
+    keys.clear();
+
+    for (size_t idx = 0; idx < array->elements; idx++)
+    {
+        keys.emplace_back(array->element[idx]->str, array->element[idx]->len);
+    }
+
+    return std::string(reply->element[0]->str, reply->element[0]->len);
+}
+
 std::vector<std::string> RedisClient::getAsicStateSwitchesKeys() const
 {
     SWSS_LOG_ENTER();
@@ -114,6 +114,19 @@ namespace syncd
 
             std::vector<std::string> getAsicStateKeys() const;
 
+            /**
+             * @brief Single SCAN iteration over ASIC_STATE keys.
+             *
+             * Start with cursor "0", iteration is finished when returned
+             * cursor is "0". Key can be returned more than once.
+             *
+             * @return Next cursor.
+             */
+            std::string scanAsicStateKeys(
+                    _In_ const std::string& cursor,
+                    _In_ uint32_t count,
+                    _Out_ std::vector<std::string>& keys) const;
+
             std::vector<std::string> getAsicStateSwitchesKeys() const;
 
             void removeColdVid(
@@ -5,6 +5,11 @@
 
 #include "meta/sai_serialize.h"
 
+#include <inttypes.h>
+
+#include <algorithm>
+#include <chrono>
+
 using namespace syncd;
 
 /**
@@ -19,11 +24,23 @@ using namespace syncd;
  */
 #define SAI_DISCOVERY_LIST_MAX_ELEMENTS 1024
 
+/**
+ * @def SAI_DISCOVERY_BULK_MAX_OBJECTS
+ *
+ * Defines maximum number of objects queried in single bulk get call. For list
+ * attributes each object needs its own buffer of
+ * SAI_DISCOVERY_LIST_MAX_ELEMENTS elements.
+ */
+#define SAI_DISCOVERY_BULK_MAX_OBJECTS 128
+
 SaiDiscovery::SaiDiscovery(
         _In_ std::shared_ptr<sairedis::SaiInterface> sai,
         _In_ Flags flags):
     m_sai(sai),
-    m_flags(flags)
+    m_flags(flags),
+    m_discoveryTime(0),
+    m_getCount(0),
+    m_bulkGetCount(0)
 {
     SWSS_LOG_ENTER();
 
@@ -61,9 +78,9 @@ SaiDiscovery::~SaiDiscovery()
     // empty
 }
 
-void SaiDiscovery::discover(
-        _In_ sai_object_id_t rid,
-        _Inout_ std::set<sai_object_id_t> &discovered)
+std::vector<sai_object_id_t> SaiDiscovery::discoverLevel(
+        _In_ const std::vector<sai_object_id_t>& rids,
+        _Inout_ std::set<sai_object_id_t>& discovered)
 {
     SWSS_LOG_ENTER();
 
@@ -75,178 +92,265 @@ void SaiDiscovery::discover(
      * dependency on each oid.
      */
 
-    if (rid == SAI_NULL_OBJECT_ID)
-    {
-        return;
-    }
+    std::set<sai_object_id_t> queued;
+
+    std::map<sai_object_type_t, std::vector<sai_object_id_t>> objects;
 
-    if (discovered.find(rid) != discovered.end())
+    for (sai_object_id_t rid: rids)
     {
-        return;
+        if (rid == SAI_NULL_OBJECT_ID)
+        {
+            continue;
+        }
+
+        if (discovered.find(rid) != discovered.end() || queued.find(rid) != queued.end())
+        {
+            continue;
+        }
+
+        sai_object_type_t ot = m_sai->objectTypeQuery(rid);
+
+        if (ot == SAI_OBJECT_TYPE_NULL)
+        {
+            SWSS_LOG_THROW("objectTypeQuery: rid %s returned NULL object type",
+                    sai_serialize_object_id(rid).c_str());
+        }
+
+        SWSS_LOG_DEBUG("processing %s: %s",
+                sai_serialize_object_id(rid).c_str(),
+                sai_serialize_object_type(ot).c_str());
+
+        /*
+         * We will ignore STP ports by now, since when removing bridge port, then
+         * associated stp port is automatically removed, and we don't use STP in
+         * out solution.  This causing inconsistency with redis ASIC view vs
+         * actual ASIC asic state.
+         *
+         * TODO: This needs to be solved by sending discovered state to sairedis
+         * metadata db for reference count.
+         *
+         * XXX: workaround
+         */
+
+        if (ot != SAI_OBJECT_TYPE_STP_PORT)
+        {
+            discovered.insert(rid);
+        }
+
+        queued.insert(rid);
+
+        objects[ot].push_back(rid);
     }
 
-    sai_object_type_t ot = m_sai->objectTypeQuery(rid);
+    std::vector<sai_object_id_t> next;
 
-    if (ot == SAI_OBJECT_TYPE_NULL)
+    for (const auto& kvp: objects)
     {
-        SWSS_LOG_THROW("objectTypeQuery: rid %s returned NULL object type",
-                sai_serialize_object_id(rid).c_str());
-    }
+        const sai_object_type_info_t *info = sai_metadata_get_object_type_info(kvp.first);
 
-    SWSS_LOG_DEBUG("processing %s: %s",
-            sai_serialize_object_id(rid).c_str(),
-            sai_serialize_object_type(ot).c_str());
+        /*
+         * We will query only oid object types then we don't need meta key,
+         * but we need to add to metadata pointers to only generic functions.
+         */
 
-    /*
-     * We will ignore STP ports by now, since when removing bridge port, then
-     * associated stp port is automatically removed, and we don't use STP in
-     * out solution.  This causing inconsistency with redis ASIC view vs
-     * actual ASIC asic state.
-     *
-     * TODO: This needs to be solved by sending discovered state to sairedis
-     * metadata db for reference count.
-     *
-     * XXX: workaround
-     */
+        for (int idx = 0; info->attrmetadata[idx] != NULL; ++idx)
+        {
+            const sai_attr_metadata_t *md = info->attrmetadata[idx];
 
-    if (ot != SAI_OBJECT_TYPE_STP_PORT)
-    {
-        discovered.insert(rid);
+            if (shouldQueryAttribute(md))
+            {
+                queryAttribute(md, kvp.second, next);
+            }
+        }
     }
 
-    const sai_object_type_info_t *info = sai_metadata_get_object_type_info(ot);
+    return next;
+}
+
+bool SaiDiscovery::shouldQueryAttribute(
+        _In_ const sai_attr_metadata_t* md)
+{
+    SWSS_LOG_ENTER();
 
     /*
-     * We will query only oid object types
-     * then we don't need meta key, but we need to add to metadata
-     * pointers to only generic functions.
+     * Note that we don't care about ACL object id's since
+     * we assume that there are no ACLs on switch after init.
      */
 
-    sai_object_meta_key_t mk = { .objecttype = ot, .objectkey = { .key = { .object_id = rid } } };
-
-    for (int idx = 0; info->attrmetadata[idx] != NULL; ++idx)
+    if (!m_attrVersionChecker.isSufficientVersion(md))
     {
-        const sai_attr_metadata_t *md = info->attrmetadata[idx];
+        return false;
+    }
 
-        /*
-         * Note that we don't care about ACL object id's since
-         * we assume that there are no ACLs on switch after init.
-         */
+    if (m_unsupportedAttributes.find(std::make_pair(md->objecttype, md->attrid)) != m_unsupportedAttributes.end())
+    {
+        return false;
+    }
 
-        sai_attribute_t attr;
+    if (md->attrvaluetype == SAI_ATTR_VALUE_TYPE_OBJECT_ID)
+    {
+        if (md->defaultvaluetype == SAI_DEFAULT_VALUE_TYPE_CONST)
+        {
+            /*
+             * This means that default value for this object is
+             * SAI_NULL_OBJECT_ID, since this is discovery after
+             * create, we don't need to query this attribute.
+             */
 
-        attr.id = md->attrid;
+            if (m_flags & Flags::SkipDefaultEmptyAttributes)
+            {
+                return false;
+            }
+        }
 
-        if (!m_attrVersionChecker.isSufficientVersion(md))
+        if (md->objecttype == SAI_OBJECT_TYPE_STP &&
+                md->attrid == SAI_STP_ATTR_BRIDGE_ID)
         {
-            continue;
+            // XXX workaround (for mlnx)
+            SWSS_LOG_WARN("skipping since it causes crash: %s", md->attridname);
+            return false;
         }
 
-        if (md->attrvaluetype == SAI_ATTR_VALUE_TYPE_OBJECT_ID)
+        if (md->objecttype == SAI_OBJECT_TYPE_BRIDGE_PORT)
         {
-            if (md->defaultvaluetype == SAI_DEFAULT_VALUE_TYPE_CONST)
+            if (md->attrid == SAI_BRIDGE_PORT_ATTR_TUNNEL_ID ||
+                    md->attrid == SAI_BRIDGE_PORT_ATTR_RIF_ID)
             {
                 /*
-                 * This means that default value for this object is
-                 * SAI_NULL_OBJECT_ID, since this is discovery after
-                 * create, we don't need to query this attribute.
+                 * We know that bridge port is bound on PORT, no need
+                 * to query those attributes.
                  */
 
-                if (m_flags & Flags::SkipDefaultEmptyAttributes)
-                {
-                    continue;
-                }
+                return false;
             }
+        }
+
+        return true;
+    }
 
-            if (md->objecttype == SAI_OBJECT_TYPE_STP &&
-                    md->attrid == SAI_STP_ATTR_BRIDGE_ID)
+    if (md->attrvaluetype == SAI_ATTR_VALUE_TYPE_OBJECT_LIST)
+    {
+        if (md->defaultvaluetype == SAI_DEFAULT_VALUE_TYPE_EMPTY_LIST)
+        {
+            /*
+             * This means that default value for this object is
+             * empty list, since this is discovery after
+             * create, we don't need to query this attribute.
+             */
+
+            if (m_flags & Flags::SkipDefaultEmptyAttributes)
             {
-                // XXX workaround (for mlnx)
-                SWSS_LOG_WARN("skipping since it causes crash: %s", md->attridname);
-                continue;
+                return false;
             }
+        }
 
-            if (md->objecttype == SAI_OBJECT_TYPE_BRIDGE_PORT)
-            {
-                if (md->attrid == SAI_BRIDGE_PORT_ATTR_TUNNEL_ID ||
-                        md->attrid == SAI_BRIDGE_PORT_ATTR_RIF_ID)
-                {
-                    /*
-                     * We know that bridge port is bound on PORT, no need
-                     * to query those attributes.
-                     */
+        return true;
+    }
 
-                    continue;
-                }
-            }
+    return false;
+}
 
-            SWSS_LOG_DEBUG("getting %s for %s", md->attridname,
-                    sai_serialize_object_id(rid).c_str());
+void SaiDiscovery::queryAttribute(
+        _In_ const sai_attr_metadata_t* md,
+        _In_ const std::vector<sai_object_id_t>& rids,
+        _Inout_ std::vector<sai_object_id_t>& next)
+{
+    SWSS_LOG_ENTER();
 
-            sai_status_t status = m_sai->get(mk.objecttype, mk.objectkey.key.object_id, 1, &attr);
+    bool isList = md->attrvaluetype == SAI_ATTR_VALUE_TYPE_OBJECT_LIST;
 
-            if (status != SAI_STATUS_SUCCESS)
-            {
-                /*
-                 * We failed to get value, maybe it's not supported ?
-                 */
+    auto attrKey = std::make_pair(md->objecttype, md->attrid);
 
-                SWSS_LOG_INFO("%s: %s on %s",
-                        md->attridname,
-                        sai_serialize_status(status).c_str(),
-                        sai_serialize_object_id(rid).c_str());
+    for (size_t start = 0; start < rids.size(); start += SAI_DISCOVERY_BULK_MAX_OBJECTS)
+    {
+        if (m_unsupportedAttributes.find(attrKey) != m_unsupportedAttributes.end())
+        {
+            break;
+        }
 
-                continue;
+        uint32_t objectCount = (uint32_t)std::min(rids.size() - start, (size_t)SAI_DISCOVERY_BULK_MAX_OBJECTS);
+
+        const sai_object_id_t* objectIds = rids.data() + start;
+
+        std::vector<sai_attribute_t> attrs(objectCount);
+
+        std::vector<sai_object_id_t> lists(isList ? objectCount * SAI_DISCOVERY_LIST_MAX_ELEMENTS : 0);
+
+        std::vector<sai_status_t> statuses(objectCount, SAI_STATUS_NOT_EXECUTED);
+
+        for (uint32_t i = 0; i < objectCount; i++)
+        {
+            attrs[i].id = md->attrid;
+
+            if (isList)
+            {
+                attrs[i].value.objlist.count = SAI_DISCOVERY_LIST_MAX_ELEMENTS;
+                attrs[i].value.objlist.list = &lists[i * SAI_DISCOVERY_LIST_MAX_ELEMENTS];
             }
+        }
+
+        if (objectCount > 1 && m_bulkGetUnsupported.find(md->objecttype) == m_bulkGetUnsupported.end())
+        {
+            SWSS_LOG_DEBUG("bulk getting %s for %u objects", md->attridname, objectCount);
+
+            std::vector<uint32_t> attrCounts(objectCount, 1);
 
-            m_defaultOidMap[rid][attr.id] = attr.value.oid;
+            std::vector<sai_attribute_t*> attrLists(objectCount);
 
-            if (!md->allownullobjectid && attr.value.oid == SAI_NULL_OBJECT_ID)
+            for (uint32_t i = 0; i < objectCount; i++)
             {
-                // SWSS_LOG_WARN("got null on %s, but not allowed", md->attridname);
+                attrLists[i] = &attrs[i];
             }
 
-            if (attr.value.oid != SAI_NULL_OBJECT_ID)
+            m_bulkGetCount++;
+
+            sai_status_t status = m_sai->bulkGet(
+                    md->objecttype,
+                    objectCount,
+                    objectIds,
+                    attrCounts.data(),
+                    attrLists.data(),
+                    SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR,
+                    statuses.data());
+
+            if (status == SAI_STATUS_NOT_IMPLEMENTED || status == SAI_STATUS_NOT_SUPPORTED)
             {
-                ot = m_sai->objectTypeQuery(attr.value.oid);
+                SWSS_LOG_INFO("bulk get %s: %s, will query objects one by one",
+                        sai_serialize_object_type(md->objecttype).c_str(),
+                        sai_serialize_status(status).c_str());
 
-                if (ot == SAI_OBJECT_TYPE_NULL)
-                {
-                    SWSS_LOG_THROW("when query %s (on %s RID %s) got value %s objectTypeQuery returned NULL object type",
-                            md->attridname,
-                            sai_serialize_object_type(md->objecttype).c_str(),
-                            sai_serialize_object_id(rid).c_str(),
-                            sai_serialize_object_id(attr.value.oid).c_str());
-                }
-            }
+                m_bulkGetUnsupported.insert(md->objecttype);
 
-            discover(attr.value.oid, discovered); // recursion
+                std::fill(statuses.begin(), statuses.end(), SAI_STATUS_NOT_EXECUTED);
+            }
         }
-        else if (md->attrvaluetype == SAI_ATTR_VALUE_TYPE_OBJECT_LIST)
+
+        for (uint32_t i = 0; i < objectCount; i++)
         {
-            if (md->defaultvaluetype == SAI_DEFAULT_VALUE_TYPE_EMPTY_LIST)
+            sai_object_id_t rid = objectIds[i];
+
+            if (statuses[i] == SAI_STATUS_NOT_EXECUTED)
             {
-                /*
-                 * This means that default value for this object is
-                 * empty list, since this is discovery after
-                 * create, we don't need to query this attribute.
-                 */
+                if (m_unsupportedAttributes.find(attrKey) != m_unsupportedAttributes.end())
+                {
+                    break;
+                }
 
-                if (m_flags & Flags::SkipDefaultEmptyAttributes)
+                if (isList)
                 {
-                    continue;
+                    attrs[i].value.objlist.count = SAI_DISCOVERY_LIST_MAX_ELEMENTS;
+                    attrs[i].value.objlist.list = &lists[i * SAI_DISCOVERY_LIST_MAX_ELEMENTS];
                 }
-            }
 
-            SWSS_LOG_DEBUG("getting %s for %s", md->attridname,
-                    sai_serialize_object_id(rid).c_str());
+                SWSS_LOG_DEBUG("getting %s for %s", md->attridname,
+                        sai_serialize_object_id(rid).c_str());
 
-            sai_object_id_t local[SAI_DISCOVERY_LIST_MAX_ELEMENTS];
+                m_getCount++;
 
-            attr.value.objlist.count = SAI_DISCOVERY_LIST_MAX_ELEMENTS;
-            attr.value.objlist.list = local;
+                statuses[i] = m_sai->get(md->objecttype, rid, 1, &attrs[i]);
+            }
 
-            sai_status_t status = m_sai->get(mk.objecttype, mk.objectkey.key.object_id, 1, &attr);
+            sai_status_t status = statuses[i];
 
             if (status != SAI_STATUS_SUCCESS)
             {
@@ -259,29 +363,81 @@ void SaiDiscovery::discover(
                         sai_serialize_status(status).c_str(),
                         sai_serialize_object_id(rid).c_str());
 
+                if (status == SAI_STATUS_NOT_IMPLEMENTED ||
+                        status == SAI_STATUS_NOT_SUPPORTED ||
+                        SAI_STATUS_IS_ATTR_NOT_IMPLEMENTED(status) ||
+                        SAI_STATUS_IS_ATTR_NOT_SUPPORTED(status))
+                {
+                    /*
+                     * Attribute capability doesn't depend on object, so there
+                     * is no need to query it on other objects.
+                     */
+
+                    m_unsupportedAttributes.insert(attrKey);
+                }
+
                 continue;
             }
 
-            SWSS_LOG_DEBUG("list count %s %u", md->attridname, attr.value.objlist.count);
+            processAttributeValue(md, rid, attrs[i], next);
+        }
+    }
+}
 
-            for (uint32_t i = 0; i < attr.value.objlist.count; ++i)
-            {
-                sai_object_id_t oid = attr.value.objlist.list[i];
+void SaiDiscovery::processAttributeValue(
+        _In_ const sai_attr_metadata_t* md,
+        _In_ sai_object_id_t rid,
+        _In_ const sai_attribute_t& attr,
+        _Inout_ std::vector<sai_object_id_t>& next)
+{
+    SWSS_LOG_ENTER();
 
-                ot = m_sai->objectTypeQuery(oid);
+    if (md->attrvaluetype == SAI_ATTR_VALUE_TYPE_OBJECT_ID)
+    {
+        m_defaultOidMap[rid][attr.id] = attr.value.oid;
 
-                if (ot == SAI_OBJECT_TYPE_NULL)
-                {
-                    SWSS_LOG_THROW("when query %s (on %s RID %s) got value %s objectTypeQuery returned NULL object type",
-                            md->attridname,
-                            sai_serialize_object_type(md->objecttype).c_str(),
-                            sai_serialize_object_id(rid).c_str(),
-                            sai_serialize_object_id(oid).c_str());
-                }
+        if (!md->allownullobjectid && attr.value.oid == SAI_NULL_OBJECT_ID)
+        {
+            // SWSS_LOG_WARN("got null on %s, but not allowed", md->attridname);
+        }
 
-                discover(oid, discovered); // recursion
+        if (attr.value.oid != SAI_NULL_OBJECT_ID)
+        {
+            sai_object_type_t ot = m_sai->objectTypeQuery(attr.value.oid);
+
+            if (ot == SAI_OBJECT_TYPE_NULL)
+            {
+                SWSS_LOG_THROW("when query %s (on %s RID %s) got value %s objectTypeQuery returned NULL object type",
+                        md->attridname,
+                        sai_serialize_object_type(md->objecttype).c_str(),
+                        sai_serialize_object_id(rid).c_str(),
+                        sai_serialize_object_id(attr.value.oid).c_str());
             }
+
+            next.push_back(attr.value.oid);
         }
+
+        return;
+    }
+
+    SWSS_LOG_DEBUG("list count %s %u", md->attridname, attr.value.objlist.count);
+
+    for (uint32_t i = 0; i < attr.value.objlist.count; ++i)
+    {
+        sai_object_id_t oid = attr.value.objlist.list[i];
+
+        sai_object_type_t ot = m_sai->objectTypeQuery(oid);
+
+        if (ot == SAI_OBJECT_TYPE_NULL)
+        {
+            SWSS_LOG_THROW("when query %s (on %s RID %s) got value %s objectTypeQuery returned NULL object type",
+                    md->attridname,
+                    sai_serialize_object_type(md->objecttype).c_str(),
+                    sai_serialize_object_id(rid).c_str(),
+                    sai_serialize_object_id(oid).c_str());
+        }
+
+        next.push_back(oid);
     }
 }
 
@@ -310,22 +466,42 @@ std::set<sai_object_id_t> SaiDiscovery::discover(
 
     std::set<sai_object_id_t> discovered_rids;
 
+    m_getCount = 0;
+    m_bulkGetCount = 0;
+
     {
         SWSS_LOG_TIMER("discover");
 
+        auto start = std::chrono::steady_clock::now();
+
         auto levels = getApiLogLevel();
 
         setApiLogLevel(SAI_LOG_LEVEL_CRITICAL);
 
-        for (size_t idx = 0; idx < count; idx++)
+        /*
+         * Object graph is processed breadth first, so all objects of the same
+         * type on given level can be queried together.
+         */
+
+        std::vector<sai_object_id_t> level(rids, rids + count);
+
+        while (level.size())
         {
-            discover(rids[idx], discovered_rids);
+            level = discoverLevel(level, discovered_rids);
         }
 
         setApiLogLevel(levels);
+
+        auto end = std::chrono::steady_clock::now();
+
+        m_discoveryTime = (uint64_t)std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
     }
 
-    SWSS_LOG_NOTICE("discovered objects count: %zu", discovered_rids.size());
+    SWSS_LOG_NOTICE("discovered objects count: %zu in %" PRIu64 " ms, get calls: %" PRIu64 ", bulk get calls: %" PRIu64,
+            discovered_rids.size(),
+            m_discoveryTime,
+            m_getCount,
+            m_bulkGetCount);
 
     std::map<sai_object_type_t, int> map;
 
@@ -354,6 +530,27 @@ const SaiDiscovery::DefaultOidMap& SaiDiscovery::getDefaultOidMap() const
     return m_defaultOidMap;
 }
 
+uint64_t SaiDiscovery::getDiscoveryTime() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_discoveryTime;
+}
+
+uint64_t SaiDiscovery::getGetCount() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_getCount;
+}
+
+uint64_t SaiDiscovery::getBulkGetCount() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_bulkGetCount;
+}
+
 void SaiDiscovery::setApiLogLevel(
         _In_ sai_log_level_t logLevel)
 {
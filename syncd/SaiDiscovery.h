@@ -7,6 +7,7 @@
 #include <memory>
 #include <set>
 #include <map>
+#include <vector>
 #include <unordered_map>
 
 #include "swss/logger.h"
@@ -52,24 +53,47 @@ namespace syncd
 
             const DefaultOidMap& getDefaultOidMap() const;
 
+            /**
+             * @brief Duration of last discover call in milliseconds.
+             */
+            uint64_t getDiscoveryTime() const;
+
+            uint64_t getGetCount() const;
+
+            uint64_t getBulkGetCount() const;
+
         private:
 
             /**
-             * @brief Discover objects on the switch.
+             * @brief Discover single level of objects on the switch.
              *
-             * Method will query recursively all OID attributes (oid and list) on
-             * the given object.
+             * Method will query all OID attributes (oid and list) on given
+             * objects, objects of the same type are queried using bulk get if
+             * vendor supports it.
              *
-             * This method should be called only once inside constructor right
-             * after switch has been created to obtain actual ASIC view.
+             * @param rids Objects to discover other objects.
+             * @param discovered Set of already discovered objects. This set
+             * will be updated every time new object ID is discovered.
              *
-             * @param rid Object to discover other objects.
-             * @param processed Set of already processed objects. This set will be
-             * updated every time new object ID is discovered.
+             * @return Object IDs found in attributes, next level to discover.
              */
-            void discover(
+            std::vector<sai_object_id_t> discoverLevel(
+                    _In_ const std::vector<sai_object_id_t>& rids,
+                    _Inout_ std::set<sai_object_id_t>& discovered);
+
+            bool shouldQueryAttribute(
+                    _In_ const sai_attr_metadata_t* md);
+
+            void queryAttribute(
+                    _In_ const sai_attr_metadata_t* md,
+                    _In_ const std::vector<sai_object_id_t>& rids,
+                    _Inout_ std::vector<sai_object_id_t>& next);
+
+            void processAttributeValue(
+                    _In_ const sai_attr_metadata_t* md,
                     _In_ sai_object_id_t rid,
-                    _Inout_ std::set<sai_object_id_t> &processed);
+                    _In_ const sai_attribute_t& attr,
+                    _Inout_ std::vector<sai_object_id_t>& next);
 
             void setApiLogLevel(
                     _In_ sai_log_level_t logLevel);
@@ -88,5 +112,19 @@ namespace syncd
             DefaultOidMap m_defaultOidMap;
 
             AttrVersionChecker m_attrVersionChecker;
+
+            /**
+             * @brief Attributes which vendor reported as not implemented or
+             * not supported, they are not queried again on other objects.
+             */
+            std::set<std::pair<sai_object_type_t, sai_attr_id_t>> m_unsupportedAttributes;
+
+            std::set<sai_object_type_t> m_bulkGetUnsupported;
+
+            uint64_t m_discoveryTime;
+
+            uint64_t m_getCount;
+
+            uint64_t m_bulkGetCount;
     };
 }
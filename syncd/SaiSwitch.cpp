@@ -7,11 +7,15 @@
 
 #include "meta/sai_serialize.h"
 #include "swss/logger.h"
+#include "swss/dbconnector.h"
+#include "swss/table.h"
 
 using namespace syncd;
 
 #define MAX_OBJLIST_LEN 128
 
+#define STATE_SYNCD_DISCOVERY_TABLE_NAME "SYNCD_DISCOVERY_TABLE"
+
 #define MAX_LANES_PER_PORT 8
 
 /*
@@ -713,6 +717,38 @@ void SaiSwitch::helperDiscover()
     m_discovered_rids = sd.discover(m_switch_rid);
 
     m_defaultOidMap = sd.getDefaultOidMap();
+
+    helperSaveDiscoveryStats(sd, m_discovered_rids.size());
+}
+
+void SaiSwitch::helperSaveDiscoveryStats(
+        _In_ const SaiDiscovery& sd,
+        _In_ size_t discoveredCount)
+{
+    SWSS_LOG_ENTER();
+
+    try
+    {
+        swss::DBConnector db("STATE_DB", 0);
+
+        swss::Table table(&db, STATE_SYNCD_DISCOVERY_TABLE_NAME);
+
+        std::vector<swss::FieldValueTuple> values;
+
+        values.emplace_back("discovery_time_ms", std::to_string(sd.getDiscoveryTime()));
+        values.emplace_back("discovered_objects", std::to_string(discoveredCount));
+        values.emplace_back("get_calls", std::to_string(sd.getGetCount()));
+        values.emplace_back("bulk_get_calls", std::to_string(sd.getBulkGetCount()));
+        values.emplace_back("warm_boot", m_warmBoot ? "true" : "false");
+
+        table.set(sai_serialize_object_id(m_switch_vid), values);
+    }
+    catch (const std::exception& e)
+    {
+        // statistics are informational only, don't fail switch init
+
+        SWSS_LOG_WARN("failed to save discovery stats to STATE_DB: %s", e.what());
+    }
 }
 
 void SaiSwitch::helperLoadColdVids()
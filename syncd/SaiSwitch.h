@@ -8,6 +8,7 @@ extern "C" {
 #include "VirtualOidTranslator.h"
 #include "RedisClient.h"
 #include "SaiSwitchInterface.h"
+#include "SaiDiscovery.h"
 
 #include <set>
 #include <string>
@@ -301,6 +302,13 @@ namespace syncd
              */
             void helperDiscover();
 
+            /**
+             * @brief Save discovery statistics to STATE_DB.
+             */
+            void helperSaveDiscoveryStats(
+                    _In_ const SaiDiscovery& sd,
+                    _In_ size_t discoveredCount);
+
             void helperSaveDiscoveredObjectsToRedis();
 
             void helperInternalOids();
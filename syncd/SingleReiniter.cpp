@@ -12,6 +12,9 @@
 #include <unistd.h>
 #include <inttypes.h>
 
+#include <algorithm>
+#include <chrono>
+
 using namespace syncd;
 using namespace saimeta;
 
@@ -22,14 +25,16 @@ SingleReiniter::SingleReiniter(
         _In_ std::shared_ptr<NotificationHandler> handler,
         _In_ const ObjectIdMap& vidToRidMap,
         _In_ const ObjectIdMap& ridToVidMap,
-        _In_ const std::vector<std::string>& asicKeys):
+        _In_ const std::vector<std::string>& asicKeys,
+        _In_ uint32_t bulkSize):
     m_vendorSai(sai),
     m_vidToRidMap(vidToRidMap),
     m_ridToVidMap(ridToVidMap),
     m_asicKeys(asicKeys),
     m_translator(translator),
     m_client(client),
-    m_handler(handler)
+    m_handler(handler),
+    m_bulkSize(bulkSize)
 {
     SWSS_LOG_ENTER();
 
@@ -50,16 +55,16 @@ std::shared_ptr<SaiSwitch> SingleReiniter::hardReinit()
 
     SWSS_LOG_TIMER("hard reinit");
 
-    prepareAsicState();
+    runPhase("read asic state", [&]{ prepareAsicState(); });
 
-    processSwitches();
-    processFdbs();
-    processNeighbors();
-    processOids();
-    processRoutes(true);
-    processRoutes(false);
-    processInsegs();
-    processNatEntries();
+    runPhase("switches", [&]{ processSwitches(); });
+    runPhase("fdbs", [&]{ processFdbs(); });
+    runPhase("neighbors", [&]{ processNeighbors(); });
+    runPhase("oids", [&]{ processOids(); });
+    runPhase("default routes", [&]{ processRoutes(true); });
+    runPhase("routes", [&]{ processRoutes(false); });
+    runPhase("insegs", [&]{ processInsegs(); });
+    runPhase("nat entries", [&]{ processNatEntries(); });
 
 #ifdef ENABLE_PERF
 
@@ -377,6 +382,12 @@ void SingleReiniter::processFdbs()
 
         processAttributesForOids(SAI_OBJECT_TYPE_FDB_ENTRY, attrCount, attrList);
 
+        if (isBulkEnabled(SAI_OBJECT_TYPE_FDB_ENTRY))
+        {
+            queueEntry(meta_key, asicKey);
+            continue;
+        }
+
         sai_status_t status = m_vendorSai->create(&meta_key.objectkey.key.fdb_entry, attrCount, attrList);
 
         if (status != SAI_STATUS_SUCCESS)
@@ -388,6 +399,8 @@ void SingleReiniter::processFdbs()
                     sai_serialize_status(status).c_str());
         }
     }
+
+    flushEntries();
 }
 
 void SingleReiniter::processNeighbors()
@@ -415,6 +428,12 @@ void SingleReiniter::processNeighbors()
 
         processAttributesForOids(SAI_OBJECT_TYPE_NEIGHBOR_ENTRY, attrCount, attrList);
 
+        if (isBulkEnabled(SAI_OBJECT_TYPE_NEIGHBOR_ENTRY))
+        {
+            queueEntry(meta_key, asicKey);
+            continue;
+        }
+
         sai_status_t status = m_vendorSai->create(&meta_key.objectkey.key.neighbor_entry, attrCount, attrList);
 
         if (status != SAI_STATUS_SUCCESS)
@@ -426,6 +445,8 @@ void SingleReiniter::processNeighbors()
                     sai_serialize_status(status).c_str());
         }
     }
+
+    flushEntries();
 }
 
 void SingleReiniter::processRoutes(
@@ -469,6 +490,12 @@ void SingleReiniter::processRoutes(
 
         processAttributesForOids(SAI_OBJECT_TYPE_ROUTE_ENTRY, attrCount, attrList);
 
+        if (isBulkEnabled(SAI_OBJECT_TYPE_ROUTE_ENTRY))
+        {
+            queueEntry(meta_key, asicKey);
+            continue;
+        }
+
         sai_status_t status = m_vendorSai->create(&meta_key.objectkey.key.route_entry, attrCount, attrList);
 
         if (status != SAI_STATUS_SUCCESS)
@@ -484,6 +511,8 @@ void SingleReiniter::processRoutes(
                     sai_serialize_status(status).c_str());
         }
     }
+
+    flushEntries();
 }
 
 void SingleReiniter::processInsegs()
@@ -511,6 +540,12 @@ void SingleReiniter::processInsegs()
 
         processAttributesForOids(SAI_OBJECT_TYPE_INSEG_ENTRY, attrCount, attrList);
 
+        if (isBulkEnabled(SAI_OBJECT_TYPE_INSEG_ENTRY))
+        {
+            queueEntry(meta_key, asicKey);
+            continue;
+        }
+
         sai_status_t status = sai_metadata_sai_mpls_api->
             create_inseg_entry(&meta_key.objectkey.key.inseg_entry, attrCount, attrList);
 
@@ -523,6 +558,8 @@ void SingleReiniter::processInsegs()
                     sai_serialize_status(status).c_str());
         }
     }
+
+    flushEntries();
 }
 
 void SingleReiniter::processNatEntries()
@@ -550,6 +587,12 @@ void SingleReiniter::processNatEntries()
 
         processAttributesForOids(SAI_OBJECT_TYPE_NAT_ENTRY, attrCount, attrList);
 
+        if (isBulkEnabled(SAI_OBJECT_TYPE_NAT_ENTRY))
+        {
+            queueEntry(meta_key, asicKey);
+            continue;
+        }
+
         sai_status_t status = m_vendorSai->create(&meta_key.objectkey.key.nat_entry, attrCount, attrList);
 
         if (status != SAI_STATUS_SUCCESS)
@@ -561,6 +604,8 @@ void SingleReiniter::processNatEntries()
                     sai_serialize_status(status).c_str());
         }
     }
+
+    flushEntries();
 }
 
 void SingleReiniter::trapGroupWorkaround(
@@ -861,6 +906,77 @@ sai_object_id_t SingleReiniter::processSingleVid(
     return rid;
 }
 
+void SingleReiniter::getAttributeOids(
+        _In_ const sai_attr_metadata_t* meta,
+        _In_ sai_attribute_t& attr,
+        _Out_ uint32_t& count,
+        _Out_ sai_object_id_t*& objectIdList)
+{
+    SWSS_LOG_ENTER();
+
+    count = 0;
+    objectIdList = nullptr;
+
+    switch (meta->attrvaluetype)
+    {
+        case SAI_ATTR_VALUE_TYPE_OBJECT_ID:
+            count = 1;
+            objectIdList = &attr.value.oid;
+            break;
+
+        case SAI_ATTR_VALUE_TYPE_OBJECT_LIST:
+            count = attr.value.objlist.count;
+            objectIdList = attr.value.objlist.list;
+            break;
+
+        case SAI_ATTR_VALUE_TYPE_ACL_FIELD_DATA_OBJECT_ID:
+            if (attr.value.aclfield.enable)
+            {
+                count = 1;
+                objectIdList = &attr.value.aclfield.data.oid;
+            }
+            break;
+
+        case SAI_ATTR_VALUE_TYPE_ACL_FIELD_DATA_OBJECT_LIST:
+            if (attr.value.aclfield.enable)
+            {
+                count = attr.value.aclfield.data.objlist.count;
+                objectIdList = attr.value.aclfield.data.objlist.list;
+            }
+            break;
+
+        case SAI_ATTR_VALUE_TYPE_ACL_ACTION_DATA_OBJECT_ID:
+            if (attr.value.aclaction.enable)
+            {
+                count = 1;
+                objectIdList = &attr.value.aclaction.parameter.oid;
+            }
+            break;
+
+        case SAI_ATTR_VALUE_TYPE_ACL_ACTION_DATA_OBJECT_LIST:
+            if (attr.value.aclaction.enable)
+            {
+                count = attr.value.aclaction.parameter.objlist.count;
+                objectIdList = attr.value.aclaction.parameter.objlist.list;
+            }
+            break;
+
+        default:
+
+            // TODO later isoidattribute
+            if (meta->allowedobjecttypeslength > 0)
+            {
+                SWSS_LOG_THROW("attribute %s is oid attribute, but not processed, FIXME", meta->attridname);
+            }
+
+            /*
+             * This is not oid attribute, we can skip processing.
+             */
+
+            break;
+    }
+}
+
 void SingleReiniter::processAttributesForOids(
         _In_ sai_object_type_t objectType,
         _In_ uint32_t attr_count,
@@ -884,97 +1000,522 @@ void SingleReiniter::processAttributesForOids(
                     attr.id);
         }
 
-        uint32_t count = 0;
+        uint32_t count;
         sai_object_id_t *objectIdList;
 
-        switch (meta->attrvaluetype)
+        getAttributeOids(meta, attr, count, objectIdList);
+
+        /*
+         * Attribute contains object id's, they need to be translated some of
+         * them could be already translated.
+         */
+
+        for (uint32_t j = 0; j < count; j++)
         {
-            case SAI_ATTR_VALUE_TYPE_OBJECT_ID:
-                count = 1;
-                objectIdList = &attr.value.oid;
-                break;
+            sai_object_id_t vid = objectIdList[j];
 
-            case SAI_ATTR_VALUE_TYPE_OBJECT_LIST:
-                count = attr.value.objlist.count;
-                objectIdList = attr.value.objlist.list;
-                break;
+            sai_object_id_t rid = processSingleVid(vid);
 
-            case SAI_ATTR_VALUE_TYPE_ACL_FIELD_DATA_OBJECT_ID:
-                if (attr.value.aclfield.enable)
-                {
-                    count = 1;
-                    objectIdList = &attr.value.aclfield.data.oid;
-                }
-                break;
+            objectIdList[j] = rid;
+        }
+    }
+}
 
-            case SAI_ATTR_VALUE_TYPE_ACL_FIELD_DATA_OBJECT_LIST:
-                if (attr.value.aclfield.enable)
-                {
-                    count = attr.value.aclfield.data.objlist.count;
-                    objectIdList = attr.value.aclfield.data.objlist.list;
-                }
-                break;
+void SingleReiniter::processOids()
+{
+    SWSS_LOG_ENTER();
 
-            case SAI_ATTR_VALUE_TYPE_ACL_ACTION_DATA_OBJECT_ID:
-                if (attr.value.aclaction.enable)
-                {
-                    count = 1;
-                    objectIdList = &attr.value.aclaction.parameter.oid;
-                }
-                break;
+    if (m_bulkSize)
+    {
+        processOidsBulk();
+        return;
+    }
 
-            case SAI_ATTR_VALUE_TYPE_ACL_ACTION_DATA_OBJECT_LIST:
-                if (attr.value.aclaction.enable)
-                {
-                    count = attr.value.aclaction.parameter.objlist.count;
-                    objectIdList = attr.value.aclaction.parameter.objlist.list;
-                }
-                break;
+    for (const auto &kv: m_oids)
+    {
+        const std::string &strObjectId = kv.first;
 
-            default:
+        sai_object_id_t vid;
+        sai_deserialize_object_id(strObjectId, vid);
 
-                // TODO later isoidattribute
-                if (meta->allowedobjecttypeslength > 0)
-                {
-                    SWSS_LOG_THROW("attribute %s is oid attribute, but not processed, FIXME", meta->attridname);
-                }
+        processSingleVid(vid);
+    }
+}
+
+std::map<int, std::vector<sai_object_id_t>> SingleReiniter::getOidsByLevel()
+{
+    SWSS_LOG_ENTER();
+
+    std::unordered_map<sai_object_id_t, int> levels;
+
+    std::map<int, std::vector<sai_object_id_t>> vidsByLevel;
+
+    for (const auto &kv: m_oids)
+    {
+        sai_object_id_t vid;
+        sai_deserialize_object_id(kv.first, vid);
+
+        if (m_translatedV2R.find(vid) != m_translatedV2R.end())
+        {
+            // switch is already processed
+            continue;
+        }
+
+        vidsByLevel[getOidLevel(vid, levels)].push_back(vid);
+    }
 
+    return vidsByLevel;
+}
+
+void SingleReiniter::processOidsBulk()
+{
+    SWSS_LOG_ENTER();
+
+    /*
+     * Group objects by dependency level, all objects on given level refer
+     * only to objects on lower levels, so they can be created together when
+     * all lower levels are processed.
+     */
+
+    auto vidsByLevel = getOidsByLevel();
+
+    for (const auto& lvl: vidsByLevel)
+    {
+        std::map<sai_object_type_t, std::vector<sai_object_id_t>> toCreate;
+
+        for (sai_object_id_t vid: lvl.second)
+        {
+            sai_object_type_t objectType = VidManager::objectTypeQuery(vid);
+
+            auto v2rMapIt = m_vidToRidMap.find(vid);
+
+            if (v2rMapIt == m_vidToRidMap.end())
+            {
+                SWSS_LOG_THROW("failed to find VID %s in VIDTORID map",
+                        sai_serialize_object_id(vid).c_str());
+            }
+
+            if (!isBulkEnabled(objectType) ||
+                    objectType == SAI_OBJECT_TYPE_HOSTIF_TRAP_GROUP ||
+                    m_sw->isDiscoveredRid(v2rMapIt->second))
+            {
                 /*
-                 * This is not oid attribute, we can skip processing.
+                 * Existing objects only need their attributes set, and trap
+                 * group needs workaround, so those are processed one by one.
                  */
 
+                processSingleVid(vid);
                 continue;
+            }
+
+            toCreate[objectType].push_back(vid);
         }
 
-        /*
-         * Attribute contains object id's, they need to be translated some of
-         * them could be already translated.
-         */
+        for (const auto& kvp: toCreate)
+        {
+            const auto& vids = kvp.second;
+
+            for (size_t idx = 0; idx < vids.size(); idx += m_bulkSize)
+            {
+                size_t end = std::min(vids.size(), idx + m_bulkSize);
+
+                bulkCreateOids(kvp.first, std::vector<sai_object_id_t>(vids.begin() + idx, vids.begin() + end));
+            }
+        }
+
+        SWSS_LOG_NOTICE("processed dependency level %d: %zu objects", lvl.first, lvl.second.size());
+    }
+}
+
+int SingleReiniter::getOidLevel(
+        _In_ sai_object_id_t vid,
+        _Inout_ std::unordered_map<sai_object_id_t, int>& levels)
+{
+    SWSS_LOG_ENTER();
+
+    if (vid == SAI_NULL_OBJECT_ID || m_translatedV2R.find(vid) != m_translatedV2R.end())
+    {
+        return -1;
+    }
+
+    auto it = levels.find(vid);
+
+    if (it != levels.end())
+    {
+        if (it->second < 0)
+        {
+            SWSS_LOG_THROW("dependency loop detected on VID %s",
+                    sai_serialize_object_id(vid).c_str());
+        }
+
+        return it->second;
+    }
+
+    std::string strVid = sai_serialize_object_id(vid);
+
+    auto oit = m_oids.find(strVid);
+
+    if (oit == m_oids.end())
+    {
+        SWSS_LOG_THROW("failed to find VID %s in OIDs map", strVid.c_str());
+    }
+
+    levels[vid] = -1; // in progress
+
+    sai_object_type_t objectType = VidManager::objectTypeQuery(vid);
+
+    std::shared_ptr<SaiAttributeList> list = m_attributesLists[oit->second];
+
+    sai_attribute_t *attrList = list->get_attr_list();
+
+    uint32_t attrCount = list->get_attr_count();
+
+    int level = 0;
+
+    for (uint32_t idx = 0; idx < attrCount; idx++)
+    {
+        auto meta = sai_metadata_get_attr_metadata(objectType, attrList[idx].id);
+
+        if (meta == NULL)
+        {
+            SWSS_LOG_THROW("unable to get metadata for object type %s, attribute %d",
+                    sai_serialize_object_type(objectType).c_str(),
+                    attrList[idx].id);
+        }
+
+        uint32_t count;
+        sai_object_id_t *objectIdList;
+
+        getAttributeOids(meta, attrList[idx], count, objectIdList);
 
         for (uint32_t j = 0; j < count; j++)
         {
-            sai_object_id_t vid = objectIdList[j];
+            level = std::max(level, getOidLevel(objectIdList[j], levels) + 1);
+        }
+    }
 
-            sai_object_id_t rid = processSingleVid(vid);
+    levels[vid] = level;
 
-            objectIdList[j] = rid;
+    return level;
+}
+
+void SingleReiniter::bulkCreateOids(
+        _In_ sai_object_type_t objectType,
+        _In_ const std::vector<sai_object_id_t>& vids)
+{
+    SWSS_LOG_ENTER();
+
+    uint32_t objectCount = (uint32_t)vids.size();
+
+    std::vector<uint32_t> attrCounts;
+    std::vector<const sai_attribute_t*> attrLists;
+
+    for (sai_object_id_t vid: vids)
+    {
+        std::shared_ptr<SaiAttributeList> list = m_attributesLists[m_oids.at(sai_serialize_object_id(vid))];
+
+        // all referenced objects are on lower levels and they are already translated
+
+        processAttributesForOids(objectType, list->get_attr_count(), list->get_attr_list());
+
+        attrCounts.push_back(list->get_attr_count());
+        attrLists.push_back(list->get_attr_list());
+    }
+
+    std::vector<sai_object_id_t> rids(objectCount, SAI_NULL_OBJECT_ID);
+    std::vector<sai_status_t> statuses(objectCount, SAI_STATUS_NOT_EXECUTED);
+
+#ifdef ENABLE_PERF
+    auto start = std::chrono::high_resolution_clock::now();
+#endif
+
+    sai_status_t status = m_vendorSai->bulkCreate(
+            objectType,
+            m_switch_rid,
+            objectCount,
+            attrCounts.data(),
+            attrLists.data(),
+            SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR,
+            rids.data(),
+            statuses.data());
+
+    if (isBulkUnsupported(objectType, status))
+    {
+        status = SAI_STATUS_SUCCESS;
+
+        for (uint32_t idx = 0; idx < objectCount; idx++)
+        {
+            statuses[idx] = m_vendorSai->create(objectType, &rids[idx], m_switch_rid, attrCounts[idx], attrLists[idx]);
+
+            if (statuses[idx] != SAI_STATUS_SUCCESS)
+            {
+                status = statuses[idx];
+                break;
+            }
+        }
+    }
+
+#ifdef ENABLE_PERF
+    auto end = std::chrono::high_resolution_clock::now();
+
+    typedef std::chrono::duration<double, std::ratio<1>> second_t;
+
+    double duration = std::chrono::duration_cast<second_t>(end - start).count();
+
+    std::get<0>(m_perf_create[objectType]) += (int)objectCount;
+    std::get<1>(m_perf_create[objectType]) += duration;
+#endif
+
+    for (uint32_t idx = 0; idx < objectCount; idx++)
+    {
+        if (statuses[idx] != SAI_STATUS_SUCCESS)
+        {
+            listFailedAttributes(objectType, attrCounts[idx], attrLists[idx]);
+
+            SWSS_LOG_THROW("failed to create object %s VID %s: %s",
+                    sai_serialize_object_type(objectType).c_str(),
+                    sai_serialize_object_id(vids[idx]).c_str(),
+                    sai_serialize_status(statuses[idx]).c_str());
         }
+
+        m_translatedV2R[vids[idx]] = rids[idx];
+        m_translatedR2V[rids[idx]] = vids[idx];
+
+        SWSS_LOG_DEBUG("created object of type %s, processed VID %s to RID %s",
+                sai_serialize_object_type(objectType).c_str(),
+                sai_serialize_object_id(vids[idx]).c_str(),
+                sai_serialize_object_id(rids[idx]).c_str());
+    }
+
+    if (status != SAI_STATUS_SUCCESS)
+    {
+        SWSS_LOG_THROW("bulk create of %u objects %s failed: %s",
+                objectCount,
+                sai_serialize_object_type(objectType).c_str(),
+                sai_serialize_status(status).c_str());
     }
 }
 
-void SingleReiniter::processOids()
+bool SingleReiniter::isBulkEnabled(
+        _In_ sai_object_type_t objectType) const
 {
     SWSS_LOG_ENTER();
 
-    for (const auto &kv: m_oids)
+    return m_bulkSize != 0 && m_bulkUnsupported.find(objectType) == m_bulkUnsupported.end();
+}
+
+bool SingleReiniter::isBulkUnsupported(
+        _In_ sai_object_type_t objectType,
+        _In_ sai_status_t status)
+{
+    SWSS_LOG_ENTER();
+
+    if (status != SAI_STATUS_NOT_IMPLEMENTED && status != SAI_STATUS_NOT_SUPPORTED)
     {
-        const std::string &strObjectId = kv.first;
+        return false;
+    }
 
-        sai_object_id_t vid;
-        sai_deserialize_object_id(strObjectId, vid);
+    SWSS_LOG_NOTICE("bulk create %s is not supported by vendor (%s), creating objects one by one",
+            sai_serialize_object_type(objectType).c_str(),
+            sai_serialize_status(status).c_str());
 
-        processSingleVid(vid);
+    m_bulkUnsupported.insert(objectType);
+
+    return true;
+}
+
+void SingleReiniter::queueEntry(
+        _In_ const sai_object_meta_key_t& metaKey,
+        _In_ const std::string& asicKey)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_pendingEntries.size() && m_pendingEntries.front().objecttype != metaKey.objecttype)
+    {
+        flushEntries();
+    }
+
+    m_pendingEntries.push_back(metaKey);
+    m_pendingAsicKeys.push_back(asicKey);
+
+    if (m_pendingEntries.size() >= m_bulkSize)
+    {
+        flushEntries();
+    }
+}
+
+void SingleReiniter::flushEntries()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_pendingEntries.empty())
+    {
+        return;
+    }
+
+    sai_object_type_t objectType = m_pendingEntries.front().objecttype;
+
+    uint32_t objectCount = (uint32_t)m_pendingEntries.size();
+
+    std::vector<uint32_t> attrCounts;
+    std::vector<const sai_attribute_t*> attrLists;
+
+    for (const auto& asicKey: m_pendingAsicKeys)
+    {
+        std::shared_ptr<SaiAttributeList> list = m_attributesLists[asicKey];
+
+        attrCounts.push_back(list->get_attr_count());
+        attrLists.push_back(list->get_attr_list());
+    }
+
+    std::vector<sai_status_t> statuses(objectCount, SAI_STATUS_NOT_EXECUTED);
+
+    sai_status_t status;
+
+#ifdef ENABLE_PERF
+    auto start = std::chrono::high_resolution_clock::now();
+#endif
+
+    switch (objectType)
+    {
+        case SAI_OBJECT_TYPE_ROUTE_ENTRY:
+        {
+            std::vector<sai_route_entry_t> entries;
+
+            for (const auto& mk: m_pendingEntries)
+                entries.push_back(mk.objectkey.key.route_entry);
+
+            status = m_vendorSai->bulkCreate(objectCount, entries.data(), attrCounts.data(), attrLists.data(),
+                    SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR, statuses.data());
+        }
+        break;
+
+        case SAI_OBJECT_TYPE_FDB_ENTRY:
+        {
+            std::vector<sai_fdb_entry_t> entries;
+
+            for (const auto& mk: m_pendingEntries)
+                entries.push_back(mk.objectkey.key.fdb_entry);
+
+            status = m_vendorSai->bulkCreate(objectCount, entries.data(), attrCounts.data(), attrLists.data(),
+                    SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR, statuses.data());
+        }
+        break;
+
+        case SAI_OBJECT_TYPE_NEIGHBOR_ENTRY:
+        {
+            std::vector<sai_neighbor_entry_t> entries;
+
+            for (const auto& mk: m_pendingEntries)
+                entries.push_back(mk.objectkey.key.neighbor_entry);
+
+            status = m_vendorSai->bulkCreate(objectCount, entries.data(), attrCounts.data(), attrLists.data(),
+                    SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR, statuses.data());
+        }
+        break;
+
+        case SAI_OBJECT_TYPE_NAT_ENTRY:
+        {
+            std::vector<sai_nat_entry_t> entries;
+
+            for (const auto& mk: m_pendingEntries)
+                entries.push_back(mk.objectkey.key.nat_entry);
+
+            status = m_vendorSai->bulkCreate(objectCount, entries.data(), attrCounts.data(), attrLists.data(),
+                    SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR, statuses.data());
+        }
+        break;
+
+        case SAI_OBJECT_TYPE_INSEG_ENTRY:
+        {
+            std::vector<sai_inseg_entry_t> entries;
+
+            for (const auto& mk: m_pendingEntries)
+                entries.push_back(mk.objectkey.key.inseg_entry);
+
+            status = m_vendorSai->bulkCreate(objectCount, entries.data(), attrCounts.data(), attrLists.data(),
+                    SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR, statuses.data());
+        }
+        break;
+
+        default:
+            SWSS_LOG_THROW("bulk create is not supported for %s",
+                    sai_serialize_object_type(objectType).c_str());
     }
+
+    if (isBulkUnsupported(objectType, status))
+    {
+        status = SAI_STATUS_SUCCESS;
+
+        for (uint32_t idx = 0; idx < objectCount; idx++)
+        {
+            statuses[idx] = m_vendorSai->create(m_pendingEntries[idx], SAI_NULL_OBJECT_ID, attrCounts[idx], attrLists[idx]);
+
+            if (statuses[idx] != SAI_STATUS_SUCCESS)
+            {
+                status = statuses[idx];
+                break;
+            }
+        }
+    }
+
+#ifdef ENABLE_PERF
+    auto end = std::chrono::high_resolution_clock::now();
+
+    typedef std::chrono::duration<double, std::ratio<1>> second_t;
+
+    double duration = std::chrono::duration_cast<second_t>(end - start).count();
+
+    std::get<0>(m_perf_create[objectType]) += (int)objectCount;
+    std::get<1>(m_perf_create[objectType]) += duration;
+#endif
+
+    for (uint32_t idx = 0; idx < objectCount; idx++)
+    {
+        if (statuses[idx] != SAI_STATUS_SUCCESS)
+        {
+            listFailedAttributes(objectType, attrCounts[idx], attrLists[idx]);
+
+            SWSS_LOG_ERROR("translated entry: %s",
+                    sai_serialize_object_meta_key(m_pendingEntries[idx]).c_str());
+
+            SWSS_LOG_THROW("failed to create %s: %s",
+                    m_pendingAsicKeys[idx].c_str(),
+                    sai_serialize_status(statuses[idx]).c_str());
+        }
+    }
+
+    if (status != SAI_STATUS_SUCCESS)
+    {
+        SWSS_LOG_THROW("bulk create of %u entries %s failed: %s",
+                objectCount,
+                sai_serialize_object_type(objectType).c_str(),
+                sai_serialize_status(status).c_str());
+    }
+
+    SWSS_LOG_INFO("bulk created %u entries %s", objectCount, sai_serialize_object_type(objectType).c_str());
+
+    m_pendingEntries.clear();
+    m_pendingAsicKeys.clear();
+}
+
+void SingleReiniter::runPhase(
+        _In_ const std::string& name,
+        _In_ const std::function<void()>& fun)
+{
+    SWSS_LOG_ENTER();
+
+    auto start = std::chrono::steady_clock::now();
+
+    fun();
+
+    auto end = std::chrono::steady_clock::now();
+
+    double duration = std::chrono::duration<double>(end - start).count();
+
+    SWSS_LOG_NOTICE("hard reinit phase %s took %.3f sec (bulk size %u)", name.c_str(), duration, m_bulkSize);
+
+    m_phaseTimes.emplace_back(name, duration);
 }
 
 void SingleReiniter::processStructNonObjectIds(
@@ -1162,3 +1703,10 @@ std::shared_ptr<SaiSwitch> SingleReiniter::getSwitch() const
 
     return m_sw;
 }
+
+const SingleReiniter::PhaseTimes& SingleReiniter::getPhaseTimes() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_phaseTimes;
+}
@@ -9,7 +9,9 @@
 #include "meta/SaiAttributeList.h"
 
 #include <string>
+#include <functional>
 #include <unordered_map>
+#include <set>
 #include <map>
 #include <vector>
 #include <memory>
@@ -23,6 +25,11 @@ namespace syncd
             typedef std::unordered_map<std::string, std::string> StringHash;
             typedef std::unordered_map<sai_object_id_t, sai_object_id_t> ObjectIdMap;
 
+            /**
+             * @brief Phase name and its duration in seconds, in execution order.
+             */
+            typedef std::vector<std::pair<std::string, double>> PhaseTimes;
+
         public:
 
             SingleReiniter(
@@ -32,7 +39,8 @@ namespace syncd
                     _In_ std::shared_ptr<NotificationHandler> handler,
                     _In_ const ObjectIdMap& vidToRidMap,
                     _In_ const ObjectIdMap& ridToVidMap,
-                    _In_ const std::vector<std::string>& asicKeys);
+                    _In_ const std::vector<std::string>& asicKeys,
+                    _In_ uint32_t bulkSize);
 
             virtual ~SingleReiniter();
 
@@ -46,6 +54,8 @@ namespace syncd
 
             std::shared_ptr<SaiSwitch> getSwitch() const;
 
+            const PhaseTimes& getPhaseTimes() const;
+
         private:
 
             void prepareAsicState();
@@ -70,6 +80,51 @@ namespace syncd
             sai_object_id_t processSingleVid(
                     _In_ sai_object_id_t vid);
 
+            void processOidsBulk();
+
+            /**
+             * @brief Group not yet translated OIDs by dependency level.
+             */
+            std::map<int, std::vector<sai_object_id_t>> getOidsByLevel();
+
+            /**
+             * @brief Get dependency level of object.
+             *
+             * Objects without object id attributes are on level 0, other
+             * objects are one level above highest level object they refer
+             * to. Objects on the same level are independent of each other.
+             */
+            int getOidLevel(
+                    _In_ sai_object_id_t vid,
+                    _Inout_ std::unordered_map<sai_object_id_t, int>& levels);
+
+            void bulkCreateOids(
+                    _In_ sai_object_type_t objectType,
+                    _In_ const std::vector<sai_object_id_t>& vids);
+
+            bool isBulkEnabled(
+                    _In_ sai_object_type_t objectType) const;
+
+            bool isBulkUnsupported(
+                    _In_ sai_object_type_t objectType,
+                    _In_ sai_status_t status);
+
+            /**
+             * @brief Queue non object id entry for bulk create.
+             *
+             * Queued entries are created when queue reaches bulk size or
+             * when flushEntries is called.
+             */
+            void queueEntry(
+                    _In_ const sai_object_meta_key_t& metaKey,
+                    _In_ const std::string& asicKey);
+
+            void flushEntries();
+
+            void runPhase(
+                    _In_ const std::string& name,
+                    _In_ const std::function<void()>& fun);
+
             std::shared_ptr<saimeta::SaiAttributeList> redisGetAttributesFromAsicKey(
                     _In_ const std::string &key);
 
@@ -78,6 +133,12 @@ namespace syncd
                     _In_ uint32_t attr_count,
                     _In_ sai_attribute_t *attr_list);
 
+            static void getAttributeOids(
+                    _In_ const sai_attr_metadata_t* meta,
+                    _In_ sai_attribute_t& attr,
+                    _Out_ uint32_t& count,
+                    _Out_ sai_object_id_t*& objectIdList);
+
             void processStructNonObjectIds(
                     _In_ sai_object_meta_key_t &meta_key);
 
@@ -136,5 +197,22 @@ namespace syncd
             std::shared_ptr<RedisClient> m_client;
 
             std::shared_ptr<NotificationHandler> m_handler;
+
+            /**
+             * @brief Maximum number of objects in single vendor bulk create,
+             * 0 disables bulk create.
+             */
+            uint32_t m_bulkSize;
+
+            /**
+             * @brief Object types for which vendor bulk create is not
+             * implemented, those are created one by one.
+             */
+            std::set<sai_object_type_t> m_bulkUnsupported;
+
+            std::vector<sai_object_meta_key_t> m_pendingEntries;
+            std::vector<std::string> m_pendingAsicKeys;
+
+            PhaseTimes m_phaseTimes;
     };
 }
@@ -12,6 +12,7 @@
 #include "RedisNotificationProducer.h"
 #include "ZeroMQNotificationProducer.h"
 #include "WatchdogScope.h"
+#include "PipelineFlushScope.h"
 #include "VendorSaiOptions.h"
 
 #include "sairediscommon.h"
@@ -21,6 +22,7 @@
 #include "swss/tokenize.h"
 #include "swss/notificationproducer.h"
 #include "swss/exec.h"
+#include "swss/table.h"
 
 #include "meta/sai_serialize.h"
 #include "meta/ZeroMQSelectableChannel.h"
@@ -41,6 +43,8 @@
 #define DEF_SAI_WARM_BOOT_DATA_FILE "/var/warmboot/sai-warmboot.bin"
 #define SAI_FAILURE_DUMP_SCRIPT "/usr/bin/sai_failure_dump.sh"
 
+#define STATE_HARD_REINIT_TABLE_NAME "HARD_REINIT_TABLE"
+
 using namespace syncd;
 using namespace saimeta;
 using namespace sairediscommon;
@@ -119,6 +123,20 @@ Syncd::Syncd(
 
     loadProfileMap();
 
+    // command line lock policy takes precedence over profile
+
+    if (m_commandLineOptions->m_vendorLockPolicy.size())
+    {
+        m_profileMap[SYNCD_KEY_VENDOR_LOCK_POLICY] = m_commandLineOptions->m_vendorLockPolicy;
+    }
+
+    auto lockPolicy = m_profileMap.find(SYNCD_KEY_VENDOR_LOCK_POLICY);
+
+    if (lockPolicy != m_profileMap.end())
+    {
+        vso->m_lockPolicy = lockPolicy->second;
+    }
+
     m_profileIter = m_profileMap.begin();
 
     // we need STATE_DB ASIC_DB and COUNTERS_DB
@@ -182,7 +200,8 @@ Syncd::Syncd(
     m_dbFlexCounter = std::make_shared<swss::DBConnector>(m_contextConfig->m_dbFlex, 0);
     m_flexCounter = std::make_shared<swss::ConsumerTable>(m_dbFlexCounter.get(), FLEX_COUNTER_TABLE);
     m_flexCounterGroup = std::make_shared<swss::ConsumerTable>(m_dbFlexCounter.get(), FLEX_COUNTER_GROUP_TABLE);
-    m_flexCounterTable = std::make_shared<swss::Table>(m_dbFlexCounter.get(), FLEX_COUNTER_TABLE);
+    m_flexCounterPipeline = std::make_shared<swss::RedisPipeline>(m_dbFlexCounter.get());
+    m_flexCounterTable = std::make_shared<swss::Table>(m_flexCounterPipeline.get(), FLEX_COUNTER_TABLE, true);
     m_flexCounterGroupTable = std::make_shared<swss::Table>(m_dbFlexCounter.get(), FLEX_COUNTER_GROUP_TABLE);
 
     m_switchConfigContainer = std::make_shared<sairedis::SwitchConfigContainer>();
@@ -237,6 +256,16 @@ Syncd::Syncd(
 
     m_breakConfig = BreakConfigParser::parseBreakConfig(m_commandLineOptions->m_breakConfig);
 
+    if (m_commandLineOptions->m_asicAuditRate)
+    {
+        m_asicAuditor = std::make_shared<AsicAuditor>(
+                m_client,
+                m_translator,
+                m_vendorSai,
+                std::make_shared<swss::DBConnector>("STATE_DB", 0), // TODO from config
+                m_commandLineOptions->m_asicAuditRate);
+    }
+
     SWSS_LOG_NOTICE("syncd started");
 }
 
@@ -1141,9 +1170,19 @@ sai_status_t Syncd::processBulkQuadEventInInitViewMode(
                         sai_object_id_t objectVid;
                         sai_deserialize_object_id(str, objectVid);
 
-                        // in init view mode insert every created object except switch
+                        if (api == SAI_COMMON_API_BULK_CREATE)
+                        {
+                            // in init view mode insert every created object except switch
+
+                            m_createdInInitView.insert(objectVid);
+                        }
+                        else
+                        {
+                            // same as single remove, removed existing objects
+                            // will not be populated to temporary view
 
-                        m_createdInInitView.insert(objectVid);
+                            m_initViewRemovedVidSet.insert(objectVid);
+                        }
                     }
 
                     return SAI_STATUS_SUCCESS;
@@ -2439,8 +2478,12 @@ sai_status_t Syncd::processBulkOidSet(
     for (size_t idx = 0; idx < object_count; idx++)
     {
         sai_deserialize_object_id(objectIds[idx], objectVids[idx]);
-        objectRids[idx] = m_translator->translateVidToRid(objectVids[idx]);
+    }
+
+    m_translator->translateVidsToRids(object_count, objectVids.data(), objectRids.data());
 
+    for (size_t idx = 0; idx < object_count; idx++)
+    {
         const auto attr_count = attributes[idx]->get_attr_count();
         if (attr_count != 1)
         {
@@ -2493,8 +2536,12 @@ sai_status_t Syncd::processBulkOidGet(
     for (size_t idx = 0; idx < object_count; idx++)
     {
         sai_deserialize_object_id(objectIds[idx], objectVids[idx]);
-        objectRids[idx] = m_translator->translateVidToRid(objectVids[idx]);
+    }
+
+    m_translator->translateVidsToRids(object_count, objectVids.data(), objectRids.data());
 
+    for (size_t idx = 0; idx < object_count; idx++)
+    {
         attr_counts[idx] = attributes[idx]->get_attr_count();
         attr_lists[idx] = attributes[idx]->get_attr_list();
     }
@@ -2540,8 +2587,12 @@ sai_status_t Syncd::processBulkOidRemove(
     for (size_t idx = 0; idx < object_count; idx++)
     {
         sai_deserialize_object_id(objectIds[idx], objectVids[idx]);
-        objectRids[idx] = m_translator->translateVidToRid(objectVids[idx]);
+    }
 
+    m_translator->translateVidsToRids(object_count, objectVids.data(), objectRids.data());
+
+    for (size_t idx = 0; idx < object_count; idx++)
+    {
         if (objectType == SAI_OBJECT_TYPE_PORT)
         {
             sai_object_id_t switchVid = VidManager::switchIdQuery(objectVids[idx]);
@@ -3143,6 +3194,10 @@ sai_status_t Syncd::processFlexCounterEvent(
     auto strVids = key.substr(delimiter + 1);
     auto vidStringVector = swss::tokenize(strVids, ',');
 
+    // FLEX_COUNTER writes buffered before failure must be sent as well
+
+    PipelineFlushScope flushScope(m_flexCounterPipeline);
+
     if (fromAsicChannel && op == SET_COMMAND && (!vidStringVector.empty()))
     {
         std::vector<sai_object_id_t> vids;
@@ -3176,6 +3231,10 @@ sai_status_t Syncd::processFlexCounterEvent(
             m_flexCounterTable->set(singleKey, values);
         }
 
+        // all keys are written in one redis round trip
+
+        m_flexCounterPipeline->flush();
+
         if (fromAsicChannel)
         {
             sendApiResponse(SAI_COMMON_API_SET, SAI_STATUS_SUCCESS);
@@ -3184,6 +3243,8 @@ sai_status_t Syncd::processFlexCounterEvent(
         return SAI_STATUS_SUCCESS;
     }
 
+    std::vector<sai_object_id_t> removeVids;
+
     for(auto &strVid : vidStringVector)
     {
         auto effective_op = op;
@@ -3223,7 +3284,7 @@ sai_status_t Syncd::processFlexCounterEvent(
             {
                 m_flexCounterTable->del(singleKey);
             }
-            m_manager->removeCounter(vid, groupName);
+            removeVids.push_back(vid);
         }
         else
         {
@@ -3231,6 +3292,13 @@ sai_status_t Syncd::processFlexCounterEvent(
         }
     }
 
+    if (removeVids.size())
+    {
+        m_manager->bulkRemoveCounter(removeVids, groupName);
+    }
+
+    m_flexCounterPipeline->flush();
+
     if (fromAsicChannel)
     {
         sendApiResponse(SAI_COMMON_API_SET, SAI_STATUS_SUCCESS);
@@ -4423,6 +4491,24 @@ void Syncd::inspectAsic()
     }
 }
 
+void Syncd::processAsicAudit()
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (m_asicInitViewMode)
+    {
+        // ASIC view will be replaced on apply view, audit is resumed after
+
+        return;
+    }
+
+    WatchdogScope ws(m_timerWatchdog, "asic audit");
+
+    m_asicAuditor->auditSlice();
+}
+
 sai_status_t Syncd::processNotifySyncd(
         _In_ const swss::KeyOpFieldsValuesTuple &kco)
 {
@@ -4583,8 +4669,7 @@ sai_status_t Syncd::processNotifySyncd(
         {
             /*
              * We successfully applied new view, VID mapping could change, so
-             * we need to clear local db, and all new VIDs will be queried
-             * using redis.
+             * we need to reload local db from redis.
              *
              * TODO possible race condition - get notification when new view is
              * applied and cache have old values, and notification start's
@@ -4594,9 +4679,16 @@ sai_status_t Syncd::processNotifySyncd(
              * there should be no issue.
              */
 
-            m_translator->clearLocalCache();
+            m_translator->loadLocalCache();
 
             m_createdInInitView.clear();
+
+            if (m_asicAuditor)
+            {
+                // objects from previous view could be removed or replaced
+
+                m_asicAuditor->restartSweep();
+            }
         }
         else
         {
@@ -4993,6 +5085,8 @@ void Syncd::onSyncdStart(
 
         performWarmRestart();
 
+        m_translator->loadLocalCache();
+
         SWSS_LOG_NOTICE("skipping hard reinit since WARM start was performed");
         return;
     }
@@ -5009,10 +5103,43 @@ void Syncd::onSyncdStart(
         SWSS_LOG_THROW("performing hard reinit, but there are %zu switches defined, bug!", m_switches.size());
     }
 
-    HardReiniter hr(m_client, m_translator, m_vendorSai, m_handler);
+    HardReiniter hr(m_client, m_translator, m_vendorSai, m_handler, m_commandLineOptions->m_hardReinitBulkSize);
 
     m_switches = hr.hardReinit();
 
+    m_translator->loadLocalCache();
+
+    /*
+     * Publish phase durations, so hard reinit time and bulk size effect can
+     * be checked without parsing syslog.
+     */
+
+    swss::DBConnector dbState("STATE_DB", 0); // TODO from config
+
+    swss::Table hardReinitTable(&dbState, STATE_HARD_REINIT_TABLE_NAME);
+
+    for (auto& kvp: hr.getPhaseTimes())
+    {
+        std::vector<swss::FieldValueTuple> values;
+
+        values.emplace_back("bulk_size", std::to_string(m_commandLineOptions->m_hardReinitBulkSize));
+
+        for (auto& phase: kvp.second)
+        {
+            std::string field = phase.first;
+
+            std::replace(field.begin(), field.end(), ' ', '_');
+
+            char buffer[32];
+
+            snprintf(buffer, sizeof(buffer), "%.3f", phase.second);
+
+            values.emplace_back(field, buffer);
+        }
+
+        hardReinitTable.set(sai_serialize_object_id(kvp.first), values);
+    }
+
     for (auto& sw: m_switches)
     {
         startDiagShell(sw.second->getRid());
@@ -5752,6 +5879,11 @@ void Syncd::run()
         s->addSelectable(m_flexCounter.get());
         s->addSelectable(m_flexCounterGroup.get());
 
+        if (m_asicAuditor)
+        {
+            s->addSelectable(m_asicAuditor->getSelectable());
+        }
+
         SWSS_LOG_NOTICE("starting main loop");
     }
     catch(const std::exception &e)
@@ -5883,6 +6015,10 @@ void Syncd::run()
             {
                 processEvent(*m_selectableChannel.get());
             }
+            else if (m_asicAuditor && sel == m_asicAuditor->getSelectable())
+            {
+                processAsicAudit();
+            }
             else
             {
                 SWSS_LOG_ERROR("select failed: %d", result);
@@ -18,6 +18,7 @@
 #include "NotificationProducerBase.h"
 #include "TimerWatchdog.h"
 #include "MdioIpcServer.h"
+#include "AsicAuditor.h"
 
 #include "meta/SaiAttributeList.h"
 #include "meta/SelectableChannel.h"
@@ -80,6 +81,12 @@ namespace syncd
             void processFlexCounterEvent(
                     _In_ swss::ConsumerTable &consumer);
 
+            /**
+             * @brief Audit next slice of ASIC objects, when background ASIC
+             * auditor is enabled.
+             */
+            void processAsicAudit();
+
             const char* profileGetValue(
                     _In_ sai_switch_profile_id_t profile_id,
                     _In_ const char* variable);
@@ -487,6 +494,11 @@ namespace syncd
 
             std::shared_ptr<syncd::MdioIpcServer> m_mdioIpcServer;
 
+            /**
+             * @brief Background ASIC vs ASIC_DB auditor, null when disabled.
+             */
+            std::shared_ptr<AsicAuditor> m_asicAuditor;
+
             bool m_enableSyncMode;
 
         private:
@@ -524,7 +536,8 @@ namespace syncd
             std::shared_ptr<swss::DBConnector> m_dbFlexCounter;
             std::shared_ptr<swss::ConsumerTable> m_flexCounter;
             std::shared_ptr<swss::ConsumerTable> m_flexCounterGroup;
-            std::shared_ptr<swss::Table> m_flexCounterTable;
+            std::shared_ptr<swss::RedisPipeline> m_flexCounterPipeline;
+            std::shared_ptr<swss::Table> m_flexCounterTable; // buffered on m_flexCounterPipeline
             std::shared_ptr<swss::Table> m_flexCounterGroupTable;
 
             std::shared_ptr<NotificationProducerBase> m_notifications;
@@ -7,10 +7,14 @@
 
 #include <cinttypes>
 #include <cstring>
+#include <chrono>
+#include <sstream>
 
 using namespace syncd;
 
-#define MUTEX() std::lock_guard<std::mutex> _lock(m_apimutex)
+#define MUTEX() ApiLock _lock(*this, SYNCD_VENDOR_API_CLASS_CONFIG)
+#define STATS_MUTEX() ApiLock _lock(*this, SYNCD_VENDOR_API_CLASS_STATS)
+#define QUERY_MUTEX() ApiLock _lock(*this, SYNCD_VENDOR_API_CLASS_QUERY)
 
 #define VENDOR_CHECK_API_INITIALIZED()                                       \
     if (!m_apiInitialized) {                                                \
@@ -23,6 +27,11 @@ VendorSai::VendorSai()
 
     m_apiInitialized = false;
 
+    for (int idx = 0; idx < SYNCD_VENDOR_API_CLASS_MAX; idx++)
+    {
+        m_lockPolicy[idx] = SYNCD_VENDOR_LOCK_POLICY_GLOBAL;
+    }
+
     memset(&m_apis, 0, sizeof(m_apis));
 
     sai_global_apis_t ga =
@@ -102,6 +111,32 @@ sai_status_t VendorSai::apiInitialize(
         return SAI_STATUS_INVALID_PARAMETER;
     }
 
+    auto vso = std::dynamic_pointer_cast<VendorSaiOptions>(getOptions(VendorSaiOptions::OPTIONS_KEY));
+
+    if (vso && vso->m_lockPolicy.size())
+    {
+        try
+        {
+            auto policy = parseLockPolicy(vso->m_lockPolicy);
+
+            // policy is changed before any api is initialized, so no other
+            // thread can hold lock of previous policy
+
+            for (int idx = 0; idx < SYNCD_VENDOR_API_CLASS_MAX; idx++)
+            {
+                m_lockPolicy[idx] = policy[idx];
+            }
+
+            SWSS_LOG_NOTICE("vendor lock policy: %s", vso->m_lockPolicy.c_str());
+        }
+        catch (const std::exception& e)
+        {
+            SWSS_LOG_ERROR("invalid vendor lock policy '%s': %s", vso->m_lockPolicy.c_str(), e.what());
+
+            return SAI_STATUS_INVALID_PARAMETER;
+        }
+    }
+
     memcpy(&m_service_method_table, service_method_table, sizeof(m_service_method_table));
 
     auto status = m_globalApis.api_initialize(flags, service_method_table);
@@ -165,9 +200,164 @@ sai_status_t VendorSai::apiUninitialize(void)
         memset(&m_apis, 0, sizeof(m_apis));
     }
 
+    logLockWaitStats();
+
     return status;
 }
 
+// LOCK POLICY
+
+VendorSai::ApiLock::ApiLock(
+        _In_ VendorSai& sai,
+        _In_ syncd_vendor_api_class_t apiClass)
+{
+    SWSS_LOG_ENTER();
+
+    std::mutex* mutex = nullptr;
+
+    switch (sai.m_lockPolicy[apiClass])
+    {
+        case SYNCD_VENDOR_LOCK_POLICY_GLOBAL:
+            mutex = &sai.m_apimutex;
+            break;
+
+        case SYNCD_VENDOR_LOCK_POLICY_SEPARATE:
+            mutex = &sai.m_classMutex[apiClass];
+            break;
+
+        default:
+            return;
+    }
+
+    auto& counters = sai.m_lockWaitCounters[apiClass];
+
+    counters.m_count++;
+
+    m_lock = std::unique_lock<std::mutex>(*mutex, std::try_to_lock);
+
+    if (m_lock.owns_lock())
+    {
+        return;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+
+    m_lock.lock();
+
+    uint64_t waitNs = (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start).count();
+
+    counters.m_contended++;
+    counters.m_totalWaitNs += waitNs;
+
+    uint64_t max = counters.m_maxWaitNs;
+
+    while (waitNs > max && !counters.m_maxWaitNs.compare_exchange_weak(max, waitNs))
+    {
+        // max was updated by other thread, retry
+    }
+}
+
+void VendorSai::ApiLock::unlock()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_lock.owns_lock())
+    {
+        m_lock.unlock();
+    }
+}
+
+std::vector<syncd_vendor_lock_policy_t> VendorSai::parseLockPolicy(
+        _In_ const std::string& policy)
+{
+    SWSS_LOG_ENTER();
+
+    static const std::map<std::string, syncd_vendor_api_class_t> classes = {
+        { "config", SYNCD_VENDOR_API_CLASS_CONFIG },
+        { "stats",  SYNCD_VENDOR_API_CLASS_STATS },
+        { "query",  SYNCD_VENDOR_API_CLASS_QUERY },
+    };
+
+    static const std::map<std::string, syncd_vendor_lock_policy_t> policies = {
+        { "global",   SYNCD_VENDOR_LOCK_POLICY_GLOBAL },
+        { "separate", SYNCD_VENDOR_LOCK_POLICY_SEPARATE },
+        { "none",     SYNCD_VENDOR_LOCK_POLICY_NONE },
+    };
+
+    std::vector<syncd_vendor_lock_policy_t> result(SYNCD_VENDOR_API_CLASS_MAX, SYNCD_VENDOR_LOCK_POLICY_GLOBAL);
+
+    std::istringstream iss(policy);
+
+    std::string item;
+
+    while (std::getline(iss, item, ','))
+    {
+        auto pos = item.find(':');
+
+        if (pos == std::string::npos)
+        {
+            SWSS_LOG_THROW("expected class:policy, got '%s'", item.c_str());
+        }
+
+        auto c = classes.find(item.substr(0, pos));
+        auto p = policies.find(item.substr(pos + 1));
+
+        if (c == classes.end() || p == policies.end())
+        {
+            SWSS_LOG_THROW("unknown api class or lock policy in '%s'", item.c_str());
+        }
+
+        result[c->second] = p->second;
+    }
+
+    return result;
+}
+
+syncd_vendor_lock_policy_t VendorSai::getLockPolicy(
+        _In_ syncd_vendor_api_class_t apiClass) const
+{
+    SWSS_LOG_ENTER();
+
+    return m_lockPolicy[apiClass];
+}
+
+VendorSai::LockWaitStats VendorSai::getLockWaitStats(
+        _In_ syncd_vendor_api_class_t apiClass) const
+{
+    SWSS_LOG_ENTER();
+
+    auto& counters = m_lockWaitCounters[apiClass];
+
+    LockWaitStats stats;
+
+    stats.m_count = counters.m_count;
+    stats.m_contended = counters.m_contended;
+    stats.m_totalWaitNs = counters.m_totalWaitNs;
+    stats.m_maxWaitNs = counters.m_maxWaitNs;
+
+    return stats;
+}
+
+void VendorSai::logLockWaitStats() const
+{
+    SWSS_LOG_ENTER();
+
+    static const char* names[SYNCD_VENDOR_API_CLASS_MAX] = { "config", "stats", "query" };
+
+    for (int idx = 0; idx < SYNCD_VENDOR_API_CLASS_MAX; idx++)
+    {
+        auto stats = getLockWaitStats((syncd_vendor_api_class_t)idx);
+
+        SWSS_LOG_NOTICE("%s lock: count %" PRIu64 ", contended %" PRIu64 ", total wait %" PRIu64 " ns, max wait %" PRIu64 " ns",
+                names[idx],
+                stats.m_count,
+                stats.m_contended,
+                stats.m_totalWaitNs,
+                stats.m_maxWaitNs);
+    }
+}
+
 // QUAD OID
 
 sai_status_t VendorSai::create(
@@ -211,7 +401,7 @@ sai_status_t VendorSai::set(
         _In_ sai_object_id_t objectId,
         _In_ const sai_attribute_t *attr)
 {
-    std::unique_lock<std::mutex> _lock(m_apimutex);
+    MUTEX();
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -322,7 +512,7 @@ sai_status_t VendorSai::getStats(
         _In_ const sai_stat_id_t *counter_ids,
         _Out_ uint64_t *counters)
 {
-    MUTEX();
+    STATS_MUTEX();
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -342,7 +532,7 @@ sai_status_t VendorSai::queryStatsCapability(
         _In_ sai_object_type_t objectType,
         _Inout_ sai_stat_capability_list_t *stats_capability)
 {
-    MUTEX();
+    QUERY_MUTEX();
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -357,7 +547,7 @@ sai_status_t VendorSai::queryStatsStCapability(
     _In_ sai_object_type_t objectType,
     _Inout_ sai_stat_st_capability_list_t *stats_capability)
 {
-    MUTEX();
+    QUERY_MUTEX();
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -377,7 +567,7 @@ sai_status_t VendorSai::getStatsExt(
         _In_ sai_stats_mode_t mode,
         _Out_ uint64_t *counters)
 {
-    MUTEX();
+    STATS_MUTEX();
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -392,7 +582,7 @@ sai_status_t VendorSai::clearStats(
         _In_ uint32_t number_of_counters,
         _In_ const sai_stat_id_t *counter_ids)
 {
-    MUTEX();
+    STATS_MUTEX();
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -412,7 +602,7 @@ sai_status_t VendorSai::bulkGetStats(
         _Inout_ sai_status_t *object_statuses,
         _Out_ uint64_t *counters)
 {
-    MUTEX();
+    STATS_MUTEX();
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -440,7 +630,7 @@ sai_status_t VendorSai::bulkClearStats(
         _In_ sai_stats_mode_t mode,
         _Inout_ sai_status_t *object_statuses)
 {
-    MUTEX();
+    STATS_MUTEX();
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -733,7 +923,8 @@ sai_status_t VendorSai::bulkGet(
             break;
 
         default:
-            SWSS_LOG_ERROR("not implemented %s, FIXME", sai_serialize_object_type(object_type).c_str());
+            // discovery probes bulk get on every object type
+            SWSS_LOG_INFO("not implemented %s, FIXME", sai_serialize_object_type(object_type).c_str());
             return SAI_STATUS_NOT_IMPLEMENTED;
     }
 
@@ -2139,6 +2330,65 @@ sai_status_t VendorSai::switchMdioCl22Write(
 #endif
 }
 
+sai_status_t VendorSai::switchMdioBatch(
+        _In_ sai_object_id_t switch_id,
+        _In_ uint32_t count,
+        _Inout_ syncd_mdio_ipc_batch_op_t *ops)
+{
+    MUTEX();
+    SWSS_LOG_ENTER();
+    VENDOR_CHECK_API_INITIALIZED();
+
+    // call vendor api directly, public mdio methods would take lock again
+
+    sai_status_t rc = SAI_STATUS_SUCCESS;
+
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        syncd_mdio_ipc_batch_op_t& op = ops[i];
+
+        switch (op.op)
+        {
+            case SYNCD_IPC_BATCH_OP_READ:
+                op.status = m_apis.switch_api->switch_mdio_read(switch_id, op.mdio_addr, op.reg_addr, 1, &op.val);
+                break;
+
+            case SYNCD_IPC_BATCH_OP_WRITE:
+                op.status = m_apis.switch_api->switch_mdio_write(switch_id, op.mdio_addr, op.reg_addr, 1, &op.val);
+                break;
+
+#if (SAI_API_VERSION >= SAI_VERSION(1, 11, 0))
+            case SYNCD_IPC_BATCH_OP_READ_CL22:
+                op.status = m_apis.switch_api->switch_mdio_cl22_read(switch_id, op.mdio_addr, op.reg_addr, 1, &op.val);
+                break;
+
+            case SYNCD_IPC_BATCH_OP_WRITE_CL22:
+                op.status = m_apis.switch_api->switch_mdio_cl22_write(switch_id, op.mdio_addr, op.reg_addr, 1, &op.val);
+                break;
+#else
+            case SYNCD_IPC_BATCH_OP_READ_CL22:
+                op.status = m_apis.switch_api->switch_mdio_read(switch_id, op.mdio_addr, op.reg_addr, 1, &op.val);
+                break;
+
+            case SYNCD_IPC_BATCH_OP_WRITE_CL22:
+                op.status = m_apis.switch_api->switch_mdio_write(switch_id, op.mdio_addr, op.reg_addr, 1, &op.val);
+                break;
+#endif
+
+            default:
+                op.status = SAI_STATUS_INVALID_PARAMETER;
+                break;
+        }
+
+        if (op.status != SAI_STATUS_SUCCESS)
+        {
+            rc = SAI_STATUS_FAILURE;
+        }
+    }
+
+    return rc;
+}
+
 // SAI API
 
 sai_status_t VendorSai::objectTypeGetAvailability(
@@ -2148,7 +2398,7 @@ sai_status_t VendorSai::objectTypeGetAvailability(
         _In_ const sai_attribute_t *attrList,
         _Out_ uint64_t *count)
 {
-    MUTEX();
+    QUERY_MUTEX();
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -2166,7 +2416,7 @@ sai_status_t VendorSai::queryAttributeCapability(
         _In_ sai_attr_id_t attrId,
         _Out_ sai_attr_capability_t *capability)
 {
-    MUTEX();
+    QUERY_MUTEX();
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -2183,7 +2433,7 @@ sai_status_t VendorSai::queryAttributeEnumValuesCapability(
         _In_ sai_attr_id_t attrId,
         _Inout_ sai_s32_list_t *enum_values_capability)
 {
-    MUTEX();
+    QUERY_MUTEX();
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
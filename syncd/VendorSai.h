@@ -4,6 +4,9 @@ extern "C" {
 #include "sai.h"
 }
 
+#include "VendorSaiOptions.h"
+#include "MdioIpcCommon.h"
+
 #include "meta/SaiInterface.h"
 
 #include <string>
@@ -11,6 +14,7 @@ extern "C" {
 #include <memory>
 #include <mutex>
 #include <map>
+#include <atomic>
 
 namespace syncd
 {
@@ -185,6 +189,22 @@ namespace syncd
                     _In_ uint32_t number_of_registers,
                     _In_ const uint32_t *reg_val) override;
 
+            /**
+             * @brief Execute batch of MDIO operations in order.
+             *
+             * Config class lock is held for whole batch, so other vendor
+             * calls can't interleave with multi register sequence, like
+             * clause 45 address and data access. Status of each operation
+             * is set in its status field.
+             *
+             * @return SAI_STATUS_SUCCESS if all operations succeeded,
+             * otherwise SAI_STATUS_FAILURE.
+             */
+            sai_status_t switchMdioBatch(
+                    _In_ sai_object_id_t switch_id,
+                    _In_ uint32_t count,
+                    _Inout_ syncd_mdio_ipc_batch_op_t *ops);
+
         public: // SAI API
 
             virtual sai_status_t objectTypeGetAvailability(
@@ -224,12 +244,84 @@ namespace syncd
             virtual sai_log_level_t logGet(
                     _In_ sai_api_t api) override;
 
+        public: // lock policy
+
+            typedef struct _LockWaitStats
+            {
+                uint64_t m_count;       // number of acquired locks
+
+                uint64_t m_contended;   // number of locks that had to wait
+
+                uint64_t m_totalWaitNs;
+
+                uint64_t m_maxWaitNs;
+
+            } LockWaitStats;
+
+            /**
+             * @brief Parse lock policy string.
+             *
+             * See SYNCD_KEY_VENDOR_LOCK_POLICY for format. Throws on invalid
+             * input. Returned vector is indexed by syncd_vendor_api_class_t.
+             */
+            static std::vector<syncd_vendor_lock_policy_t> parseLockPolicy(
+                    _In_ const std::string& policy);
+
+            syncd_vendor_lock_policy_t getLockPolicy(
+                    _In_ syncd_vendor_api_class_t apiClass) const;
+
+            LockWaitStats getLockWaitStats(
+                    _In_ syncd_vendor_api_class_t apiClass) const;
+
+        private:
+
+            /**
+             * @brief Scoped lock acquired according to API class lock policy.
+             *
+             * Time spent waiting on contended lock is accumulated in lock
+             * wait counters of given class.
+             */
+            class ApiLock
+            {
+                public:
+
+                    ApiLock(
+                            _In_ VendorSai& sai,
+                            _In_ syncd_vendor_api_class_t apiClass);
+
+                    void unlock();
+
+                private:
+
+                    std::unique_lock<std::mutex> m_lock;
+            };
+
+            typedef struct _LockWaitCounters
+            {
+                std::atomic<uint64_t> m_count{0};
+
+                std::atomic<uint64_t> m_contended{0};
+
+                std::atomic<uint64_t> m_totalWaitNs{0};
+
+                std::atomic<uint64_t> m_maxWaitNs{0};
+
+            } LockWaitCounters;
+
+            void logLockWaitStats() const;
+
         private:
 
             bool m_apiInitialized;
 
             std::mutex m_apimutex;
 
+            std::mutex m_classMutex[SYNCD_VENDOR_API_CLASS_MAX];
+
+            syncd_vendor_lock_policy_t m_lockPolicy[SYNCD_VENDOR_API_CLASS_MAX];
+
+            LockWaitCounters m_lockWaitCounters[SYNCD_VENDOR_API_CLASS_MAX];
+
             sai_service_method_table_t m_service_method_table;
 
             sai_apis_t m_apis;
@@ -2,8 +2,63 @@
 
 #include "meta/SaiOptions.h"
 
+#include <string>
+
+/**
+ * @brief Vendor SAI lock policy profile key.
+ *
+ * Value format is comma separated list of "class:policy" pairs, where class
+ * is one of "config", "stats", "query" and policy is one of "global",
+ * "separate", "none", for example: "stats:separate,query:none". Classes not
+ * listed are using global lock.
+ */
+#define SYNCD_KEY_VENDOR_LOCK_POLICY "SYNCD_VENDOR_LOCK_POLICY"
+
 namespace syncd
 {
+    /**
+     * @brief Vendor SAI API class, each class can have its own lock policy.
+     */
+    typedef enum _syncd_vendor_api_class_t
+    {
+        /**
+         * @brief Create, remove, set, get and all other programming APIs.
+         */
+        SYNCD_VENDOR_API_CLASS_CONFIG = 0,
+
+        /**
+         * @brief Get and clear stats APIs, including bulk versions.
+         */
+        SYNCD_VENDOR_API_CLASS_STATS,
+
+        /**
+         * @brief Capability and availability query APIs.
+         */
+        SYNCD_VENDOR_API_CLASS_QUERY,
+
+        SYNCD_VENDOR_API_CLASS_MAX,
+
+    } syncd_vendor_api_class_t;
+
+    typedef enum _syncd_vendor_lock_policy_t
+    {
+        /**
+         * @brief API is serialized with all other APIs using global lock.
+         */
+        SYNCD_VENDOR_LOCK_POLICY_GLOBAL = 0,
+
+        /**
+         * @brief API is serialized only with APIs from the same class.
+         */
+        SYNCD_VENDOR_LOCK_POLICY_SEPARATE,
+
+        /**
+         * @brief API is not serialized at all, vendor SAI must be thread safe.
+         */
+        SYNCD_VENDOR_LOCK_POLICY_NONE,
+
+    } syncd_vendor_lock_policy_t;
+
     class VendorSaiOptions:
         public sairedis::SaiOptions
     {
@@ -13,5 +68,10 @@ namespace syncd
         public:
 
             bool m_checkAttrVersion = false;
+
+            /**
+             * @brief Lock policy, see SYNCD_KEY_VENDOR_LOCK_POLICY for format.
+             */
+            std::string m_lockPolicy;
     };
 }
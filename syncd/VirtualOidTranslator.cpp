@@ -15,6 +15,8 @@ VirtualOidTranslator::VirtualOidTranslator(
         _In_ std::shared_ptr<sairedis::SaiInterface> vendorSai):
     m_virtualObjectIdManager(virtualObjectIdManager),
     m_vendorSai(vendorSai),
+    m_cacheHits(0),
+    m_cacheMisses(0),
     m_client(client)
 {
     SWSS_LOG_ENTER();
@@ -28,8 +30,6 @@ bool VirtualOidTranslator::tryTranslateRidToVid(
 {
     SWSS_LOG_ENTER();
 
-    std::lock_guard<std::mutex> lock(m_mutex);
-
     if (rid == SAI_NULL_OBJECT_ID)
     {
         SWSS_LOG_DEBUG("translated RID null to VID null");
@@ -38,14 +38,16 @@ bool VirtualOidTranslator::tryTranslateRidToVid(
         return true;
     }
 
-    auto it = m_rid2vid.find(vid);
-
-    if (it != m_rid2vid.end())
+    if (m_rid2vid.find(rid, vid))
     {
-        vid = it->second;
+        m_cacheHits++;
         return true;
     }
 
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_cacheMisses++;
+
     vid = m_client->getVidForRid(rid);
 
     if (vid == SAI_NULL_OBJECT_ID)
@@ -54,6 +56,8 @@ bool VirtualOidTranslator::tryTranslateRidToVid(
         return false;
     }
 
+    m_rid2vid.insert(rid, vid);
+
     return true;
 }
 
@@ -64,8 +68,6 @@ sai_object_id_t VirtualOidTranslator::translateRidToVid(
 {
     SWSS_LOG_ENTER();
 
-    std::lock_guard<std::mutex> lock(m_mutex);
-
     /*
      * NOTE: switch_vid here is Virtual ID of switch for which we need
      * create VID for given RID.
@@ -78,16 +80,27 @@ sai_object_id_t VirtualOidTranslator::translateRidToVid(
         return SAI_NULL_OBJECT_ID;
     }
 
-    auto it = m_rid2vid.find(rid);
+    sai_object_id_t vid;
 
-    if (it != m_rid2vid.end())
+    if (m_rid2vid.find(rid, vid))
     {
-        return it->second;
+        m_cacheHits++;
+        return vid;
     }
 
-    std::string strRid = sai_serialize_object_id(rid);
+    // new VID allocation must be serialized, so check cache again under lock
 
-    auto vid = m_client->getVidForRid(rid);
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (m_rid2vid.find(rid, vid))
+    {
+        m_cacheHits++;
+        return vid;
+    }
+
+    m_cacheMisses++;
+
+    vid = m_client->getVidForRid(rid);
 
     if (vid != SAI_NULL_OBJECT_ID)
     {
@@ -141,8 +154,8 @@ sai_object_id_t VirtualOidTranslator::translateRidToVid(
 
     m_client->insertVidAndRid(vid, rid);
 
-    m_rid2vid[rid] = vid;
-    m_vid2rid[vid] = rid;
+    m_rid2vid.insert(rid, vid);
+    m_vid2rid.insert(vid, rid);
 
     return vid;
 }
@@ -158,10 +171,40 @@ void VirtualOidTranslator::translateRidsToVids(
     std::lock_guard<std::mutex> lock(m_mutex);
 
     /*
-     * Fetch VIDs for given RIDs from database.
-     * Unknown RID's will be mapped to SAI_NULL_OBJECT_ID in vids array.
+     * Fetch VIDs for given RIDs from local cache, and only missing ones from
+     * database. Unknown RID's will be mapped to SAI_NULL_OBJECT_ID in vids
+     * array.
      */
-    m_client->getVidsForRids(count, rids, vids);
+
+    size_t found = m_rid2vid.find(count, rids, vids);
+
+    m_cacheHits += found;
+
+    if (found != count)
+    {
+        std::vector<size_t> missIndexes;
+        std::vector<sai_object_id_t> missRids;
+
+        for (size_t idx = 0; idx < count; idx++)
+        {
+            if (vids[idx] == SAI_NULL_OBJECT_ID)
+            {
+                missIndexes.push_back(idx);
+                missRids.push_back(rids[idx]);
+            }
+        }
+
+        m_cacheMisses += missRids.size();
+
+        std::vector<sai_object_id_t> missVids(missRids.size());
+
+        m_client->getVidsForRids(missRids.size(), missRids.data(), missVids.data());
+
+        for (size_t idx = 0; idx < missIndexes.size(); idx++)
+        {
+            vids[missIndexes[idx]] = missVids[idx];
+        }
+    }
 
     std::vector<sai_object_id_t> newRids;
     std::vector<sai_object_id_t> newVids;
@@ -215,8 +258,8 @@ void VirtualOidTranslator::translateRidsToVids(
 
     for (size_t idx = 0; idx < count; idx++)
     {
-        m_rid2vid[rids[idx]] = vids[idx];
-        m_vid2rid[vids[idx]] = rids[idx];
+        m_rid2vid.insert(rids[idx], vids[idx]);
+        m_vid2rid.insert(vids[idx], rids[idx]);
     }
 }
 
@@ -226,15 +269,22 @@ bool VirtualOidTranslator::checkRidExists(
 {
     SWSS_LOG_ENTER();
 
-    std::lock_guard<std::mutex> lock(m_mutex);
-
     if (rid == SAI_NULL_OBJECT_ID)
         return true;
 
-    if (m_rid2vid.find(rid) != m_rid2vid.end())
+    sai_object_id_t vid;
+
+    if (m_rid2vid.find(rid, vid))
+    {
+        m_cacheHits++;
         return true;
+    }
 
-    auto vid = m_client->getVidForRid(rid);
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_cacheMisses++;
+
+    vid = m_client->getVidForRid(rid);
 
     if (vid != SAI_NULL_OBJECT_ID)
         return true;
@@ -346,8 +396,6 @@ sai_object_id_t VirtualOidTranslator::translateVidToRid(
 {
     SWSS_LOG_ENTER();
 
-    std::lock_guard<std::mutex> lock(m_mutex);
-
     if (vid == SAI_NULL_OBJECT_ID)
     {
         SWSS_LOG_DEBUG("translated VID null to RID null");
@@ -355,14 +403,19 @@ sai_object_id_t VirtualOidTranslator::translateVidToRid(
         return SAI_NULL_OBJECT_ID;
     }
 
-    auto it = m_vid2rid.find(vid);
+    sai_object_id_t rid;
 
-    if (it != m_vid2rid.end())
+    if (m_vid2rid.find(vid, rid))
     {
-        return it->second;
+        m_cacheHits++;
+        return rid;
     }
 
-    auto rid = m_client->getRidForVid(vid);
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_cacheMisses++;
+
+    rid = m_client->getRidForVid(vid);
 
     if (rid == SAI_NULL_OBJECT_ID)
     {
@@ -390,7 +443,7 @@ sai_object_id_t VirtualOidTranslator::translateVidToRid(
      * faster to retrieve it late on.
      */
 
-    m_vid2rid[vid] = rid;
+    m_vid2rid.insert(vid, rid);
 
     SWSS_LOG_DEBUG("translated VID %s to RID %s",
             sai_serialize_object_id(vid).c_str(),
@@ -399,6 +452,24 @@ sai_object_id_t VirtualOidTranslator::translateVidToRid(
     return rid;
 }
 
+void VirtualOidTranslator::translateVidsToRids(
+        _In_ size_t count,
+        _In_ const sai_object_id_t* vids,
+        _Out_ sai_object_id_t* rids)
+{
+    SWSS_LOG_ENTER();
+
+    m_cacheHits += m_vid2rid.find(count, vids, rids);
+
+    for (size_t idx = 0; idx < count; idx++)
+    {
+        if (rids[idx] == SAI_NULL_OBJECT_ID && vids[idx] != SAI_NULL_OBJECT_ID)
+        {
+            rids[idx] = translateVidToRid(vids[idx]);
+        }
+    }
+}
+
 /*
  * NOTE: We could have in metadata utils option to execute function on each
  * object on oid like this.  Problem is that we can't then add extra
@@ -411,8 +482,6 @@ bool VirtualOidTranslator::tryTranslateVidToRid(
 {
     SWSS_LOG_ENTER();
 
-    std::lock_guard<std::mutex> lock(m_mutex);
-
     if (vid == SAI_NULL_OBJECT_ID)
     {
         SWSS_LOG_DEBUG("translated VID null to RID null");
@@ -421,14 +490,16 @@ bool VirtualOidTranslator::tryTranslateVidToRid(
         return true;
     }
 
-    auto it = m_vid2rid.find(vid);
-
-    if (it != m_vid2rid.end())
+    if (m_vid2rid.find(vid, rid))
     {
-        rid = it->second;
+        m_cacheHits++;
         return true;
     }
 
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_cacheMisses++;
+
     rid = m_client->getRidForVid(vid);
 
     if (rid == SAI_NULL_OBJECT_ID)
@@ -443,7 +514,7 @@ bool VirtualOidTranslator::tryTranslateVidToRid(
      * faster to retrieve it late on.
      */
 
-    m_vid2rid[vid] = rid;
+    m_vid2rid.insert(vid, rid);
 
     SWSS_LOG_DEBUG("translated VID %s to RID %s",
             sai_serialize_object_id(vid).c_str(),
@@ -610,8 +681,8 @@ void VirtualOidTranslator::insertRidAndVid(
 
     // to support multiple switches vid/rid map must be per switch
 
-    m_rid2vid[rid] = vid;
-    m_vid2rid[vid] = rid;
+    m_rid2vid.insert(rid, vid);
+    m_vid2rid.insert(vid, rid);
 
     m_client->insertVidAndRid(vid, rid);
 }
@@ -627,8 +698,8 @@ void VirtualOidTranslator::insertRidsAndVids(
 
     for (size_t idx = 0; idx < count; idx++)
     {
-        m_rid2vid[rids[idx]] = vids[idx];
-        m_vid2rid[vids[idx]] = rids[idx];
+        m_rid2vid.insert(rids[idx], vids[idx]);
+        m_vid2rid.insert(vids[idx], rids[idx]);
     }
 
     m_client->insertVidsAndRids(count, vids, rids);
@@ -663,3 +734,36 @@ void VirtualOidTranslator::clearLocalCache()
 
     m_removedRid2vid.clear();
 }
+
+void VirtualOidTranslator::loadLocalCache()
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_rid2vid.clear();
+    m_vid2rid.clear();
+
+    m_removedRid2vid.clear();
+
+    m_rid2vid.insert(m_client->getRidToVidMap());
+    m_vid2rid.insert(m_client->getVidToRidMap());
+
+    SWSS_LOG_NOTICE("loaded %zu RID to VID and %zu VID to RID mappings",
+            m_rid2vid.size(),
+            m_vid2rid.size());
+}
+
+uint64_t VirtualOidTranslator::getCacheHits() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_cacheHits;
+}
+
+uint64_t VirtualOidTranslator::getCacheMisses() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_cacheMisses;
+}
@@ -6,12 +6,14 @@ extern "C"{
 
 #include "VirtualObjectIdManager.h"
 #include "RedisClient.h"
+#include "ConcurrentOidMap.h"
 
 #include "meta/SaiInterface.h"
 
 #include <mutex>
 #include <unordered_map>
 #include <memory>
+#include <atomic>
 
 // TODO can be child class (redis translator etc)
 
@@ -98,6 +100,16 @@ namespace syncd
             void translateVidToRid(
                     _Inout_ sai_object_list_t &element);
 
+            /*
+             * Translate VIDs to RIDs in batch, prefer this method for bulk
+             * operations, local cache is locked once per shard instead of
+             * once per object.
+             */
+            void translateVidsToRids(
+                    _In_ size_t count,
+                    _In_ const sai_object_id_t* vids,
+                    _Out_ sai_object_id_t* rids);
+
             void translateVidToRid(
                     _In_ sai_object_type_t objectType,
                     _In_ uint32_t attrCount,
@@ -128,20 +140,40 @@ namespace syncd
 
             void clearLocalCache();
 
+            /**
+             * @brief Load all VID/RID mappings from redis to local cache.
+             *
+             * Should be called when redis mappings were changed outside of
+             * translator (warm boot, hard reinit, apply view), so in steady
+             * state there are no redis queries on translation.
+             */
+            void loadLocalCache();
+
+            uint64_t getCacheHits() const;
+
+            uint64_t getCacheMisses() const;
+
         private:
 
             std::shared_ptr<sairedis::VirtualObjectIdManager> m_virtualObjectIdManager;
 
             std::shared_ptr<sairedis::SaiInterface> m_vendorSai;
 
+            /**
+             * @brief Guards redis access, new VID allocation and removed map,
+             * cache lookups don't take this lock.
+             */
             std::mutex m_mutex;
 
             // those hashes keep mapping from all switches
 
-            std::unordered_map<sai_object_id_t, sai_object_id_t> m_rid2vid;
-            std::unordered_map<sai_object_id_t, sai_object_id_t> m_vid2rid;
+            ConcurrentOidMap m_rid2vid;
+            ConcurrentOidMap m_vid2rid;
             std::unordered_map<sai_object_id_t, sai_object_id_t> m_removedRid2vid;
 
+            std::atomic<uint64_t> m_cacheHits;
+            std::atomic<uint64_t> m_cacheMisses;
+
             std::shared_ptr<RedisClient> m_client;
     };
 }
@@ -637,6 +637,77 @@ sub test_bulk_set_multiple
     play "test_bulk_set_multiple_B.rec", 0;
 }
 
+sub test_auto_bulk
+{
+    fresh_start;
+
+    # single operations are replayed as bulk, and view must be the same as
+    # when replaying single operations
+
+    play "-a", "64", "-b", "-o", "autobulk.json", "full.rec";
+    play "full.rec", 0;
+
+    open (my $H, "<", "autobulk.json") or die "failed to open autobulk.json $!";
+
+    my $report = do { local $/; <$H> };
+
+    close ($H);
+
+    if (not $report =~ /"auto_bulk_calls": (\d+)/ or $1 == 0)
+    {
+        print color('red') . "expected auto bulk calls in benchmark report" . color('reset') . "\n";
+        exit 1;
+    }
+}
+
+sub test_binary_recording
+{
+    fresh_start;
+
+    # binary recording must convert back to the same text recording and
+    # replay to the same view as text recording
+
+    `../sairecconv/sairecconv -b -o full.recb $utils::DIR/full.rec`;
+
+    if ($? != 0)
+    {
+        print color('red') . "failed to convert full.rec to binary" . color('reset') . "\n";
+        exit 1;
+    }
+
+    `../sairecconv/sairecconv -o full.rec.txt full.recb && cmp -s full.rec.txt $utils::DIR/full.rec`;
+
+    if ($? != 0)
+    {
+        print color('red') . "binary recording converted to text differs from full.rec" . color('reset') . "\n";
+        exit 1;
+    }
+
+    play "full.recb";
+    play "full.rec", 0;
+}
+
+sub test_benchmark_replay
+{
+    fresh_start;
+
+    # replay 100 times faster than recorded with latency report
+
+    play "-b", "-S", "100", "-o", "benchmark.json", "bulk_route.rec";
+
+    open (my $H, "<", "benchmark.json") or die "failed to open benchmark.json $!";
+
+    my $report = do { local $/; <$H> };
+
+    close ($H);
+
+    if (not $report =~ /"calls_per_sec"/ or not $report =~ /SAI_COMMON_API_BULK_CREATE/)
+    {
+        print color('red') . "expected throughput and bulk create latency in benchmark report" . color('reset') . "\n";
+        exit 1;
+    }
+}
+
 sub test_lag_label
 {
     fresh_start;
@@ -903,6 +974,9 @@ test_macsec_p2p_establishment;
 test_no_lag_label;
 test_lag_label;
 test_bulk_set_multiple;
+test_benchmark_replay;
+test_auto_bulk;
+test_binary_recording;
 test_depreacated_enums;
 test_brcm_buffer_pool_zmq_sync_flag;
 test_brcm_buffer_pool_zmq;
@@ -0,0 +1,426 @@
+#include "TestBenchmark.h"
+
+#include <arpa/inet.h>
+
+#include <algorithm>
+
+using namespace std;
+using namespace std::placeholders;
+
+using json = nlohmann::json;
+
+// route prefixes are allocated from 20.0.0.0/8 and neighbors from 30.0.0.0/8
+
+#define BENCHMARK_ROUTE_PREFIX      0x14000000
+#define BENCHMARK_NEIGHBOR_PREFIX   0x1e000000
+#define BENCHMARK_MAX_SCALE         0x00ffffff
+
+TestBenchmark::TestBenchmark(
+        _In_ sai_redis_communication_mode_t mode,
+        _In_ uint32_t bulkSize):
+    m_mode(mode),
+    m_bulkSize(bulkSize),
+    m_vrId(SAI_NULL_OBJECT_ID),
+    m_rifId(SAI_NULL_OBJECT_ID),
+    m_nextHopId(SAI_NULL_OBJECT_ID),
+    m_results(json::array())
+{
+    SWSS_LOG_ENTER();
+
+    m_switch_id = SAI_NULL_OBJECT_ID;
+
+    m_nextHopNeighbor = {};
+}
+
+TestBenchmark::~TestBenchmark()
+{
+    SWSS_LOG_ENTER();
+
+    // empty intentionally
+}
+
+uint64_t TestBenchmark::getElapsed(
+        _In_ const std::chrono::time_point<std::chrono::steady_clock>& start)
+{
+    SWSS_LOG_ENTER();
+
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    return (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+}
+
+uint64_t TestBenchmark::getPercentile(
+        _In_ const std::vector<uint64_t>& sortedLatencies,
+        _In_ double percentile)
+{
+    SWSS_LOG_ENTER();
+
+    if (sortedLatencies.empty())
+    {
+        return 0;
+    }
+
+    size_t rank = (size_t)((double)sortedLatencies.size() * percentile);
+
+    return sortedLatencies[std::min(rank, sortedLatencies.size() - 1)];
+}
+
+void TestBenchmark::setupSwitch()
+{
+    SWSS_LOG_ENTER();
+
+    m_profileMap.clear();
+
+    m_profileIter = m_profileMap.begin();
+
+    m_smt.profileGetValue = std::bind(&TestBenchmark::profileGetValue, this, _1, _2);
+    m_smt.profileGetNextValue = std::bind(&TestBenchmark::profileGetNextValue, this, _1, _2, _3);
+
+    m_test_services = m_smt.getServiceMethodTable();
+
+    ASSERT_SUCCESS(sai_api_initialize(0, &m_test_services));
+
+    sai_switch_api_t* switch_api;
+
+    ASSERT_SUCCESS(sai_api_query(SAI_API_SWITCH, (void**)&switch_api));
+
+    sai_attribute_t attr;
+
+    // communication mode must be set before switch is created
+
+    attr.id = SAI_REDIS_SWITCH_ATTR_REDIS_COMMUNICATION_MODE;
+    attr.value.s32 = m_mode;
+
+    ASSERT_SUCCESS(switch_api->set_switch_attribute(SAI_NULL_OBJECT_ID, &attr));
+
+    attr.id = SAI_REDIS_SWITCH_ATTR_RECORD;
+    attr.value.booldata = false;
+
+    ASSERT_SUCCESS(switch_api->set_switch_attribute(SAI_NULL_OBJECT_ID, &attr));
+
+    attr.id = SAI_SWITCH_ATTR_INIT_SWITCH;
+    attr.value.booldata = true;
+
+    ASSERT_SUCCESS(switch_api->create_switch(&m_switch_id, 1, &attr));
+
+    ASSERT_TRUE(m_switch_id != SAI_NULL_OBJECT_ID);
+
+    attr.id = SAI_SWITCH_ATTR_DEFAULT_VIRTUAL_ROUTER_ID;
+
+    ASSERT_SUCCESS(switch_api->get_switch_attribute(m_switch_id, 1, &attr));
+
+    m_vrId = attr.value.oid;
+
+    sai_object_id_t ports[128];
+
+    attr.id = SAI_SWITCH_ATTR_PORT_LIST;
+    attr.value.objlist.count = 128;
+    attr.value.objlist.list = ports;
+
+    ASSERT_SUCCESS(switch_api->get_switch_attribute(m_switch_id, 1, &attr));
+
+    ASSERT_TRUE(attr.value.objlist.count > 0);
+
+    sai_router_interface_api_t* rif_api;
+
+    ASSERT_SUCCESS(sai_api_query(SAI_API_ROUTER_INTERFACE, (void**)&rif_api));
+
+    sai_attribute_t rifattr[3];
+
+    rifattr[0].id = SAI_ROUTER_INTERFACE_ATTR_VIRTUAL_ROUTER_ID;
+    rifattr[0].value.oid = m_vrId;
+    rifattr[1].id = SAI_ROUTER_INTERFACE_ATTR_TYPE;
+    rifattr[1].value.s32 = SAI_ROUTER_INTERFACE_TYPE_PORT;
+    rifattr[2].id = SAI_ROUTER_INTERFACE_ATTR_PORT_ID;
+    rifattr[2].value.oid = ports[0];
+
+    ASSERT_SUCCESS(rif_api->create_router_interface(&m_rifId, m_switch_id, 3, rifattr));
+
+    // all benchmark routes are pointing to single next hop
+
+    sai_neighbor_api_t* neighbor_api;
+
+    ASSERT_SUCCESS(sai_api_query(SAI_API_NEIGHBOR, (void**)&neighbor_api));
+
+    m_nextHopNeighbor.switch_id = m_switch_id;
+    m_nextHopNeighbor.rif_id = m_rifId;
+    m_nextHopNeighbor.ip_address.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
+    m_nextHopNeighbor.ip_address.addr.ip4 = htonl(0x0a000001);
+
+    sai_mac_t mac = { 0x00, 0x11, 0x22, 0x33, 0x44, 0x55 };
+
+    attr.id = SAI_NEIGHBOR_ENTRY_ATTR_DST_MAC_ADDRESS;
+    memcpy(attr.value.mac, mac, sizeof(sai_mac_t));
+
+    ASSERT_SUCCESS(neighbor_api->create_neighbor_entry(&m_nextHopNeighbor, 1, &attr));
+
+    sai_next_hop_api_t* next_hop_api;
+
+    ASSERT_SUCCESS(sai_api_query(SAI_API_NEXT_HOP, (void**)&next_hop_api));
+
+    sai_attribute_t nhattr[3];
+
+    nhattr[0].id = SAI_NEXT_HOP_ATTR_TYPE;
+    nhattr[0].value.s32 = SAI_NEXT_HOP_TYPE_IP;
+    nhattr[1].id = SAI_NEXT_HOP_ATTR_IP;
+    nhattr[1].value.ipaddr = m_nextHopNeighbor.ip_address;
+    nhattr[2].id = SAI_NEXT_HOP_ATTR_ROUTER_INTERFACE_ID;
+    nhattr[2].value.oid = m_rifId;
+
+    ASSERT_SUCCESS(next_hop_api->create_next_hop(&m_nextHopId, m_switch_id, 3, nhattr));
+
+    barrier();
+
+    SWSS_LOG_NOTICE("switch %s ready, mode %s",
+            sai_serialize_object_id(m_switch_id).c_str(),
+            sai_serialize_redis_communication_mode(m_mode).c_str());
+}
+
+void TestBenchmark::teardownSwitch()
+{
+    SWSS_LOG_ENTER();
+
+    sai_next_hop_api_t* next_hop_api;
+    sai_neighbor_api_t* neighbor_api;
+    sai_router_interface_api_t* rif_api;
+    sai_switch_api_t* switch_api;
+
+    ASSERT_SUCCESS(sai_api_query(SAI_API_NEXT_HOP, (void**)&next_hop_api));
+    ASSERT_SUCCESS(sai_api_query(SAI_API_NEIGHBOR, (void**)&neighbor_api));
+    ASSERT_SUCCESS(sai_api_query(SAI_API_ROUTER_INTERFACE, (void**)&rif_api));
+    ASSERT_SUCCESS(sai_api_query(SAI_API_SWITCH, (void**)&switch_api));
+
+    ASSERT_SUCCESS(next_hop_api->remove_next_hop(m_nextHopId));
+    ASSERT_SUCCESS(neighbor_api->remove_neighbor_entry(&m_nextHopNeighbor));
+    ASSERT_SUCCESS(rif_api->remove_router_interface(m_rifId));
+    ASSERT_SUCCESS(switch_api->remove_switch(m_switch_id));
+
+    m_switch_id = SAI_NULL_OBJECT_ID;
+
+    ASSERT_SUCCESS(sai_api_uninitialize());
+}
+
+void TestBenchmark::barrier()
+{
+    SWSS_LOG_ENTER();
+
+    sai_switch_api_t* switch_api;
+
+    ASSERT_SUCCESS(sai_api_query(SAI_API_SWITCH, (void**)&switch_api));
+
+    // GET is always synchronous and it's processed by syncd after all
+    // previously queued requests
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_SWITCH_ATTR_PORT_NUMBER;
+
+    ASSERT_SUCCESS(switch_api->get_switch_attribute(m_switch_id, 1, &attr));
+}
+
+void TestBenchmark::measure(
+        _In_ sai_object_type_t objectType,
+        _In_ const std::string& operation,
+        _In_ uint32_t count,
+        _In_ bool bulk,
+        _In_ const std::function<sai_status_t(uint32_t, uint32_t)>& call)
+{
+    SWSS_LOG_ENTER();
+
+    uint32_t step = bulk ? m_bulkSize : 1;
+
+    std::vector<uint64_t> latencies;
+
+    latencies.reserve(count / step + 1);
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (uint32_t offset = 0; offset < count; offset += step)
+    {
+        uint32_t n = std::min(step, count - offset);
+
+        auto callStart = std::chrono::steady_clock::now();
+
+        sai_status_t status = call(offset, n);
+
+        latencies.push_back(getElapsed(callStart));
+
+        ASSERT_SUCCESS(status);
+    }
+
+    barrier();
+
+    uint64_t elapsed = getElapsed(start);
+
+    std::sort(latencies.begin(), latencies.end());
+
+    uint64_t total = 0;
+
+    for (auto latency: latencies)
+    {
+        total += latency;
+    }
+
+    json j;
+
+    j["object_type"] = sai_serialize_object_type(objectType);
+    j["operation"] = operation;
+    j["api"] = bulk ? "bulk" : "single";
+    j["scale"] = count;
+    j["calls"] = latencies.size();
+    j["elapsed_us"] = elapsed;
+    j["objects_per_sec"] = elapsed ? (double)count * 1000000.0 / (double)elapsed : 0.0;
+    j["mean_per_object_us"] = count ? (double)total / (double)count : 0.0;
+    j["p50_us"] = getPercentile(latencies, 0.50);
+    j["p99_us"] = getPercentile(latencies, 0.99);
+    j["max_us"] = latencies.empty() ? 0 : latencies.back();
+
+    SWSS_LOG_NOTICE("%s %s %s x %u: %.0f objects/s",
+            j["object_type"].get<std::string>().c_str(),
+            operation.c_str(),
+            bulk ? "bulk" : "single",
+            count,
+            j["objects_per_sec"].get<double>());
+
+    m_results.push_back(j);
+}
+
+void TestBenchmark::benchmarkRoutes(
+        _In_ uint32_t count,
+        _In_ bool bulk)
+{
+    SWSS_LOG_ENTER();
+
+    sai_route_api_t* route_api;
+
+    ASSERT_SUCCESS(sai_api_query(SAI_API_ROUTE, (void**)&route_api));
+
+    std::vector<sai_route_entry_t> routes(count);
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        routes[i].switch_id = m_switch_id;
+        routes[i].vr_id = m_vrId;
+        routes[i].destination.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
+        routes[i].destination.addr.ip4 = htonl(BENCHMARK_ROUTE_PREFIX + i);
+        routes[i].destination.mask.ip4 = htonl(0xffffffff);
+    }
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID;
+    attr.value.oid = m_nextHopId;
+
+    std::vector<uint32_t> attr_count(m_bulkSize, 1);
+    std::vector<const sai_attribute_t*> attr_list(m_bulkSize, &attr);
+    std::vector<sai_status_t> statuses(m_bulkSize);
+
+    measure(SAI_OBJECT_TYPE_ROUTE_ENTRY, "create", count, bulk, [&](uint32_t offset, uint32_t n) {
+
+            if (!bulk)
+            {
+                return route_api->create_route_entry(&routes[offset], 1, &attr);
+            }
+
+            return route_api->create_route_entries(n, &routes[offset], attr_count.data(), attr_list.data(),
+                    SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR, statuses.data());
+    });
+
+    measure(SAI_OBJECT_TYPE_ROUTE_ENTRY, "remove", count, bulk, [&](uint32_t offset, uint32_t n) {
+
+            if (!bulk)
+            {
+                return route_api->remove_route_entry(&routes[offset]);
+            }
+
+            return route_api->remove_route_entries(n, &routes[offset], SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR, statuses.data());
+    });
+}
+
+void TestBenchmark::benchmarkNeighbors(
+        _In_ uint32_t count,
+        _In_ bool bulk)
+{
+    SWSS_LOG_ENTER();
+
+    sai_neighbor_api_t* neighbor_api;
+
+    ASSERT_SUCCESS(sai_api_query(SAI_API_NEIGHBOR, (void**)&neighbor_api));
+
+    std::vector<sai_neighbor_entry_t> neighbors(count);
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        neighbors[i].switch_id = m_switch_id;
+        neighbors[i].rif_id = m_rifId;
+        neighbors[i].ip_address.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
+        neighbors[i].ip_address.addr.ip4 = htonl(BENCHMARK_NEIGHBOR_PREFIX + i);
+    }
+
+    sai_attribute_t attr;
+
+    sai_mac_t mac = { 0x00, 0x22, 0x33, 0x44, 0x55, 0x66 };
+
+    attr.id = SAI_NEIGHBOR_ENTRY_ATTR_DST_MAC_ADDRESS;
+    memcpy(attr.value.mac, mac, sizeof(sai_mac_t));
+
+    std::vector<uint32_t> attr_count(m_bulkSize, 1);
+    std::vector<const sai_attribute_t*> attr_list(m_bulkSize, &attr);
+    std::vector<sai_status_t> statuses(m_bulkSize);
+
+    measure(SAI_OBJECT_TYPE_NEIGHBOR_ENTRY, "create", count, bulk, [&](uint32_t offset, uint32_t n) {
+
+            if (!bulk)
+            {
+                return neighbor_api->create_neighbor_entry(&neighbors[offset], 1, &attr);
+            }
+
+            return neighbor_api->create_neighbor_entries(n, &neighbors[offset], attr_count.data(), attr_list.data(),
+                    SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR, statuses.data());
+    });
+
+    measure(SAI_OBJECT_TYPE_NEIGHBOR_ENTRY, "remove", count, bulk, [&](uint32_t offset, uint32_t n) {
+
+            if (!bulk)
+            {
+                return neighbor_api->remove_neighbor_entry(&neighbors[offset]);
+            }
+
+            return neighbor_api->remove_neighbor_entries(n, &neighbors[offset], SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR, statuses.data());
+    });
+}
+
+void TestBenchmark::run(
+        _In_ const std::vector<uint32_t>& scales)
+{
+    SWSS_LOG_ENTER();
+
+    setupSwitch();
+
+    for (auto scale: scales)
+    {
+        ASSERT_TRUE(scale > 0 && scale <= BENCHMARK_MAX_SCALE);
+
+        for (bool bulk: { false, true })
+        {
+            benchmarkRoutes(scale, bulk);
+
+            benchmarkNeighbors(scale, bulk);
+        }
+    }
+
+    teardownSwitch();
+}
+
+std::string TestBenchmark::getReport() const
+{
+    SWSS_LOG_ENTER();
+
+    json report;
+
+    report["communication_mode"] = sai_serialize_redis_communication_mode(m_mode);
+    report["bulk_size"] = m_bulkSize;
+    report["results"] = m_results;
+
+    return report.dump();
+}
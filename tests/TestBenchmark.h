@@ -0,0 +1,97 @@
+#pragma once
+
+#include "TestClient.h"
+
+#include <nlohmann/json.hpp>
+
+#include <chrono>
+#include <functional>
+
+/**
+ * @brief End to end benchmark of sairedis client, communication channel,
+ * syncd and virtual switch.
+ *
+ * Benchmark acts as orchestration agent, it creates new switch on running
+ * syncd and measures create and remove of route and neighbor entries using
+ * single and bulk API at given scales.
+ *
+ * In asynchronous mode API calls return before syncd processes them, so
+ * latencies measure only client side, but throughput includes time to drain
+ * whole queue, since each run is finished with synchronous GET.
+ */
+class TestBenchmark:
+    public TestClient
+{
+    public:
+
+        TestBenchmark(
+                _In_ sai_redis_communication_mode_t mode,
+                _In_ uint32_t bulkSize);
+
+        virtual ~TestBenchmark();
+
+    public:
+
+        void run(
+                _In_ const std::vector<uint32_t>& scales);
+
+        /**
+         * @brief Get results of all runs as JSON string.
+         */
+        std::string getReport() const;
+
+    protected:
+
+        void setupSwitch();
+
+        void teardownSwitch();
+
+        /**
+         * @brief Wait until syncd processed all previous requests.
+         */
+        void barrier();
+
+        void benchmarkRoutes(
+                _In_ uint32_t count,
+                _In_ bool bulk);
+
+        void benchmarkNeighbors(
+                _In_ uint32_t count,
+                _In_ bool bulk);
+
+        /**
+         * @brief Measure operation on count objects.
+         *
+         * Call is executed for each single object or for each chunk of bulk
+         * size objects, it gets offset of first object and number of objects.
+         */
+        void measure(
+                _In_ sai_object_type_t objectType,
+                _In_ const std::string& operation,
+                _In_ uint32_t count,
+                _In_ bool bulk,
+                _In_ const std::function<sai_status_t(uint32_t, uint32_t)>& call);
+
+        static uint64_t getPercentile(
+                _In_ const std::vector<uint64_t>& sortedLatencies,
+                _In_ double percentile);
+
+        static uint64_t getElapsed(
+                _In_ const std::chrono::time_point<std::chrono::steady_clock>& start);
+
+    protected:
+
+        sai_redis_communication_mode_t m_mode;
+
+        uint32_t m_bulkSize;
+
+        sai_object_id_t m_vrId;
+
+        sai_object_id_t m_rifId;
+
+        sai_object_id_t m_nextHopId;
+
+        sai_neighbor_entry_t m_nextHopNeighbor;
+
+        nlohmann::json m_results;
+};
@@ -0,0 +1,81 @@
+#!/bin/bash
+
+# this script runs end to end benchmark: sairedis client -> channel -> syncd
+# -> virtual switch, for each communication mode, and writes JSON report
+#
+# usage: ./benchmark.sh [-s scales] [-b bulk_size] [-z modes] [-o output]
+#
+# if redis server is not running, local one is started for benchmark duration
+
+set -e
+
+cd "$(dirname "${BASH_SOURCE[0]}")"
+
+SCALES="1000,10000,50000"
+BULK_SIZE="1000"
+MODES="redis_async redis_sync zmq_sync"
+OUTPUT="benchmark.json"
+
+while getopts "s:b:z:o:h" opt; do
+    case $opt in
+        s) SCALES="$OPTARG" ;;
+        b) BULK_SIZE="$OPTARG" ;;
+        z) MODES="$OPTARG" ;;
+        o) OUTPUT="$OPTARG" ;;
+        *) echo "usage: $0 [-s scales] [-b bulk_size] [-z modes] [-o output]"; exit 1 ;;
+    esac
+done
+
+REDIS_PID=""
+TMPDIR=$(mktemp -d)
+
+cleanup()
+{
+    killall -9 vssyncd lt-vssyncd 2>/dev/null || true
+
+    if [ -n "$REDIS_PID" ]; then
+        kill "$REDIS_PID" 2>/dev/null || true
+    fi
+
+    rm -rf "$TMPDIR"
+}
+
+trap cleanup EXIT
+
+if ! redis-cli ping >/dev/null 2>&1; then
+    echo "starting local redis server"
+
+    mkdir -p /var/run/redis
+
+    redis-server --port 6379 --save "" --appendonly no \
+        --unixsocket /var/run/redis/redis.sock --unixsocketperm 777 >/dev/null &
+
+    REDIS_PID=$!
+
+    for i in $(seq 50); do
+        redis-cli ping >/dev/null 2>&1 && break
+        sleep 0.1
+    done
+fi
+
+REPORTS=()
+
+for mode in $MODES; do
+    echo "benchmarking $mode"
+
+    killall -9 vssyncd lt-vssyncd 2>/dev/null || true
+
+    redis-cli flushall >/dev/null
+
+    ./vssyncd -Sl -p BCM56850/vsprofile.ini -z "$mode" >/dev/null 2>&1 &
+
+    sleep 1
+
+    ./testbenchmark -z "$mode" -s "$SCALES" -b "$BULK_SIZE" -o "$TMPDIR/$mode.json"
+
+    REPORTS+=("$(cat "$TMPDIR/$mode.json")")
+done
+
+(IFS=,; echo "{\"runs\":[${REPORTS[*]}]}") > "$OUTPUT"
+
+echo "report written to $OUTPUT"
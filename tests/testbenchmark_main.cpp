@@ -0,0 +1,137 @@
+#include "TestBenchmark.h"
+
+#include <getopt.h>
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+
+void print_usage()
+{
+    SWSS_LOG_ENTER();
+
+    std::cerr << "Usage: testbenchmark [-z mode] [-s scales] [-b bulk_size] [-o output]" << std::endl << std::endl;
+    std::cerr << "    Benchmarks route and neighbor entries on running syncd, syncd must" << std::endl;
+    std::cerr << "    use the same communication mode." << std::endl << std::endl;
+    std::cerr << "    -z --redis_communication_mode:" << std::endl;
+    std::cerr << "        Communication mode: redis_async (default), redis_sync or zmq_sync" << std::endl;
+    std::cerr << "    -s --scales:" << std::endl;
+    std::cerr << "        Comma separated list of object counts, default 1000,10000" << std::endl;
+    std::cerr << "    -b --bulk_size:" << std::endl;
+    std::cerr << "        Number of objects in single bulk call, default 1000" << std::endl;
+    std::cerr << "    -o --output:" << std::endl;
+    std::cerr << "        Output JSON report file, default is standard output" << std::endl;
+    std::cerr << "    -h --help:" << std::endl;
+    std::cerr << "        Print out this message" << std::endl;
+}
+
+int main(int argc, char **argv)
+{
+    swss::Logger::getInstance().setMinPrio(swss::Logger::SWSS_NOTICE);
+
+    SWSS_LOG_ENTER();
+
+    static struct option longOptions[] =
+    {
+        { "redis_communication_mode", required_argument, 0, 'z' },
+        { "scales",                   required_argument, 0, 's' },
+        { "bulk_size",                required_argument, 0, 'b' },
+        { "output",                   required_argument, 0, 'o' },
+        { "help",                     no_argument,       0, 'h' },
+        { 0,                          0,                 0,  0  }
+    };
+
+    sai_redis_communication_mode_t mode = SAI_REDIS_COMMUNICATION_MODE_REDIS_ASYNC;
+
+    std::vector<uint32_t> scales = { 1000, 10000 };
+
+    uint32_t bulkSize = 1000;
+
+    std::string output;
+
+    int c = 0;
+
+    try
+    {
+        while ((c = getopt_long(argc, argv, "z:s:b:o:h", longOptions, NULL)) != -1)
+        {
+            switch (c)
+            {
+                case 'z':
+                    sai_deserialize_redis_communication_mode(optarg, mode);
+                    break;
+
+                case 's':
+                    {
+                        scales.clear();
+
+                        std::stringstream ss(optarg);
+                        std::string scale;
+
+                        while (std::getline(ss, scale, ','))
+                        {
+                            scales.push_back((uint32_t)std::stoul(scale));
+                        }
+                    }
+                    break;
+
+                case 'b':
+                    bulkSize = (uint32_t)std::stoul(optarg);
+                    break;
+
+                case 'o':
+                    output = optarg;
+                    break;
+
+                case 'h':
+                    print_usage();
+                    return EXIT_SUCCESS;
+
+                default:
+                    print_usage();
+                    return EXIT_FAILURE;
+            }
+        }
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "invalid argument: " << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if (scales.empty() || bulkSize == 0)
+    {
+        print_usage();
+        return EXIT_FAILURE;
+    }
+
+    TestBenchmark tb(mode, bulkSize);
+
+    try
+    {
+        tb.run(scales);
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "benchmark failed: " << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if (output.empty())
+    {
+        std::cout << tb.getReport() << std::endl;
+        return EXIT_SUCCESS;
+    }
+
+    std::ofstream ofs(output);
+
+    if (!ofs.is_open())
+    {
+        std::cerr << "failed to open " << output << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    ofs << tb.getReport() << std::endl;
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,203 @@
+#include "BinaryRecord.h"
+#include "BinaryRecordReader.h"
+#include "BinaryRecordWriter.h"
+#include "Recorder.h"
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+using namespace sairedis;
+
+TEST(BinaryRecord, varint)
+{
+    std::string buffer;
+
+    BinaryRecord::encodeVarint(buffer, 0);
+    BinaryRecord::encodeVarint(buffer, 127);
+    BinaryRecord::encodeVarint(buffer, 128);
+    BinaryRecord::encodeVarint(buffer, UINT64_MAX);
+
+    EXPECT_EQ(buffer.size(), 1 + 1 + 2 + 10);
+
+    size_t offset = 0;
+    uint64_t value;
+
+    EXPECT_TRUE(BinaryRecord::decodeVarint(buffer, offset, value));
+    EXPECT_EQ(value, 0);
+
+    EXPECT_TRUE(BinaryRecord::decodeVarint(buffer, offset, value));
+    EXPECT_EQ(value, 127);
+
+    EXPECT_TRUE(BinaryRecord::decodeVarint(buffer, offset, value));
+    EXPECT_EQ(value, 128);
+
+    EXPECT_TRUE(BinaryRecord::decodeVarint(buffer, offset, value));
+    EXPECT_EQ(value, UINT64_MAX);
+
+    EXPECT_FALSE(BinaryRecord::decodeVarint(buffer, offset, value));
+
+    offset = 0;
+
+    EXPECT_FALSE(BinaryRecord::decodeVarint(std::string("\x80", 1), offset, value));
+}
+
+TEST(BinaryRecord, zigzag)
+{
+    EXPECT_EQ(BinaryRecord::zigzagEncode(0), 0);
+    EXPECT_EQ(BinaryRecord::zigzagEncode(-1), 1);
+    EXPECT_EQ(BinaryRecord::zigzagEncode(1), 2);
+
+    for (int64_t value: { (int64_t)0, (int64_t)-7, (int64_t)1000000, INT64_MIN, INT64_MAX })
+    {
+        EXPECT_EQ(BinaryRecord::zigzagDecode(BinaryRecord::zigzagEncode(value)), value);
+    }
+}
+
+TEST(BinaryRecord, tokenize)
+{
+    EXPECT_EQ(BinaryRecord::tokenize(""), std::vector<std::string>({ "" }));
+    EXPECT_EQ(BinaryRecord::tokenize("c|a||b|"), std::vector<std::string>({ "c", "a", "", "b", "" }));
+}
+
+TEST(BinaryRecord, isBinary)
+{
+    std::stringstream text("2017-04-19.22:34:16.946880|#|comment");
+
+    EXPECT_FALSE(BinaryRecord::isBinary(text));
+    EXPECT_EQ(text.tellg(), 0);
+
+    std::stringstream empty;
+
+    EXPECT_FALSE(BinaryRecord::isBinary(empty));
+
+    std::stringstream binary(BinaryRecord::BLOCK_MAGIC + "x");
+
+    EXPECT_TRUE(BinaryRecord::isBinary(binary));
+    EXPECT_EQ(binary.get(), 'S');
+}
+
+static std::vector<std::pair<uint64_t, std::string>> records =
+{
+    { 1492634056946880, "#|recording on: ./sairedis.rec" },
+    { 1492634056946881, "c|SAI_OBJECT_TYPE_SWITCH:oid:0x21000000000000|SAI_SWITCH_ATTR_INIT_SWITCH=true|SAI_SWITCH_ATTR_SRC_MAC_ADDRESS=90:B1:1C:F4:A8:53" },
+    { 1492634056947000, "g|SAI_OBJECT_TYPE_SWITCH:oid:0x21000000000000|SAI_SWITCH_ATTR_PORT_NUMBER=0" },
+    { 1492634056946990, "G|SAI_STATUS_SUCCESS|SAI_SWITCH_ATTR_PORT_NUMBER=32" },
+    { 1492634056948000, "C|SAI_OBJECT_TYPE_ROUTE_ENTRY||{\"dest\":\"10.0.0.0/24\"}|SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION=SAI_PACKET_ACTION_FORWARD||{\"dest\":\"10.0.1.0/24\"}|SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION=SAI_PACKET_ACTION_DROP" },
+    { 1492634056948001, "E|SAI_STATUS_FAILURE||SAI_STATUS_SUCCESS|SAI_STATUS_FAILURE" },
+    { 1492634056948002, "" },
+};
+
+static std::string write_records(
+        _In_ size_t flushEvery)
+{
+    SWSS_LOG_ENTER();
+
+    std::stringstream stream;
+
+    BinaryRecordWriter writer(stream);
+
+    for (size_t i = 0; i < records.size(); i++)
+    {
+        writer.write(records[i].first, records[i].second);
+
+        if (flushEvery && (i + 1) % flushEvery == 0)
+        {
+            writer.flush();
+        }
+    }
+
+    writer.flush();
+
+    return stream.str();
+}
+
+static void check_records(
+        _In_ const std::string& binary)
+{
+    SWSS_LOG_ENTER();
+
+    std::stringstream stream(binary);
+
+    BinaryRecordReader reader(stream);
+
+    std::string line;
+
+    for (auto& record: records)
+    {
+        ASSERT_TRUE(reader.getline(line));
+
+        EXPECT_EQ(line, Recorder::getTimestamp(record.first) + "|" + record.second);
+    }
+
+    EXPECT_FALSE(reader.getline(line));
+}
+
+TEST(BinaryRecordReader, roundTrip)
+{
+    check_records(write_records(0));
+
+    // tables and timestamps are reset in each block
+
+    check_records(write_records(1));
+    check_records(write_records(3));
+}
+
+TEST(BinaryRecordReader, truncated)
+{
+    std::string first = write_records(0);
+
+    std::string binary = first + first.substr(0, first.size() - 1);
+
+    std::stringstream stream(binary);
+
+    BinaryRecordReader reader(stream);
+
+    std::string line;
+
+    size_t count = 0;
+
+    while (reader.getline(line))
+    {
+        count++;
+    }
+
+    EXPECT_EQ(count, records.size());
+}
+
+TEST(BinaryRecordReader, corrupted)
+{
+    std::string binary = write_records(0);
+
+    binary[0] = 'X';
+
+    std::stringstream stream(binary);
+
+    BinaryRecordReader reader(stream);
+
+    std::string line;
+
+    EXPECT_THROW(reader.getline(line), std::exception);
+}
+
+TEST(BinaryRecordWriter, compression)
+{
+    std::stringstream stream;
+
+    BinaryRecordWriter writer(stream);
+
+    size_t textSize = 0;
+
+    for (uint64_t i = 0; i < 10000; i++)
+    {
+        std::string line = "s|SAI_OBJECT_TYPE_PORT:oid:0x1000000000002|SAI_PORT_ATTR_ADMIN_STATE=true";
+
+        writer.write(1492634056946880 + i * 10, line);
+
+        textSize += Recorder::getTimestamp(0).size() + 1 + line.size() + 1;
+    }
+
+    writer.flush();
+
+    EXPECT_LT(stream.str().size() * 10, textSize);
+}
@@ -12,3 +12,9 @@ TEST(ClientConfig, loadFromFile)
 
     EXPECT_NE(ClientConfig::loadFromFile("files/client_config_ok.txt"), nullptr);
 }
+
+TEST(ClientConfig, pipelineDepth)
+{
+    EXPECT_EQ(ClientConfig::loadFromFile("files/client_config_ok.txt")->m_pipelineDepth, 0);
+    EXPECT_EQ(ClientConfig::loadFromFile("files/client_config_pipeline.txt")->m_pipelineDepth, 16);
+}
@@ -1,9 +1,16 @@
 #include "Context.h"
 
+#include "sairediscommon.h"
+
 #include "swss/logger.h"
+#include "swss/dbconnector.h"
+#include "swss/table.h"
+#include "swss/redisreply.h"
 
 #include <gtest/gtest.h>
 
+#include <set>
+
 using namespace sairedis;
 
 static sai_switch_notifications_t handle_notification(
@@ -30,6 +37,152 @@ TEST(Context, populateMetadata)
     ctx->populateMetadata(0x212121212212121L);
 }
 
+static void createAsicState(
+        _In_ int routes)
+{
+    SWSS_LOG_ENTER();
+
+    // objects are created on server side, so large view is created fast
+
+    static const std::string script =
+        "redis.call('FLUSHDB')\n"
+        "redis.call('HSET', KEYS[1] .. ':SAI_OBJECT_TYPE_SWITCH:oid:0x21000000000000', 'NULL', 'NULL')\n"
+        "redis.call('HSET', KEYS[1] .. ':SAI_OBJECT_TYPE_VIRTUAL_ROUTER:oid:0x3000000000022', 'NULL', 'NULL')\n"
+        "for i = 0, tonumber(ARGV[1]) - 1 do\n"
+        "    local dest = string.format('10.%d.%d.%d/32', math.floor(i / 65536) % 256, math.floor(i / 256) % 256, i % 256)\n"
+        "    redis.call('HSET', KEYS[1] .. ':SAI_OBJECT_TYPE_ROUTE_ENTRY:{\"dest\":\"' .. dest .. '\",\"switch_id\":\"oid:0x21000000000000\",\"vr\":\"oid:0x3000000000022\"}',\n"
+        "        'SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION', 'SAI_PACKET_ACTION_DROP')\n"
+        "end\n";
+
+    swss::DBConnector db("ASIC_DB", 0);
+
+    swss::RedisCommand command;
+
+    command.format("EVAL %s 1 %s %d", script.c_str(), ASIC_STATE_TABLE, routes);
+
+    swss::RedisReply r(&db, command);
+}
+
+static void flushAsicState()
+{
+    SWSS_LOG_ENTER();
+
+    swss::DBConnector db("ASIC_DB", 0);
+
+    db.flushdb();
+}
+
+TEST(Context, populateMetadataScan)
+{
+    auto recorder = std::make_shared<Recorder>();
+
+    auto cc = std::make_shared<ContextConfig>(0, "syncd", "ASIC_DB", "COUNTERS_DB","FLEX_DB", "STATE_DB");
+
+    auto ctx = std::make_shared<Context>(cc, recorder,handle_notification);
+
+    // more objects than single populate batch, so view is read using SCAN
+
+    createAsicState(12000);
+
+    ctx->populateMetadata(0x21000000000000);
+
+    EXPECT_EQ(ctx->m_meta->getObjectReferenceCount(0x3000000000022), 12000);
+    EXPECT_EQ(ctx->m_meta->getMissingReferencedOids(0x21000000000000).size(), 0);
+
+    flushAsicState();
+}
+
+TEST(Context, scanAsicState)
+{
+    auto recorder = std::make_shared<Recorder>();
+
+    auto cc = std::make_shared<ContextConfig>(0, "syncd", "ASIC_DB", "COUNTERS_DB","FLEX_DB", "STATE_DB");
+
+    auto ctx = std::make_shared<Context>(cc, recorder,handle_notification);
+
+    createAsicState(1000);
+
+    std::set<std::string> keys;
+
+    size_t batches = 0;
+
+    auto collect = [&](const swss::TableDump& dump)
+    {
+        SWSS_LOG_ENTER();
+
+        batches++;
+
+        for (auto& kvp: dump)
+        {
+            EXPECT_TRUE(keys.insert(kvp.first).second);
+            EXPECT_EQ(kvp.first.find(ASIC_STATE_TABLE), std::string::npos);
+        }
+    };
+
+    ctx->m_redisSai->scanAsicState(100, collect);
+
+    EXPECT_GT(batches, 1);
+    EXPECT_EQ(keys.size(), 1002);
+    EXPECT_EQ(keys.count("SAI_OBJECT_TYPE_VIRTUAL_ROUTER:oid:0x3000000000022"), 1);
+
+    // whole database fits into single batch, atomic dump is used
+
+    keys.clear();
+    batches = 0;
+
+    ctx->m_redisSai->scanAsicState(10000, collect);
+
+    EXPECT_EQ(batches, 1);
+    EXPECT_EQ(keys.size(), 1002);
+
+    flushAsicState();
+}
+
+TEST(Context, populateMissingReferences)
+{
+    auto recorder = std::make_shared<Recorder>();
+
+    auto cc = std::make_shared<ContextConfig>(0, "syncd", "ASIC_DB", "COUNTERS_DB","FLEX_DB", "STATE_DB");
+
+    auto ctx = std::make_shared<Context>(cc, recorder,handle_notification);
+
+    createAsicState(0);
+
+    swss::DBConnector db("ASIC_DB", 0);
+
+    swss::Table table(&db, ASIC_STATE_TABLE);
+
+    table.set("SAI_OBJECT_TYPE_ROUTER_INTERFACE:oid:0x60000000005cf", { { "SAI_ROUTER_INTERFACE_ATTR_VIRTUAL_ROUTER_ID", "oid:0x3000000000023" } });
+    table.set("SAI_OBJECT_TYPE_VIRTUAL_ROUTER:oid:0x3000000000023", { { "NULL", "NULL" } });
+
+    // view torn by scan, route is present but objects created before it
+    // are missing, next hop was removed after route was scanned
+
+    swss::TableDump dump;
+
+    dump["SAI_OBJECT_TYPE_ROUTE_ENTRY:{\"dest\":\"10.0.0.0/32\",\"switch_id\":\"oid:0x21000000000000\",\"vr\":\"oid:0x3000000000022\"}"]
+        ["SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID"] = "oid:0x60000000005cf";
+
+    dump["SAI_OBJECT_TYPE_ROUTE_ENTRY:{\"dest\":\"10.0.0.1/32\",\"switch_id\":\"oid:0x21000000000000\",\"vr\":\"oid:0x3000000000022\"}"]
+        ["SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID"] = "oid:0x4000000000001";
+
+    ctx->m_meta->populate(dump, 0x21000000000000);
+
+    EXPECT_EQ(ctx->m_meta->getMissingReferencedOids(0x21000000000000).size(), 4);
+
+    ctx->populateMissingReferences(0x21000000000000);
+
+    sai_object_meta_key_t mk = { .objecttype = SAI_OBJECT_TYPE_VIRTUAL_ROUTER, .objectkey = { .key = { .object_id = 0x3000000000023 } } };
+
+    // virtual router is referenced only by router interface
+
+    EXPECT_TRUE(ctx->m_meta->objectExists(mk));
+
+    EXPECT_EQ(ctx->m_meta->getMissingReferencedOids(0x21000000000000), std::vector<sai_object_id_t>({ 0x4000000000001 }));
+
+    flushAsicState();
+}
+
 TEST(Context, bulkGetClearStats)
 {
     auto recorder = std::make_shared<Recorder>();
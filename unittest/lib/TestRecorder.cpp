@@ -1,8 +1,11 @@
 #include "Recorder.h"
+#include "BinaryRecord.h"
+#include "BinaryRecordReader.h"
 
 #include <gtest/gtest.h>
 
 #include <memory>
+#include <fstream>
 
 using namespace sairedis;
 
@@ -26,3 +29,94 @@ TEST(Recorder, requestLogRotate)
 
     rec.recordComment("bar");
 }
+
+TEST(Recorder, setRecordingFormat)
+{
+    Recorder rec;
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_REDIS_SWITCH_ATTR_RECORDING_FILENAME;
+    attr.value.s8list.list = (int8_t*)"sairedis.recb";
+    attr.value.s8list.count = 13;
+
+    EXPECT_TRUE(rec.setRecordingFilename(attr));
+
+    attr.id = SAI_REDIS_SWITCH_ATTR_RECORDING_FORMAT;
+    attr.value.s32 = 7;
+
+    EXPECT_FALSE(rec.setRecordingFormat(attr));
+
+    attr.value.s32 = SAI_REDIS_RECORDING_FORMAT_BINARY;
+
+    EXPECT_TRUE(rec.setRecordingFormat(attr));
+
+    unlink("sairedis.recb");
+
+    rec.enableRecording(true);
+
+    rec.recordComment("foo");
+
+    rec.enableRecording(false);
+
+    std::ifstream ifs("sairedis.recb", std::ifstream::in | std::ifstream::binary);
+
+    EXPECT_TRUE(BinaryRecord::isBinary(ifs));
+
+    BinaryRecordReader reader(ifs);
+
+    std::string line;
+
+    EXPECT_TRUE(reader.getline(line));
+    EXPECT_NE(line.find("|#|recording on: ./sairedis.recb"), std::string::npos);
+
+    EXPECT_TRUE(reader.getline(line));
+    EXPECT_NE(line.find("|#|foo"), std::string::npos);
+
+    EXPECT_FALSE(reader.getline(line));
+}
+
+TEST(Recorder, binaryFlushThread)
+{
+    Recorder rec;
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_REDIS_SWITCH_ATTR_RECORDING_FILENAME;
+    attr.value.s8list.list = (int8_t*)"sairedis.recf";
+    attr.value.s8list.count = 13;
+
+    EXPECT_TRUE(rec.setRecordingFilename(attr));
+
+    attr.id = SAI_REDIS_SWITCH_ATTR_RECORDING_FORMAT;
+    attr.value.s32 = SAI_REDIS_RECORDING_FORMAT_BINARY;
+
+    EXPECT_TRUE(rec.setRecordingFormat(attr));
+
+    unlink("sairedis.recf");
+
+    rec.enableRecording(true);
+
+    rec.recordComment("foo");
+
+    // block is written by flush thread without new records and without
+    // closing recording file
+
+    usleep(2500 * 1000);
+
+    std::ifstream ifs("sairedis.recf", std::ifstream::in | std::ifstream::binary);
+
+    BinaryRecordReader reader(ifs);
+
+    std::string line;
+
+    EXPECT_TRUE(reader.getline(line));
+    EXPECT_TRUE(reader.getline(line));
+    EXPECT_NE(line.find("|#|foo"), std::string::npos);
+
+    rec.enableRecording(false);
+
+    EXPECT_EQ(rec.m_flushThread, nullptr);
+
+    unlink("sairedis.recf");
+}
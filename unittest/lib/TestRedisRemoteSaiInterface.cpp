@@ -88,3 +88,225 @@ TEST(RedisRemoteSaiInterface, queryStatsStCapability)
                                          SAI_OBJECT_TYPE_PORT,
                                          &stats_capability));
 }
+
+class TestRedisRemoteSaiInterfacePipelineChannel : public RedisChannel
+{
+public:
+  TestRedisRemoteSaiInterfacePipelineChannel(_In_ const string &dbAsic,
+              _In_ Channel::Callback callback) : RedisChannel(dbAsic, callback) {
+      SWSS_LOG_ENTER();
+    }
+
+  void set(
+      _In_ const string &key,
+      _In_ const vector<FieldValueTuple> &values,
+      _In_ const string &command) override
+    {
+      SWSS_LOG_ENTER();
+
+      m_sent++;
+    }
+
+  sai_status_t receiveResponse(
+      _In_ const string &command,
+      _Out_ KeyOpFieldsValuesTuple &kco) override
+    {
+      SWSS_LOG_ENTER();
+
+      m_received++;
+
+      return (m_received % 2) ? SAI_STATUS_SUCCESS : SAI_STATUS_INVALID_PARAMETER;
+    }
+
+  size_t m_sent = 0;
+
+  size_t m_received = 0;
+};
+
+static vector<pair<uint64_t, sai_status_t>> g_pipelineResponses;
+
+static void pipelineResponse(
+        _In_ uint64_t ticket,
+        _In_ sai_status_t status)
+{
+    SWSS_LOG_ENTER();
+
+    g_pipelineResponses.emplace_back(ticket, status);
+}
+
+TEST(RedisRemoteSaiInterface, syncPipeline)
+{
+    SWSS_LOG_ENTER();
+
+    auto ctx = ContextConfigContainer::loadFromFile("foo");
+    auto rec = make_shared<Recorder>();
+
+    RedisRemoteSaiInterface sai(ctx->get(0), nullptr, rec);
+
+    auto channel = std::make_shared<TestRedisRemoteSaiInterfacePipelineChannel>(
+        sai.m_contextConfig->m_dbAsic,
+        std::bind(&RedisRemoteSaiInterface::handleNotification, &sai, placeholders::_1, placeholders::_2, placeholders::_3));
+
+    sai.m_communicationChannel = channel;
+    sai.m_syncMode = true;
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_REDIS_SWITCH_ATTR_SYNC_PIPELINE_RESPONSE_NOTIFY;
+    attr.value.ptr = (void*)&pipelineResponse;
+
+    EXPECT_EQ(sai.set(SAI_OBJECT_TYPE_SWITCH, SAI_NULL_OBJECT_ID, &attr), SAI_STATUS_SUCCESS);
+
+    attr.id = SAI_REDIS_SWITCH_ATTR_SYNC_PIPELINE_DEPTH;
+    attr.value.u32 = 3;
+
+    EXPECT_EQ(sai.set(SAI_OBJECT_TYPE_SWITCH, SAI_NULL_OBJECT_ID, &attr), SAI_STATUS_SUCCESS);
+
+    g_pipelineResponses.clear();
+
+    // all requests return success, but only window of 3 is outstanding
+
+    attr.id = SAI_PORT_ATTR_ADMIN_STATE;
+    attr.value.booldata = true;
+
+    for (int i = 0; i < 5; i++)
+    {
+        EXPECT_EQ(sai.set(SAI_OBJECT_TYPE_PORT, "oid:0x1000000000002", &attr), SAI_STATUS_SUCCESS);
+    }
+
+    EXPECT_EQ(channel->m_sent, 5);
+    EXPECT_EQ(channel->m_received, 2);
+    EXPECT_EQ(channel->getDeferredResponseCount(), 3);
+
+    attr.id = SAI_REDIS_SWITCH_ATTR_SYNC_PIPELINE_COLLECT;
+    attr.value.booldata = true;
+
+    EXPECT_EQ(sai.set(SAI_OBJECT_TYPE_SWITCH, SAI_NULL_OBJECT_ID, &attr), SAI_STATUS_INVALID_PARAMETER);
+
+    EXPECT_EQ(channel->getDeferredResponseCount(), 0);
+
+    // responses are collected in order, each with its own status
+
+    ASSERT_EQ(g_pipelineResponses.size(), 5);
+
+    for (size_t i = 0; i < g_pipelineResponses.size(); i++)
+    {
+        EXPECT_EQ(g_pipelineResponses[i].first, i + 1);
+        EXPECT_EQ(g_pipelineResponses[i].second, (i % 2) ? SAI_STATUS_INVALID_PARAMETER : SAI_STATUS_SUCCESS);
+    }
+
+    // failure was already reported
+
+    EXPECT_EQ(sai.set(SAI_OBJECT_TYPE_SWITCH, SAI_NULL_OBJECT_ID, &attr), SAI_STATUS_SUCCESS);
+
+    // disabling pipeline returns to waiting for each response
+
+    attr.id = SAI_REDIS_SWITCH_ATTR_SYNC_PIPELINE_DEPTH;
+    attr.value.u32 = 0;
+
+    EXPECT_EQ(sai.set(SAI_OBJECT_TYPE_SWITCH, SAI_NULL_OBJECT_ID, &attr), SAI_STATUS_SUCCESS);
+
+    attr.id = SAI_PORT_ATTR_ADMIN_STATE;
+
+    EXPECT_EQ(sai.set(SAI_OBJECT_TYPE_PORT, "oid:0x1000000000002", &attr), SAI_STATUS_INVALID_PARAMETER);
+
+    EXPECT_EQ(channel->m_received, 6);
+    EXPECT_EQ(channel->getDeferredResponseCount(), 0);
+}
+
+class TestRedisRemoteSaiInterfaceTimeoutChannel : public TestRedisRemoteSaiInterfacePipelineChannel
+{
+public:
+  TestRedisRemoteSaiInterfaceTimeoutChannel(_In_ const string &dbAsic,
+              _In_ Channel::Callback callback) : TestRedisRemoteSaiInterfacePipelineChannel(dbAsic, callback) {
+      SWSS_LOG_ENTER();
+    }
+
+  sai_status_t receiveResponse(
+      _In_ const string &command,
+      _Out_ KeyOpFieldsValuesTuple &kco) override
+    {
+      SWSS_LOG_ENTER();
+
+      m_received++;
+
+      if (m_received == 2)
+      {
+          // second response times out
+
+          markOutOfSync(command);
+
+          return SAI_STATUS_FAILURE;
+      }
+
+      return SAI_STATUS_SUCCESS;
+    }
+};
+
+TEST(RedisRemoteSaiInterface, syncPipelineTimeout)
+{
+    SWSS_LOG_ENTER();
+
+    auto ctx = ContextConfigContainer::loadFromFile("foo");
+    auto rec = make_shared<Recorder>();
+
+    RedisRemoteSaiInterface sai(ctx->get(0), nullptr, rec);
+
+    auto channel = std::make_shared<TestRedisRemoteSaiInterfaceTimeoutChannel>(
+        sai.m_contextConfig->m_dbAsic,
+        std::bind(&RedisRemoteSaiInterface::handleNotification, &sai, placeholders::_1, placeholders::_2, placeholders::_3));
+
+    sai.m_communicationChannel = channel;
+    sai.m_syncMode = true;
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_REDIS_SWITCH_ATTR_SYNC_PIPELINE_RESPONSE_NOTIFY;
+    attr.value.ptr = (void*)&pipelineResponse;
+
+    EXPECT_EQ(sai.set(SAI_OBJECT_TYPE_SWITCH, SAI_NULL_OBJECT_ID, &attr), SAI_STATUS_SUCCESS);
+
+    attr.id = SAI_REDIS_SWITCH_ATTR_SYNC_PIPELINE_DEPTH;
+    attr.value.u32 = 3;
+
+    EXPECT_EQ(sai.set(SAI_OBJECT_TYPE_SWITCH, SAI_NULL_OBJECT_ID, &attr), SAI_STATUS_SUCCESS);
+
+    g_pipelineResponses.clear();
+
+    attr.id = SAI_PORT_ATTR_ADMIN_STATE;
+    attr.value.booldata = true;
+
+    for (int i = 0; i < 5; i++)
+    {
+        EXPECT_EQ(sai.set(SAI_OBJECT_TYPE_PORT, "oid:0x1000000000002", &attr), SAI_STATUS_SUCCESS);
+    }
+
+    // timeout of second response fails all outstanding requests
+
+    EXPECT_TRUE(channel->isOutOfSync());
+    EXPECT_EQ(channel->m_received, 2);
+    EXPECT_EQ(channel->getDeferredResponseCount(), 0);
+
+    ASSERT_EQ(g_pipelineResponses.size(), 5);
+
+    for (size_t i = 0; i < g_pipelineResponses.size(); i++)
+    {
+        EXPECT_EQ(g_pipelineResponses[i].first, i + 1);
+        EXPECT_EQ(g_pipelineResponses[i].second, i ? SAI_STATUS_FAILURE : SAI_STATUS_SUCCESS);
+    }
+
+    // next requests fail without waiting for late responses
+
+    EXPECT_EQ(sai.set(SAI_OBJECT_TYPE_PORT, "oid:0x1000000000002", &attr), SAI_STATUS_SUCCESS);
+
+    ASSERT_EQ(g_pipelineResponses.size(), 6);
+    EXPECT_EQ(g_pipelineResponses[5].first, 6);
+    EXPECT_EQ(g_pipelineResponses[5].second, SAI_STATUS_FAILURE);
+
+    EXPECT_EQ(channel->m_received, 2);
+
+    attr.id = SAI_REDIS_SWITCH_ATTR_SYNC_PIPELINE_COLLECT;
+    attr.value.booldata = true;
+
+    EXPECT_EQ(sai.set(SAI_OBJECT_TYPE_SWITCH, SAI_NULL_OBJECT_ID, &attr), SAI_STATUS_FAILURE);
+}
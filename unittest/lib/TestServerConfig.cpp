@@ -13,3 +13,9 @@ TEST(ServerConfig, loadFromFile)
     EXPECT_NE(ServerConfig::loadFromFile("files/server_config_ok.json"), nullptr);
     EXPECT_NE(ServerConfig::loadFromFile("files/server_config_bad.json"), nullptr);
 }
+
+TEST(ServerConfig, workerThreads)
+{
+    EXPECT_EQ(ServerConfig::loadFromFile("files/server_config_ok.json")->m_workerThreads, 0);
+    EXPECT_EQ(ServerConfig::loadFromFile("files/server_config_workers.json")->m_workerThreads, 4);
+}
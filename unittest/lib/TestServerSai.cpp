@@ -1,9 +1,12 @@
 #include "ServerSai.h"
+#include "ClientSai.h"
+#include "sairedis.h"
 
 #include "sai_serialize.h"
 #include "vslib/ContextConfigContainer.h"
 #include "vslib/VirtualSwitchSaiInterface.h"
 #include "vslib/Sai.h"
+#include "vslib/saivs.h"
 #include "lib/Sai.h"
 
 #include "swss/dbconnector.h"
@@ -20,6 +23,10 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 #include <memory>
+#include <fstream>
+#include <thread>
+#include <atomic>
+#include <chrono>
 
 
 using namespace sairedis;
@@ -103,3 +110,307 @@ TEST(ServerSai, stats_st_capability_query)
               sai.processStatsStCapabilityQuery(kco));
 }
 #endif
+
+static std::string g_serverConfig;
+static std::string g_clientConfig;
+
+static const char* router_profile_get_value(
+        _In_ sai_switch_profile_id_t profile_id,
+        _In_ const char* variable)
+{
+    SWSS_LOG_ENTER();
+
+    if (variable == NULL)
+        return NULL;
+
+    if (strcmp(variable, SAI_REDIS_KEY_SERVER_CONFIG) == 0)
+        return g_serverConfig.c_str();
+
+    if (strcmp(variable, SAI_REDIS_KEY_CLIENT_CONFIG) == 0)
+        return g_clientConfig.c_str();
+
+    if (strcmp(variable, SAI_KEY_VS_SWITCH_TYPE) == 0)
+        return SAI_VALUE_VS_SWITCH_TYPE_BCM56850;
+
+    return NULL;
+}
+
+static sai_service_method_table_t router_services = {
+    router_profile_get_value,
+    profile_get_next_value
+};
+
+static std::shared_ptr<ServerSai> createServer(
+        _In_ std::shared_ptr<saivs::Sai> vs,
+        _In_ uint32_t workerThreads)
+{
+    SWSS_LOG_ENTER();
+
+    g_serverConfig = "/tmp/sai_server_test_config.json";
+
+    std::ofstream ofs(g_serverConfig);
+
+    ofs << "{ \"zmq_endpoint\": \"ipc:///tmp/saiServerTest\", "
+        << "\"zmq_ntf_endpoint\": \"ipc:///tmp/saiServerTestNtf\", "
+        << "\"worker_threads\": " << workerThreads << " }";
+
+    ofs.close();
+
+    auto server = std::make_shared<ServerSai>(vs);
+
+    EXPECT_EQ(server->apiInitialize(0, &router_services), SAI_STATUS_SUCCESS);
+
+    return server;
+}
+
+static std::shared_ptr<ClientSai> createClient(
+        _In_ int index,
+        _In_ uint32_t pipelineDepth)
+{
+    SWSS_LOG_ENTER();
+
+    g_clientConfig = "/tmp/sai_client_test_config_" + std::to_string(index) + ".json";
+
+    std::ofstream ofs(g_clientConfig);
+
+    ofs << "{ \"zmq_endpoint\": \"ipc:///tmp/saiServerTest\", "
+        << "\"zmq_ntf_endpoint\": \"ipc:///tmp/saiServerTestNtf" << index << "\", "
+        << "\"pipeline_depth\": " << pipelineDepth << " }";
+
+    ofs.close();
+
+    auto client = std::make_shared<ClientSai>();
+
+    EXPECT_EQ(client->apiInitialize(0, &router_services), SAI_STATUS_SUCCESS);
+
+    return client;
+}
+
+static std::vector<sai_object_id_t> createSwitch(
+        _In_ std::shared_ptr<saivs::Sai> vs,
+        _Out_ sai_object_id_t& switchId)
+{
+    SWSS_LOG_ENTER();
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_SWITCH_ATTR_INIT_SWITCH;
+    attr.value.booldata = true;
+
+    EXPECT_EQ(vs->create(SAI_OBJECT_TYPE_SWITCH, &switchId, SAI_NULL_OBJECT_ID, 1, &attr), SAI_STATUS_SUCCESS);
+
+    std::vector<sai_object_id_t> ports(128);
+
+    attr.id = SAI_SWITCH_ATTR_PORT_LIST;
+    attr.value.objlist.count = (uint32_t)ports.size();
+    attr.value.objlist.list = ports.data();
+
+    EXPECT_EQ(vs->get(SAI_OBJECT_TYPE_SWITCH, switchId, 1, &attr), SAI_STATUS_SUCCESS);
+
+    ports.resize(attr.value.objlist.count);
+
+    return ports;
+}
+
+static std::vector<std::pair<uint64_t, sai_status_t>> g_pipelineResponses;
+
+static void onPipelineResponse(
+        _In_ uint64_t ticket,
+        _In_ sai_status_t status)
+{
+    SWSS_LOG_ENTER();
+
+    g_pipelineResponses.emplace_back(ticket, status);
+}
+
+TEST(ServerSai, isReadOnlyOperation)
+{
+    EXPECT_TRUE(ServerSai::isReadOnlyOperation(REDIS_ASIC_STATE_COMMAND_GET));
+    EXPECT_TRUE(ServerSai::isReadOnlyOperation(REDIS_ASIC_STATE_COMMAND_GET_STATS));
+    EXPECT_TRUE(ServerSai::isReadOnlyOperation(REDIS_ASIC_STATE_COMMAND_ATTR_CAPABILITY_QUERY));
+
+    EXPECT_FALSE(ServerSai::isReadOnlyOperation(REDIS_ASIC_STATE_COMMAND_SET));
+    EXPECT_FALSE(ServerSai::isReadOnlyOperation(REDIS_ASIC_STATE_COMMAND_CLEAR_STATS));
+    EXPECT_FALSE(ServerSai::isReadOnlyOperation(REDIS_ASIC_STATE_COMMAND_BULK_CREATE));
+}
+
+TEST(ServerSai, routerMultipleClients)
+{
+    auto vs = std::make_shared<saivs::Sai>();
+
+    auto server = createServer(vs, 4);
+
+    sai_object_id_t switchId;
+
+    auto ports = createSwitch(vs, switchId);
+
+    ASSERT_NE(ports.size(), 0);
+
+    auto a = createClient(0, 0);
+    auto b = createClient(1, 8);
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_SWITCH_ATTR_PORT_NUMBER;
+
+    EXPECT_EQ(a->get(SAI_OBJECT_TYPE_SWITCH, switchId, 1, &attr), SAI_STATUS_SUCCESS);
+    EXPECT_EQ(attr.value.u32, ports.size());
+
+    g_pipelineResponses.clear();
+
+    attr.id = SAI_REDIS_SWITCH_ATTR_SYNC_PIPELINE_RESPONSE_NOTIFY;
+    attr.value.ptr = (void*)&onPipelineResponse;
+
+    EXPECT_EQ(b->set(SAI_OBJECT_TYPE_SWITCH, switchId, &attr), SAI_STATUS_SUCCESS);
+
+    // pipelined sets return immediately
+
+    attr.id = SAI_PORT_ATTR_ADMIN_STATE;
+    attr.value.booldata = true;
+
+    for (auto port: ports)
+    {
+        EXPECT_EQ(b->set(SAI_OBJECT_TYPE_PORT, port, &attr), SAI_STATUS_SUCCESS);
+    }
+
+    // failure of pipelined set is returned by collect
+
+    EXPECT_EQ(b->set(SAI_OBJECT_TYPE_PORT, switchId, &attr), SAI_STATUS_SUCCESS);
+
+    attr.id = SAI_REDIS_SWITCH_ATTR_SYNC_PIPELINE_COLLECT;
+    attr.value.booldata = true;
+
+    EXPECT_NE(b->set(SAI_OBJECT_TYPE_SWITCH, switchId, &attr), SAI_STATUS_SUCCESS);
+
+    ASSERT_EQ(g_pipelineResponses.size(), ports.size() + 1);
+
+    EXPECT_EQ(g_pipelineResponses.front().first, 1);
+    EXPECT_EQ(g_pipelineResponses.front().second, SAI_STATUS_SUCCESS);
+    EXPECT_EQ(g_pipelineResponses.back().first, ports.size() + 1);
+    EXPECT_NE(g_pipelineResponses.back().second, SAI_STATUS_SUCCESS);
+
+    // failure is reported only once
+
+    EXPECT_EQ(b->set(SAI_OBJECT_TYPE_SWITCH, switchId, &attr), SAI_STATUS_SUCCESS);
+
+    attr.id = SAI_PORT_ATTR_ADMIN_STATE;
+
+    // get is executed after all previous requests of the same client
+
+    attr.value.booldata = false;
+
+    EXPECT_EQ(b->get(SAI_OBJECT_TYPE_PORT, ports.back(), 1, &attr), SAI_STATUS_SUCCESS);
+    EXPECT_EQ(attr.value.booldata, true);
+
+    // other client sees the change
+
+    attr.value.booldata = false;
+
+    EXPECT_EQ(a->get(SAI_OBJECT_TYPE_PORT, ports.front(), 1, &attr), SAI_STATUS_SUCCESS);
+    EXPECT_EQ(attr.value.booldata, true);
+
+    EXPECT_EQ(a->apiUninitialize(), SAI_STATUS_SUCCESS);
+    EXPECT_EQ(b->apiUninitialize(), SAI_STATUS_SUCCESS);
+
+    EXPECT_EQ(server->apiUninitialize(), SAI_STATUS_SUCCESS);
+}
+
+static double runClients(
+        _In_ uint32_t workerThreads,
+        _In_ uint32_t pipelineDepth,
+        _In_ int clientCount,
+        _In_ int count)
+{
+    SWSS_LOG_ENTER();
+
+    auto vs = std::make_shared<saivs::Sai>();
+
+    auto server = createServer(vs, workerThreads);
+
+    sai_object_id_t switchId;
+
+    auto ports = createSwitch(vs, switchId);
+
+    std::vector<std::shared_ptr<ClientSai>> clients;
+
+    for (int i = 0; i < clientCount; i++)
+    {
+        clients.push_back(createClient(i, pipelineDepth));
+    }
+
+    std::atomic<int> failures(0);
+
+    std::vector<std::thread> threads;
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    for (auto& client: clients)
+    {
+        threads.emplace_back([&, client]() {
+
+            sai_attribute_t attr;
+
+            attr.id = SAI_PORT_ATTR_ADMIN_STATE;
+
+            for (int i = 0; i < count; i++)
+            {
+                auto port = ports.at((size_t)i % ports.size());
+
+                // mostly reads, every 4th request is write
+
+                if (i % 4 == 0)
+                {
+                    attr.value.booldata = (i % 8 == 0);
+
+                    if (client->set(SAI_OBJECT_TYPE_PORT, port, &attr) != SAI_STATUS_SUCCESS)
+                        failures++;
+                }
+                else if (client->get(SAI_OBJECT_TYPE_PORT, port, 1, &attr) != SAI_STATUS_SUCCESS)
+                {
+                    failures++;
+                }
+            }
+        });
+    }
+
+    for (auto& t: threads)
+    {
+        t.join();
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+
+    for (auto& client: clients)
+    {
+        client->apiUninitialize();
+    }
+
+    server->apiUninitialize();
+
+    EXPECT_EQ(failures, 0);
+
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+TEST(ServerSai, routerThroughput_perf)
+{
+    int count = 20000;
+
+    if (getenv("TEST_NO_PERF"))
+    {
+        count = 200;
+
+        std::cout << "disabling performance tests" << std::endl;
+    }
+
+    int clients = 4;
+
+    double rep = runClients(0, 0, clients, count);
+    double router = runClients(4, 0, clients, count);
+    double pipelined = runClients(4, 16, clients, count);
+
+    std::cout << clients << " clients x " << count << " requests, "
+        << "REP: " << rep << " ms, "
+        << "ROUTER: " << router << " ms, "
+        << "ROUTER pipelined: " << pipelined << " ms" << std::endl;
+}
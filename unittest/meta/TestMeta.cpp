@@ -1,6 +1,7 @@
 #include "Meta.h"
 #include "MockMeta.h"
 #include "MetaTestSaiInterface.h"
+#include "sai_serialize.h"
 
 #include <arpa/inet.h>
 #include <net/ethernet.h>
@@ -10,6 +11,7 @@
 #include <boost/algorithm/string/join.hpp>
 
 #include <memory>
+#include <algorithm>
 
 #define VLAN_ID 2
 
@@ -1739,10 +1741,120 @@ TEST(Meta, populate)
     m.populate(dump);
 }
 
+TEST(Meta, populateShards)
+{
+    Meta m(std::make_shared<MetaTestSaiInterface>());
+
+    swss::TableDump dump;
+
+    // enough objects to be deserialized by multiple shards
+
+    for (int i = 0; i < 5000; i++)
+    {
+        auto dest = "10.0." + std::to_string(i / 256) + "." + std::to_string(i % 256) + "/32";
+
+        dump["SAI_OBJECT_TYPE_ROUTE_ENTRY:{\"dest\":\"" + dest + "\",\"switch_id\":\"oid:0x21000000000000\",\"vr\":\"oid:0x3000000000022\"}"]
+            ["SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID"] = "oid:0x60000000005cf";
+    }
+
+    // route of other switch must be skipped
+
+    std::string otherSwitchRoute = "SAI_OBJECT_TYPE_ROUTE_ENTRY:{\"dest\":\"10.0.0.0/32\",\"switch_id\":\"oid:0x121000000000001\",\"vr\":\"oid:0x103000000000022\"}";
+
+    dump[otherSwitchRoute]["SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID"] = "oid:0x60000000005cf";
+
+    // shard count is not taken from hardware, so parallel path is
+    // exercised also on single core machine
+
+    EXPECT_EQ(m.populate(dump, 0x21000000000000, 4), 4);
+
+    EXPECT_EQ(m.getObjectReferenceCount(0x60000000005cf), 5000);
+    EXPECT_EQ(m.getObjectReferenceCount(0x3000000000022), 5000);
+
+    sai_object_meta_key_t mk;
+
+    sai_deserialize_object_meta_key(otherSwitchRoute, mk);
+
+    EXPECT_FALSE(m.objectExists(mk));
+
+    sai_deserialize_object_meta_key(dump.begin()->first, mk);
+
+    EXPECT_TRUE(m.objectExists(mk));
+}
+
+TEST(Meta, populateShardException)
+{
+    Meta m(std::make_shared<MetaTestSaiInterface>());
+
+    swss::TableDump dump;
+
+    for (int i = 0; i < 5000; i++)
+    {
+        auto dest = "10.0." + std::to_string(i / 256) + "." + std::to_string(i % 256) + "/32";
+
+        dump["SAI_OBJECT_TYPE_ROUTE_ENTRY:{\"dest\":\"" + dest + "\",\"switch_id\":\"oid:0x21000000000000\",\"vr\":\"oid:0x3000000000022\"}"]
+            ["SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID"] = "oid:0x60000000005cf";
+    }
+
+    // invalid attribute is deserialized by last shard
+
+    dump["SAI_OBJECT_TYPE_VLAN:oid:0x2600000000002f"]["SAI_VLAN_ATTR_FOO"] = "2";
+
+    EXPECT_ANY_THROW(m.populate(dump, SAI_NULL_OBJECT_ID, 4));
+}
+
+TEST(Meta, populateShardCount)
+{
+    Meta m(std::make_shared<MetaTestSaiInterface>());
+
+    swss::TableDump dump;
+
+    dump["SAI_OBJECT_TYPE_VLAN:oid:0x2600000000002f"]["SAI_VLAN_ATTR_VLAN_ID"] = "2";
+
+    // too few objects to be split
+
+    EXPECT_EQ(m.populate(dump, SAI_NULL_OBJECT_ID, 4), 1);
+}
+
+TEST(Meta, getMissingReferencedOids)
+{
+    Meta m(std::make_shared<MetaTestSaiInterface>());
+
+    swss::TableDump dump;
+
+    dump["SAI_OBJECT_TYPE_ROUTE_ENTRY:{\"dest\":\"10.0.0.0/32\",\"switch_id\":\"oid:0x21000000000000\",\"vr\":\"oid:0x3000000000022\"}"]
+        ["SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID"] = "oid:0x60000000005cf";
+
+    dump["SAI_OBJECT_TYPE_ROUTE_ENTRY:{\"dest\":\"10.0.0.0/32\",\"switch_id\":\"oid:0x121000000000001\",\"vr\":\"oid:0x103000000000022\"}"]
+        ["SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID"] = "oid:0x0";
+
+    m.populate(dump);
+
+    auto missing = m.getMissingReferencedOids(0x21000000000000);
+
+    std::sort(missing.begin(), missing.end());
+
+    EXPECT_EQ(missing, std::vector<sai_object_id_t>({ 0x3000000000022, 0x60000000005cf, 0x21000000000000 }));
+
+    EXPECT_EQ(m.getMissingReferencedOids().size(), 5);
+
+    // populated objects are no longer missing
+
+    swss::TableDump refs;
+
+    refs["SAI_OBJECT_TYPE_SWITCH:oid:0x21000000000000"]["NULL"] = "NULL";
+    refs["SAI_OBJECT_TYPE_VIRTUAL_ROUTER:oid:0x3000000000022"]["NULL"] = "NULL";
+    refs["SAI_OBJECT_TYPE_ROUTER_INTERFACE:oid:0x60000000005cf"]["NULL"] = "NULL";
+
+    m.populate(refs);
+
+    EXPECT_EQ(m.getMissingReferencedOids(0x21000000000000).size(), 0);
+}
+
 TEST(Meta, bulkGetClearStats)
 {
     Meta m(std::make_shared<MetaTestSaiInterface>());
-    EXPECT_EQ(SAI_STATUS_NOT_IMPLEMENTED, m.bulkGetStats(SAI_NULL_OBJECT_ID,
+    EXPECT_EQ(SAI_STATUS_INVALID_PARAMETER, m.bulkGetStats(SAI_NULL_OBJECT_ID,
                                                          SAI_OBJECT_TYPE_PORT,
                                                          0,
                                                          nullptr,
@@ -1751,7 +1863,7 @@ TEST(Meta, bulkGetClearStats)
                                                          SAI_STATS_MODE_BULK_READ,
                                                          nullptr,
                                                          nullptr));
-    EXPECT_EQ(SAI_STATUS_NOT_IMPLEMENTED, m.bulkClearStats(SAI_NULL_OBJECT_ID,
+    EXPECT_EQ(SAI_STATUS_INVALID_PARAMETER, m.bulkClearStats(SAI_NULL_OBJECT_ID,
                                                            SAI_OBJECT_TYPE_PORT,
                                                            0,
                                                            nullptr,
@@ -0,0 +1,70 @@
+#include "SaiAttrArena.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+using namespace saimeta;
+
+TEST(SaiAttrArena, ctr)
+{
+    EXPECT_THROW(std::make_shared<SaiAttrArena>(16), std::runtime_error);
+}
+
+TEST(SaiAttrArena, allocate)
+{
+    SaiAttrArena arena;
+
+    EXPECT_EQ(arena.allocate(0), nullptr);
+
+    void* a = arena.allocate(8);
+    void* b = arena.allocate(24);
+
+    ASSERT_NE(a, nullptr);
+    ASSERT_NE(b, nullptr);
+
+    // sizes are rounded up to size class
+
+    EXPECT_EQ(arena.getUsedBytes(), 16 + 32);
+    EXPECT_EQ(arena.getReservedBytes(), SaiAttrArena::DEFAULT_CHUNK_SIZE);
+
+    arena.deallocate(a, 8);
+
+    EXPECT_EQ(arena.getUsedBytes(), 32);
+
+    // released block is reused for the same size class
+
+    EXPECT_EQ(arena.allocate(16), a);
+
+    arena.deallocate(a, 16);
+    arena.deallocate(b, 24);
+
+    EXPECT_EQ(arena.getUsedBytes(), 0);
+
+    // large blocks are allocated directly
+
+    void* c = arena.allocate(SaiAttrArena::MAX_BLOCK_SIZE + 1);
+
+    EXPECT_EQ(arena.getUsedBytes(), SaiAttrArena::MAX_BLOCK_SIZE + 1);
+
+    arena.deallocate(c, SaiAttrArena::MAX_BLOCK_SIZE + 1);
+
+    EXPECT_EQ(arena.getUsedBytes(), 0);
+    EXPECT_EQ(arena.getReservedBytes(), SaiAttrArena::DEFAULT_CHUNK_SIZE);
+}
+
+TEST(SaiAttrArena, newChunk)
+{
+    SaiAttrArena arena(SaiAttrArena::MAX_BLOCK_SIZE);
+
+    void* a = arena.allocate(SaiAttrArena::MAX_BLOCK_SIZE);
+    void* b = arena.allocate(16);
+
+    EXPECT_EQ(arena.getReservedBytes(), 2 * SaiAttrArena::MAX_BLOCK_SIZE);
+
+    arena.deallocate(nullptr, 16);
+    arena.deallocate(a, SaiAttrArena::MAX_BLOCK_SIZE);
+    arena.deallocate(b, 16);
+
+    EXPECT_EQ(arena.getUsedBytes(), 0);
+}
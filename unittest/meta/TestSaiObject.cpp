@@ -41,3 +41,125 @@ TEST(SaiObject, setAttr)
 
     so.setAttr(a);
 }
+
+TEST(SaiObject, getAttr)
+{
+    sai_object_meta_key_t mk = { .objecttype = SAI_OBJECT_TYPE_PORT, .objectkey = { .key = { .object_id = 1 } } };
+
+    SaiObject so(mk);
+
+    EXPECT_EQ(so.getAttr(SAI_PORT_ATTR_MTU), nullptr);
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_PORT_ATTR_MTU;
+    attr.value.u32 = 9100;
+
+    so.setAttr(sai_metadata_get_attr_metadata(SAI_OBJECT_TYPE_PORT, attr.id), &attr);
+
+    sai_object_id_t list[2] = { 0x10, 0x20 };
+
+    attr.id = SAI_PORT_ATTR_INGRESS_MIRROR_SESSION;
+    attr.value.objlist.count = 2;
+    attr.value.objlist.list = list;
+
+    so.setAttr(sai_metadata_get_attr_metadata(SAI_OBJECT_TYPE_PORT, attr.id), &attr);
+
+    // list is deep copied
+
+    list[0] = 0x30;
+
+    attr.id = SAI_PORT_ATTR_ADMIN_STATE;
+    attr.value.booldata = true;
+
+    so.setAttr(sai_metadata_get_attr_metadata(SAI_OBJECT_TYPE_PORT, attr.id), &attr);
+
+    EXPECT_TRUE(so.hasAttr(SAI_PORT_ATTR_MTU));
+    EXPECT_TRUE(so.hasAttr(SAI_PORT_ATTR_ADMIN_STATE));
+    EXPECT_FALSE(so.hasAttr(SAI_PORT_ATTR_SPEED));
+
+    EXPECT_EQ(so.getAttr(SAI_PORT_ATTR_MTU)->getSaiAttr()->value.u32, 9100);
+
+    auto mirror = so.getAttr(SAI_PORT_ATTR_INGRESS_MIRROR_SESSION);
+
+    ASSERT_NE(mirror, nullptr);
+    EXPECT_EQ(mirror->getAttrId(), SAI_PORT_ATTR_INGRESS_MIRROR_SESSION);
+    EXPECT_EQ(mirror->getSaiAttr()->value.objlist.count, 2);
+    EXPECT_EQ(mirror->getSaiAttr()->value.objlist.list[0], 0x10);
+    EXPECT_EQ(mirror->getSaiAttr()->value.objlist.list[1], 0x20);
+
+    // override list, previously returned wrapper stays valid
+
+    attr.id = SAI_PORT_ATTR_INGRESS_MIRROR_SESSION;
+    attr.value.objlist.count = 1;
+    attr.value.objlist.list = list;
+
+    so.setAttr(sai_metadata_get_attr_metadata(SAI_OBJECT_TYPE_PORT, attr.id), &attr);
+
+    EXPECT_EQ(mirror->getSaiAttr()->value.objlist.list[0], 0x10);
+    EXPECT_EQ(so.getAttr(SAI_PORT_ATTR_INGRESS_MIRROR_SESSION)->getSaiAttr()->value.objlist.count, 1);
+    EXPECT_EQ(so.getAttr(SAI_PORT_ATTR_INGRESS_MIRROR_SESSION)->getSaiAttr()->value.objlist.list[0], 0x30);
+
+    auto attrs = so.getAttributes();
+
+    ASSERT_EQ(attrs.size(), 3);
+
+    // attributes are sorted by id
+
+    EXPECT_LT(attrs[0]->getAttrId(), attrs[1]->getAttrId());
+    EXPECT_LT(attrs[1]->getAttrId(), attrs[2]->getAttrId());
+}
+
+TEST(SaiObject, getSaiAttr)
+{
+    sai_object_meta_key_t mk = { .objecttype = SAI_OBJECT_TYPE_PORT, .objectkey = { .key = { .object_id = 1 } } };
+
+    SaiObject so(mk);
+
+    EXPECT_EQ(so.getSaiAttr(SAI_PORT_ATTR_MTU), nullptr);
+    EXPECT_EQ(so.getAttrCount(), 0);
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_PORT_ATTR_MTU;
+    attr.value.u32 = 9100;
+
+    so.setAttr(sai_metadata_get_attr_metadata(SAI_OBJECT_TYPE_PORT, attr.id), &attr);
+
+    uint32_t lanes[2] = { 1, 2 };
+
+    attr.id = SAI_PORT_ATTR_HW_LANE_LIST;
+    attr.value.u32list.count = 2;
+    attr.value.u32list.list = lanes;
+
+    so.setAttr(sai_metadata_get_attr_metadata(SAI_OBJECT_TYPE_PORT, attr.id), &attr);
+
+    lanes[0] = 3;
+
+    auto view = so.getSaiAttr(SAI_PORT_ATTR_HW_LANE_LIST);
+
+    ASSERT_NE(view, nullptr);
+    EXPECT_EQ(view->id, SAI_PORT_ATTR_HW_LANE_LIST);
+    EXPECT_EQ(view->value.u32list.count, 2);
+    EXPECT_EQ(view->value.u32list.list[0], 1);
+
+    // view points to object memory, no copy is made
+
+    EXPECT_EQ(view, so.getSaiAttr(SAI_PORT_ATTR_HW_LANE_LIST));
+
+    // set value from own view
+
+    so.setAttr(sai_metadata_get_attr_metadata(SAI_OBJECT_TYPE_PORT, view->id), view);
+
+    view = so.getSaiAttr(SAI_PORT_ATTR_HW_LANE_LIST);
+
+    EXPECT_EQ(view->value.u32list.list[1], 2);
+
+    ASSERT_EQ(so.getAttrCount(), 2);
+
+    EXPECT_EQ(so.getSaiAttrAt(0)->id, SAI_PORT_ATTR_HW_LANE_LIST);
+    EXPECT_EQ(so.getSaiAttrMetadataAt(0)->attrid, SAI_PORT_ATTR_HW_LANE_LIST);
+    EXPECT_EQ(so.getSaiAttrAt(1)->value.u32, 9100);
+
+    EXPECT_THROW(so.getSaiAttrAt(2), std::out_of_range);
+}
@@ -1,7 +1,16 @@
 #include "SaiObjectCollection.h"
 
+#include "sai_serialize.h"
+
+#include "swss/logger.h"
+
 #include <gtest/gtest.h>
 
+#include <arpa/inet.h>
+#include <malloc.h>
+#include <string.h>
+
+#include <unordered_map>
 #include <memory>
 
 using namespace saimeta;
@@ -56,3 +65,236 @@ TEST(SaiObjectCollection, getObject)
 
     EXPECT_THROW(oc.getObject(mk), std::runtime_error);
 }
+
+static size_t getAllocatedBytes()
+{
+    SWSS_LOG_ENTER();
+
+#if __GLIBC_PREREQ(2, 33)
+    return mallinfo2().uordblks;
+#else
+    return (size_t)(unsigned int)mallinfo().uordblks;
+#endif
+}
+
+/**
+ * @brief Attribute wrapper as it was before compact object store, every
+ * value is copied by serialize/deserialize.
+ */
+class BaselineAttrWrapper
+{
+    public:
+
+        BaselineAttrWrapper(
+                _In_ const sai_attr_metadata_t* meta,
+                _In_ const sai_attribute_t& attr):
+            m_meta(meta),
+            m_attr(attr)
+        {
+            SWSS_LOG_ENTER();
+
+            std::string str = sai_serialize_attr_value(*meta, attr, false);
+
+            sai_deserialize_attr_value(str, *meta, m_attr, false);
+        }
+
+        virtual ~BaselineAttrWrapper()
+        {
+            SWSS_LOG_ENTER();
+
+            sai_deserialize_free_attribute_value(m_meta->attrvaluetype, m_attr);
+        }
+
+    private:
+
+        const sai_attr_metadata_t* m_meta;
+
+        sai_attribute_t m_attr;
+};
+
+/**
+ * @brief Object as it was before compact object store, hash map of shared
+ * attribute wrappers.
+ */
+class BaselineObject
+{
+    public:
+
+        BaselineObject(
+                _In_ const sai_object_meta_key_t& metaKey):
+            m_metaKey(metaKey)
+        {
+            SWSS_LOG_ENTER();
+        }
+
+        virtual ~BaselineObject() = default;
+
+    public:
+
+        void setAttr(
+                _In_ const sai_attr_metadata_t* md,
+                _In_ const sai_attribute_t *attr)
+        {
+            SWSS_LOG_ENTER();
+
+            m_attrs[attr->id] = std::make_shared<BaselineAttrWrapper>(md, *attr);
+        }
+
+    private:
+
+        sai_object_meta_key_t m_metaKey;
+
+        std::unordered_map<sai_attr_id_t, std::shared_ptr<BaselineAttrWrapper>> m_attrs;
+};
+
+static void fillRouteEntry(
+        _Out_ sai_object_meta_key_t& mk,
+        _In_ uint32_t index)
+{
+    SWSS_LOG_ENTER();
+
+    memset(&mk, 0, sizeof(mk));
+
+    mk.objecttype = SAI_OBJECT_TYPE_ROUTE_ENTRY;
+    mk.objectkey.key.route_entry.switch_id = 0x21000000000000;
+    mk.objectkey.key.route_entry.vr_id = 0x3000000000001;
+    mk.objectkey.key.route_entry.destination.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
+    mk.objectkey.key.route_entry.destination.addr.ip4 = htonl(0x0a000000 + index);
+    mk.objectkey.key.route_entry.destination.mask.ip4 = 0xffffffff;
+}
+
+TEST(SaiObjectCollection, routeMemory)
+{
+    uint32_t count = 100000;
+
+    if (getenv("TEST_NO_PERF"))
+    {
+        count = 1000;
+
+        std::cout << "disabling performance tests" << std::endl;
+    }
+
+    sai_attribute_t attrs[2];
+
+    attrs[0].id = SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION;
+    attrs[0].value.s32 = SAI_PACKET_ACTION_FORWARD;
+
+    attrs[1].id = SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID;
+    attrs[1].value.oid = 0x40000000000001;
+
+    const sai_attr_metadata_t* mds[2] = {
+        sai_metadata_get_attr_metadata(SAI_OBJECT_TYPE_ROUTE_ENTRY, attrs[0].id),
+        sai_metadata_get_attr_metadata(SAI_OBJECT_TYPE_ROUTE_ENTRY, attrs[1].id),
+    };
+
+    size_t before = getAllocatedBytes();
+
+    {
+        std::unordered_map<sai_object_meta_key_t, std::shared_ptr<BaselineObject>, MetaKeyHasher, MetaKeyHasher> baseline;
+
+        for (uint32_t i = 0; i < count; i++)
+        {
+            sai_object_meta_key_t mk;
+
+            fillRouteEntry(mk, i);
+
+            auto obj = std::make_shared<BaselineObject>(mk);
+
+            for (int a = 0; a < 2; a++)
+            {
+                obj->setAttr(mds[a], &attrs[a]);
+            }
+
+            baseline[mk] = obj;
+        }
+
+        size_t baselineBytes = getAllocatedBytes() - before;
+
+        before = getAllocatedBytes();
+
+        SaiObjectCollection oc;
+
+        for (uint32_t i = 0; i < count; i++)
+        {
+            sai_object_meta_key_t mk;
+
+            fillRouteEntry(mk, i);
+
+            oc.createObject(mk);
+
+            for (int a = 0; a < 2; a++)
+            {
+                oc.setObjectAttr(mk, *mds[a], &attrs[a]);
+            }
+        }
+
+        size_t compactBytes = getAllocatedBytes() - before;
+
+        std::cout << "bytes per route, baseline: " << baselineBytes / count
+            << ", compact: " << compactBytes / count << std::endl;
+
+        EXPECT_LT(compactBytes, baselineBytes);
+
+        sai_object_meta_key_t mk;
+
+        fillRouteEntry(mk, count - 1);
+
+        EXPECT_TRUE(oc.hasObjectAttr(mk, SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID));
+        EXPECT_EQ(oc.getObjectSaiAttr(mk, SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID)->value.oid, attrs[1].value.oid);
+        EXPECT_EQ(oc.getObjectAttr(mk, SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID)->getSaiAttr()->value.oid, attrs[1].value.oid);
+        EXPECT_EQ(oc.getObjectAttributes(mk).size(), 2);
+    }
+}
+
+TEST(SaiObjectCollection, listAttrArena)
+{
+    SaiObjectCollection oc;
+
+    sai_object_id_t list[3] = { 0x10, 0x20, 0x30 };
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_PORT_ATTR_INGRESS_MIRROR_SESSION;
+    attr.value.objlist.count = 3;
+    attr.value.objlist.list = list;
+
+    auto md = sai_metadata_get_attr_metadata(SAI_OBJECT_TYPE_PORT, attr.id);
+
+    for (sai_object_id_t oid = 1; oid <= 2; oid++)
+    {
+        sai_object_meta_key_t mk = { .objecttype = SAI_OBJECT_TYPE_PORT, .objectkey = { .key = { .object_id = oid } } };
+
+        oc.createObject(mk);
+
+        oc.setObjectAttr(mk, *md, &attr);
+    }
+
+    sai_object_meta_key_t mk1 = { .objecttype = SAI_OBJECT_TYPE_PORT, .objectkey = { .key = { .object_id = 1 } } };
+    sai_object_meta_key_t mk2 = { .objecttype = SAI_OBJECT_TYPE_PORT, .objectkey = { .key = { .object_id = 2 } } };
+
+    auto a1 = oc.getObjectSaiAttr(mk1, attr.id);
+    auto a2 = oc.getObjectSaiAttr(mk2, attr.id);
+
+    ASSERT_NE(a1, nullptr);
+    ASSERT_NE(a2, nullptr);
+
+    // lists are copied into the same per object type arena
+
+    EXPECT_NE(a1->value.objlist.list, list);
+    EXPECT_NE(a1->value.objlist.list, a2->value.objlist.list);
+    EXPECT_EQ(a1->value.objlist.list + 4, a2->value.objlist.list);
+    EXPECT_EQ(a2->value.objlist.list[2], 0x30);
+
+    // released list memory is reused
+
+    auto released = a1->value.objlist.list;
+
+    oc.removeObject(mk1);
+
+    oc.createObject(mk1);
+    oc.setObjectAttr(mk1, *md, &attr);
+
+    EXPECT_EQ(oc.getObjectSaiAttr(mk1, attr.id)->value.objlist.list, released);
+
+    EXPECT_FALSE(oc.hasObjectAttr(mk1, SAI_PORT_ATTR_MTU));
+}
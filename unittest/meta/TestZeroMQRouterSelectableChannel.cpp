@@ -0,0 +1,131 @@
+#include "ZeroMQRouterSelectableChannel.h"
+#include "ZeroMQChannel.h"
+
+#include "sairediscommon.h"
+
+#include "swss/select.h"
+
+#include <gtest/gtest.h>
+
+#include <map>
+
+using namespace sairedis;
+
+TEST(ZeroMQRouterSelectableChannel, ctr)
+{
+    EXPECT_THROW(std::make_shared<ZeroMQRouterSelectableChannel>("/dev_not/foo"), std::runtime_error);
+}
+
+TEST(ZeroMQRouterSelectableChannel, empty)
+{
+    ZeroMQRouterSelectableChannel c("ipc:///tmp/zmq_router_test");
+
+    EXPECT_EQ(c.empty(), true);
+    EXPECT_EQ(c.hasData(), false);
+    EXPECT_EQ(c.hasCachedData(), false);
+}
+
+TEST(ZeroMQRouterSelectableChannel, pop)
+{
+    ZeroMQRouterSelectableChannel c("ipc:///tmp/zmq_router_test");
+
+    swss::KeyOpFieldsValuesTuple kco;
+
+    std::string identity;
+
+    EXPECT_THROW(c.pop(kco, false), std::runtime_error);
+    EXPECT_THROW(c.pop(kco, identity), std::runtime_error);
+}
+
+static void cb(
+        _In_ const std::string&,
+        _In_ const std::string&,
+        _In_ const std::vector<swss::FieldValueTuple>&)
+{
+    SWSS_LOG_ENTER();
+
+    // notification callback
+}
+
+TEST(ZeroMQRouterSelectableChannel, multipleClients)
+{
+    ZeroMQRouterSelectableChannel c("ipc:///tmp/zmq_router_test");
+
+    // REQ client and pipelined DEALER client
+
+    ZeroMQChannel a("ipc:///tmp/zmq_router_test", "ipc:///tmp/zmq_router_test_ntf_a", cb);
+    ZeroMQChannel b("ipc:///tmp/zmq_router_test", "ipc:///tmp/zmq_router_test_ntf_b", cb, 2);
+
+    EXPECT_EQ(a.getPipelineDepth(), 0);
+    EXPECT_EQ(b.getPipelineDepth(), 2);
+
+    EXPECT_THROW(a.deferResponse(REDIS_ASIC_STATE_COMMAND_GETRESPONSE), std::runtime_error);
+
+    std::vector<swss::FieldValueTuple> values;
+
+    a.set("a", values, "command");
+
+    b.set("b1", values, "command");
+    b.deferResponse(REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
+    b.set("b2", values, "command");
+
+    swss::Select ss;
+
+    ss.addSelectable(&c);
+
+    std::map<std::string, std::vector<std::string>> keys;
+
+    int count = 0;
+
+    while (count < 3)
+    {
+        swss::Selectable *sel = NULL;
+
+        ASSERT_EQ(ss.select(&sel, 2000), swss::Select::OBJECT);
+
+        while (!c.empty())
+        {
+            swss::KeyOpFieldsValuesTuple kco;
+
+            std::string identity;
+
+            c.pop(kco, identity);
+
+            EXPECT_EQ(kfvOp(kco), "command");
+
+            keys[identity].push_back(kfvKey(kco));
+
+            count++;
+        }
+    }
+
+    ASSERT_EQ(keys.size(), 2);
+
+    for (auto& kv: keys)
+    {
+        // respond in reverse client order, each client gets only its own
+
+        if (kv.second.size() == 2)
+        {
+            EXPECT_EQ(kv.second.at(0), "b1");
+            EXPECT_EQ(kv.second.at(1), "b2");
+
+            c.send(kv.first, "SAI_STATUS_FAILURE", values, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
+            c.send(kv.first, "SAI_STATUS_SUCCESS", values, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
+        }
+        else
+        {
+            EXPECT_EQ(kv.second.at(0), "a");
+
+            c.send(kv.first, "SAI_STATUS_NOT_SUPPORTED", values, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
+        }
+    }
+
+    swss::KeyOpFieldsValuesTuple kco;
+
+    EXPECT_EQ(a.wait(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, kco), SAI_STATUS_NOT_SUPPORTED);
+
+    // deferred failure is collected first and only logged
+
+    EXPECT_EQ(b.wait(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, kco), SAI_STATUS_SUCCESS);
+}
@@ -1,6 +1,11 @@
 #include <gtest/gtest.h>
 #include "meta/sai_serialize.h"
 #include "SaiDump.h"
+#include <set>
+#include <sstream>
+#include <fstream>
+#include <cstdio>
+#include <nlohmann/json.hpp>
 using namespace swss;
 
 #define ARRAYLEN(arr) (int)(sizeof(arr) / sizeof((arr)[0]))
@@ -91,3 +96,190 @@ TEST(SaiDump, dumpGraphFun)
     TableMap map;
     m_saiDump.printAttributes(indent, map);
 }
+
+static std::multiset<std::string> splitRdbJsonDump(const std::string& output)
+{
+    SWSS_LOG_ENTER();
+
+    // each item starts with not indented line, order of items may differ
+    std::multiset<std::string> items;
+    std::istringstream ss(output);
+    std::string line;
+    std::string item;
+
+    while (std::getline(ss, line))
+    {
+        if (!line.empty() && line[0] != ' ' && !item.empty())
+        {
+            items.insert(item);
+            item.clear();
+        }
+
+        item += line + "\n";
+    }
+
+    if (!item.empty())
+    {
+        items.insert(item);
+    }
+
+    return items;
+}
+
+static void traverseRdbJsonTree(const nlohmann::json& jsn, std::ostream& out)
+{
+    SWSS_LOG_ENTER();
+
+    if (jsn.is_array())
+    {
+        for (const auto& element: jsn)
+        {
+            if (element.is_object() || element.is_array())
+            {
+                traverseRdbJsonTree(element, out);
+            }
+        }
+
+        return;
+    }
+
+    if (!jsn.is_object())
+    {
+        return;
+    }
+
+    for (auto it = jsn.begin(); it != jsn.end(); ++it)
+    {
+        const std::string& key = it.key();
+
+        size_t pos = key.find_first_of(":");
+
+        if (pos == std::string::npos || key.substr(0, pos) != "ASIC_STATE")
+        {
+            continue;
+        }
+
+        std::string name = key.substr(pos + 1);
+
+        if (name.find(":") != std::string::npos)
+        {
+            name.replace(name.find_first_of(":"), 1, " ");
+        }
+
+        out << name << " " << std::endl;
+
+        if (!it->is_object())
+        {
+            continue;
+        }
+
+        TableMap map;
+
+        size_t maxLen = 0;
+
+        for (auto field = it->begin(); field != it->end(); ++field)
+        {
+            if (field.key() != "NULL")
+            {
+                map[field.key()] = field.value().get<std::string>();
+                maxLen = std::max(maxLen, field.key().length());
+            }
+        }
+
+        for (const auto& field: map)
+        {
+            out << "    " << field.first << std::string(maxLen - field.first.length(), ' ') << " : ";
+            out << field.second << std::endl;
+        }
+
+        out << std::endl;
+    }
+}
+
+/*
+ * Reference implementation which loads whole json tree into memory, used to
+ * verify output of streaming parser.
+ */
+static sai_status_t dumpRdbJsonTree(const std::string& file, std::string& output)
+{
+    SWSS_LOG_ENTER();
+
+    std::ifstream input(file);
+
+    if (!input.is_open())
+    {
+        return SAI_STATUS_FAILURE;
+    }
+
+    try
+    {
+        nlohmann::json jsn;
+        input >> jsn;
+
+        std::stringstream ss;
+        traverseRdbJsonTree(jsn, ss);
+        output = ss.str();
+
+        return SAI_STATUS_SUCCESS;
+    }
+    catch (const std::exception&)
+    {
+        return SAI_STATUS_FAILURE;
+    }
+}
+
+TEST(SaiDump, dumpFromRedisRdbJsonStreaming)
+{
+    SWSS_LOG_ENTER();
+    syncd::SaiDump m_saiDump;
+    const char *cmd[] = {"saidump", "-r", "./dump.json"};
+    optind = 0;
+    m_saiDump.handleCmdLine(ARRAYLEN(cmd), const_cast<char **>(cmd));
+
+    std::string tree;
+    EXPECT_EQ(SAI_STATUS_SUCCESS, dumpRdbJsonTree("./dump.json", tree));
+
+    testing::internal::CaptureStdout();
+    EXPECT_EQ(SAI_STATUS_SUCCESS, m_saiDump.dumpFromRedisRdbJson());
+    std::string streaming = testing::internal::GetCapturedStdout();
+
+    EXPECT_NE(tree.find("SAI_OBJECT_TYPE_"), std::string::npos);
+    EXPECT_EQ(tree.size(), streaming.size());
+    EXPECT_EQ(splitRdbJsonDump(tree), splitRdbJsonDump(streaming));
+}
+
+TEST(SaiDump, dumpFromRedisRdbJsonStreamingErrors)
+{
+    SWSS_LOG_ENTER();
+    syncd::SaiDump m_saiDump;
+    const char *cmd[] = {"saidump", "-r", "./err.json"};
+    optind = 0;
+    m_saiDump.handleCmdLine(ARRAYLEN(cmd), const_cast<char **>(cmd));
+    std::string tree;
+    EXPECT_EQ(SAI_STATUS_FAILURE, dumpRdbJsonTree("./err.json", tree));
+    EXPECT_EQ(SAI_STATUS_FAILURE, m_saiDump.dumpFromRedisRdbJson());
+
+    // non string attribute value
+    std::ofstream("./num.json") << "[{\"ASIC_STATE:SAI_OBJECT_TYPE_PORT:oid:0x1\":{\"SAI_PORT_ATTR_MTU\":9100}}]";
+    const char *cmd2[] = {"saidump", "-r", "./num.json"};
+    optind = 0;
+    m_saiDump.handleCmdLine(ARRAYLEN(cmd2), const_cast<char **>(cmd2));
+    EXPECT_EQ(SAI_STATUS_FAILURE, dumpRdbJsonTree("./num.json", tree));
+    EXPECT_EQ(SAI_STATUS_FAILURE, m_saiDump.dumpFromRedisRdbJson());
+
+    // nested arrays and skipped values
+    std::ofstream("./nested.json") << "[[{\"ASIC_STATE:SAI_OBJECT_TYPE_PORT:oid:0x1\":{\"NULL\":1,\"SAI_PORT_ATTR_MTU\":\"9100\"},"
+        "\"ASIC_STATE:SAI_OBJECT_TYPE_PORT:oid:0x2\":[{\"a\":\"b\"}],\"FOO:bar\":{\"x\":[1]}}]]";
+    const char *cmd3[] = {"saidump", "-r", "./nested.json"};
+    optind = 0;
+    m_saiDump.handleCmdLine(ARRAYLEN(cmd3), const_cast<char **>(cmd3));
+    EXPECT_EQ(SAI_STATUS_SUCCESS, dumpRdbJsonTree("./nested.json", tree));
+    testing::internal::CaptureStdout();
+    EXPECT_EQ(SAI_STATUS_SUCCESS, m_saiDump.dumpFromRedisRdbJson());
+    std::string streaming = testing::internal::GetCapturedStdout();
+    EXPECT_EQ(tree, streaming);
+    EXPECT_EQ(tree, "SAI_OBJECT_TYPE_PORT oid:0x1 \n    SAI_PORT_ATTR_MTU : 9100\n\nSAI_OBJECT_TYPE_PORT oid:0x2 \n");
+
+    std::remove("./num.json");
+    std::remove("./nested.json");
+}
@@ -0,0 +1,239 @@
+#include "SaiPlayer.h"
+
+#include "MockableSaiInterface.h"
+
+#include "meta/sai_serialize.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+using namespace saiplayer;
+
+#define SWITCH_ID 0x21000000000000
+
+class SaiPlayerTest : public ::testing::Test
+{
+    public:
+
+        void SetUp() override
+        {
+            SWSS_LOG_ENTER();
+
+            m_sai = std::make_shared<MockableSaiInterface>();
+
+            m_sai->mock_switchIdQuery = [](sai_object_id_t) { return SWITCH_ID; };
+
+            m_sai->mock_bulkCreate = [this](
+                    sai_object_type_t,
+                    sai_object_id_t,
+                    uint32_t object_count,
+                    const uint32_t*,
+                    const sai_attribute_t**,
+                    sai_bulk_op_error_mode_t,
+                    sai_object_id_t* object_id,
+                    sai_status_t* object_statuses) -> sai_status_t
+            {
+                m_bulkCounts.push_back(object_count);
+
+                for (uint32_t idx = 0; idx < object_count; idx++)
+                {
+                    object_id[idx] = 0x26000000000100 + m_created++;
+                    object_statuses[idx] = SAI_STATUS_SUCCESS;
+                }
+
+                return SAI_STATUS_SUCCESS;
+            };
+
+            m_sai->mock_bulkSet = [this](
+                    sai_object_type_t,
+                    uint32_t object_count,
+                    const sai_object_id_t* object_id,
+                    const sai_attribute_t* attr_list,
+                    sai_bulk_op_error_mode_t,
+                    sai_status_t* object_statuses) -> sai_status_t
+            {
+                m_bulkCounts.push_back(object_count);
+
+                for (uint32_t idx = 0; idx < object_count; idx++)
+                {
+                    m_setValues.emplace_back(object_id[idx], attr_list[idx].value.booldata);
+
+                    object_statuses[idx] = m_setStatus;
+                }
+
+                return m_setStatus;
+            };
+
+            m_cmd = std::make_shared<CommandLineOptions>();
+
+            m_cmd->m_autoBulkSize = 4;
+
+            m_player = std::make_shared<SaiPlayer>(m_sai, m_cmd);
+
+            m_player->match_redis_with_rec(SWITCH_ID, SWITCH_ID);
+        }
+
+    protected:
+
+        std::string line(
+                _In_ const std::string& op,
+                _In_ const std::string& object,
+                _In_ const std::string& attrs)
+        {
+            SWSS_LOG_ENTER();
+
+            return "2024-01-01.00:00:00.000000|" + op + "|" + object + (attrs.size() ? "|" + attrs : "");
+        }
+
+    protected:
+
+        std::shared_ptr<MockableSaiInterface> m_sai;
+
+        std::shared_ptr<CommandLineOptions> m_cmd;
+
+        std::shared_ptr<SaiPlayer> m_player;
+
+        std::vector<uint32_t> m_bulkCounts;
+
+        std::vector<std::pair<sai_object_id_t, bool>> m_setValues;
+
+        sai_status_t m_setStatus = SAI_STATUS_SUCCESS;
+
+        uint32_t m_created = 0;
+};
+
+TEST_F(SaiPlayerTest, autoBulkSupported)
+{
+    EXPECT_TRUE(m_player->is_auto_bulk_supported(SAI_COMMON_API_CREATE, SAI_OBJECT_TYPE_VLAN));
+    EXPECT_TRUE(m_player->is_auto_bulk_supported(SAI_COMMON_API_SET, SAI_OBJECT_TYPE_ROUTE_ENTRY));
+    EXPECT_FALSE(m_player->is_auto_bulk_supported(SAI_COMMON_API_GET, SAI_OBJECT_TYPE_VLAN));
+    EXPECT_FALSE(m_player->is_auto_bulk_supported(SAI_COMMON_API_CREATE, SAI_OBJECT_TYPE_SWITCH));
+    EXPECT_FALSE(m_player->is_auto_bulk_supported(SAI_COMMON_API_SET, SAI_OBJECT_TYPE_PORT));
+
+    // not supported operation is executed as single, pending are flushed
+
+    EXPECT_TRUE(m_player->auto_bulk_add(SAI_COMMON_API_CREATE, line("c", "SAI_OBJECT_TYPE_VLAN:oid:0x26000000000001", "SAI_VLAN_ATTR_VLAN_ID=2")));
+
+    EXPECT_FALSE(m_player->auto_bulk_add(SAI_COMMON_API_SET, line("s", "SAI_OBJECT_TYPE_PORT:oid:0x1000000000002", "SAI_PORT_ATTR_ADMIN_STATE=true")));
+
+    EXPECT_EQ(m_bulkCounts, std::vector<uint32_t>({ 1 }));
+}
+
+TEST_F(SaiPlayerTest, autoBulkCreate)
+{
+    for (int idx = 1; idx <= 6; idx++)
+    {
+        auto vid = sai_serialize_object_id(0x26000000000000 + idx);
+
+        EXPECT_TRUE(m_player->auto_bulk_add(SAI_COMMON_API_CREATE, line("c", "SAI_OBJECT_TYPE_VLAN:" + vid, "SAI_VLAN_ATTR_VLAN_ID=" + std::to_string(idx + 1))));
+    }
+
+    // bulk size is reached on fifth object
+
+    EXPECT_EQ(m_bulkCounts, std::vector<uint32_t>({ 4 }));
+    EXPECT_EQ(m_player->m_autoBulkObjectIds.size(), 2);
+
+    m_player->auto_bulk_flush();
+
+    EXPECT_EQ(m_bulkCounts, std::vector<uint32_t>({ 4, 2 }));
+    EXPECT_TRUE(m_player->m_autoBulkObjectIds.empty());
+    EXPECT_TRUE(m_player->m_autoBulkCreated.empty());
+
+    // each created object is mapped to returned object
+
+    EXPECT_EQ(m_player->translate_local_to_redis(0x26000000000001), 0x26000000000100);
+    EXPECT_EQ(m_player->translate_local_to_redis(0x26000000000006), 0x26000000000105);
+
+    // empty flush don't call bulk
+
+    m_player->auto_bulk_flush();
+
+    EXPECT_EQ(m_bulkCounts.size(), 2);
+}
+
+TEST_F(SaiPlayerTest, autoBulkReferences)
+{
+    EXPECT_TRUE(m_player->auto_bulk_add(SAI_COMMON_API_CREATE, line("c", "SAI_OBJECT_TYPE_VLAN:oid:0x26000000000001", "SAI_VLAN_ATTR_VLAN_ID=2")));
+
+    EXPECT_EQ(m_player->m_autoBulkCreated, std::set<sai_object_id_t>({ 0x26000000000001 }));
+
+    sai_attribute_t attrs[2];
+
+    attrs[0].id = SAI_VLAN_MEMBER_ATTR_VLAN_ID;
+    attrs[0].value.oid = 0x26000000000001;
+
+    attrs[1].id = SAI_VLAN_MEMBER_ATTR_BRIDGE_PORT_ID;
+    attrs[1].value.oid = 0x3a000000000001;
+
+    EXPECT_TRUE(m_player->references_objects(SAI_OBJECT_TYPE_VLAN_MEMBER, 2, attrs, m_player->m_autoBulkCreated));
+    EXPECT_FALSE(m_player->references_objects(SAI_OBJECT_TYPE_VLAN_MEMBER, 1, &attrs[1], m_player->m_autoBulkCreated));
+    EXPECT_FALSE(m_player->references_objects(SAI_OBJECT_TYPE_VLAN_MEMBER, 2, attrs, {}));
+
+    // object referencing pending object is added after pending objects are
+    // created, so reference can be translated
+
+    m_player->match_redis_with_rec(0x3a000000000100, 0x3a000000000001);
+
+    EXPECT_TRUE(m_player->auto_bulk_add(SAI_COMMON_API_CREATE, line("c", "SAI_OBJECT_TYPE_VLAN_MEMBER:oid:0x27000000000001",
+                    "SAI_VLAN_MEMBER_ATTR_VLAN_ID=oid:0x26000000000001|SAI_VLAN_MEMBER_ATTR_BRIDGE_PORT_ID=oid:0x3a000000000001")));
+
+    EXPECT_EQ(m_bulkCounts, std::vector<uint32_t>({ 1 }));
+
+    auto attr = m_player->m_autoBulkAttributes.at(0)->get_attr_list();
+
+    EXPECT_EQ(attr[0].value.oid, 0x26000000000100);
+    EXPECT_EQ(attr[1].value.oid, 0x3a000000000100);
+
+    EXPECT_EQ(m_player->m_autoBulkCreated, std::set<sai_object_id_t>({ 0x27000000000001 }));
+}
+
+TEST_F(SaiPlayerTest, autoBulkSetSameObject)
+{
+    m_player->match_redis_with_rec(0x26000000000101, 0x26000000000001);
+    m_player->match_redis_with_rec(0x26000000000102, 0x26000000000002);
+
+    EXPECT_TRUE(m_player->auto_bulk_add(SAI_COMMON_API_SET, line("s", "SAI_OBJECT_TYPE_VLAN:oid:0x26000000000001", "SAI_VLAN_ATTR_LEARN_DISABLE=true")));
+    EXPECT_TRUE(m_player->auto_bulk_add(SAI_COMMON_API_SET, line("s", "SAI_OBJECT_TYPE_VLAN:oid:0x26000000000002", "SAI_VLAN_ATTR_LEARN_DISABLE=true")));
+
+    EXPECT_TRUE(m_bulkCounts.empty());
+
+    // bulk don't define order of operations on the same object, so second set
+    // of the same object must be executed after the first one
+
+    EXPECT_TRUE(m_player->auto_bulk_add(SAI_COMMON_API_SET, line("s", "SAI_OBJECT_TYPE_VLAN:oid:0x26000000000001", "SAI_VLAN_ATTR_LEARN_DISABLE=false")));
+
+    EXPECT_EQ(m_bulkCounts, std::vector<uint32_t>({ 2 }));
+
+    m_player->auto_bulk_flush();
+
+    EXPECT_EQ(m_bulkCounts, std::vector<uint32_t>({ 2, 1 }));
+
+    std::vector<std::pair<sai_object_id_t, bool>> expected = {
+        { 0x26000000000101, true },
+        { 0x26000000000102, true },
+        { 0x26000000000101, false } };
+
+    EXPECT_EQ(m_setValues, expected);
+}
+
+TEST_F(SaiPlayerTest, autoBulkStatus)
+{
+    m_player->match_redis_with_rec(0x26000000000101, 0x26000000000001);
+
+    EXPECT_THROW(m_player->auto_bulk_status("2024-01-01.00:00:00.000000|E|SAI_STATUS_FAILURE"), std::runtime_error);
+
+    EXPECT_TRUE(m_player->auto_bulk_add(SAI_COMMON_API_SET, line("s", "SAI_OBJECT_TYPE_VLAN:oid:0x26000000000001", "SAI_VLAN_ATTR_LEARN_DISABLE=true")));
+
+    m_player->auto_bulk_status("2024-01-01.00:00:00.000000|E|SAI_STATUS_FAILURE");
+
+    m_setStatus = SAI_STATUS_FAILURE;
+
+    // returned status matches recorded one
+
+    m_player->auto_bulk_flush();
+
+    EXPECT_TRUE(m_player->auto_bulk_add(SAI_COMMON_API_SET, line("s", "SAI_OBJECT_TYPE_VLAN:oid:0x26000000000001", "SAI_VLAN_ATTR_LEARN_DISABLE=true")));
+
+    EXPECT_THROW(m_player->auto_bulk_flush(), std::runtime_error);
+}
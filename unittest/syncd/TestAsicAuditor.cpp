@@ -0,0 +1,254 @@
+#include "AsicAuditor.h"
+#include "MockableSaiInterface.h"
+#include "lib/RedisVidIndexGenerator.h"
+#include "lib/sairediscommon.h"
+#include "vslib/Sai.h"
+#include "meta/sai_serialize.h"
+
+#include "swss/table.h"
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <set>
+
+using namespace syncd;
+
+static const std::string vlanKey1 = "ASIC_STATE:SAI_OBJECT_TYPE_VLAN:oid:0x26000000000001";
+static const std::string vlanKey2 = "ASIC_STATE:SAI_OBJECT_TYPE_VLAN:oid:0x26000000000002";
+
+class AsicAuditorTest : public ::testing::Test
+{
+    public:
+
+        void SetUp() override
+        {
+            SWSS_LOG_ENTER();
+
+            m_dbAsic = std::make_shared<swss::DBConnector>("ASIC_DB", 0);
+            m_dbState = std::make_shared<swss::DBConnector>("STATE_DB", 0);
+
+            swss::RedisReply r(m_dbAsic.get(), "FLUSHALL", REDIS_REPLY_STATUS);
+
+            r.checkStatusOK();
+
+            m_client = std::make_shared<RedisClient>(m_dbAsic);
+
+            auto switchConfigContainer = std::make_shared<sairedis::SwitchConfigContainer>();
+            auto redisVidIndexGenerator = std::make_shared<sairedis::RedisVidIndexGenerator>(m_dbAsic, REDIS_KEY_VIDCOUNTER);
+            auto virtualObjectIdManager = std::make_shared<sairedis::VirtualObjectIdManager>(0, switchConfigContainer, redisVidIndexGenerator);
+
+            m_translator = std::make_shared<VirtualOidTranslator>(m_client, virtualObjectIdManager, std::make_shared<saivs::Sai>());
+
+            m_translator->insertRidAndVid(0x1, 0x26000000000001);
+            m_translator->insertRidAndVid(0x2, 0x26000000000002);
+
+            m_dbAsic->hset(vlanKey1, "SAI_VLAN_ATTR_VLAN_ID", "10");
+            m_dbAsic->hset(vlanKey2, "SAI_VLAN_ATTR_VLAN_ID", "20");
+
+            m_vendorSai = std::make_shared<MockableSaiInterface>();
+        }
+
+    protected:
+
+        std::shared_ptr<swss::DBConnector> m_dbAsic;
+
+        std::shared_ptr<swss::DBConnector> m_dbState;
+
+        std::shared_ptr<RedisClient> m_client;
+
+        std::shared_ptr<VirtualOidTranslator> m_translator;
+
+        std::shared_ptr<MockableSaiInterface> m_vendorSai;
+
+        // VLAN ID programmed on ASIC per RID, second VLAN drifted
+        std::map<sai_object_id_t, uint16_t> m_asicVlans = { { 0x1, 10 }, { 0x2, 30 } };
+};
+
+TEST_F(AsicAuditorTest, zeroRate)
+{
+    EXPECT_THROW(std::make_shared<AsicAuditor>(m_client, m_translator, m_vendorSai, m_dbState, 0), std::runtime_error);
+}
+
+TEST_F(AsicAuditorTest, auditSliceBulk)
+{
+    int bulkCalls = 0;
+
+    m_vendorSai->mock_bulkGet = [&](sai_object_type_t objectType, uint32_t objectCount, const sai_object_id_t* objectIds, const uint32_t* attrCounts, sai_attribute_t** attrLists, sai_bulk_op_error_mode_t mode, sai_status_t* statuses) -> sai_status_t {
+        bulkCalls++;
+
+        EXPECT_EQ(objectType, SAI_OBJECT_TYPE_VLAN);
+        EXPECT_EQ(objectCount, 2u);
+        EXPECT_EQ(mode, SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR);
+
+        for (uint32_t idx = 0; idx < objectCount; idx++)
+        {
+            EXPECT_EQ(attrCounts[idx], 1u);
+
+            attrLists[idx][0].value.u16 = m_asicVlans.at(objectIds[idx]);
+
+            statuses[idx] = SAI_STATUS_SUCCESS;
+        }
+
+        return SAI_STATUS_SUCCESS;
+    };
+
+    auto auditor = std::make_shared<AsicAuditor>(m_client, m_translator, m_vendorSai, m_dbState, 100);
+
+    auditor->auditSlice();
+
+    EXPECT_EQ(bulkCalls, 1);
+
+    swss::Table drift(m_dbState.get(), "ASIC_AUDIT_DRIFT_TABLE");
+
+    std::vector<swss::FieldValueTuple> values;
+
+    EXPECT_FALSE(drift.get(vlanKey1, values));
+
+    EXPECT_TRUE(drift.get(vlanKey2, values));
+
+    std::string value;
+
+    EXPECT_TRUE(drift.hget(vlanKey2, "SAI_VLAN_ATTR_VLAN_ID:db", value));
+    EXPECT_EQ(value, "20");
+
+    EXPECT_TRUE(drift.hget(vlanKey2, "SAI_VLAN_ATTR_VLAN_ID:asic", value));
+    EXPECT_EQ(value, "30");
+
+    swss::Table summary(m_dbState.get(), "ASIC_AUDIT_TABLE");
+
+    EXPECT_TRUE(summary.hget("summary", "sweeps", value));
+    EXPECT_EQ(value, "1");
+
+    EXPECT_TRUE(summary.hget("summary", "drifted_objects", value));
+    EXPECT_EQ(value, "1");
+
+    // drift fixed on ASIC is cleared on next sweep
+
+    m_asicVlans[0x2] = 20;
+
+    auditor->auditSlice();
+
+    EXPECT_FALSE(drift.get(vlanKey2, values));
+}
+
+TEST_F(AsicAuditorTest, auditSliceBulkNotSupported)
+{
+    int bulkCalls = 0;
+    int getCalls = 0;
+
+    m_vendorSai->mock_bulkGet = [&](sai_object_type_t, uint32_t, const sai_object_id_t*, const uint32_t*, sai_attribute_t**, sai_bulk_op_error_mode_t, sai_status_t*) -> sai_status_t {
+        bulkCalls++;
+
+        return SAI_STATUS_NOT_SUPPORTED;
+    };
+
+    m_vendorSai->mock_get = [&](sai_object_type_t, sai_object_id_t objectId, uint32_t, sai_attribute_t* attrList) -> sai_status_t {
+        getCalls++;
+
+        attrList[0].value.u16 = m_asicVlans.at(objectId);
+
+        return SAI_STATUS_SUCCESS;
+    };
+
+    auto auditor = std::make_shared<AsicAuditor>(m_client, m_translator, m_vendorSai, m_dbState, 100);
+
+    auditor->auditSlice();
+
+    EXPECT_EQ(bulkCalls, 1);
+    EXPECT_EQ(getCalls, 2);
+
+    // bulk get is not attempted again on the same object type
+
+    auditor->auditSlice();
+
+    EXPECT_EQ(bulkCalls, 1);
+    EXPECT_EQ(getCalls, 4);
+
+    swss::Table drift(m_dbState.get(), "ASIC_AUDIT_DRIFT_TABLE");
+
+    std::string value;
+
+    EXPECT_TRUE(drift.hget(vlanKey2, "SAI_VLAN_ATTR_VLAN_ID:asic", value));
+    EXPECT_EQ(value, "30");
+}
+
+TEST_F(AsicAuditorTest, auditSliceIncremental)
+{
+    // slice size is 10 objects at rate of 100 objects per second
+
+    for (sai_object_id_t idx = 0x10; idx < 0x10 + 50; idx++)
+    {
+        m_translator->insertRidAndVid(idx, 0x26000000000000 + idx);
+
+        m_dbAsic->hset("ASIC_STATE:SAI_OBJECT_TYPE_VLAN:" + sai_serialize_object_id(0x26000000000000 + idx), "SAI_VLAN_ATTR_VLAN_ID", "10");
+
+        m_asicVlans[idx] = 10;
+    }
+
+    std::multiset<sai_object_id_t> audited;
+
+    m_vendorSai->mock_bulkGet = [&](sai_object_type_t, uint32_t objectCount, const sai_object_id_t* objectIds, const uint32_t*, sai_attribute_t** attrLists, sai_bulk_op_error_mode_t, sai_status_t* statuses) -> sai_status_t {
+
+        EXPECT_LE(objectCount, 10u);
+
+        for (uint32_t idx = 0; idx < objectCount; idx++)
+        {
+            audited.insert(objectIds[idx]);
+
+            attrLists[idx][0].value.u16 = m_asicVlans.at(objectIds[idx]);
+
+            statuses[idx] = SAI_STATUS_SUCCESS;
+        }
+
+        return SAI_STATUS_SUCCESS;
+    };
+
+    m_vendorSai->mock_get = [&](sai_object_type_t, sai_object_id_t objectId, uint32_t, sai_attribute_t* attrList) -> sai_status_t {
+
+        audited.insert(objectId);
+
+        attrList[0].value.u16 = m_asicVlans.at(objectId);
+
+        return SAI_STATUS_SUCCESS;
+    };
+
+    auto auditor = std::make_shared<AsicAuditor>(m_client, m_translator, m_vendorSai, m_dbState, 100);
+
+    int slices = 0;
+
+    while (auditor->m_sweeps == 0 && slices < 100)
+    {
+        auditor->auditSlice();
+
+        slices++;
+    }
+
+    // each object is audited exactly once in sweep, split into slices
+
+    EXPECT_EQ(auditor->m_sweeps, 1u);
+    EXPECT_GE(slices, 6);
+    EXPECT_EQ(audited.size(), 52u);
+    EXPECT_EQ(std::set<sai_object_id_t>(audited.begin(), audited.end()).size(), 52u);
+
+    swss::Table drift(m_dbState.get(), "ASIC_AUDIT_DRIFT_TABLE");
+
+    std::vector<swss::FieldValueTuple> values;
+
+    EXPECT_TRUE(drift.get(vlanKey2, values));
+
+    // drift of object removed from ASIC_DB is cleared when next sweep ends
+
+    m_dbAsic->del(vlanKey2);
+
+    while (auditor->m_sweeps == 1 && slices < 200)
+    {
+        auditor->auditSlice();
+
+        slices++;
+    }
+
+    EXPECT_EQ(auditor->m_sweeps, 2u);
+
+    EXPECT_FALSE(drift.get(vlanKey2, values));
+}
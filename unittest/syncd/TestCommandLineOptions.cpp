@@ -7,7 +7,7 @@
 using namespace syncd;
 
 const std::string expected_usage =
-R"(Usage: syncd [-d] [-p profile] [-t type] [-u] [-S] [-U] [-C] [-s] [-z mode] [-l] [-g idx] [-x contextConfig] [-b breakConfig] [-B supportingBulkCounters] [-h]
+R"(Usage: syncd [-d] [-p profile] [-t type] [-u] [-S] [-U] [-C] [-s] [-z mode] [-l] [-g idx] [-x contextConfig] [-b breakConfig] [-B supportingBulkCounters] [-H bulkSize] [-L lockPolicy] [-A auditRate] [-h]
     -d --diag
         Enable diagnostic shell
     -p --profile profile
@@ -40,6 +40,12 @@ R"(Usage: syncd [-d] [-p profile] [-t type] [-u] [-S] [-U] [-C] [-s] [-z mode] [
         Counter groups those support bulk polling
     -a --enableAttrVersionCheck
         Enable attribute SAI version check when performing SAI discovery
+    -H --hardReinitBulkSize bulkSize
+        Create objects in vendor bulk calls of given size during hard reinit, default: 0 (disabled)
+    -L --vendorLockPolicy lockPolicy
+        Vendor SAI lock per API class (config|stats|query):(global|separate|none), e.g. stats:separate,query:none
+    -A --asicAuditRate auditRate
+        Audit given number of ASIC_DB objects per second against ASIC in background, default: 0 (disabled)
     -h --help
         Print out this message
 )";
@@ -53,7 +59,8 @@ TEST(CommandLineOptions, getCommandLineString)
     EXPECT_EQ(str, " EnableDiagShell=NO EnableTempView=NO DisableExitSleep=NO EnableUnittests=NO"
             " EnableConsistencyCheck=NO EnableSyncMode=NO RedisCommunicationMode=redis_async"
             " EnableSaiBulkSuport=NO StartType=cold ProfileMapFile= GlobalContext=0 ContextConfig= BreakConfig="
-            " WatchdogWarnTimeSpan=30000000 SupportingBulkCounters= EnableAttrVersionCheck=NO");
+            " WatchdogWarnTimeSpan=30000000 SupportingBulkCounters= EnableAttrVersionCheck=NO"
+            " HardReinitBulkSize=0 VendorLockPolicy= AsicAuditRate=0");
 }
 
 TEST(CommandLineOptions, startTypeStringToStartType)
@@ -81,9 +88,18 @@ TEST(CommandLineOptionsParser, parseCommandLine)
     char arg3[] = "1000";
     char arg4[] = "-B";
     char arg5[] = "WATERMARK";
-    std::vector<char *> args = {arg1, arg2, arg3, arg4, arg5};
+    char arg6[] = "-H";
+    char arg7[] = "512";
+    char arg8[] = "-L";
+    char arg9[] = "stats:separate";
+    char arg10[] = "-A";
+    char arg11[] = "1000";
+    std::vector<char *> args = {arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11};
 
     auto opt = syncd::CommandLineOptionsParser::parseCommandLine((int)args.size(), args.data());
     EXPECT_EQ(opt->m_watchdogWarnTimeSpan, 1000);
     EXPECT_EQ(opt->m_supportingBulkCounterGroups, "WATERMARK");
+    EXPECT_EQ(opt->m_hardReinitBulkSize, 512);
+    EXPECT_EQ(opt->m_vendorLockPolicy, "stats:separate");
+    EXPECT_EQ(opt->m_asicAuditRate, 1000);
 }
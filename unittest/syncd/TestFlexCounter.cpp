@@ -5,6 +5,11 @@
 #include "VirtualObjectIdManager.h"
 #include "NumberOidIndexGenerator.h"
 #include <string>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <future>
+#include <set>
 #include <gtest/gtest.h>
 
 using namespace saimeta;
@@ -2019,3 +2024,396 @@ TEST(FlexCounter, noEniDashMeterCounter)
         counterVerifyFunc,
         false);
 }
+
+/**
+ * @brief Blocks poll thread inside vendor call on first object, until
+ * released by test.
+ */
+class PollBlocker
+{
+    public:
+
+        PollBlocker(
+                _In_ sai_object_id_t blockedRid):
+            m_mainThread(std::this_thread::get_id()),
+            m_blockedRid(blockedRid)
+        {
+            SWSS_LOG_ENTER();
+
+            sai->mock_getStatsExt = [this](sai_object_type_t, sai_object_id_t rid, uint32_t number_of_counters, const sai_stat_id_t *, sai_stats_mode_t, uint64_t *counters) {
+                onGetStats(rid);
+
+                for (uint32_t i = 0; i < number_of_counters; i++)
+                {
+                    counters[i] = (i + 1) * 100;
+                }
+                return SAI_STATUS_SUCCESS;
+            };
+            sai->mock_queryStatsCapability = [](sai_object_id_t, sai_object_type_t, sai_stat_capability_list_t *) {
+                return SAI_STATUS_FAILURE;
+            };
+            sai->mock_bulkGetStats = [](sai_object_id_t, sai_object_type_t, uint32_t, const sai_object_key_t *, uint32_t, const sai_stat_id_t *, sai_stats_mode_t, sai_status_t *, uint64_t *) {
+                return SAI_STATUS_FAILURE;
+            };
+        }
+
+        ~PollBlocker()
+        {
+            SWSS_LOG_ENTER();
+
+            sai->mock_getStatsExt = [](sai_object_type_t, sai_object_id_t, uint32_t, const sai_stat_id_t *, sai_stats_mode_t, uint64_t *) {
+                return SAI_STATUS_SUCCESS;
+            };
+        }
+
+        void waitBlocked()
+        {
+            SWSS_LOG_ENTER();
+
+            std::unique_lock<std::mutex> lock(m_mtx);
+
+            m_cv.wait(lock, [this]() { return m_blocked; });
+        }
+
+        void release()
+        {
+            SWSS_LOG_ENTER();
+
+            std::lock_guard<std::mutex> lock(m_mtx);
+
+            m_released = true;
+
+            m_cv.notify_all();
+        }
+
+        void removed(
+                _In_ sai_object_id_t rid)
+        {
+            SWSS_LOG_ENTER();
+
+            std::lock_guard<std::mutex> lock(m_mtx);
+
+            m_removed.insert(rid);
+        }
+
+        void waitPolled(
+                _In_ sai_object_id_t rid)
+        {
+            SWSS_LOG_ENTER();
+
+            std::unique_lock<std::mutex> lock(m_mtx);
+
+            m_cv.wait(lock, [&]() { return m_polled.count(rid) != 0; });
+        }
+
+        bool removedPolled()
+        {
+            SWSS_LOG_ENTER();
+
+            std::lock_guard<std::mutex> lock(m_mtx);
+
+            return m_removedPolled;
+        }
+
+    private:
+
+        void onGetStats(
+                _In_ sai_object_id_t rid)
+        {
+            SWSS_LOG_ENTER();
+
+            if (std::this_thread::get_id() == m_mainThread)
+            {
+                return;
+            }
+
+            std::unique_lock<std::mutex> lock(m_mtx);
+
+            m_removedPolled |= (m_removed.count(rid) != 0);
+
+            m_polled.insert(rid);
+
+            m_cv.notify_all();
+
+            if (rid == m_blockedRid && !m_released)
+            {
+                m_blocked = true;
+
+                m_cv.notify_all();
+
+                m_cv.wait(lock, [this]() { return m_released; });
+            }
+        }
+
+    private:
+
+        std::thread::id m_mainThread;
+
+        sai_object_id_t m_blockedRid;
+
+        std::mutex m_mtx;
+
+        std::condition_variable m_cv;
+
+        bool m_blocked = false;
+
+        bool m_released = false;
+
+        bool m_removedPolled = false;
+
+        std::set<sai_object_id_t> m_removed;
+
+        std::set<sai_object_id_t> m_polled;
+};
+
+TEST(FlexCounter, addRemoveCounterDuringPoll)
+{
+    test_syncd::mockVidManagerObjectTypeQuery(SAI_OBJECT_TYPE_COUNTER);
+
+    std::vector<sai_object_id_t> object_ids = generateOids(3, SAI_OBJECT_TYPE_COUNTER);
+
+    PollBlocker blocker(object_ids[0]);
+
+    {
+        FlexCounter fc("test", sai, "COUNTERS_DB");
+
+        std::vector<swss::FieldValueTuple> values;
+        values.emplace_back(FLOW_COUNTER_ID_LIST, "SAI_COUNTER_STAT_PACKETS,SAI_COUNTER_STAT_BYTES");
+
+        fc.addCounter(object_ids[0], object_ids[0], values);
+        fc.addCounter(object_ids[1], object_ids[1], values);
+
+        std::vector<swss::FieldValueTuple> group;
+        group.emplace_back(POLL_INTERVAL_FIELD, "100");
+        group.emplace_back(FLEX_COUNTER_STATUS_FIELD, "enable");
+        fc.addCounterPlugin(group);
+
+        // poll thread is now inside vendor call on first object, counter
+        // changes must not wait for it
+
+        blocker.waitBlocked();
+
+        fc.removeCounter(object_ids[1]);
+
+        blocker.removed(object_ids[1]);
+
+        std::vector<swss::FieldValueTuple> invalid;
+        invalid.emplace_back(FLOW_COUNTER_ID_LIST, "SAI_COUNTER_STAT_INVALID");
+
+        EXPECT_THROW(fc.addCounter(object_ids[2], object_ids[2], invalid), std::runtime_error);
+
+        fc.addCounter(object_ids[2], object_ids[2], values);
+
+        blocker.release();
+
+        // new object is added when poll cycle ends
+
+        blocker.waitPolled(object_ids[2]);
+
+        EXPECT_FALSE(blocker.removedPolled());
+
+        EXPECT_EQ(fc.isEmpty(), false);
+
+        fc.removeCounter(object_ids[0]);
+        fc.removeCounter(object_ids[2]);
+
+        EXPECT_EQ(fc.isEmpty(), true);
+    }
+
+    swss::DBConnector db("COUNTERS_DB", 0);
+    swss::Table countersTable(&db, COUNTERS_TABLE);
+
+    for (auto oid: object_ids)
+    {
+        countersTable.del(toOid(oid));
+    }
+}
+
+TEST(FlexCounter, discardDuringPoll)
+{
+    test_syncd::mockVidManagerObjectTypeQuery(SAI_OBJECT_TYPE_COUNTER);
+
+    std::vector<sai_object_id_t> object_ids = generateOids(1, SAI_OBJECT_TYPE_COUNTER);
+
+    PollBlocker blocker(object_ids[0]);
+
+    FlexCounter fc("test", sai, "COUNTERS_DB");
+
+    std::vector<swss::FieldValueTuple> values;
+    values.emplace_back(FLOW_COUNTER_ID_LIST, "SAI_COUNTER_STAT_PACKETS,SAI_COUNTER_STAT_BYTES");
+
+    fc.addCounter(object_ids[0], object_ids[0], values);
+
+    values.clear();
+    values.emplace_back(POLL_INTERVAL_FIELD, "100");
+    values.emplace_back(FLEX_COUNTER_STATUS_FIELD, "enable");
+    fc.addCounterPlugin(values);
+
+    blocker.waitBlocked();
+
+    fc.removeCounterPlugins();
+
+    // removal of object in vendor call returns when call ends, then
+    // instance is reported as discarded even if poll cycle was in progress
+
+    auto discarded = std::async(std::launch::async, [&]() {
+        fc.removeCounter(object_ids[0]);
+        return fc.isDiscarded();
+    });
+
+    blocker.release();
+
+    EXPECT_TRUE(discarded.get());
+
+    swss::DBConnector db("COUNTERS_DB", 0);
+    swss::Table countersTable(&db, COUNTERS_TABLE);
+
+    countersTable.del(toOid(object_ids[0]));
+}
+
+TEST(FlexCounter, bulkRemoveCounter)
+{
+    sai->mock_queryStatsCapability = [](sai_object_id_t, sai_object_type_t, sai_stat_capability_list_t *stats_capability) {
+        if (stats_capability->count == 0)
+        {
+            stats_capability->count = 2;
+            return SAI_STATUS_BUFFER_OVERFLOW;
+        }
+        stats_capability->count = 2;
+        for (int i = 0; i < 2; i++)
+        {
+            stats_capability->list[i].stat_enum = i;
+            stats_capability->list[i].stat_modes = SAI_STATS_MODE_READ | SAI_STATS_MODE_BULK_READ;
+        }
+        return SAI_STATUS_SUCCESS;
+    };
+
+    std::mutex mtx;
+    std::set<sai_object_id_t> polled;
+
+    sai->mock_bulkGetStats = [&](sai_object_id_t,
+                                sai_object_type_t,
+                                uint32_t object_count,
+                                const sai_object_key_t *object_keys,
+                                uint32_t number_of_counters,
+                                const sai_stat_id_t *,
+                                sai_stats_mode_t,
+                                sai_status_t *object_status,
+                                uint64_t *counters)
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        polled.clear();
+        for (uint32_t i = 0; i < object_count; i++)
+        {
+            polled.insert(object_keys[i].key.object_id);
+            object_status[i] = SAI_STATUS_SUCCESS;
+            for (uint32_t j = 0; j < number_of_counters; j++)
+            {
+                counters[i * number_of_counters + j] = (j + 1) * 100;
+            }
+        }
+        return SAI_STATUS_SUCCESS;
+    };
+
+    test_syncd::mockVidManagerObjectTypeQuery(SAI_OBJECT_TYPE_COUNTER);
+
+    std::vector<sai_object_id_t> object_ids = generateOids(10, SAI_OBJECT_TYPE_COUNTER);
+
+    FlexCounter fc("test", sai, "COUNTERS_DB");
+
+    std::vector<swss::FieldValueTuple> values;
+    values.emplace_back(POLL_INTERVAL_FIELD, "100");
+    values.emplace_back(FLEX_COUNTER_STATUS_FIELD, "enable");
+    fc.addCounterPlugin(values);
+
+    values.clear();
+    values.emplace_back(FLOW_COUNTER_ID_LIST, "SAI_COUNTER_STAT_PACKETS,SAI_COUNTER_STAT_BYTES");
+
+    fc.bulkAddCounter(SAI_OBJECT_TYPE_COUNTER, object_ids, object_ids, values);
+
+    usleep(300*1000);
+
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        EXPECT_EQ(polled.size(), object_ids.size());
+    }
+
+    // remove every other object, remaining ones keep their keys
+
+    std::vector<sai_object_id_t> removed;
+    std::set<sai_object_id_t> remaining;
+
+    for (size_t i = 0; i < object_ids.size(); i++)
+    {
+        if (i % 2)
+            remaining.insert(object_ids[i]);
+        else
+            removed.push_back(object_ids[i]);
+    }
+
+    fc.bulkRemoveCounter(removed);
+
+    usleep(300*1000);
+
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        EXPECT_EQ(polled, remaining);
+    }
+
+    swss::DBConnector db("COUNTERS_DB", 0);
+    swss::Table countersTable(&db, COUNTERS_TABLE);
+
+    std::vector<swss::FieldValueTuple> fvs;
+
+    for (auto vid: removed)
+    {
+        EXPECT_FALSE(countersTable.get(toOid(vid), fvs));
+    }
+
+    fc.bulkRemoveCounter(object_ids);
+
+    EXPECT_EQ(fc.isEmpty(), true);
+
+    for (auto vid: object_ids)
+    {
+        countersTable.del(toOid(vid));
+    }
+}
+
+TEST(FlexCounter, queuedCommandFailure)
+{
+    FlexCounter fc("test", sai, "COUNTERS_DB");
+
+    {
+        std::lock_guard<std::mutex> lock(fc.m_cmdMtx);
+
+        fc.m_polling = true;
+    }
+
+    // queued commands return right away, failure is not thrown to any caller
+
+    EXPECT_NO_THROW(fc.runCommand([]() { throw std::runtime_error("queued failure"); }, {}));
+
+    bool applied = false;
+
+    EXPECT_NO_THROW(fc.runCommand([&]() { applied = true; }, {}));
+
+    {
+        std::lock_guard<std::mutex> lock(fc.m_cmdMtx);
+
+        fc.m_polling = false;
+
+        EXPECT_NO_THROW(fc.applyCommands());
+
+        EXPECT_TRUE(fc.m_commands.empty());
+        EXPECT_EQ(fc.m_commandErrors, 1);
+    }
+
+    EXPECT_TRUE(applied);
+
+    // command applied right away still throws to its caller
+
+    EXPECT_THROW(fc.runCommand([]() { throw std::runtime_error("direct failure"); }, {}), std::runtime_error);
+
+    EXPECT_NO_THROW(fc.runCommand([]() {}, {}));
+}
@@ -6,11 +6,17 @@
 
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/socket.h>
+#include <sys/un.h>
 #include <fcntl.h>
 #include <unistd.h>
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <iostream>
+#include <vector>
+
 #define MDIO_MISSING_DEV_ADDR 0x1F
 #define MDIO_MISSING_REG_ADDR 0xFFFF
 
@@ -256,3 +262,167 @@ TEST(MdioIpcServer, mdioConnect)
 
     mdio_server->stopMdioThread();
 }
+
+TEST(MdioIpcServer, mdioBatch)
+{
+    SWSS_LOG_ENTER();
+    std::shared_ptr<MockableSaiInterface> mdio_sai(new MockableSaiInterface());
+    mdio_sai->mock_switchMdioRead = MockMdioRead;
+    mdio_sai->mock_switchMdioWrite = MockMdioWrite;
+    mdio_sai->mock_switchMdioCl22Read = MockMdioCl22Read;
+    mdio_sai->mock_switchMdioCl22Write = MockMdioCl22Write;
+    mkdir(SYNCD_IPC_SOCK_SYNCD, 0755);
+    std::shared_ptr<MdioIpcServer> mdio_server(new MdioIpcServer(mdio_sai, 0));
+    mdio_server->setIpcTestMode();
+    mdio_server->setSwitchId(0x21000000000000);
+    mdio_server->startMdioThread();
+    sleep(1);
+
+    mdioDevRegValMap.clear();
+    mdioDevCl22RegValMap.clear();
+
+    /* clause 45 and clause 22 sequence in one transaction */
+    std::vector<syncd_mdio_ipc_batch_op_t> ops = {
+        { SYNCD_IPC_BATCH_OP_WRITE,      0x4, 0x1A, 0xC0DE, 0 },
+        { SYNCD_IPC_BATCH_OP_READ,       0x4, 0x1A, 0,      0 },
+        { SYNCD_IPC_BATCH_OP_WRITE_CL22, 0x2, 0x1C, 0xFEED, 0 },
+        { SYNCD_IPC_BATCH_OP_READ_CL22,  0x2, 0x1C, 0,      0 },
+    };
+
+    sai_status_t rc = mdio_batch(0xF0F0F0F0F0F0F0F0, (uint32_t)ops.size(), ops.data());
+    EXPECT_EQ(rc, SAI_STATUS_SUCCESS);
+    EXPECT_EQ(ops[1].val, 0xC0DE);
+    EXPECT_EQ(ops[3].val, 0xFEED);
+
+    /* failed operation does not stop the rest of the batch */
+    ops = {
+        { SYNCD_IPC_BATCH_OP_WRITE, MDIO_MISSING_DEV_ADDR, MDIO_MISSING_REG_ADDR, 0, 0 },
+        { 0xFF,                     0x4,                   0x1A,                  0, 0 },
+        { SYNCD_IPC_BATCH_OP_READ,  0x4,                   0x1A,                  0, 0 },
+    };
+
+    rc = mdio_batch(0xF0F0F0F0F0F0F0F0, (uint32_t)ops.size(), ops.data());
+    EXPECT_NE(rc, SAI_STATUS_SUCCESS);
+    EXPECT_NE(ops[0].status, SAI_STATUS_SUCCESS);
+    EXPECT_EQ(ops[1].status, SAI_STATUS_INVALID_PARAMETER);
+    EXPECT_EQ(ops[2].status, SAI_STATUS_SUCCESS);
+    EXPECT_EQ(ops[2].val, 0xC0DE);
+
+    /* text commands still work on the same connection */
+    uint32_t data = 0;
+    rc = mdio_read(0xF0F0F0F0F0F0F0F0, 0x4, 0x1A, 1, &data);
+    EXPECT_EQ(rc, SAI_STATUS_SUCCESS);
+    EXPECT_EQ(data, 0xC0DE);
+
+    /* init time: per register round trip vs batched transaction */
+    uint32_t count = 20000;
+
+    if (getenv("TEST_NO_PERF"))
+    {
+        count = 2 * SYNCD_IPC_BATCH_MAX + 1;
+
+        std::cout << "disabling performance tests" << std::endl;
+    }
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        data = i;
+        EXPECT_EQ(mdio_write(0xF0F0F0F0F0F0F0F0, 0x5, i, 1, &data), SAI_STATUS_SUCCESS);
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+
+    auto single = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    ops.clear();
+
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        ops.push_back({ SYNCD_IPC_BATCH_OP_WRITE, 0x6, i, i, 0 });
+    }
+
+    start = std::chrono::high_resolution_clock::now();
+
+    rc = mdio_batch(0xF0F0F0F0F0F0F0F0, count, ops.data());
+
+    end = std::chrono::high_resolution_clock::now();
+
+    auto batch = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    EXPECT_EQ(rc, SAI_STATUS_SUCCESS);
+    EXPECT_EQ(mdioDevRegValMap[(0x6ULL << 32) | (count - 1)], count - 1);
+
+    std::cout << count << " mdio writes, single: " << single << " us, batch: " << batch << " us" << std::endl;
+
+    mdio_server->stopMdioThread();
+    sleep(MDIO_CLIENT_TIMEOUT+1);
+}
+
+static int connectRaw()
+{
+    SWSS_LOG_ENTER();
+
+    int sock = socket(AF_UNIX, SOCK_STREAM, 0);
+
+    struct sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    snprintf(addr.sun_path, sizeof(addr.sun_path), "%s/%s.srv", SYNCD_IPC_SOCK_SYNCD, SYNCD_IPC_SOCK_FILE);
+
+    EXPECT_EQ(connect(sock, (struct sockaddr *)&addr, sizeof(addr)), 0);
+
+    return sock;
+}
+
+TEST(MdioIpcServer, stalledClient)
+{
+    SWSS_LOG_ENTER();
+    std::shared_ptr<MockableSaiInterface> mdio_sai(new MockableSaiInterface());
+    mdio_sai->mock_switchMdioRead = MockMdioRead;
+    mdio_sai->mock_switchMdioWrite = MockMdioWrite;
+    mkdir(SYNCD_IPC_SOCK_SYNCD, 0755);
+    std::shared_ptr<MdioIpcServer> mdio_server(new MdioIpcServer(mdio_sai, 0));
+    mdio_server->setIpcTestMode();
+    mdio_server->setSwitchId(0x21000000000000);
+    mdio_server->startMdioThread();
+    sleep(1);
+
+    mdioDevRegValMap.clear();
+    mdioDevRegValMap[(0x4ULL << 32) | 0x1A] = 0xC0DE;
+
+    /* first half of batch magic only */
+    int partialMagic = connectRaw();
+    uint32_t magic = SYNCD_IPC_BATCH_MAGIC;
+    EXPECT_EQ(send(partialMagic, &magic, 2, 0), 2);
+
+    /* batch header without operations */
+    int partialBatch = connectRaw();
+    syncd_mdio_ipc_batch_hdr_t hdr;
+    memset(&hdr, 0, sizeof(hdr));
+    hdr.magic = SYNCD_IPC_BATCH_MAGIC;
+    hdr.count = 2;
+    EXPECT_EQ(send(partialBatch, &hdr, sizeof(hdr), 0), (ssize_t)sizeof(hdr));
+
+    /* server is not blocked by stalled clients */
+    auto start = std::chrono::steady_clock::now();
+
+    uint32_t data = 0;
+    EXPECT_EQ(mdio_read(0xF0F0F0F0F0F0F0F0, 0x4, 0x1A, 1, &data), SAI_STATUS_SUCCESS);
+    EXPECT_EQ(data, 0xC0DE);
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock::now() - start).count();
+    EXPECT_LT(elapsed, MDIO_CLIENT_TIMEOUT);
+
+    /* stalled connections are dropped by server, reset when data was left unread */
+    char buf[4];
+    EXPECT_LE(recv(partialMagic, buf, sizeof(buf), 0), 0);
+    EXPECT_LE(recv(partialBatch, buf, sizeof(buf), 0), 0);
+
+    close(partialMagic);
+    close(partialBatch);
+
+    mdio_server->stopMdioThread();
+    sleep(MDIO_CLIENT_TIMEOUT+1);
+}
@@ -0,0 +1,44 @@
+#include "PipelineFlushScope.h"
+
+#include "swss/dbconnector.h"
+#include "swss/table.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+using namespace syncd;
+
+TEST(PipelineFlushScope, flushOnException)
+{
+    auto db = std::make_shared<swss::DBConnector>("FLEX_COUNTER_DB", 0);
+
+    auto pipeline = std::make_shared<swss::RedisPipeline>(db.get());
+
+    swss::Table table(pipeline.get(), "FLEX_COUNTER_TABLE", true);
+
+    swss::Table reader(db.get(), "FLEX_COUNTER_TABLE");
+
+    reader.del("TEST:oid:0x1");
+
+    try
+    {
+        PipelineFlushScope scope(pipeline);
+
+        table.set("TEST:oid:0x1", { { "POLL_INTERVAL", "1000" } });
+
+        throw std::runtime_error("failed to add counter");
+    }
+    catch (const std::runtime_error&)
+    {
+    }
+
+    // buffered write was sent when scope was left by exception
+
+    std::string value;
+
+    EXPECT_TRUE(reader.hget("TEST:oid:0x1", "POLL_INTERVAL", value));
+    EXPECT_EQ(value, "1000");
+
+    reader.del("TEST:oid:0x1");
+}
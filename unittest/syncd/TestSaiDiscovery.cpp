@@ -0,0 +1,151 @@
+#include "SaiDiscovery.h"
+#include "VendorSaiOptions.h"
+#include "MockableSaiInterface.h"
+
+#include "swss/logger.h"
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <memory>
+
+using namespace syncd;
+
+#define SWITCH_RID  0x1
+#define PORT_RID    0x10
+#define QUEUE_RID   0x20
+#define PORT_COUNT  4
+
+static sai_object_type_t objectTypeQuery(
+        _In_ sai_object_id_t oid)
+{
+    SWSS_LOG_ENTER();
+
+    if (oid == SWITCH_RID)
+        return SAI_OBJECT_TYPE_SWITCH;
+
+    if (oid >= PORT_RID && oid < PORT_RID + PORT_COUNT)
+        return SAI_OBJECT_TYPE_PORT;
+
+    if (oid >= QUEUE_RID && oid < QUEUE_RID + PORT_COUNT)
+        return SAI_OBJECT_TYPE_QUEUE;
+
+    return SAI_OBJECT_TYPE_NULL;
+}
+
+static std::shared_ptr<MockableSaiInterface> createSai(
+        _Inout_ std::map<std::pair<sai_object_type_t, sai_attr_id_t>, int>& gets)
+{
+    SWSS_LOG_ENTER();
+
+    auto sai = std::make_shared<MockableSaiInterface>();
+
+    sai->setOptions(VendorSaiOptions::OPTIONS_KEY, std::make_shared<VendorSaiOptions>());
+
+    sai->mock_objectTypeQuery = objectTypeQuery;
+
+    sai->mock_get = [&](sai_object_type_t ot, sai_object_id_t oid, uint32_t count, sai_attribute_t* attrs) -> sai_status_t {
+
+        gets[std::make_pair(ot, attrs[0].id)]++;
+
+        if (ot == SAI_OBJECT_TYPE_SWITCH && attrs[0].id == SAI_SWITCH_ATTR_PORT_LIST)
+        {
+            attrs[0].value.objlist.count = PORT_COUNT;
+
+            for (uint32_t i = 0; i < PORT_COUNT; i++)
+                attrs[0].value.objlist.list[i] = PORT_RID + i;
+
+            return SAI_STATUS_SUCCESS;
+        }
+
+        return SAI_STATUS_ATTR_NOT_IMPLEMENTED_0;
+    };
+
+    return sai;
+}
+
+TEST(SaiDiscovery, discover)
+{
+    std::map<std::pair<sai_object_type_t, sai_attr_id_t>, int> gets;
+
+    auto sai = createSai(gets);
+
+    int bulkCalls = 0;
+
+    sai->mock_bulkGet = [&](sai_object_type_t ot, uint32_t count, const sai_object_id_t* oids, const uint32_t* attrCount, sai_attribute_t** attrs, sai_bulk_op_error_mode_t mode, sai_status_t* statuses) -> sai_status_t {
+
+        if (ot != SAI_OBJECT_TYPE_PORT)
+            return SAI_STATUS_NOT_IMPLEMENTED;
+
+        bulkCalls++;
+
+        for (uint32_t i = 0; i < count; i++)
+        {
+            EXPECT_EQ(attrCount[i], 1);
+
+            if (attrs[i]->id == SAI_PORT_ATTR_QOS_QUEUE_LIST)
+            {
+                attrs[i]->value.objlist.count = 1;
+                attrs[i]->value.objlist.list[0] = QUEUE_RID + (oids[i] - PORT_RID);
+
+                statuses[i] = SAI_STATUS_SUCCESS;
+            }
+            else
+            {
+                statuses[i] = SAI_STATUS_ATTR_NOT_IMPLEMENTED_0;
+            }
+        }
+
+        return SAI_STATUS_FAILURE;
+    };
+
+    SaiDiscovery sd(sai);
+
+    auto discovered = sd.discover(SWITCH_RID);
+
+    EXPECT_EQ(discovered.size(), 1 + 2 * PORT_COUNT);
+
+    for (uint32_t i = 0; i < PORT_COUNT; i++)
+    {
+        EXPECT_EQ(discovered.count(PORT_RID + i), 1);
+        EXPECT_EQ(discovered.count(QUEUE_RID + i), 1);
+    }
+
+    // ports are queried only by bulk
+
+    EXPECT_GT(bulkCalls, 0);
+    EXPECT_EQ(sd.getBulkGetCount(), (uint64_t)bulkCalls + 1);
+
+    for (auto& kvp: gets)
+    {
+        EXPECT_NE(kvp.first.first, SAI_OBJECT_TYPE_PORT);
+
+        // not implemented attributes are queried only once
+
+        EXPECT_EQ(kvp.second, 1);
+    }
+
+    EXPECT_EQ(sd.getGetCount(), gets.size());
+}
+
+TEST(SaiDiscovery, discoverNoBulk)
+{
+    std::map<std::pair<sai_object_type_t, sai_attr_id_t>, int> gets;
+
+    auto sai = createSai(gets);
+
+    SaiDiscovery sd(sai);
+
+    auto discovered = sd.discover(SWITCH_RID);
+
+    EXPECT_EQ(discovered.size(), 1 + PORT_COUNT);
+
+    // one failed bulk get on ports, and not implemented attributes are not retried
+
+    EXPECT_EQ(sd.getBulkGetCount(), 1);
+
+    for (auto& kvp: gets)
+    {
+        EXPECT_EQ(kvp.second, 1);
+    }
+}
@@ -0,0 +1,257 @@
+#include "SingleReiniter.h"
+#include "VidManager.h"
+#include "MockableSaiInterface.h"
+
+#include "meta/sai_serialize.h"
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <memory>
+#include <vector>
+
+using namespace syncd;
+using namespace saimeta;
+
+static const sai_object_id_t switchVid = 0x21000000000000;
+static const sai_object_id_t switchRid = 0x21000000000100;
+
+static const sai_object_id_t vrVid = 0x3000000000001;
+static const sai_object_id_t vlanVid1 = 0x26000000000001;
+static const sai_object_id_t vlanVid2 = 0x26000000000002;
+static const sai_object_id_t rifVid = 0x6000000000001;
+static const sai_object_id_t nhVid1 = 0x4000000000001;
+static const sai_object_id_t nhVid2 = 0x4000000000002;
+
+class SingleReiniterTest : public ::testing::Test
+{
+    public:
+
+        void SetUp() override
+        {
+            SWSS_LOG_ENTER();
+
+            m_vendorSai = std::make_shared<MockableSaiInterface>();
+
+            SingleReiniter::ObjectIdMap empty;
+
+            m_reiniter = std::make_shared<SingleReiniter>(nullptr, nullptr, m_vendorSai, nullptr, empty, empty, std::vector<std::string>(), 16);
+
+            // switch is created before any other object
+
+            m_reiniter->m_switch_vid = switchVid;
+            m_reiniter->m_switch_rid = switchRid;
+
+            m_reiniter->m_translatedV2R[switchVid] = switchRid;
+            m_reiniter->m_translatedR2V[switchRid] = switchVid;
+        }
+
+    protected:
+
+        void addObject(
+                _In_ sai_object_id_t vid,
+                _In_ const std::vector<swss::FieldValueTuple>& values)
+        {
+            SWSS_LOG_ENTER();
+
+            auto objectType = VidManager::objectTypeQuery(vid);
+
+            auto strVid = sai_serialize_object_id(vid);
+
+            auto key = "ASIC_STATE:" + sai_serialize_object_type(objectType) + ":" + strVid;
+
+            m_reiniter->m_oids[strVid] = key;
+            m_reiniter->m_attributesLists[key] = std::make_shared<SaiAttributeList>(objectType, values, false);
+            m_reiniter->m_vidToRidMap[vid] = vid + 0x100; // not discovered
+        }
+
+        void addChain()
+        {
+            SWSS_LOG_ENTER();
+
+            addObject(vrVid, { { "SAI_VIRTUAL_ROUTER_ATTR_ADMIN_V4_STATE", "true" } });
+
+            addObject(vlanVid1, { { "SAI_VLAN_ATTR_VLAN_ID", "10" } });
+
+            addObject(rifVid, {
+                    { "SAI_ROUTER_INTERFACE_ATTR_VIRTUAL_ROUTER_ID", sai_serialize_object_id(vrVid) },
+                    { "SAI_ROUTER_INTERFACE_ATTR_TYPE", "SAI_ROUTER_INTERFACE_TYPE_VLAN" },
+                    { "SAI_ROUTER_INTERFACE_ATTR_VLAN_ID", sai_serialize_object_id(vlanVid1) } });
+
+            addObject(nhVid1, {
+                    { "SAI_NEXT_HOP_ATTR_TYPE", "SAI_NEXT_HOP_TYPE_IP" },
+                    { "SAI_NEXT_HOP_ATTR_IP", "10.0.0.1" },
+                    { "SAI_NEXT_HOP_ATTR_ROUTER_INTERFACE_ID", sai_serialize_object_id(rifVid) } });
+
+            addObject(nhVid2, {
+                    { "SAI_NEXT_HOP_ATTR_TYPE", "SAI_NEXT_HOP_TYPE_IP" },
+                    { "SAI_NEXT_HOP_ATTR_IP", "10.0.0.2" },
+                    { "SAI_NEXT_HOP_ATTR_ROUTER_INTERFACE_ID", sai_serialize_object_id(rifVid) } });
+        }
+
+        /**
+         * @brief Create all objects level by level, same as processOidsBulk
+         * for objects which are not discovered.
+         */
+        void createByLevel()
+        {
+            SWSS_LOG_ENTER();
+
+            for (auto& lvl: m_reiniter->getOidsByLevel())
+            {
+                std::map<sai_object_type_t, std::vector<sai_object_id_t>> toCreate;
+
+                for (auto vid: lvl.second)
+                {
+                    toCreate[VidManager::objectTypeQuery(vid)].push_back(vid);
+                }
+
+                for (auto& kvp: toCreate)
+                {
+                    m_reiniter->bulkCreateOids(kvp.first, kvp.second);
+                }
+            }
+        }
+
+    protected:
+
+        std::shared_ptr<MockableSaiInterface> m_vendorSai;
+
+        std::shared_ptr<SingleReiniter> m_reiniter;
+
+        sai_object_id_t m_nextRid = 0x1000;
+};
+
+TEST_F(SingleReiniterTest, getOidsByLevel)
+{
+    addChain();
+
+    auto levels = m_reiniter->getOidsByLevel();
+
+    ASSERT_EQ(levels.size(), 3u);
+
+    EXPECT_EQ(levels[0].size(), 2u); // virtual router and vlan
+    EXPECT_EQ(levels[1], std::vector<sai_object_id_t>{ rifVid });
+    EXPECT_EQ(levels[2].size(), 2u); // next hops
+}
+
+TEST_F(SingleReiniterTest, bulkCreateMultiLevelChain)
+{
+    addChain();
+
+    std::vector<std::pair<sai_object_type_t, uint32_t>> calls;
+
+    m_vendorSai->mock_bulkCreate = [&](sai_object_type_t objectType, sai_object_id_t switchId, uint32_t objectCount, const uint32_t* attrCounts, const sai_attribute_t** attrLists, sai_bulk_op_error_mode_t mode, sai_object_id_t* objectIds, sai_status_t* statuses) -> sai_status_t {
+
+        EXPECT_EQ(switchId, switchRid);
+
+        calls.emplace_back(objectType, objectCount);
+
+        for (uint32_t idx = 0; idx < objectCount; idx++)
+        {
+            // referenced objects must be already created and translated
+
+            for (uint32_t i = 0; i < attrCounts[idx]; i++)
+            {
+                auto md = sai_metadata_get_attr_metadata(objectType, attrLists[idx][i].id);
+
+                if (md->attrvaluetype == SAI_ATTR_VALUE_TYPE_OBJECT_ID)
+                {
+                    EXPECT_TRUE(m_reiniter->m_translatedR2V.find(attrLists[idx][i].value.oid) != m_reiniter->m_translatedR2V.end());
+                }
+            }
+
+            objectIds[idx] = m_nextRid++;
+            statuses[idx] = SAI_STATUS_SUCCESS;
+        }
+
+        return SAI_STATUS_SUCCESS;
+    };
+
+    createByLevel();
+
+    ASSERT_EQ(calls.size(), 4u);
+
+    EXPECT_EQ(calls[0], std::make_pair(SAI_OBJECT_TYPE_VIRTUAL_ROUTER, 1u));
+    EXPECT_EQ(calls[1], std::make_pair(SAI_OBJECT_TYPE_VLAN, 1u));
+    EXPECT_EQ(calls[2], std::make_pair(SAI_OBJECT_TYPE_ROUTER_INTERFACE, 1u));
+    EXPECT_EQ(calls[3], std::make_pair(SAI_OBJECT_TYPE_NEXT_HOP, 2u));
+
+    EXPECT_EQ(m_reiniter->m_translatedV2R.size(), 6u); // including switch
+}
+
+TEST_F(SingleReiniterTest, bulkCreateNotImplemented)
+{
+    addObject(vlanVid1, { { "SAI_VLAN_ATTR_VLAN_ID", "10" } });
+    addObject(vlanVid2, { { "SAI_VLAN_ATTR_VLAN_ID", "20" } });
+
+    int bulkCalls = 0;
+    int createCalls = 0;
+
+    m_vendorSai->mock_bulkCreate = [&](sai_object_type_t objectType, sai_object_id_t switchId, uint32_t objectCount, const uint32_t* attrCounts, const sai_attribute_t** attrLists, sai_bulk_op_error_mode_t mode, sai_object_id_t* objectIds, sai_status_t* statuses) -> sai_status_t {
+        bulkCalls++;
+        return SAI_STATUS_NOT_IMPLEMENTED;
+    };
+
+    m_vendorSai->mock_create = [&](sai_object_type_t objectType, sai_object_id_t* objectId, sai_object_id_t switchId, uint32_t attrCount, const sai_attribute_t* attrList) -> sai_status_t {
+        createCalls++;
+        *objectId = m_nextRid++;
+        return SAI_STATUS_SUCCESS;
+    };
+
+    EXPECT_TRUE(m_reiniter->isBulkEnabled(SAI_OBJECT_TYPE_VLAN));
+
+    m_reiniter->bulkCreateOids(SAI_OBJECT_TYPE_VLAN, { vlanVid1, vlanVid2 });
+
+    EXPECT_EQ(bulkCalls, 1);
+    EXPECT_EQ(createCalls, 2);
+
+    EXPECT_NE(m_reiniter->m_translatedV2R.find(vlanVid1), m_reiniter->m_translatedV2R.end());
+    EXPECT_NE(m_reiniter->m_translatedV2R.find(vlanVid2), m_reiniter->m_translatedV2R.end());
+
+    // next objects of this type will be created one by one
+
+    EXPECT_FALSE(m_reiniter->isBulkEnabled(SAI_OBJECT_TYPE_VLAN));
+    EXPECT_TRUE(m_reiniter->isBulkEnabled(SAI_OBJECT_TYPE_VIRTUAL_ROUTER));
+}
+
+TEST_F(SingleReiniterTest, bulkCreateMixedFailure)
+{
+    addObject(vlanVid1, { { "SAI_VLAN_ATTR_VLAN_ID", "10" } });
+    addObject(vlanVid2, { { "SAI_VLAN_ATTR_VLAN_ID", "20" } });
+
+    m_vendorSai->mock_bulkCreate = [&](sai_object_type_t objectType, sai_object_id_t switchId, uint32_t objectCount, const uint32_t* attrCounts, const sai_attribute_t** attrLists, sai_bulk_op_error_mode_t mode, sai_object_id_t* objectIds, sai_status_t* statuses) -> sai_status_t {
+
+        EXPECT_EQ(mode, SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR);
+
+        objectIds[0] = m_nextRid++;
+        statuses[0] = SAI_STATUS_SUCCESS;
+
+        statuses[1] = SAI_STATUS_INVALID_PARAMETER;
+
+        return SAI_STATUS_FAILURE;
+    };
+
+    EXPECT_THROW(m_reiniter->bulkCreateOids(SAI_OBJECT_TYPE_VLAN, { vlanVid1, vlanVid2 }), std::runtime_error);
+
+    EXPECT_NE(m_reiniter->m_translatedV2R.find(vlanVid1), m_reiniter->m_translatedV2R.end());
+    EXPECT_EQ(m_reiniter->m_translatedV2R.find(vlanVid2), m_reiniter->m_translatedV2R.end());
+
+    // failure is not treated as missing bulk support
+
+    EXPECT_TRUE(m_reiniter->isBulkEnabled(SAI_OBJECT_TYPE_VLAN));
+}
+
+TEST_F(SingleReiniterTest, getPhaseTimes)
+{
+    m_reiniter->runPhase("first", []{});
+    m_reiniter->runPhase("second", []{});
+
+    auto& times = m_reiniter->getPhaseTimes();
+
+    ASSERT_EQ(times.size(), 2u);
+
+    EXPECT_EQ(times[0].first, "first");
+    EXPECT_EQ(times[1].first, "second");
+    EXPECT_GE(times[1].second, 0.0);
+}
@@ -677,4 +677,34 @@ TEST_F(SyncdTest, BulkRemoveTest)
 
     m_syncd->processEvent(*channel);
 }
+
+TEST_F(SyncdTest, BulkRemoveInitView)
+{
+    m_syncd->m_asicInitViewMode = true;
+
+    swss::KeyOpFieldsValuesTuple kco;
+
+    std::vector<swss::FieldValueTuple> values = {
+        {"oid:0x26000000000003", "SAI_VLAN_ATTR_VLAN_ID=3"}
+    };
+
+    kco = std::make_tuple("SAI_OBJECT_TYPE_VLAN:bulk:1", "bulkcreate", values);
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, m_syncd->processBulkQuadEvent(SAI_COMMON_API_BULK_CREATE, kco));
+
+    values = {
+        {"oid:0x26000000000001", ""},
+        {"oid:0x26000000000002", ""}
+    };
+
+    kco = std::make_tuple("SAI_OBJECT_TYPE_VLAN:bulk:2", "bulkremove", values);
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, m_syncd->processBulkQuadEvent(SAI_COMMON_API_BULK_REMOVE, kco));
+
+    // removed objects are not created objects, they must not be populated
+    // to temporary view, same as objects removed by single remove
+
+    EXPECT_EQ(m_syncd->m_createdInInitView, std::set<sai_object_id_t>({0x26000000000003}));
+    EXPECT_EQ(m_syncd->m_initViewRemovedVidSet, std::set<sai_object_id_t>({0x26000000000001, 0x26000000000002}));
+}
 #endif
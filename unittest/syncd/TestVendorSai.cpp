@@ -1807,3 +1807,76 @@ TEST_F(VendorSaiTest, bulk_eni_trusted_vni_entry)
     EXPECT_EQ(SAI_STATUS_NOT_SUPPORTED,
             m_vsai->bulkSet(0, e, nullptr, SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR, nullptr));
 }
+
+TEST(VendorSai, parseLockPolicy)
+{
+    auto policy = VendorSai::parseLockPolicy("stats:separate,query:none");
+
+    ASSERT_EQ(policy.size(), SYNCD_VENDOR_API_CLASS_MAX);
+
+    EXPECT_EQ(policy[SYNCD_VENDOR_API_CLASS_CONFIG], SYNCD_VENDOR_LOCK_POLICY_GLOBAL);
+    EXPECT_EQ(policy[SYNCD_VENDOR_API_CLASS_STATS], SYNCD_VENDOR_LOCK_POLICY_SEPARATE);
+    EXPECT_EQ(policy[SYNCD_VENDOR_API_CLASS_QUERY], SYNCD_VENDOR_LOCK_POLICY_NONE);
+
+    EXPECT_THROW(VendorSai::parseLockPolicy("stats"), std::runtime_error);
+    EXPECT_THROW(VendorSai::parseLockPolicy("foo:none"), std::runtime_error);
+    EXPECT_THROW(VendorSai::parseLockPolicy("stats:foo"), std::runtime_error);
+}
+
+TEST(VendorSai, lockPolicy)
+{
+    VendorSai sai;
+
+    auto vso = std::make_shared<VendorSaiOptions>();
+
+    vso->m_lockPolicy = "stats:foo";
+
+    sai.setOptions(VendorSaiOptions::OPTIONS_KEY, vso);
+
+    EXPECT_EQ(sai.apiInitialize(0, &test_services), SAI_STATUS_INVALID_PARAMETER);
+
+    vso->m_lockPolicy = "stats:separate,query:none";
+
+    EXPECT_EQ(sai.apiInitialize(0, &test_services), SAI_STATUS_SUCCESS);
+
+    EXPECT_EQ(sai.getLockPolicy(SYNCD_VENDOR_API_CLASS_CONFIG), SYNCD_VENDOR_LOCK_POLICY_GLOBAL);
+    EXPECT_EQ(sai.getLockPolicy(SYNCD_VENDOR_API_CLASS_STATS), SYNCD_VENDOR_LOCK_POLICY_SEPARATE);
+    EXPECT_EQ(sai.getLockPolicy(SYNCD_VENDOR_API_CLASS_QUERY), SYNCD_VENDOR_LOCK_POLICY_NONE);
+
+    auto config = sai.getLockWaitStats(SYNCD_VENDOR_API_CLASS_CONFIG).m_count;
+
+    sai_stat_id_t id = 0;
+
+    sai.clearStats(SAI_OBJECT_TYPE_PORT, SAI_NULL_OBJECT_ID, 1, &id);
+
+    uint64_t count = 0;
+
+    sai.objectTypeGetAvailability(SAI_NULL_OBJECT_ID, SAI_OBJECT_TYPE_PORT, 0, nullptr, &count);
+
+    // stats took only its own lock, query took no lock at all
+
+    EXPECT_EQ(sai.getLockWaitStats(SYNCD_VENDOR_API_CLASS_CONFIG).m_count, config);
+    EXPECT_EQ(sai.getLockWaitStats(SYNCD_VENDOR_API_CLASS_STATS).m_count, 1);
+    EXPECT_EQ(sai.getLockWaitStats(SYNCD_VENDOR_API_CLASS_QUERY).m_count, 0);
+
+    EXPECT_EQ(sai.apiUninitialize(), SAI_STATUS_SUCCESS);
+}
+
+TEST_F(VendorSaiTest, switchMdioBatch)
+{
+    syncd_mdio_ipc_batch_op_t ops[3] = {
+        { SYNCD_IPC_BATCH_OP_READ, 0, 0, 0, 0 },
+        { SYNCD_IPC_BATCH_OP_WRITE, 0, 0, 0, 0 },
+        { 0xff, 0, 0, 0, 0 },
+    };
+
+    auto config = m_vsai->getLockWaitStats(SYNCD_VENDOR_API_CLASS_CONFIG).m_count;
+
+    EXPECT_EQ(m_vsai->switchMdioBatch(m_swid, 3, ops), SAI_STATUS_FAILURE);
+
+    EXPECT_EQ(ops[2].status, SAI_STATUS_INVALID_PARAMETER);
+
+    // whole batch executed under single config lock
+
+    EXPECT_EQ(m_vsai->getLockWaitStats(SYNCD_VENDOR_API_CLASS_CONFIG).m_count, config + 1);
+}
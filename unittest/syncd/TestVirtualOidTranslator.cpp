@@ -7,6 +7,8 @@
 
 #include <gtest/gtest.h>
 
+#include <thread>
+
 using namespace syncd;
 using namespace std::placeholders;
 
@@ -160,3 +162,144 @@ TEST(VirtualOidTranslator, tryTranslateVidToRid)
 
     sai->apiUninitialize();
 }
+
+TEST(VirtualOidTranslator, translateVidsToRids)
+{
+    auto dbAsic = std::make_shared<swss::DBConnector>("ASIC_DB", 0);
+    auto client = std::make_shared<RedisClient>(dbAsic);
+    auto sai = std::make_shared<saivs::Sai>();
+
+    auto switchConfigContainer = std::make_shared<sairedis::SwitchConfigContainer>();
+    auto redisVidIndexGenerator = std::make_shared<sairedis::RedisVidIndexGenerator>(dbAsic, REDIS_KEY_VIDCOUNTER);
+
+    auto virtualObjectIdManager =
+        std::make_shared<sairedis::VirtualObjectIdManager>(
+                0,
+                switchConfigContainer,
+                redisVidIndexGenerator);
+
+    VirtualOidTranslator vot(client, virtualObjectIdManager, sai);
+
+    vot.clearLocalCache();
+
+    std::vector<sai_object_id_t> vids = { 0x21000000000100, 0x21000000000101, 0x21000000000102 };
+    std::vector<sai_object_id_t> rids = { 0x2100000100, 0x2100000101, 0x2100000102 };
+
+    // mapping exists only in redis
+
+    client->insertVidsAndRids(vids.size(), vids.data(), rids.data());
+
+    std::vector<sai_object_id_t> out(vids.size());
+
+    vot.translateVidsToRids(vids.size(), vids.data(), out.data());
+
+    EXPECT_EQ(out, rids);
+    EXPECT_EQ(vot.getCacheMisses(), vids.size());
+
+    vot.translateVidsToRids(vids.size(), vids.data(), out.data());
+
+    EXPECT_EQ(out, rids);
+    EXPECT_EQ(vot.getCacheHits(), vids.size());
+    EXPECT_EQ(vot.getCacheMisses(), vids.size());
+
+    // preloaded cache has no misses
+
+    vot.loadLocalCache();
+
+    sai_object_id_t vid;
+
+    EXPECT_TRUE(vot.tryTranslateRidToVid(rids[1], vid));
+    EXPECT_EQ(vid, vids[1]);
+
+    EXPECT_EQ(vot.translateVidToRid(vids[2]), rids[2]);
+
+    EXPECT_EQ(vot.getCacheMisses(), vids.size());
+
+    // null is translated to null
+
+    sai_object_id_t nullVid = SAI_NULL_OBJECT_ID;
+    sai_object_id_t nullRid = 1;
+
+    vot.translateVidsToRids(1, &nullVid, &nullRid);
+
+    EXPECT_EQ(nullRid, SAI_NULL_OBJECT_ID);
+
+    for (size_t idx = 0; idx < vids.size(); idx++)
+    {
+        vot.eraseRidAndVid(rids[idx], vids[idx]);
+    }
+
+    EXPECT_THROW(vot.translateVidsToRids(vids.size(), vids.data(), out.data()), std::runtime_error);
+}
+
+TEST(ConcurrentOidMap, findInsertErase)
+{
+    ConcurrentOidMap map;
+
+    std::unordered_map<sai_object_id_t, sai_object_id_t> items;
+
+    for (sai_object_id_t oid = 1; oid <= 1000; oid++)
+    {
+        items[oid] = oid + 0x1000;
+    }
+
+    map.insert(items);
+
+    EXPECT_EQ(map.size(), items.size());
+
+    sai_object_id_t value;
+
+    EXPECT_TRUE(map.find(10, value));
+    EXPECT_EQ(value, 0x1000 + 10);
+
+    EXPECT_FALSE(map.find(1001, value));
+
+    std::vector<sai_object_id_t> keys = { 1, 1001, 500 };
+    std::vector<sai_object_id_t> values(keys.size());
+
+    EXPECT_EQ(map.find(keys.size(), keys.data(), values.data()), 2);
+
+    EXPECT_EQ(values[0], 0x1001);
+    EXPECT_EQ(values[1], SAI_NULL_OBJECT_ID);
+    EXPECT_EQ(values[2], 0x1000 + 500);
+
+    map.erase(1);
+
+    EXPECT_FALSE(map.find(1, value));
+
+    map.clear();
+
+    EXPECT_EQ(map.size(), 0);
+}
+
+TEST(ConcurrentOidMap, concurrentAccess)
+{
+    ConcurrentOidMap map;
+
+    std::vector<std::thread> threads;
+
+    for (sai_object_id_t t = 0; t < 4; t++)
+    {
+        threads.emplace_back([&map, t]() {
+
+            for (sai_object_id_t oid = 1; oid <= 10000; oid++)
+            {
+                sai_object_id_t key = (t << 32) | oid;
+
+                map.insert(key, oid);
+
+                sai_object_id_t value = 0;
+
+                EXPECT_TRUE(map.find(key, value));
+                EXPECT_EQ(value, oid);
+            }
+        });
+    }
+
+    for (auto& thread: threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(map.size(), 4 * 10000);
+}
@@ -0,0 +1,248 @@
+#include "CounterStore.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+using namespace saivs;
+
+#define NS_PER_SECOND (1000000000ULL)
+
+static const sai_object_id_t portId = 0x1000000000002;
+
+TEST(CounterStore, setGet)
+{
+    CounterStore cs;
+
+    sai_stat_id_t ids[] = { SAI_PORT_STAT_IF_IN_OCTETS, SAI_PORT_STAT_IF_OUT_OCTETS };
+
+    uint64_t values[] = { 10, 20 };
+    uint64_t counters[] = { 1, 1 };
+
+    cs.get(SAI_OBJECT_TYPE_PORT, portId, 2, ids, false, counters, 0);
+
+    EXPECT_EQ(counters[0], 0);
+    EXPECT_EQ(counters[1], 0);
+
+    cs.set(SAI_OBJECT_TYPE_PORT, portId, 2, ids, values);
+
+    cs.get(SAI_OBJECT_TYPE_PORT, portId, 2, ids, false, counters, 0);
+
+    EXPECT_EQ(counters[0], 10);
+    EXPECT_EQ(counters[1], 20);
+
+    EXPECT_EQ(cs.getObjectCount(SAI_OBJECT_TYPE_PORT), 1);
+    EXPECT_EQ(cs.getObjectCount(SAI_OBJECT_TYPE_QUEUE), 0);
+}
+
+TEST(CounterStore, clear)
+{
+    CounterStore cs;
+
+    sai_stat_id_t ids[] = { SAI_PORT_STAT_IF_IN_OCTETS, SAI_PORT_STAT_IF_OUT_OCTETS };
+
+    uint64_t values[] = { 10, 20 };
+    uint64_t counters[2];
+
+    cs.set(SAI_OBJECT_TYPE_PORT, portId, 2, ids, values);
+
+    // clear only first counter, without reading
+
+    cs.get(SAI_OBJECT_TYPE_PORT, portId, 1, ids, true, nullptr, 0);
+
+    cs.get(SAI_OBJECT_TYPE_PORT, portId, 2, ids, true, counters, 0);
+
+    EXPECT_EQ(counters[0], 0);
+    EXPECT_EQ(counters[1], 20);
+
+    cs.get(SAI_OBJECT_TYPE_PORT, portId, 2, ids, false, counters, 0);
+
+    EXPECT_EQ(counters[0], 0);
+    EXPECT_EQ(counters[1], 0);
+}
+
+TEST(CounterStore, sparse)
+{
+    CounterStore cs;
+
+    // id outside of port stat enum
+
+    sai_stat_id_t id = 0x7fffffff;
+
+    uint64_t value = 42;
+    uint64_t counter = 0;
+
+    cs.set(SAI_OBJECT_TYPE_PORT, portId, 1, &id, &value);
+
+    cs.get(SAI_OBJECT_TYPE_PORT, portId, 1, &id, false, &counter, 0);
+
+    EXPECT_EQ(counter, 42);
+
+    cs.remove(SAI_OBJECT_TYPE_PORT, portId);
+
+    cs.get(SAI_OBJECT_TYPE_PORT, portId, 1, &id, false, &counter, 0);
+
+    EXPECT_EQ(counter, 0);
+}
+
+TEST(CounterStore, remove)
+{
+    CounterStore cs;
+
+    sai_stat_id_t id = SAI_PORT_STAT_IF_IN_OCTETS;
+
+    uint64_t value = 7;
+    uint64_t counter = 0;
+
+    cs.set(SAI_OBJECT_TYPE_PORT, portId, 1, &id, &value);
+    cs.set(SAI_OBJECT_TYPE_PORT, portId + 1, 1, &id, &value);
+
+    EXPECT_EQ(cs.getObjectCount(SAI_OBJECT_TYPE_PORT), 2);
+
+    cs.remove(SAI_OBJECT_TYPE_PORT, portId);
+    cs.remove(SAI_OBJECT_TYPE_PORT, portId);
+    cs.remove(SAI_OBJECT_TYPE_QUEUE, portId);
+
+    EXPECT_EQ(cs.getObjectCount(SAI_OBJECT_TYPE_PORT), 1);
+
+    // row is reused and must be zeroed
+
+    cs.get(SAI_OBJECT_TYPE_PORT, portId + 2, 1, &id, false, &counter, 0);
+
+    EXPECT_EQ(counter, 0);
+
+    cs.get(SAI_OBJECT_TYPE_PORT, portId + 1, 1, &id, false, &counter, 0);
+
+    EXPECT_EQ(counter, 7);
+}
+
+TEST(CounterStore, packetsAt)
+{
+    EXPECT_EQ(CounterStore::packetsAt(1000, 0), 0);
+    EXPECT_EQ(CounterStore::packetsAt(1000, NS_PER_SECOND / 2), 500);
+    EXPECT_EQ(CounterStore::packetsAt(1000, 3 * NS_PER_SECOND), 3000);
+
+    // must not overflow on large uptime and rate
+
+    EXPECT_EQ(CounterStore::packetsAt(1000000000, 100000 * NS_PER_SECOND), 100000000000000ULL);
+}
+
+TEST(CounterStore, trafficModel)
+{
+    CounterStore cs;
+
+    EXPECT_FALSE(cs.isTrafficModelEnabled());
+
+    cs.setTrafficModel(1000, 100);
+
+    EXPECT_TRUE(cs.isTrafficModelEnabled());
+
+    sai_stat_id_t ids[] = {
+        SAI_PORT_STAT_IF_IN_UCAST_PKTS,
+        SAI_PORT_STAT_IF_IN_OCTETS,
+        SAI_PORT_STAT_IF_IN_DISCARDS,
+        SAI_PORT_STAT_IF_IN_ERRORS,
+    };
+
+    uint64_t counters[4];
+
+    uint64_t start = 5 * NS_PER_SECOND;
+
+    // traffic starts on first read
+
+    cs.get(SAI_OBJECT_TYPE_PORT, portId, 4, ids, false, counters, start);
+
+    EXPECT_EQ(counters[0], 0);
+    EXPECT_EQ(counters[1], 0);
+
+    cs.get(SAI_OBJECT_TYPE_PORT, portId, 4, ids, false, counters, start + NS_PER_SECOND);
+
+    EXPECT_EQ(counters[0], 1000);
+    EXPECT_EQ(counters[1], 100000);
+    EXPECT_EQ(counters[2], 0);
+    EXPECT_EQ(counters[3], 0);
+
+    // time going back is ignored
+
+    cs.get(SAI_OBJECT_TYPE_PORT, portId, 4, ids, true, counters, start);
+
+    EXPECT_EQ(counters[0], 1000);
+
+    cs.get(SAI_OBJECT_TYPE_PORT, portId, 4, ids, false, counters, start + 3 * NS_PER_SECOND / 2);
+
+    EXPECT_EQ(counters[0], 500);
+    EXPECT_EQ(counters[1], 50000);
+
+    // queues and priority groups are advanced as well
+
+    sai_stat_id_t qid = SAI_QUEUE_STAT_PACKETS;
+
+    cs.get(SAI_OBJECT_TYPE_QUEUE, 0x15000000000001, 1, &qid, false, counters, start);
+    cs.get(SAI_OBJECT_TYPE_QUEUE, 0x15000000000001, 1, &qid, false, counters, start + NS_PER_SECOND);
+
+    EXPECT_EQ(counters[0], 1000);
+
+    sai_stat_id_t pgid = SAI_INGRESS_PRIORITY_GROUP_STAT_BYTES;
+
+    cs.get(SAI_OBJECT_TYPE_INGRESS_PRIORITY_GROUP, 0x1a000000000001, 1, &pgid, false, counters, start);
+    cs.get(SAI_OBJECT_TYPE_INGRESS_PRIORITY_GROUP, 0x1a000000000001, 1, &pgid, false, counters, start + NS_PER_SECOND);
+
+    EXPECT_EQ(counters[0], 100000);
+
+    // other object types are not advanced
+
+    sai_stat_id_t rid = SAI_ROUTER_INTERFACE_STAT_IN_PACKETS;
+
+    cs.get(SAI_OBJECT_TYPE_ROUTER_INTERFACE, 0x6000000000001, 1, &rid, false, counters, start);
+    cs.get(SAI_OBJECT_TYPE_ROUTER_INTERFACE, 0x6000000000001, 1, &rid, false, counters, start + NS_PER_SECOND);
+
+    EXPECT_EQ(counters[0], 0);
+}
+
+TEST(CounterStore, bulkScale)
+{
+    uint32_t count = 100000;
+
+    if (getenv("TEST_NO_PERF"))
+    {
+        count = 1000;
+
+        std::cout << "disabling performance tests" << std::endl;
+    }
+
+    CounterStore cs;
+
+    cs.setTrafficModel(1000000, 512);
+
+    auto info = sai_metadata_get_object_type_info(SAI_OBJECT_TYPE_QUEUE);
+
+    std::vector<sai_stat_id_t> ids;
+
+    for (size_t idx = 0; idx < info->statenum->valuescount; idx++)
+    {
+        ids.push_back((sai_stat_id_t)info->statenum->values[idx]);
+    }
+
+    std::vector<uint64_t> counters(ids.size());
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    for (int round = 0; round < 2; round++)
+    {
+        for (uint32_t idx = 0; idx < count; idx++)
+        {
+            cs.get(SAI_OBJECT_TYPE_QUEUE, 0x15000000000000 + idx, (uint32_t)ids.size(), ids.data(),
+                    false, counters.data(), (uint64_t)round * NS_PER_SECOND);
+        }
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+
+    EXPECT_EQ(cs.getObjectCount(SAI_OBJECT_TYPE_QUEUE), count);
+
+    auto us = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    std::cout << "2 polls of " << count << " queues x " << ids.size() << " counters, ms: " << (double)us / 1000 << std::endl;
+}
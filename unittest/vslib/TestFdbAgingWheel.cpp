@@ -0,0 +1,138 @@
+#include "FdbAgingWheel.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+using namespace saivs;
+
+static FdbInfo make_fdb_info(
+        _In_ uint8_t index,
+        _In_ sai_vlan_id_t vlanId = 1)
+{
+    FdbInfo fi;
+
+    fi.m_fdbEntry.mac_address[5] = index;
+
+    fi.setVlanId(vlanId);
+
+    return fi;
+}
+
+TEST(FdbAgingWheel, ctr)
+{
+    EXPECT_THROW(std::make_shared<FdbAgingWheel>(0), std::runtime_error);
+}
+
+TEST(FdbAgingWheel, getKey)
+{
+    EXPECT_NE(FdbAgingWheel::getKey(make_fdb_info(1, 1)), FdbAgingWheel::getKey(make_fdb_info(1, 2)));
+    EXPECT_NE(FdbAgingWheel::getKey(make_fdb_info(1, 1)), FdbAgingWheel::getKey(make_fdb_info(2, 1)));
+    EXPECT_EQ(FdbAgingWheel::getKey(make_fdb_info(1, 1)), FdbAgingWheel::getKey(make_fdb_info(1, 1)));
+}
+
+TEST(FdbAgingWheel, expire)
+{
+    FdbAgingWheel wheel(16);
+
+    wheel.setAgingTime(10);
+
+    wheel.touch(make_fdb_info(1), 100);
+    wheel.touch(make_fdb_info(2), 105);
+
+    EXPECT_EQ(wheel.expire(100).size(), 0);
+    EXPECT_EQ(wheel.expire(109).size(), 0);
+
+    auto aged = wheel.expire(110);
+
+    ASSERT_EQ(aged.size(), 1);
+    EXPECT_EQ(aged[0].m_fdbEntry.mac_address[5], 1);
+
+    EXPECT_EQ(wheel.expire(115).size(), 1);
+    EXPECT_EQ(wheel.size(), 0);
+}
+
+TEST(FdbAgingWheel, refresh)
+{
+    FdbAgingWheel wheel(16);
+
+    wheel.setAgingTime(10);
+
+    wheel.touch(make_fdb_info(1), 100);
+
+    EXPECT_EQ(wheel.expire(105).size(), 0);
+
+    wheel.touch(make_fdb_info(1), 105);
+
+    EXPECT_EQ(wheel.getTimestamp(make_fdb_info(1)), 105);
+
+    EXPECT_EQ(wheel.expire(110).size(), 0);
+    EXPECT_EQ(wheel.expire(114).size(), 0);
+    EXPECT_EQ(wheel.expire(115).size(), 1);
+}
+
+TEST(FdbAgingWheel, remove)
+{
+    FdbAgingWheel wheel(16);
+
+    wheel.setAgingTime(10);
+
+    wheel.touch(make_fdb_info(1), 100);
+    wheel.expire(100);
+
+    wheel.remove(make_fdb_info(1));
+
+    EXPECT_EQ(wheel.size(), 0);
+    EXPECT_EQ(wheel.expire(120).size(), 0);
+}
+
+TEST(FdbAgingWheel, longAgingTime)
+{
+    // aging time longer than wheel rounds
+
+    FdbAgingWheel wheel(4);
+
+    wheel.setAgingTime(10);
+
+    wheel.touch(make_fdb_info(1), 100);
+
+    for (uint32_t now = 100; now < 110; now++)
+    {
+        EXPECT_EQ(wheel.expire(now).size(), 0);
+    }
+
+    EXPECT_EQ(wheel.expire(110).size(), 1);
+}
+
+TEST(FdbAgingWheel, largeTimeGap)
+{
+    FdbAgingWheel wheel(4);
+
+    wheel.setAgingTime(10);
+
+    wheel.touch(make_fdb_info(1), 100);
+    wheel.touch(make_fdb_info(2), 100);
+
+    EXPECT_EQ(wheel.expire(100).size(), 0);
+    EXPECT_EQ(wheel.expire(1000).size(), 2);
+}
+
+TEST(FdbAgingWheel, setAgingTime)
+{
+    FdbAgingWheel wheel(16);
+
+    wheel.touch(make_fdb_info(1), 100);
+
+    // aging disabled
+
+    EXPECT_EQ(wheel.expire(200).size(), 0);
+
+    wheel.setAgingTime(300);
+
+    EXPECT_EQ(wheel.getAgingTime(), 300);
+    EXPECT_EQ(wheel.expire(201).size(), 0);
+
+    wheel.setAgingTime(50);
+
+    EXPECT_EQ(wheel.expire(202).size(), 1);
+}
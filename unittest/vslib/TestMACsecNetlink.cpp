@@ -0,0 +1,186 @@
+#include "MACsecNetlink.h"
+
+#include <swss/logger.h>
+
+#include <netlink/netlink.h>
+#include <netlink/route/link.h>
+#include <netlink/route/link/veth.h>
+
+#include <gtest/gtest.h>
+
+#include <sched.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#include <iostream>
+
+using namespace saivs;
+
+#define NAMESPACE_OK            (0)
+#define NAMESPACE_FAILED        (1)
+#define NAMESPACE_UNSUPPORTED   (2)
+
+TEST(MACsecNetlink, parseHex)
+{
+    std::vector<uint8_t> bytes;
+
+    EXPECT_TRUE(MACsecNetlink::parseHex("", bytes));
+    EXPECT_EQ(bytes.size(), 0);
+
+    EXPECT_TRUE(MACsecNetlink::parseHex("00aBfF", bytes));
+    EXPECT_EQ(bytes, std::vector<uint8_t>({ 0x00, 0xab, 0xff }));
+
+    EXPECT_FALSE(MACsecNetlink::parseHex("abc", bytes));
+    EXPECT_FALSE(MACsecNetlink::parseHex("zz", bytes));
+}
+
+TEST(MACsecNetlink, sci)
+{
+    uint64_t sci;
+
+    EXPECT_TRUE(MACsecNetlink::parseSci("fe5400409b920001", sci));
+    EXPECT_EQ(sci, 0xfe5400409b920001ULL);
+
+    EXPECT_EQ(MACsecNetlink::serializeSci(sci), "fe5400409b920001");
+    EXPECT_EQ(MACsecNetlink::serializeSci(1), "0000000000000001");
+
+    EXPECT_FALSE(MACsecNetlink::parseSci("fe5400409b92", sci));
+    EXPECT_FALSE(MACsecNetlink::parseSci("02:42:ac:11:00:03", sci));
+}
+
+TEST(MACsecNetlink, getCipherSuite)
+{
+    EXPECT_NE(MACsecNetlink::getCipherSuite(MACsecAttr::CIPHER_NAME_GCM_AES_128), 0);
+    EXPECT_NE(MACsecNetlink::getCipherSuite(MACsecAttr::CIPHER_NAME_GCM_AES_XPN_256), 0);
+    EXPECT_EQ(MACsecNetlink::getCipherSuite(MACsecAttr::CIPHER_NAME_INVALID), 0);
+}
+
+static int macsec_in_namespace()
+{
+    SWSS_LOG_ENTER();
+
+    if (unshare(CLONE_NEWNET) != 0)
+    {
+        return NAMESPACE_UNSUPPORTED;
+    }
+
+    struct nl_sock *sock = nl_socket_alloc();
+
+    if (sock == nullptr || nl_connect(sock, NETLINK_ROUTE) < 0)
+    {
+        return NAMESPACE_UNSUPPORTED;
+    }
+
+    int err = rtnl_link_veth_add(sock, "veth0", "veth1", getpid());
+
+    nl_socket_free(sock);
+
+    if (err < 0)
+    {
+        return NAMESPACE_UNSUPPORTED;
+    }
+
+    MACsecAttr attr;
+
+    attr.m_vethName = "veth0";
+    attr.m_macsecName = "macsec_veth0";
+    attr.m_sci = "fe5400409b920001";
+    attr.m_an = 0;
+    attr.m_pn = 1;
+    attr.m_cipher = MACsecAttr::CIPHER_NAME_GCM_AES_128;
+    attr.m_authKey = "ebe9123ecbbfd96bee92c8ab01000000";
+    attr.m_sak = "e21b7a2ae60ddc9d7e5f6c2b8c4f4f8f";
+    attr.m_sendSci = true;
+    attr.m_encryptionEnable = true;
+    attr.m_direction = SAI_MACSEC_DIRECTION_EGRESS;
+
+    MACsecNetlink netlink;
+
+    if (!netlink.createSecY(attr) || !netlink.isAvailable())
+    {
+        // kernel without MACsec support
+
+        return NAMESPACE_UNSUPPORTED;
+    }
+
+    MACsecAttr ingress = attr;
+
+    ingress.m_sci = "5254001234560001";
+    ingress.m_direction = SAI_MACSEC_DIRECTION_INGRESS;
+
+    if (!netlink.createSA(attr) ||
+            !netlink.createRxSC(ingress) ||
+            !netlink.createSA(ingress) ||
+            !netlink.updateSAPn(ingress, 100))
+    {
+        return NAMESPACE_FAILED;
+    }
+
+    MACsecNetlink::DeviceInfo device;
+
+    if (!netlink.getDevice(attr.m_macsecName, device) ||
+            device.m_sci != attr.m_sci ||
+            device.m_txsc.m_sas.count(0) != 1 ||
+            device.m_rxscs.count(ingress.m_sci) != 1 ||
+            device.m_rxscs[ingress.m_sci].m_sas[0].m_pn != 100)
+    {
+        return NAMESPACE_FAILED;
+    }
+
+    if (!netlink.deleteSA(ingress) ||
+            !netlink.deleteRxSC(ingress) ||
+            !netlink.deleteSA(attr))
+    {
+        return NAMESPACE_FAILED;
+    }
+
+    if (!netlink.getDevice(attr.m_macsecName, device) ||
+            device.m_txsc.m_sas.size() ||
+            device.m_rxscs.size())
+    {
+        return NAMESPACE_FAILED;
+    }
+
+    // deleting already deleted SA must fail
+
+    if (netlink.deleteSA(attr))
+    {
+        return NAMESPACE_FAILED;
+    }
+
+    if (!netlink.deleteSecY(attr.m_macsecName) || netlink.getDevice(attr.m_macsecName, device))
+    {
+        return NAMESPACE_FAILED;
+    }
+
+    return NAMESPACE_OK;
+}
+
+TEST(MACsecNetlink, veth)
+{
+    // network namespace is created in child process, so it will not affect
+    // other tests, it requires CAP_NET_ADMIN and kernel with MACsec support
+
+    pid_t pid = fork();
+
+    ASSERT_GE(pid, 0);
+
+    if (pid == 0)
+    {
+        _exit(macsec_in_namespace());
+    }
+
+    int status = 0;
+
+    ASSERT_EQ(waitpid(pid, &status, 0), pid);
+
+    ASSERT_TRUE(WIFEXITED(status));
+
+    if (WEXITSTATUS(status) == NAMESPACE_UNSUPPORTED)
+    {
+        std::cout << "network namespace or MACsec not supported, skipping" << std::endl;
+        return;
+    }
+
+    EXPECT_EQ(WEXITSTATUS(status), NAMESPACE_OK);
+}
@@ -0,0 +1,336 @@
+#include "PacketIoPool.h"
+#include "HostInterfaceInfo.h"
+
+#include "swss/logger.h"
+
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <fcntl.h>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+
+using namespace saivs;
+
+static bool waitFor(
+        _In_ const std::function<bool()>& cond)
+{
+    SWSS_LOG_ENTER();
+
+    for (int i = 0; i < 500; i++)
+    {
+        if (cond())
+            return true;
+
+        usleep(10*1000);
+    }
+
+    return cond();
+}
+
+TEST(PacketBatch, ctr)
+{
+    EXPECT_THROW(PacketBatch(0), std::runtime_error);
+
+    PacketBatch batch(4);
+
+    EXPECT_EQ(batch.getCapacity(), 4);
+}
+
+TEST(PacketBatch, receive_flush)
+{
+    int sv[2];
+
+    ASSERT_EQ(socketpair(AF_UNIX, SOCK_DGRAM, 0, sv), 0);
+
+    PacketBatch batch(4);
+
+    // nothing to receive
+
+    EXPECT_EQ(batch.receive(sv[0]), -1);
+    EXPECT_EQ(errno, EAGAIN);
+
+    unsigned char buffer[100];
+
+    for (int i = 0; i < 6; i++)
+    {
+        memset(buffer, i, sizeof(buffer));
+
+        EXPECT_EQ(write(sv[1], buffer, 20 + i), 20 + i);
+    }
+
+    EXPECT_EQ(batch.receive(sv[0]), 4);
+
+    for (size_t i = 0; i < 4; i++)
+    {
+        EXPECT_EQ(batch.getLength(i), 20 + i);
+        EXPECT_EQ(batch.getBuffer(i)[0], i);
+
+        batch.enqueue(i, batch.getLength(i));
+    }
+
+    EXPECT_THROW(batch.enqueue(0, 1), std::runtime_error);
+
+    EXPECT_EQ(batch.flush(sv[0]), 4);
+
+    // empty queue
+
+    EXPECT_EQ(batch.flush(sv[0]), 0);
+
+    for (int i = 0; i < 4; i++)
+    {
+        EXPECT_EQ(read(sv[1], buffer, sizeof(buffer)), 20 + i);
+        EXPECT_EQ(buffer[0], i);
+    }
+
+    EXPECT_EQ(batch.receive(sv[0]), 2);
+
+    close(sv[0]);
+    close(sv[1]);
+}
+
+TEST(PacketBatch, read)
+{
+    int sv[2];
+
+    ASSERT_EQ(socketpair(AF_UNIX, SOCK_DGRAM, 0, sv), 0);
+
+    ASSERT_EQ(fcntl(sv[0], F_SETFL, O_NONBLOCK), 0);
+
+    PacketBatch batch(2);
+
+    EXPECT_EQ(batch.read(sv[0]), -1);
+
+    unsigned char buffer[30] = { 0 };
+
+    EXPECT_EQ(write(sv[1], buffer, 30), 30);
+
+    EXPECT_EQ(batch.read(sv[0]), 1);
+    EXPECT_EQ(batch.getLength(0), 30);
+
+    close(sv[0]);
+    close(sv[1]);
+}
+
+TEST(PacketIoPool, ctr)
+{
+    EXPECT_THROW(PacketIoPool(0), std::runtime_error);
+
+    PacketIoPool pool(2);
+
+    EXPECT_EQ(pool.getThreadCount(), 2);
+}
+
+TEST(PacketIoPool, add_remove)
+{
+    PacketIoPool pool(2);
+
+    int sv[2];
+
+    ASSERT_EQ(socketpair(AF_UNIX, SOCK_DGRAM, 0, sv), 0);
+
+    std::atomic<int> frames(0);
+
+    auto handler = [&](PacketBatch& batch) {
+        int count = batch.receive(sv[0]);
+
+        if (count > 0)
+            frames += count;
+
+        return true;
+    };
+
+    EXPECT_TRUE(pool.add(sv[0], handler));
+    EXPECT_FALSE(pool.add(sv[0], handler));
+    EXPECT_FALSE(pool.add(-1, handler));
+
+    unsigned char buffer[64] = { 0 };
+
+    for (int i = 0; i < 100; i++)
+    {
+        EXPECT_EQ(write(sv[1], buffer, sizeof(buffer)), (ssize_t)sizeof(buffer));
+    }
+
+    EXPECT_TRUE(waitFor([&]{ return frames == 100; }));
+
+    pool.remove(sv[0]);
+    pool.remove(sv[0]);
+
+    EXPECT_EQ(write(sv[1], buffer, sizeof(buffer)), (ssize_t)sizeof(buffer));
+
+    usleep(50*1000);
+
+    EXPECT_EQ(frames, 100);
+
+    close(sv[0]);
+    close(sv[1]);
+}
+
+TEST(PacketIoPool, handler_stop)
+{
+    PacketIoPool pool(1);
+
+    int sv[2];
+
+    ASSERT_EQ(socketpair(AF_UNIX, SOCK_DGRAM, 0, sv), 0);
+
+    std::atomic<int> calls(0);
+
+    EXPECT_TRUE(pool.add(sv[0], [&](PacketBatch& batch) { calls++; return false; }));
+
+    unsigned char buffer[64] = { 0 };
+
+    EXPECT_EQ(write(sv[1], buffer, sizeof(buffer)), (ssize_t)sizeof(buffer));
+
+    EXPECT_TRUE(waitFor([&]{ return calls == 1; }));
+
+    // fd is not re-armed after handler returned false
+
+    usleep(50*1000);
+
+    EXPECT_EQ(calls, 1);
+
+    pool.remove(sv[0]);
+
+    close(sv[0]);
+    close(sv[1]);
+}
+
+TEST(HostInterfaceInfo, runPacketIoPool)
+{
+    auto eq = std::make_shared<EventQueue>(std::make_shared<Signal>());
+
+    auto pool = std::make_shared<PacketIoPool>(2);
+
+    int veth[2];
+    int tap[2];
+
+    ASSERT_EQ(socketpair(AF_UNIX, SOCK_DGRAM, 0, veth), 0);
+    ASSERT_EQ(socketpair(AF_UNIX, SOCK_DGRAM, 0, tap), 0);
+
+    {
+        HostInterfaceInfo hii(0, veth[0], tap[0], "tap", 0, eq);
+
+        EXPECT_TRUE(hii.runPacketIoPool(pool));
+        EXPECT_FALSE(hii.runPacketIoPool(pool));
+
+        EXPECT_EQ(hii.getPacketIoPool(), pool);
+
+        unsigned char buffer[ETH_FRAME_BUFFER_SIZE];
+
+        memset(buffer, 0xaa, sizeof(buffer));
+
+        // veth -> tap
+
+        EXPECT_EQ(write(veth[1], buffer, 64), 64);
+
+        EXPECT_EQ(read(tap[1], buffer, sizeof(buffer)), 64);
+
+        // tap -> veth
+
+        EXPECT_EQ(write(tap[1], buffer, 100), 100);
+
+        EXPECT_EQ(read(veth[1], buffer, sizeof(buffer)), 100);
+
+        // too short frame is dropped
+
+        EXPECT_EQ(write(veth[1], buffer, 4), 4);
+
+        usleep(50*1000);
+
+        EXPECT_EQ(recv(tap[1], buffer, sizeof(buffer), MSG_DONTWAIT), -1);
+    }
+
+    // tap fd is closed by host interface
+
+    close(veth[0]);
+    close(veth[1]);
+    close(tap[1]);
+}
+
+static double forward(
+        _In_ bool usePool,
+        _In_ int count)
+{
+    SWSS_LOG_ENTER();
+
+    auto eq = std::make_shared<EventQueue>(std::make_shared<Signal>());
+
+    int veth[2];
+    int tap[2];
+
+    EXPECT_EQ(socketpair(AF_UNIX, SOCK_DGRAM, 0, veth), 0);
+    EXPECT_EQ(socketpair(AF_UNIX, SOCK_DGRAM, 0, tap), 0);
+
+    int size = 4 * 1024 * 1024;
+
+    setsockopt(tap[1], SOL_SOCKET, SO_RCVBUF, &size, sizeof(size));
+
+    std::shared_ptr<PacketIoPool> pool;
+
+    auto hii = std::make_shared<HostInterfaceInfo>(0, veth[0], tap[0], "tap", 0, eq);
+
+    if (usePool)
+    {
+        pool = std::make_shared<PacketIoPool>(1);
+
+        hii->runPacketIoPool(pool);
+    }
+    else
+    {
+        hii->runThreads();
+    }
+
+    unsigned char buffer[ETH_FRAME_BUFFER_SIZE];
+
+    memset(buffer, 0, sizeof(buffer));
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    int received = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        if (write(veth[1], buffer, 128) != 128)
+            break;
+
+        while (recv(tap[1], buffer, sizeof(buffer), MSG_DONTWAIT) > 0)
+            received++;
+    }
+
+    while (received < count && recv(tap[1], buffer, sizeof(buffer), 0) > 0)
+        received++;
+
+    auto end = std::chrono::high_resolution_clock::now();
+
+    hii = nullptr;
+
+    close(veth[0]);
+    close(veth[1]);
+    close(tap[1]);
+
+    EXPECT_EQ(received, count);
+
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+TEST(PacketIoPool, forward_perf)
+{
+    int count = 100000;
+
+    if (getenv("TEST_NO_PERF"))
+    {
+        count = 1000;
+
+        std::cout << "disabling performance tests" << std::endl;
+    }
+
+    double threads = forward(false, count);
+    double pool = forward(true, count);
+
+    std::cout << count << " frames, dedicated threads: " << threads << " ms, packet I/O pool: " << pool << " ms" << std::endl;
+}
@@ -0,0 +1,48 @@
+#include "ReferenceIndex.h"
+
+#include <gtest/gtest.h>
+
+using namespace saivs;
+
+static const sai_object_id_t vlanId = 0x26000000000001;
+
+TEST(ReferenceIndex, isIndexed)
+{
+    EXPECT_TRUE(ReferenceIndex::isIndexed(SAI_OBJECT_TYPE_VLAN_MEMBER, SAI_VLAN_MEMBER_ATTR_VLAN_ID));
+    EXPECT_TRUE(ReferenceIndex::isIndexed(SAI_OBJECT_TYPE_BRIDGE_PORT, SAI_BRIDGE_PORT_ATTR_BRIDGE_ID));
+
+    EXPECT_FALSE(ReferenceIndex::isIndexed(SAI_OBJECT_TYPE_VLAN_MEMBER, SAI_VLAN_MEMBER_ATTR_BRIDGE_PORT_ID));
+    EXPECT_FALSE(ReferenceIndex::isIndexed(SAI_OBJECT_TYPE_PORT, SAI_PORT_ATTR_ADMIN_STATE));
+
+    EXPECT_EQ(ReferenceIndex::getIndexedAttributes(SAI_OBJECT_TYPE_PORT).size(), 0);
+}
+
+TEST(ReferenceIndex, insertRemove)
+{
+    ReferenceIndex ri;
+
+    EXPECT_EQ(ri.getReferencing(SAI_OBJECT_TYPE_VLAN_MEMBER, SAI_VLAN_MEMBER_ATTR_VLAN_ID, vlanId).size(), 0);
+
+    ri.insert(SAI_OBJECT_TYPE_VLAN_MEMBER, SAI_VLAN_MEMBER_ATTR_VLAN_ID, vlanId, "oid:0x27000000000002");
+    ri.insert(SAI_OBJECT_TYPE_VLAN_MEMBER, SAI_VLAN_MEMBER_ATTR_VLAN_ID, vlanId, "oid:0x27000000000001");
+    ri.insert(SAI_OBJECT_TYPE_VLAN_MEMBER, SAI_VLAN_MEMBER_ATTR_VLAN_ID, vlanId + 1, "oid:0x27000000000003");
+
+    auto& members = ri.getReferencing(SAI_OBJECT_TYPE_VLAN_MEMBER, SAI_VLAN_MEMBER_ATTR_VLAN_ID, vlanId);
+
+    ASSERT_EQ(members.size(), 2);
+
+    // ordered same way as object hash
+
+    EXPECT_EQ(*members.begin(), "oid:0x27000000000001");
+
+    ri.remove(SAI_OBJECT_TYPE_VLAN_MEMBER, SAI_VLAN_MEMBER_ATTR_VLAN_ID, vlanId, "oid:0x27000000000002");
+    ri.remove(SAI_OBJECT_TYPE_VLAN_MEMBER, SAI_VLAN_MEMBER_ATTR_VLAN_ID, vlanId, "oid:0x27000000000002");
+    ri.remove(SAI_OBJECT_TYPE_BRIDGE_PORT, SAI_BRIDGE_PORT_ATTR_BRIDGE_ID, vlanId, "oid:0x27000000000001");
+
+    EXPECT_EQ(ri.getReferencing(SAI_OBJECT_TYPE_VLAN_MEMBER, SAI_VLAN_MEMBER_ATTR_VLAN_ID, vlanId).size(), 1);
+    EXPECT_EQ(ri.getReferencing(SAI_OBJECT_TYPE_VLAN_MEMBER, SAI_VLAN_MEMBER_ATTR_VLAN_ID, vlanId + 1).size(), 1);
+
+    ri.clear();
+
+    EXPECT_EQ(ri.getReferencing(SAI_OBJECT_TYPE_VLAN_MEMBER, SAI_VLAN_MEMBER_ATTR_VLAN_ID, vlanId + 1).size(), 0);
+}
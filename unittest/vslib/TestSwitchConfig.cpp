@@ -77,3 +77,14 @@ TEST(SwitchConfig, parseBool)
 
     EXPECT_TRUE(SwitchConfig::parseBool("true"));
 }
+
+TEST(SwitchConfig, parseUseTypedObjectStore)
+{
+    EXPECT_TRUE(SwitchConfig::parseUseTypedObjectStore(nullptr));
+
+    EXPECT_FALSE(SwitchConfig::parseUseTypedObjectStore("foo"));
+
+    EXPECT_FALSE(SwitchConfig::parseUseTypedObjectStore("false"));
+
+    EXPECT_TRUE(SwitchConfig::parseUseTypedObjectStore("true"));
+}
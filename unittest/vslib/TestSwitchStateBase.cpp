@@ -448,3 +448,51 @@ TEST(SwitchStateBase, getObjectTypeAvailability_standalone)
     uint64_t availability = ss.getObjectTypeAvailability(SAI_OBJECT_TYPE_MY_SID_ENTRY);
     EXPECT_EQ(availability, 0);
 }
+
+TEST_F(SwitchStateBaseTest, findObjectsReferenceIndex)
+{
+    auto table1 = m_ridmgr->allocateNewObjectId(SAI_OBJECT_TYPE_ACL_TABLE, m_swid);
+    auto table2 = m_ridmgr->allocateNewObjectId(SAI_OBJECT_TYPE_ACL_TABLE, m_swid);
+
+    std::vector<sai_object_id_t> counters;
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_ACL_COUNTER_ATTR_TABLE_ID;
+    attr.value.oid = table1;
+
+    for (int i = 0; i < 3; i++)
+    {
+        auto counter = m_ridmgr->allocateNewObjectId(SAI_OBJECT_TYPE_ACL_COUNTER, m_swid);
+
+        ASSERT_EQ(m_ss->create(SAI_OBJECT_TYPE_ACL_COUNTER, sai_serialize_object_id(counter), m_swid, 1, &attr), SAI_STATUS_SUCCESS);
+
+        counters.push_back(counter);
+    }
+
+    std::vector<sai_object_id_t> objects;
+
+    m_ss->findObjects(SAI_OBJECT_TYPE_ACL_COUNTER, attr, objects);
+
+    EXPECT_EQ(objects.size(), 3);
+
+    // move one counter to other table
+
+    attr.value.oid = table2;
+
+    ASSERT_EQ(m_ss->set(SAI_OBJECT_TYPE_ACL_COUNTER, sai_serialize_object_id(counters[0]), &attr), SAI_STATUS_SUCCESS);
+
+    m_ss->findObjects(SAI_OBJECT_TYPE_ACL_COUNTER, attr, objects);
+
+    ASSERT_EQ(objects.size(), 1);
+    EXPECT_EQ(objects[0], counters[0]);
+
+    ASSERT_EQ(m_ss->remove(SAI_OBJECT_TYPE_ACL_COUNTER, sai_serialize_object_id(counters[1])), SAI_STATUS_SUCCESS);
+
+    attr.value.oid = table1;
+
+    m_ss->findObjects(SAI_OBJECT_TYPE_ACL_COUNTER, attr, objects);
+
+    ASSERT_EQ(objects.size(), 1);
+    EXPECT_EQ(objects[0], counters[2]);
+}
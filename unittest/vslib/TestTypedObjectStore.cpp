@@ -0,0 +1,348 @@
+#include "TypedObjectStore.h"
+#include "SwitchStateBase.h"
+#include "RealObjectIdManager.h"
+#include "ContextConfigContainer.h"
+
+#include "Globals.h"
+#include "sai_serialize.h"
+
+#include <gtest/gtest.h>
+
+#include <arpa/inet.h>
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <set>
+#include <sstream>
+
+using namespace saivs;
+
+static sai_route_entry_t make_route_entry(
+        _In_ sai_object_id_t switchId,
+        _In_ uint32_t index)
+{
+    SWSS_LOG_ENTER();
+
+    sai_route_entry_t re;
+
+    memset(&re, 0, sizeof(re));
+
+    re.switch_id = switchId;
+    re.vr_id = 0x3000000000022;
+    re.destination.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
+    re.destination.addr.ip4 = htonl(0x0a000000 + index);
+    re.destination.mask.ip4 = htonl(0xffffffff);
+
+    return re;
+}
+
+TEST(TypedObjectStore, isSupportedObjectType)
+{
+    EXPECT_TRUE(TypedObjectStore::isSupportedObjectType(SAI_OBJECT_TYPE_ROUTE_ENTRY));
+    EXPECT_TRUE(TypedObjectStore::isSupportedObjectType(SAI_OBJECT_TYPE_NEIGHBOR_ENTRY));
+
+    EXPECT_FALSE(TypedObjectStore::isSupportedObjectType(SAI_OBJECT_TYPE_FDB_ENTRY));
+    EXPECT_FALSE(TypedObjectStore::isSupportedObjectType(SAI_OBJECT_TYPE_PORT));
+}
+
+TEST(TypedObjectStore, serializeObjectId)
+{
+    sai_object_meta_key_t mk;
+
+    mk.objecttype = SAI_OBJECT_TYPE_ROUTE_ENTRY;
+    mk.objectkey.key.route_entry = make_route_entry(0x21000000000000, 1);
+
+    auto str = TypedObjectStore::serializeObjectId(mk);
+
+    EXPECT_EQ(str, sai_serialize_route_entry(mk.objectkey.key.route_entry));
+
+    sai_object_meta_key_t mk2;
+
+    TypedObjectStore::deserializeMetaKey(SAI_OBJECT_TYPE_ROUTE_ENTRY, str, mk2);
+
+    EXPECT_TRUE(saimeta::MetaKeyHasher()(mk, mk2));
+
+    EXPECT_THROW(TypedObjectStore::deserializeMetaKey(SAI_OBJECT_TYPE_PORT, "oid:0x1", mk2), std::runtime_error);
+}
+
+TEST(TypedObjectStore, create_set_remove)
+{
+    TypedObjectStore store;
+
+    sai_object_meta_key_t mk;
+
+    mk.objecttype = SAI_OBJECT_TYPE_ROUTE_ENTRY;
+    mk.objectkey.key.route_entry = make_route_entry(0x21000000000000, 1);
+
+    sai_attribute_t attrs[2];
+
+    attrs[0].id = SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID;
+    attrs[0].value.oid = 0x4000000000001;
+    attrs[1].id = SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION;
+    attrs[1].value.s32 = SAI_PACKET_ACTION_FORWARD;
+
+    EXPECT_EQ(store.create(mk, 2, attrs), SAI_STATUS_SUCCESS);
+    EXPECT_EQ(store.create(mk, 2, attrs), SAI_STATUS_ITEM_ALREADY_EXISTS);
+
+    EXPECT_EQ(store.size(), 1u);
+    EXPECT_EQ(store.size(SAI_OBJECT_TYPE_ROUTE_ENTRY), 1u);
+    EXPECT_EQ(store.size(SAI_OBJECT_TYPE_NEIGHBOR_ENTRY), 0u);
+
+    auto slots = store.find(mk);
+
+    ASSERT_NE(slots, nullptr);
+    EXPECT_EQ(slots->size(), 2u);
+
+    // slots are sorted by attribute id
+
+    EXPECT_EQ(slots->getAttr(0)->id, SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION);
+    EXPECT_EQ(slots->getAttr(1)->id, SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID);
+
+    EXPECT_EQ(slots->get(SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID)->value.oid, 0x4000000000001);
+    EXPECT_EQ(slots->get(SAI_ROUTE_ENTRY_ATTR_META_DATA), nullptr);
+
+    attrs[0].value.oid = 0x4000000000002;
+
+    EXPECT_EQ(store.set(mk, &attrs[0]), SAI_STATUS_SUCCESS);
+    EXPECT_EQ(slots->size(), 2u);
+    EXPECT_EQ(slots->get(SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID)->value.oid, 0x4000000000002);
+
+    EXPECT_EQ(store.remove(mk), SAI_STATUS_SUCCESS);
+    EXPECT_EQ(store.remove(mk), SAI_STATUS_ITEM_NOT_FOUND);
+    EXPECT_EQ(store.set(mk, &attrs[0]), SAI_STATUS_ITEM_NOT_FOUND);
+    EXPECT_EQ(store.find(mk), nullptr);
+}
+
+class TypedObjectStoreSwitchTest : public ::testing::Test
+{
+public:
+    TypedObjectStoreSwitchTest() = default;
+    virtual ~TypedObjectStoreSwitchTest() = default;
+
+public:
+    virtual void SetUp() override
+    {
+        auto ccc = ContextConfigContainer::getDefault();
+        auto cc = ccc->get(0);
+        auto sc = cc->m_scc->getConfig(0);
+
+        m_ridmgr = std::make_shared<RealObjectIdManager>(cc->m_guid, cc->m_scc);
+        m_swid = m_ridmgr->allocateNewSwitchObjectId(saimeta::Globals::getHardwareInfo(0, nullptr));
+
+        auto legacyConfig = std::make_shared<SwitchConfig>(*sc);
+
+        legacyConfig->m_useTypedObjectStore = false;
+
+        m_legacy = std::make_shared<SwitchStateBase>(m_swid, m_ridmgr, legacyConfig);
+
+        auto typedConfig = std::make_shared<SwitchConfig>(*sc);
+
+        typedConfig->m_useTypedObjectStore = true;
+
+        m_typed = std::make_shared<SwitchStateBase>(m_swid, m_ridmgr, typedConfig);
+    }
+
+protected:
+    std::shared_ptr<RealObjectIdManager> m_ridmgr;
+    std::shared_ptr<SwitchStateBase> m_legacy;
+    std::shared_ptr<SwitchStateBase> m_typed;
+
+    sai_object_id_t m_swid = SAI_NULL_OBJECT_ID;
+};
+
+TEST_F(TypedObjectStoreSwitchTest, sameApiBehavior)
+{
+    auto sid = sai_serialize_route_entry(make_route_entry(m_swid, 1));
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION;
+    attr.value.s32 = SAI_PACKET_ACTION_DROP;
+
+    for (auto ss: {m_legacy, m_typed})
+    {
+        EXPECT_EQ(ss->create(SAI_OBJECT_TYPE_ROUTE_ENTRY, sid, m_swid, 1, &attr), SAI_STATUS_SUCCESS);
+        EXPECT_EQ(ss->create(SAI_OBJECT_TYPE_ROUTE_ENTRY, sid, m_swid, 1, &attr), SAI_STATUS_ITEM_ALREADY_EXISTS);
+
+        sai_attribute_t get;
+
+        get.id = SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION;
+
+        EXPECT_EQ(ss->get(SAI_OBJECT_TYPE_ROUTE_ENTRY, sid, 1, &get), SAI_STATUS_SUCCESS);
+        EXPECT_EQ(get.value.s32, SAI_PACKET_ACTION_DROP);
+
+        get.id = SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID;
+
+        EXPECT_EQ(ss->get(SAI_OBJECT_TYPE_ROUTE_ENTRY, sid, 1, &get), SAI_STATUS_NOT_IMPLEMENTED);
+
+        get.id = SAI_ROUTE_ENTRY_ATTR_END;
+
+        EXPECT_EQ(ss->get(SAI_OBJECT_TYPE_ROUTE_ENTRY, sid, 1, &get), SAI_STATUS_FAILURE);
+
+        sai_attribute_t set;
+
+        set.id = SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION;
+        set.value.s32 = SAI_PACKET_ACTION_FORWARD;
+
+        EXPECT_EQ(ss->set(SAI_OBJECT_TYPE_ROUTE_ENTRY, sid, &set), SAI_STATUS_SUCCESS);
+
+        get.id = SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION;
+
+        EXPECT_EQ(ss->get(SAI_OBJECT_TYPE_ROUTE_ENTRY, sid, 1, &get), SAI_STATUS_SUCCESS);
+        EXPECT_EQ(get.value.s32, SAI_PACKET_ACTION_FORWARD);
+
+        EXPECT_EQ(ss->remove(SAI_OBJECT_TYPE_ROUTE_ENTRY, sid), SAI_STATUS_SUCCESS);
+        EXPECT_EQ(ss->remove(SAI_OBJECT_TYPE_ROUTE_ENTRY, sid), SAI_STATUS_ITEM_NOT_FOUND);
+        EXPECT_EQ(ss->get(SAI_OBJECT_TYPE_ROUTE_ENTRY, sid, 1, &get), SAI_STATUS_ITEM_NOT_FOUND);
+    }
+
+    EXPECT_EQ(m_typed->m_objectHash.at(SAI_OBJECT_TYPE_ROUTE_ENTRY).size(), 0u);
+}
+
+TEST_F(TypedObjectStoreSwitchTest, entryApi)
+{
+    sai_object_meta_key_t metaKey;
+
+    metaKey.objecttype = SAI_OBJECT_TYPE_ROUTE_ENTRY;
+    metaKey.objectkey.key.route_entry = make_route_entry(m_swid, 3);
+
+    auto sid = sai_serialize_route_entry(metaKey.objectkey.key.route_entry);
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION;
+    attr.value.s32 = SAI_PACKET_ACTION_DROP;
+
+    for (auto ss: {m_legacy, m_typed})
+    {
+        EXPECT_EQ(ss->createEntry(metaKey, m_swid, 1, &attr), SAI_STATUS_SUCCESS);
+        EXPECT_EQ(ss->createEntry(metaKey, m_swid, 1, &attr), SAI_STATUS_ITEM_ALREADY_EXISTS);
+
+        // entry created by meta key is visible to string api
+
+        sai_attribute_t get;
+
+        get.id = SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION;
+
+        EXPECT_EQ(ss->get(SAI_OBJECT_TYPE_ROUTE_ENTRY, sid, 1, &get), SAI_STATUS_SUCCESS);
+        EXPECT_EQ(get.value.s32, SAI_PACKET_ACTION_DROP);
+
+        sai_attribute_t set;
+
+        set.id = SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION;
+        set.value.s32 = SAI_PACKET_ACTION_FORWARD;
+
+        EXPECT_EQ(ss->setEntry(metaKey, &set), SAI_STATUS_SUCCESS);
+
+        EXPECT_EQ(ss->getEntry(metaKey, 1, &get), SAI_STATUS_SUCCESS);
+        EXPECT_EQ(get.value.s32, SAI_PACKET_ACTION_FORWARD);
+
+        EXPECT_EQ(ss->removeEntry(metaKey), SAI_STATUS_SUCCESS);
+        EXPECT_EQ(ss->removeEntry(metaKey), SAI_STATUS_ITEM_NOT_FOUND);
+        EXPECT_EQ(ss->getEntry(metaKey, 1, &get), SAI_STATUS_ITEM_NOT_FOUND);
+        EXPECT_EQ(ss->setEntry(metaKey, &set), SAI_STATUS_ITEM_NOT_FOUND);
+    }
+
+    EXPECT_EQ(m_typed->m_objectHash.at(SAI_OBJECT_TYPE_ROUTE_ENTRY).size(), 0u);
+}
+
+TEST_F(TypedObjectStoreSwitchTest, warmBootDump)
+{
+    auto sid = sai_serialize_route_entry(make_route_entry(m_swid, 7));
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION;
+    attr.value.s32 = SAI_PACKET_ACTION_DROP;
+
+    EXPECT_EQ(m_legacy->create(SAI_OBJECT_TYPE_ROUTE_ENTRY, sid, m_swid, 1, &attr), SAI_STATUS_SUCCESS);
+    EXPECT_EQ(m_typed->create(SAI_OBJECT_TYPE_ROUTE_ENTRY, sid, m_swid, 1, &attr), SAI_STATUS_SUCCESS);
+
+    // typed store entries are dumped after object hash, so order may differ
+
+    auto lines = [](const std::string& dump) {
+
+        std::set<std::string> set;
+        std::istringstream iss(dump);
+        std::string line;
+
+        while (std::getline(iss, line))
+        {
+            set.insert(line);
+        }
+
+        return set;
+    };
+
+    EXPECT_EQ(lines(m_legacy->dump_switch_database_for_warm_restart()),
+            lines(m_typed->dump_switch_database_for_warm_restart()));
+}
+
+static double create_routes(
+        _In_ std::shared_ptr<SwitchStateBase> ss,
+        _In_ sai_object_id_t switchId,
+        _In_ uint32_t count)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<sai_object_meta_key_t> keys;
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        sai_object_meta_key_t metaKey;
+
+        metaKey.objecttype = SAI_OBJECT_TYPE_ROUTE_ENTRY;
+        metaKey.objectkey.key.route_entry = make_route_entry(switchId, i);
+
+        keys.push_back(metaKey);
+    }
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID;
+    attr.value.oid = 0x4000000000001;
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    // same path as VirtualSwitchSaiInterface route api
+
+    for (auto& metaKey: keys)
+    {
+        EXPECT_EQ(ss->createEntry(metaKey, switchId, 1, &attr), SAI_STATUS_SUCCESS);
+    }
+
+    for (auto& metaKey: keys)
+    {
+        sai_attribute_t get;
+
+        get.id = SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID;
+
+        EXPECT_EQ(ss->getEntry(metaKey, 1, &get), SAI_STATUS_SUCCESS);
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+
+    return (double)std::chrono::duration_cast<std::chrono::microseconds>(end - start).count() / 1000;
+}
+
+TEST_F(TypedObjectStoreSwitchTest, routeScale)
+{
+    uint32_t count = 1000000;
+
+    if (getenv("TEST_NO_PERF"))
+    {
+        count = 1000;
+
+        std::cout << "disabling performance tests" << std::endl;
+    }
+
+    auto legacy = create_routes(m_legacy, m_swid, count);
+    auto typed = create_routes(m_typed, m_swid, count);
+
+    EXPECT_EQ(m_legacy->m_objectHash.at(SAI_OBJECT_TYPE_ROUTE_ENTRY).size(), count);
+    EXPECT_EQ(m_typed->m_typedObjectStore.size(SAI_OBJECT_TYPE_ROUTE_ENTRY), count);
+
+    std::cout << "create+get " << count << " routes, legacy ms: " << legacy << ", typed ms: " << typed << std::endl;
+}
@@ -164,6 +164,116 @@ TEST_F(VirtualSwitchSaiInterfaceTest, bulkGet)
                 statuses.data()));
 }
 
+TEST_F(VirtualSwitchSaiInterfaceTest, bulkGetClearStats)
+{
+    sai_attribute_t attr;
+
+    attr.id = SAI_SWITCH_ATTR_PORT_NUMBER;
+    EXPECT_EQ(m_vssai->get(SAI_OBJECT_TYPE_SWITCH, m_swid, 1, &attr), SAI_STATUS_SUCCESS);
+
+    auto portNum = attr.value.u32;
+
+    std::vector<sai_object_id_t> oids(portNum);
+
+    attr.id = SAI_SWITCH_ATTR_PORT_LIST;
+    attr.value.objlist.count = portNum;
+    attr.value.objlist.list = oids.data();
+    EXPECT_EQ(m_vssai->get(SAI_OBJECT_TYPE_SWITCH, m_swid, 1, &attr), SAI_STATUS_SUCCESS);
+
+    std::vector<sai_object_key_t> keys(portNum);
+    std::vector<sai_status_t> statuses(portNum, SAI_STATUS_FAILURE);
+
+    for (size_t i = 0; i < portNum; i++)
+    {
+        keys[i].key.object_id = oids[i];
+    }
+
+    sai_stat_id_t ids[] = { SAI_PORT_STAT_IF_IN_OCTETS, SAI_PORT_STAT_IF_OUT_OCTETS };
+
+    std::vector<uint64_t> counters(portNum * 2, 1);
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS,
+            m_vssai->bulkGetStats(
+                m_swid,
+                SAI_OBJECT_TYPE_PORT,
+                portNum,
+                keys.data(),
+                2,
+                ids,
+                SAI_STATS_MODE_BULK_READ,
+                statuses.data(),
+                counters.data()));
+
+    for (size_t i = 0; i < portNum; i++)
+    {
+        EXPECT_EQ(statuses[i], SAI_STATUS_SUCCESS);
+        EXPECT_EQ(counters[2 * i], 0);
+        EXPECT_EQ(counters[2 * i + 1], 0);
+    }
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS,
+            m_vssai->bulkClearStats(
+                m_swid,
+                SAI_OBJECT_TYPE_PORT,
+                portNum,
+                keys.data(),
+                2,
+                ids,
+                SAI_STATS_MODE_BULK_CLEAR,
+                statuses.data()));
+
+    EXPECT_EQ(SAI_STATUS_INVALID_PARAMETER,
+            m_vssai->bulkGetStats(
+                m_swid,
+                SAI_OBJECT_TYPE_PORT,
+                portNum,
+                keys.data(),
+                2,
+                ids,
+                SAI_STATS_MODE_BULK_CLEAR,
+                statuses.data(),
+                counters.data()));
+
+    EXPECT_EQ(SAI_STATUS_INVALID_PARAMETER,
+            m_vssai->bulkClearStats(
+                m_swid,
+                SAI_OBJECT_TYPE_PORT,
+                portNum,
+                keys.data(),
+                2,
+                ids,
+                SAI_STATS_MODE_BULK_READ,
+                statuses.data()));
+
+    // switch is taken from objects when switch id is not provided
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS,
+            m_vssai->bulkGetStats(
+                SAI_NULL_OBJECT_ID,
+                SAI_OBJECT_TYPE_PORT,
+                portNum,
+                keys.data(),
+                2,
+                ids,
+                SAI_STATS_MODE_BULK_READ,
+                statuses.data(),
+                counters.data()));
+
+    // switch which don't exist
+
+    EXPECT_EQ(SAI_STATUS_FAILURE,
+            m_vssai->bulkGetStats(
+                oids[0],
+                SAI_OBJECT_TYPE_PORT,
+                portNum,
+                keys.data(),
+                2,
+                ids,
+                SAI_STATS_MODE_BULK_READ,
+                statuses.data(),
+                counters.data()));
+}
+
 TEST_F(VirtualSwitchSaiInterfaceTest, queryStatsCapability)
 {
     std::vector<sai_stat_capability_t> capability_list;
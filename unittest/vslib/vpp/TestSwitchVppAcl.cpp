@@ -0,0 +1,330 @@
+#include "VppXlateStub.h"
+
+#include "SwitchVpp.h"
+#include "RealObjectIdManager.h"
+#include "ContextConfigContainer.h"
+
+#include "Globals.h"
+#include "sai_serialize.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+
+using namespace saivs;
+
+class SwitchVppAclTest : public ::testing::Test
+{
+    public:
+
+        static void SetUpTestCase()
+        {
+            SWSS_LOG_ENTER();
+
+            auto ccc = ContextConfigContainer::getDefault();
+            auto cc = ccc->get(0);
+
+            auto sc = std::make_shared<SwitchConfig>(*cc->m_scc->getConfig(0));
+
+            sc->m_switchType = SAI_VS_SWITCH_TYPE_VPP;
+
+            s_ridmgr = std::make_shared<RealObjectIdManager>(cc->m_guid, cc->m_scc);
+            s_swid = s_ridmgr->allocateNewSwitchObjectId(saimeta::Globals::getHardwareInfo(0, nullptr));
+
+            s_vpp = std::make_shared<SwitchVpp>(s_swid, s_ridmgr, sc);
+        }
+
+        static void TearDownTestCase()
+        {
+            SWSS_LOG_ENTER();
+
+            // events thread is not stopped by SwitchVpp destructor
+
+            s_vpp->m_run_vpp_events_thread = false;
+            s_vpp->m_vpp_thread->join();
+
+            s_vpp = nullptr;
+        }
+
+        void SetUp() override
+        {
+            SWSS_LOG_ENTER();
+
+            VppXlateStub::reset();
+        }
+
+    protected:
+
+        sai_object_id_t createTable()
+        {
+            SWSS_LOG_ENTER();
+
+            auto tbl = s_ridmgr->allocateNewObjectId(SAI_OBJECT_TYPE_ACL_TABLE, s_swid);
+
+            sai_attribute_t attr;
+
+            attr.id = SAI_ACL_TABLE_ATTR_ACL_STAGE;
+            attr.value.s32 = SAI_ACL_STAGE_INGRESS;
+
+            EXPECT_EQ(s_vpp->create(SAI_OBJECT_TYPE_ACL_TABLE, sai_serialize_object_id(tbl), s_swid, 1, &attr), SAI_STATUS_SUCCESS);
+
+            VppXlateStub::reset();
+
+            return tbl;
+        }
+
+        std::vector<std::string> makeEntries(
+                _In_ uint32_t count)
+        {
+            SWSS_LOG_ENTER();
+
+            std::vector<std::string> sids;
+
+            for (uint32_t i = 0; i < count; i++)
+            {
+                sids.push_back(sai_serialize_object_id(s_ridmgr->allocateNewObjectId(SAI_OBJECT_TYPE_ACL_ENTRY, s_swid)));
+            }
+
+            return sids;
+        }
+
+        std::vector<std::vector<sai_attribute_t>> makeAttrs(
+                _In_ sai_object_id_t tbl,
+                _In_ uint32_t count)
+        {
+            SWSS_LOG_ENTER();
+
+            std::vector<std::vector<sai_attribute_t>> attrs(count, std::vector<sai_attribute_t>(4));
+
+            for (uint32_t i = 0; i < count; i++)
+            {
+                auto& a = attrs[i];
+
+                a[0].id = SAI_ACL_ENTRY_ATTR_TABLE_ID;
+                a[0].value.oid = tbl;
+
+                a[1].id = SAI_ACL_ENTRY_ATTR_PRIORITY;
+                a[1].value.u32 = i;
+
+                a[2].id = SAI_ACL_ENTRY_ATTR_ACTION_PACKET_ACTION;
+                a[2].value.aclaction.enable = true;
+                a[2].value.aclaction.parameter.s32 = SAI_PACKET_ACTION_DROP;
+
+                a[3].id = SAI_ACL_ENTRY_ATTR_FIELD_L4_DST_PORT;
+                a[3].value.aclfield.enable = true;
+                a[3].value.aclfield.data.u16 = (uint16_t)i;
+                a[3].value.aclfield.mask.u16 = 0xffff;
+            }
+
+            return attrs;
+        }
+
+        sai_status_t bulkCreate(
+                _In_ sai_object_id_t tbl,
+                _In_ const std::vector<std::string>& sids,
+                _Out_ std::vector<sai_status_t>& statuses)
+        {
+            SWSS_LOG_ENTER();
+
+            uint32_t count = (uint32_t)sids.size();
+
+            auto attrs = makeAttrs(tbl, count);
+
+            std::vector<uint32_t> attrCounts(count, 4);
+            std::vector<const sai_attribute_t*> attrLists;
+
+            for (auto& a: attrs)
+            {
+                attrLists.push_back(a.data());
+            }
+
+            statuses.resize(count);
+
+            return s_vpp->bulkCreate(s_swid, SAI_OBJECT_TYPE_ACL_ENTRY, sids, attrCounts.data(), attrLists.data(),
+                    SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses.data());
+        }
+
+    protected:
+
+        static std::shared_ptr<RealObjectIdManager> s_ridmgr;
+
+        static sai_object_id_t s_swid;
+
+        static std::shared_ptr<SwitchVpp> s_vpp;
+};
+
+std::shared_ptr<RealObjectIdManager> SwitchVppAclTest::s_ridmgr;
+sai_object_id_t SwitchVppAclTest::s_swid = SAI_NULL_OBJECT_ID;
+std::shared_ptr<SwitchVpp> SwitchVppAclTest::s_vpp;
+
+TEST_F(SwitchVppAclTest, bulkCreateRemoveProgramsTableOnce)
+{
+    auto tbl = createTable();
+
+    auto sids = makeEntries(16);
+
+    std::vector<sai_status_t> statuses;
+
+    EXPECT_EQ(bulkCreate(tbl, sids, statuses), SAI_STATUS_SUCCESS);
+
+    for (auto s: statuses)
+    {
+        EXPECT_EQ(s, SAI_STATUS_SUCCESS);
+    }
+
+    EXPECT_EQ(VppXlateStub::m_aclAddReplaceCalls, 1u);
+    EXPECT_EQ(VppXlateStub::m_aclLastRulesCount, 16u);
+    EXPECT_TRUE(s_vpp->m_acl_tbl_dirty_set.empty());
+
+    VppXlateStub::reset();
+
+    std::vector<std::string> removed(sids.begin(), sids.begin() + 10);
+
+    EXPECT_EQ(s_vpp->bulkRemove(SAI_OBJECT_TYPE_ACL_ENTRY, removed, SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses.data()), SAI_STATUS_SUCCESS);
+
+    EXPECT_EQ(VppXlateStub::m_aclAddReplaceCalls, 1u);
+    EXPECT_EQ(VppXlateStub::m_aclLastRulesCount, 6u);
+}
+
+TEST_F(SwitchVppAclTest, bulkSetProgramsTableOnce)
+{
+    auto tbl = createTable();
+
+    auto sids = makeEntries(8);
+
+    std::vector<sai_status_t> statuses;
+
+    EXPECT_EQ(bulkCreate(tbl, sids, statuses), SAI_STATUS_SUCCESS);
+
+    VppXlateStub::reset();
+
+    std::vector<sai_attribute_t> attrs(sids.size());
+
+    for (auto& a: attrs)
+    {
+        a.id = SAI_ACL_ENTRY_ATTR_ACTION_PACKET_ACTION;
+        a.value.aclaction.enable = true;
+        a.value.aclaction.parameter.s32 = SAI_PACKET_ACTION_FORWARD;
+    }
+
+    EXPECT_EQ(s_vpp->bulkSet(SAI_OBJECT_TYPE_ACL_ENTRY, sids, attrs.data(), SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses.data()), SAI_STATUS_SUCCESS);
+
+    EXPECT_EQ(VppXlateStub::m_aclAddReplaceCalls, 1u);
+    EXPECT_EQ(VppXlateStub::m_aclLastRulesCount, 8u);
+}
+
+TEST_F(SwitchVppAclTest, deferredProgrammingFailure)
+{
+    auto tbl = createTable();
+
+    auto sids = makeEntries(4);
+
+    std::vector<sai_status_t> statuses;
+
+    VppXlateStub::m_aclAddReplaceStatus = -1;
+
+    EXPECT_EQ(bulkCreate(tbl, sids, statuses), SAI_STATUS_FAILURE);
+
+    // pending table programming failure is returned by operations which
+    // depend on it
+
+    s_vpp->m_acl_tbl_dirty_set.insert(tbl);
+
+    auto grp = s_ridmgr->allocateNewObjectId(SAI_OBJECT_TYPE_ACL_TABLE_GROUP, s_swid);
+
+    EXPECT_EQ(s_vpp->aclBindUnbindPorts(grp, tbl, true), SAI_STATUS_FAILURE);
+
+    VppXlateStub::m_aclAddReplaceStatus = 0;
+
+    s_vpp->m_acl_tbl_dirty_set.insert(tbl);
+
+    EXPECT_EQ(s_vpp->aclBindUnbindPorts(grp, tbl, true), SAI_STATUS_SUCCESS);
+}
+
+TEST_F(SwitchVppAclTest, bulkSetThrowEndsDeferral)
+{
+    auto tbl = createTable();
+
+    auto sids = makeEntries(2);
+
+    std::vector<sai_status_t> statuses;
+
+    EXPECT_EQ(bulkCreate(tbl, sids, statuses), SAI_STATUS_SUCCESS);
+
+    VppXlateStub::reset();
+
+    // second object id can't be deserialized, first entry is already changed
+
+    sids[1] = "oid:invalid";
+
+    std::vector<sai_attribute_t> attrs(sids.size());
+
+    for (auto& a: attrs)
+    {
+        a.id = SAI_ACL_ENTRY_ATTR_ACTION_PACKET_ACTION;
+        a.value.aclaction.enable = true;
+        a.value.aclaction.parameter.s32 = SAI_PACKET_ACTION_FORWARD;
+    }
+
+    EXPECT_ANY_THROW(s_vpp->bulkSet(SAI_OBJECT_TYPE_ACL_ENTRY, sids, attrs.data(), SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses.data()));
+
+    EXPECT_FALSE(s_vpp->m_acl_tbl_config_deferred);
+    EXPECT_TRUE(s_vpp->m_acl_tbl_dirty_set.empty());
+    EXPECT_EQ(VppXlateStub::m_aclAddReplaceCalls, 1u);
+}
+
+TEST_F(SwitchVppAclTest, bulkCreateScale)
+{
+    uint32_t count = 4096;
+
+    if (getenv("TEST_NO_PERF"))
+    {
+        count = 256;
+
+        std::cout << "disabling performance tests" << std::endl;
+    }
+
+    // single creates rebuild whole table on each entry
+
+    auto singleTbl = createTable();
+
+    auto singleSids = makeEntries(count);
+
+    auto attrs = makeAttrs(singleTbl, count);
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        EXPECT_EQ(s_vpp->create(SAI_OBJECT_TYPE_ACL_ENTRY, singleSids[i], s_swid, 4, attrs[i].data()), SAI_STATUS_SUCCESS);
+    }
+
+    auto singleMs = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - start).count();
+
+    auto singleCalls = VppXlateStub::m_aclAddReplaceCalls;
+    auto singleRules = VppXlateStub::m_aclRulesProgrammed;
+
+    EXPECT_EQ(singleCalls, count);
+
+    auto bulkTbl = createTable();
+
+    auto bulkSids = makeEntries(count);
+
+    std::vector<sai_status_t> statuses;
+
+    start = std::chrono::high_resolution_clock::now();
+
+    EXPECT_EQ(bulkCreate(bulkTbl, bulkSids, statuses), SAI_STATUS_SUCCESS);
+
+    auto bulkMs = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - start).count();
+
+    EXPECT_EQ(VppXlateStub::m_aclAddReplaceCalls, 1u);
+    EXPECT_EQ(VppXlateStub::m_aclRulesProgrammed, count);
+
+    std::cout << "create " << count << " ACL entries"
+        << ", single: " << singleMs << " ms, " << singleCalls << " VPP ACL updates, " << singleRules << " rules"
+        << ", bulk: " << bulkMs << " ms, " << VppXlateStub::m_aclAddReplaceCalls << " VPP ACL updates, "
+        << VppXlateStub::m_aclRulesProgrammed << " rules" << std::endl;
+}
@@ -0,0 +1,496 @@
+#include "VppXlateStub.h"
+
+#include "swss/logger.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "vppxlate/SaiVppXlate.h"
+#include "vppxlate/SaiAclStats.h"
+#include "vppxlate/SaiVppStats.h"
+#include "vppxlate/SaiIntfStats.h"
+
+size_t VppXlateStub::m_aclAddReplaceCalls = 0;
+uint64_t VppXlateStub::m_aclRulesProgrammed = 0;
+uint32_t VppXlateStub::m_aclLastRulesCount = 0;
+int VppXlateStub::m_aclAddReplaceStatus = 0;
+
+static uint32_t g_aclIndex = 0;
+
+void VppXlateStub::reset()
+{
+    SWSS_LOG_ENTER();
+
+    m_aclAddReplaceCalls = 0;
+    m_aclRulesProgrammed = 0;
+    m_aclLastRulesCount = 0;
+    m_aclAddReplaceStatus = 0;
+}
+
+extern "C" {
+
+vpp_event_info_t *vpp_ev_dequeue(void)
+{
+    SWSS_LOG_ENTER();
+
+    return NULL;
+}
+
+void vpp_ev_free(vpp_event_info_t *evp)
+{
+    SWSS_LOG_ENTER();
+
+    free(evp);
+}
+
+int init_vpp_client(void)
+{
+    SWSS_LOG_ENTER();
+
+    return 0;
+}
+
+int refresh_interfaces_list(void)
+{
+    SWSS_LOG_ENTER();
+
+    return 0;
+}
+
+int configure_lcp_interface(const char *hwif_name, const char *hostif_name, bool is_add)
+{
+    SWSS_LOG_ENTER();
+
+    return 0;
+}
+
+int create_loopback_instance(const char *hwif_name, uint32_t instance)
+{
+    SWSS_LOG_ENTER();
+
+    return 0;
+}
+
+int delete_loopback(const char *hwif_name, uint32_t instance)
+{
+    SWSS_LOG_ENTER();
+
+    return 0;
+}
+
+int get_sw_if_idx(const char *ifname)
+{
+    SWSS_LOG_ENTER();
+
+    return 0;
+}
+
+int create_sub_interface(const char *hwif_name, uint32_t sub_id, uint16_t vlan_id)
+{
+    SWSS_LOG_ENTER();
+
+    return 0;
+}
+
+int delete_sub_interface(const char *hwif_name, uint32_t sub_id)
+{
+    SWSS_LOG_ENTER();
+
+    return 0;
+}
+
+int set_interface_vrf(const char *hwif_name, uint32_t sub_id, uint32_t vrf_id, bool is_ipv6)
+{
+    SWSS_LOG_ENTER();
+
+    return 0;
+}
+
+int interface_ip_address_add_del(const char *hw_ifname, vpp_ip_route_t *prefix, bool is_add)
+{
+    SWSS_LOG_ENTER();
+
+    return 0;
+}
+
+int interface_set_state(const char *hwif_name, bool is_up)
+{
+    SWSS_LOG_ENTER();
+
+    return 0;
+}
+
+int hw_interface_set_mtu(const char *hwif_name, uint32_t mtu)
+{
+    SWSS_LOG_ENTER();
+
+    return 0;
+}
+
+int sw_interface_set_mtu(const char *hwif_name, uint32_t mtu)
+{
+    SWSS_LOG_ENTER();
+
+    return 0;
+}
+
+int sw_interface_set_mac(const char *hwif_name, uint8_t *mac_address)
+{
+    SWSS_LOG_ENTER();
+
+    return 0;
+}
+
+int sw_interface_ip6_enable_disable(const char *hwif_name, bool enable)
+{
+    SWSS_LOG_ENTER();
+
+    return 0;
+}
+
+int ip_vrf_add(uint32_t vrf_id, const char *vrf_name, bool is_ipv6)
+{
+    SWSS_LOG_ENTER();
+
+    return 0;
+}
+
+int ip_vrf_del(uint32_t vrf_id, const char *vrf_name, bool is_ipv6)
+{
+    SWSS_LOG_ENTER();
+
+    return 0;
+}
+
+int ip4_nbr_add_del(const char *hwif_name, uint32_t sw_if_index, struct sockaddr_in *addr, bool is_static, bool no_fib_entry, uint8_t *mac, bool is_add)
+{
+    SWSS_LOG_ENTER();
+
+    return 0;
+}
+
+int ip6_nbr_add_del(const char *hwif_name, uint32_t sw_if_index, struct sockaddr_in6 *addr, bool is_static, bool no_fib_entry, uint8_t *mac, bool is_add)
+{
+    SWSS_LOG_ENTER();
+
+    return 0;
+}
+
+int ip_route_add_del(vpp_ip_route_t *prefix, bool is_add)
+{
+    SWSS_LOG_ENTER();
+
+    return 0;
+}
+
+int vpp_ip_flow_hash_set(uint32_t vrf_id, uint32_t mask, int addr_family)
+{
+    SWSS_LOG_ENTER();
+
+    return 0;
+}
+
+int vpp_acl_add_replace(vpp_acl_t *in_acl, uint32_t *acl_index, bool is_replace)
+{
+    SWSS_LOG_ENTER();
+
+    VppXlateStub::m_aclAddReplaceCalls++;
+    VppXlateStub::m_aclRulesProgrammed += in_acl->count;
+    VppXlateStub::m_aclLastRulesCount = in_acl->count;
+
+    if (VppXlateStub::m_aclAddReplaceStatus)
+    {
+        return VppXlateStub::m_aclAddReplaceStatus;
+    }
+
+    if (!is_replace)
+    {
+        *acl_index = g_aclIndex++;
+    }
+
+    return 0;
+}
+
+int vpp_acl_del(uint32_t acl_index)
+{
+    SWSS_LOG_ENTER();
+
+    return 0;
+}
+
+int vpp_acl_interface_bind(const char *hwif_name, uint32_t acl_index, bool is_input)
+{
+    SWSS_LOG_ENTER();
+
+    return 0;
+}
+
+int vpp_acl_interface_unbind(const char *hwif_name, uint32_t acl_index, bool is_input)
+{
+    SWSS_LOG_ENTER();
+
+    return 0;
+}
+
+int vpp_tunterm_acl_add_replace(uint32_t *tunterm_index, uint32_t count, vpp_tunterm_acl_t *acl)
+{
+    SWSS_LOG_ENTER();
+
+    *tunterm_index = g_aclIndex++;
+
+    return 0;
+}
+
+int vpp_tunterm_acl_del(uint32_t tunterm_index)
+{
+    SWSS_LOG_ENTER();
+
+    return 0;
+}
+
+int vpp_tunterm_acl_interface_add_del(uint32_t tunterm_index, bool is_bind, const char *hwif_name)
+{
+    SWSS_LOG_ENTER();
+
+    return 0;
+}
+
+int interface_get_state(const char *hwif_name, bool *link_is_up)
+{
+    SWSS_LOG_ENTER();
+
+    *link_is_up = true;
+
+    return 0;
+}
+
+int vpp_sync_for_events(void)
+{
+    SWSS_LOG_ENTER();
+
+    return 0;
+}
+
+int vpp_bridge_domain_add_del(uint32_t bridge_id, bool is_add)
+{
+    SWSS_LOG_ENTER();
+
+    return 0;
+}
+
+int set_sw_interface_l2_bridge(const char *hwif_name, uint32_t bridge_id, bool l2_enable, uint32_t port_type)
+{
+    SWSS_LOG_ENTER();
+
+    return 0;
+}
+
+int set_sw_interface_l2_bridge_by_index(uint32_t sw_if_index, uint32_t bridge_id, bool l2_enable, uint32_t port_type)
+{
+    SWSS_LOG_ENTER();
+
+    return 0;
+}
+
+int set_l2_interface_vlan_tag_rewrite(const char *hwif_name, uint32_t tag1, uint32_t tag2, uint32_t push_dot1q, uint32_t vtr_op)
+{
+    SWSS_LOG_ENTER();
+
+    return 0;
+}
+
+int bridge_domain_get_member_count(uint32_t bd_id, uint32_t *member_count)
+{
+    SWSS_LOG_ENTER();
+
+    *member_count = 0;
+
+    return 0;
+}
+
+int create_bvi_interface(uint8_t *mac_address, uint32_t instance)
+{
+    SWSS_LOG_ENTER();
+
+    return 0;
+}
+
+int delete_bvi_interface(const char *hwif_name)
+{
+    SWSS_LOG_ENTER();
+
+    return 0;
+}
+
+int set_bridge_domain_flags(uint32_t bd_id, vpp_bd_flags_t flag, bool enable)
+{
+    SWSS_LOG_ENTER();
+
+    return 0;
+}
+
+int create_bond_interface(uint32_t bond_id, uint32_t mode, uint32_t lb, uint32_t *swif_idx)
+{
+    SWSS_LOG_ENTER();
+
+    *swif_idx = 0;
+
+    return 0;
+}
+
+int delete_bond_interface(const char *hwif_name)
+{
+    SWSS_LOG_ENTER();
+
+    return 0;
+}
+
+int create_bond_member(uint32_t bond_sw_if_index, const char *hwif_name, bool is_passive, bool is_long_timeout)
+{
+    SWSS_LOG_ENTER();
+
+    return 0;
+}
+
+int delete_bond_member(const char *hwif_name)
+{
+    SWSS_LOG_ENTER();
+
+    return 0;
+}
+
+const char *vpp_get_swif_name(const uint32_t swif_idx)
+{
+    SWSS_LOG_ENTER();
+
+    return NULL;
+}
+
+int l2fib_add_del(const char *hwif_name, const uint8_t *mac, uint32_t bd_id, bool is_add, bool is_static_mac)
+{
+    SWSS_LOG_ENTER();
+
+    return 0;
+}
+
+int l2fib_flush_all(void)
+{
+    SWSS_LOG_ENTER();
+
+    return 0;
+}
+
+int l2fib_flush_int(const char *hwif_name)
+{
+    SWSS_LOG_ENTER();
+
+    return 0;
+}
+
+int l2fib_flush_bd(uint32_t bd_id)
+{
+    SWSS_LOG_ENTER();
+
+    return 0;
+}
+
+int bfd_udp_add(bool multihop, const char *hwif_name, vpp_ip_addr_t *local_addr, vpp_ip_addr_t *peer_addr, uint8_t detect_mult, uint32_t desired_min_tx, uint32_t required_min_rx)
+{
+    SWSS_LOG_ENTER();
+
+    return 0;
+}
+
+int bfd_udp_del(bool multihop, const char *hwif_name, vpp_ip_addr_t *local_addr, vpp_ip_addr_t *peer_addr)
+{
+    SWSS_LOG_ENTER();
+
+    return 0;
+}
+
+int vpp_vxlan_tunnel_add_del(vpp_vxlan_tunnel_t *tunnel, bool is_add, uint32_t *sw_if_index)
+{
+    SWSS_LOG_ENTER();
+
+    *sw_if_index = 0;
+
+    return 0;
+}
+
+int vpp_ip_addr_t_to_string(vpp_ip_addr_t *ip_addr, char *buffer, size_t maxlen)
+{
+    SWSS_LOG_ENTER();
+
+    if (maxlen)
+    {
+        buffer[0] = 0;
+    }
+
+    return 0;
+}
+
+int vpp_my_sid_entry_add_del(vpp_my_sid_entry_t *my_sid, bool is_del)
+{
+    SWSS_LOG_ENTER();
+
+    return 0;
+}
+
+int vpp_sidlist_add(vpp_sidlist_t *sidlist)
+{
+    SWSS_LOG_ENTER();
+
+    return 0;
+}
+
+int vpp_sidlist_del(vpp_ip_addr_t *bsid)
+{
+    SWSS_LOG_ENTER();
+
+    return 0;
+}
+
+int vpp_sr_steer_add_del(vpp_sr_steer_t *sr_steer, bool is_del)
+{
+    SWSS_LOG_ENTER();
+
+    return 0;
+}
+
+int vpp_sr_set_encap_source(vpp_ip_addr_t *encap_src)
+{
+    SWSS_LOG_ENTER();
+
+    return 0;
+}
+
+int vpp_acl_ace_stats_query(uint32_t acl_index, uint32_t ace_index, vpp_ace_stats_t *stats)
+{
+    SWSS_LOG_ENTER();
+
+    memset(stats, 0, sizeof(vpp_ace_stats_t));
+
+    stats->ace_index = ace_index;
+
+    return 0;
+}
+
+int vpp_stats_dump(char *query_path, vpp_stat_one one, vpp_stat_two two, void *data)
+{
+    SWSS_LOG_ENTER();
+
+    return 0;
+}
+
+int vpp_intf_stats_query(const char *intf_name, vpp_interface_stats_t *stats)
+{
+    SWSS_LOG_ENTER();
+
+    memset(stats, 0, sizeof(vpp_interface_stats_t));
+
+    return 0;
+}
+
+}
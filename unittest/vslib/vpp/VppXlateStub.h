@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * @brief Replacement of vppxlate used by SwitchVpp unit tests.
+ *
+ * All VPP API calls succeed without VPP running. ACL programming calls are
+ * counted, so tests can check how many times ACL tables were rebuilt.
+ */
+class VppXlateStub
+{
+    public:
+
+        static void reset();
+
+    public:
+
+        /**
+         * @brief Number of vpp_acl_add_replace calls.
+         */
+        static size_t m_aclAddReplaceCalls;
+
+        /**
+         * @brief Sum of rules passed to vpp_acl_add_replace.
+         */
+        static uint64_t m_aclRulesProgrammed;
+
+        /**
+         * @brief Rules count of last vpp_acl_add_replace call.
+         */
+        static uint32_t m_aclLastRulesCount;
+
+        /**
+         * @brief Value returned by vpp_acl_add_replace, 0 means success.
+         */
+        static int m_aclAddReplaceStatus;
+};
@@ -0,0 +1,343 @@
+#include "CounterStore.h"
+
+#include "swss/logger.h"
+
+#include <algorithm>
+#include <cstring>
+
+#define TRAFFIC_TIME_NONE (UINT64_MAX)
+
+#define NS_PER_SECOND (1000000000ULL)
+
+using namespace saivs;
+
+CounterStore::CounterStore():
+    m_packetsPerSecond(0),
+    m_packetSize(0)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+void CounterStore::setTrafficModel(
+        _In_ uint64_t packetsPerSecond,
+        _In_ uint32_t packetSize)
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_NOTICE("traffic model: %lu pps, packet size %u", packetsPerSecond, packetSize);
+
+    m_packetsPerSecond = packetsPerSecond;
+    m_packetSize = packetSize;
+}
+
+bool CounterStore::isTrafficModelEnabled() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_packetsPerSecond != 0;
+}
+
+uint64_t CounterStore::packetsAt(
+        _In_ uint64_t packetsPerSecond,
+        _In_ uint64_t timeNs)
+{
+    SWSS_LOG_ENTER();
+
+    // split seconds and remainder, so multiplication will not overflow
+
+    return packetsPerSecond * (timeNs / NS_PER_SECOND) +
+        packetsPerSecond * (timeNs % NS_PER_SECOND) / NS_PER_SECOND;
+}
+
+CounterStore::traffic_kind_t CounterStore::getTrafficKind(
+        _In_ sai_object_type_t objectType,
+        _In_ const char* statName)
+{
+    SWSS_LOG_ENTER();
+
+    if (objectType != SAI_OBJECT_TYPE_PORT &&
+            objectType != SAI_OBJECT_TYPE_QUEUE &&
+            objectType != SAI_OBJECT_TYPE_INGRESS_PRIORITY_GROUP)
+    {
+        return TRAFFIC_KIND_NONE;
+    }
+
+    // model clean traffic, errors, drops, pause frames and gauges stay at zero
+
+    static const char* excluded[] = {
+        "DROP", "DISCARD", "ERROR", "WATERMARK", "OCCUPANCY", "CURR",
+        "PFC", "PAUSE", "WRED", "ECN", "UNKNOWN", "FEC", "TIME", "DURATION",
+    };
+
+    for (auto* word: excluded)
+    {
+        if (strstr(statName, word))
+        {
+            return TRAFFIC_KIND_NONE;
+        }
+    }
+
+    // packet size bucket counters like PKTS_64_OCTETS are packet counters
+
+    if (strstr(statName, "PKTS") || strstr(statName, "PACKETS"))
+    {
+        return TRAFFIC_KIND_PACKETS;
+    }
+
+    if (strstr(statName, "OCTETS") || strstr(statName, "BYTES"))
+    {
+        return TRAFFIC_KIND_BYTES;
+    }
+
+    return TRAFFIC_KIND_NONE;
+}
+
+CounterStore::Matrix& CounterStore::getMatrix(
+        _In_ sai_object_type_t objectType)
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_matrices.find(objectType);
+
+    if (it != m_matrices.end())
+    {
+        return it->second;
+    }
+
+    auto& matrix = m_matrices[objectType];
+
+    matrix.m_width = 0;
+
+    auto info = sai_metadata_get_object_type_info(objectType);
+
+    if (info == nullptr || info->statenum == nullptr)
+    {
+        // all counters will end up in sparse map
+
+        return matrix;
+    }
+
+    auto statenum = info->statenum;
+
+    matrix.m_width = statenum->valuescount;
+
+    bool traffic = false;
+
+    std::vector<traffic_kind_t> kinds;
+
+    for (size_t idx = 0; idx < statenum->valuescount; idx++)
+    {
+        matrix.m_columns[(sai_stat_id_t)statenum->values[idx]] = idx;
+
+        auto kind = getTrafficKind(objectType, statenum->valuesnames[idx]);
+
+        traffic |= (kind != TRAFFIC_KIND_NONE);
+
+        kinds.push_back(kind);
+    }
+
+    if (traffic)
+    {
+        matrix.m_kinds = std::move(kinds);
+    }
+
+    return matrix;
+}
+
+size_t CounterStore::getRow(
+        _Inout_ Matrix& matrix,
+        _In_ sai_object_id_t objectId)
+{
+    SWSS_LOG_ENTER();
+
+    auto it = matrix.m_rows.find(objectId);
+
+    if (it != matrix.m_rows.end())
+    {
+        return it->second;
+    }
+
+    size_t row;
+
+    if (matrix.m_freeRows.size())
+    {
+        row = matrix.m_freeRows.back();
+
+        matrix.m_freeRows.pop_back();
+
+        std::fill_n(matrix.m_data.begin() + row * matrix.m_width, matrix.m_width, 0);
+
+        matrix.m_trafficNs[row] = TRAFFIC_TIME_NONE;
+    }
+    else
+    {
+        row = matrix.m_rows.size();
+
+        matrix.m_data.resize(matrix.m_data.size() + matrix.m_width, 0);
+
+        matrix.m_trafficNs.push_back(TRAFFIC_TIME_NONE);
+    }
+
+    matrix.m_rows[objectId] = row;
+
+    return row;
+}
+
+uint64_t& CounterStore::getCounter(
+        _Inout_ Matrix& matrix,
+        _In_ size_t row,
+        _In_ sai_object_id_t objectId,
+        _In_ sai_stat_id_t counterId)
+{
+    SWSS_LOG_ENTER();
+
+    auto it = matrix.m_columns.find(counterId);
+
+    if (it == matrix.m_columns.end())
+    {
+        return matrix.m_sparse[objectId][counterId];
+    }
+
+    return matrix.m_data[row * matrix.m_width + it->second];
+}
+
+void CounterStore::applyTraffic(
+        _Inout_ Matrix& matrix,
+        _In_ size_t row,
+        _In_ uint64_t timeNs)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_packetsPerSecond == 0 || matrix.m_kinds.empty())
+        return;
+
+    uint64_t& last = matrix.m_trafficNs[row];
+
+    if (last == TRAFFIC_TIME_NONE || timeNs <= last)
+    {
+        // traffic on object starts when its counters are first read
+
+        last = (last == TRAFFIC_TIME_NONE) ? timeNs : last;
+        return;
+    }
+
+    uint64_t packets = packetsAt(m_packetsPerSecond, timeNs) - packetsAt(m_packetsPerSecond, last);
+
+    last = timeNs;
+
+    if (packets == 0)
+        return;
+
+    uint64_t bytes = packets * m_packetSize;
+
+    uint64_t* data = matrix.m_data.data() + row * matrix.m_width;
+
+    for (size_t col = 0; col < matrix.m_width; col++)
+    {
+        switch (matrix.m_kinds[col])
+        {
+            case TRAFFIC_KIND_PACKETS:
+                data[col] += packets;
+                break;
+
+            case TRAFFIC_KIND_BYTES:
+                data[col] += bytes;
+                break;
+
+            default:
+                break;
+        }
+    }
+}
+
+void CounterStore::set(
+        _In_ sai_object_type_t objectType,
+        _In_ sai_object_id_t objectId,
+        _In_ uint32_t count,
+        _In_ const sai_stat_id_t* counterIds,
+        _In_ const uint64_t* counters)
+{
+    SWSS_LOG_ENTER();
+
+    auto& matrix = getMatrix(objectType);
+
+    size_t row = getRow(matrix, objectId);
+
+    for (uint32_t idx = 0; idx < count; idx++)
+    {
+        getCounter(matrix, row, objectId, counterIds[idx]) = counters[idx];
+    }
+}
+
+void CounterStore::get(
+        _In_ sai_object_type_t objectType,
+        _In_ sai_object_id_t objectId,
+        _In_ uint32_t count,
+        _In_ const sai_stat_id_t* counterIds,
+        _In_ bool clear,
+        _Out_ uint64_t* counters,
+        _In_ uint64_t timeNs)
+{
+    SWSS_LOG_ENTER();
+
+    auto& matrix = getMatrix(objectType);
+
+    size_t row = getRow(matrix, objectId);
+
+    applyTraffic(matrix, row, timeNs);
+
+    for (uint32_t idx = 0; idx < count; idx++)
+    {
+        uint64_t& counter = getCounter(matrix, row, objectId, counterIds[idx]);
+
+        if (counters)
+        {
+            counters[idx] = counter;
+        }
+
+        if (clear)
+        {
+            counter = 0;
+        }
+    }
+}
+
+void CounterStore::remove(
+        _In_ sai_object_type_t objectType,
+        _In_ sai_object_id_t objectId)
+{
+    SWSS_LOG_ENTER();
+
+    auto mit = m_matrices.find(objectType);
+
+    if (mit == m_matrices.end())
+        return;
+
+    auto& matrix = mit->second;
+
+    auto it = matrix.m_rows.find(objectId);
+
+    if (it == matrix.m_rows.end())
+        return;
+
+    matrix.m_freeRows.push_back(it->second);
+
+    matrix.m_rows.erase(it);
+
+    matrix.m_sparse.erase(objectId);
+}
+
+size_t CounterStore::getObjectCount(
+        _In_ sai_object_type_t objectType) const
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_matrices.find(objectType);
+
+    if (it == m_matrices.end())
+        return 0;
+
+    return it->second.m_rows.size();
+}
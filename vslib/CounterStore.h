@@ -0,0 +1,156 @@
+#pragma once
+
+extern "C" {
+#include "saimetadata.h"
+}
+
+#include <unordered_map>
+#include <vector>
+#include <map>
+
+namespace saivs
+{
+    /**
+     * @brief Counter store.
+     *
+     * Keeps object counters in dense per object type matrix, one row per
+     * object and one column per value of object type stat enum. Counter ids
+     * outside of stat enum are kept in sparse map.
+     *
+     * Optionally store can run deterministic traffic model, which advances
+     * packet and byte counters of ports, queues and priority groups at
+     * configured rate. Counters are advanced lazily when object row is
+     * accessed, so cost of traffic model is proportional to number of
+     * counters read, not to number of objects.
+     */
+    class CounterStore
+    {
+        private:
+
+            CounterStore(const CounterStore&) = delete;
+            CounterStore& operator=(const CounterStore&) = delete;
+
+        public:
+
+            CounterStore();
+
+            virtual ~CounterStore() = default;
+
+        public:
+
+            /**
+             * @brief Set traffic model rate in packets per second, 0 disables
+             * traffic model.
+             */
+            void setTrafficModel(
+                    _In_ uint64_t packetsPerSecond,
+                    _In_ uint32_t packetSize);
+
+            bool isTrafficModelEnabled() const;
+
+            void set(
+                    _In_ sai_object_type_t objectType,
+                    _In_ sai_object_id_t objectId,
+                    _In_ uint32_t count,
+                    _In_ const sai_stat_id_t* counterIds,
+                    _In_ const uint64_t* counters);
+
+            /**
+             * @brief Get counters, counters can be nullptr when only clear is
+             * requested. Time is used by traffic model and must be monotonic.
+             */
+            void get(
+                    _In_ sai_object_type_t objectType,
+                    _In_ sai_object_id_t objectId,
+                    _In_ uint32_t count,
+                    _In_ const sai_stat_id_t* counterIds,
+                    _In_ bool clear,
+                    _Out_ uint64_t* counters,
+                    _In_ uint64_t timeNs);
+
+            void remove(
+                    _In_ sai_object_type_t objectType,
+                    _In_ sai_object_id_t objectId);
+
+            size_t getObjectCount(
+                    _In_ sai_object_type_t objectType) const;
+
+        public:
+
+            /**
+             * @brief Number of packets sent at given rate after given time.
+             */
+            static uint64_t packetsAt(
+                    _In_ uint64_t packetsPerSecond,
+                    _In_ uint64_t timeNs);
+
+        private:
+
+            typedef enum _traffic_kind_t
+            {
+                TRAFFIC_KIND_NONE = 0,
+
+                TRAFFIC_KIND_PACKETS,
+
+                TRAFFIC_KIND_BYTES,
+
+            } traffic_kind_t;
+
+            struct Matrix
+            {
+                size_t m_width;
+
+                std::unordered_map<sai_stat_id_t, size_t> m_columns;
+
+                /**
+                 * @brief Traffic kind per column, empty if object type is
+                 * not advanced by traffic model.
+                 */
+                std::vector<traffic_kind_t> m_kinds;
+
+                std::unordered_map<sai_object_id_t, size_t> m_rows;
+
+                std::vector<size_t> m_freeRows;
+
+                std::vector<uint64_t> m_data;
+
+                /**
+                 * @brief Time up to which traffic model was applied, per row,
+                 * TRAFFIC_TIME_NONE if row was not yet read.
+                 */
+                std::vector<uint64_t> m_trafficNs;
+
+                std::unordered_map<sai_object_id_t, std::map<sai_stat_id_t, uint64_t>> m_sparse;
+            };
+
+            Matrix& getMatrix(
+                    _In_ sai_object_type_t objectType);
+
+            size_t getRow(
+                    _Inout_ Matrix& matrix,
+                    _In_ sai_object_id_t objectId);
+
+            uint64_t& getCounter(
+                    _Inout_ Matrix& matrix,
+                    _In_ size_t row,
+                    _In_ sai_object_id_t objectId,
+                    _In_ sai_stat_id_t counterId);
+
+            void applyTraffic(
+                    _Inout_ Matrix& matrix,
+                    _In_ size_t row,
+                    _In_ uint64_t timeNs);
+
+            static traffic_kind_t getTrafficKind(
+                    _In_ sai_object_type_t objectType,
+                    _In_ const char* statName);
+
+        private:
+
+            std::map<sai_object_type_t, Matrix> m_matrices;
+
+            uint64_t m_packetsPerSecond;
+
+            uint32_t m_packetSize;
+    };
+}
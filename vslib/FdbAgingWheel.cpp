@@ -0,0 +1,274 @@
+#include "FdbAgingWheel.h"
+
+#include "swss/logger.h"
+
+using namespace saivs;
+
+constexpr size_t FdbAgingWheel::DEFAULT_SLOT_COUNT;
+
+FdbAgingWheel::FdbAgingWheel(
+        _In_ size_t slotCount):
+    m_slots(slotCount),
+    m_agingTime(0),
+    m_lastTick(0),
+    m_started(false)
+{
+    SWSS_LOG_ENTER();
+
+    if (slotCount == 0)
+    {
+        SWSS_LOG_THROW("slot count must be positive");
+    }
+}
+
+uint64_t FdbAgingWheel::getKey(
+        _In_ const FdbInfo& fi)
+{
+    SWSS_LOG_ENTER();
+
+    // same key as FdbInfo::operator<, mac address and vlan id
+
+    uint64_t key = 0;
+
+    for (size_t i = 0; i < sizeof(sai_mac_t); i++)
+    {
+        key = (key << 8) | fi.m_fdbEntry.mac_address[i];
+    }
+
+    return key | ((uint64_t)fi.getVlanId() << 48);
+}
+
+void FdbAgingWheel::setAgingTime(
+        _In_ uint32_t agingTime)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_agingTime == agingTime)
+    {
+        return;
+    }
+
+    SWSS_LOG_NOTICE("fdb aging time changed %u -> %u", m_agingTime, agingTime);
+
+    m_agingTime = agingTime;
+
+    if (m_started)
+    {
+        rebuild();
+    }
+}
+
+uint32_t FdbAgingWheel::getAgingTime() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_agingTime;
+}
+
+void FdbAgingWheel::touch(
+        _In_ const FdbInfo& fi,
+        _In_ uint32_t timestamp)
+{
+    SWSS_LOG_ENTER();
+
+    auto key = getKey(fi);
+
+    auto it = m_entries.find(key);
+
+    if (it != m_entries.end())
+    {
+        // entry will be rescheduled when it's current slot will be reached
+
+        it->second.m_timestamp = timestamp;
+
+        return;
+    }
+
+    auto& entry = m_entries[key];
+
+    entry.m_fdbInfo = fi;
+    entry.m_timestamp = timestamp;
+    entry.m_scheduled = 0;
+
+    if (m_started)
+    {
+        schedule(key, entry);
+    }
+}
+
+void FdbAgingWheel::remove(
+        _In_ const FdbInfo& fi)
+{
+    SWSS_LOG_ENTER();
+
+    // slot reference will be dropped when slot will be processed
+
+    m_entries.erase(getKey(fi));
+}
+
+uint32_t FdbAgingWheel::getTimestamp(
+        _In_ const FdbInfo& fi) const
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_entries.find(getKey(fi));
+
+    if (it == m_entries.end())
+    {
+        return fi.getTimestamp();
+    }
+
+    return it->second.m_timestamp;
+}
+
+void FdbAgingWheel::schedule(
+        _In_ uint64_t key,
+        _Inout_ Entry& entry)
+{
+    SWSS_LOG_ENTER();
+
+    uint32_t when = entry.m_timestamp + m_agingTime;
+
+    if (when <= m_lastTick)
+    {
+        // already expired, process on next tick
+
+        when = m_lastTick + 1;
+    }
+
+    entry.m_scheduled = when;
+
+    m_slots[when % m_slots.size()].push_back(key);
+}
+
+void FdbAgingWheel::processSlot(
+        _In_ uint32_t tick,
+        _Inout_ std::vector<FdbInfo>& aged)
+{
+    SWSS_LOG_ENTER();
+
+    size_t index = tick % m_slots.size();
+
+    std::vector<uint64_t> keys;
+
+    keys.swap(m_slots[index]);
+
+    for (auto key: keys)
+    {
+        auto it = m_entries.find(key);
+
+        if (it == m_entries.end())
+        {
+            // entry was removed
+            continue;
+        }
+
+        auto& entry = it->second;
+
+        if (entry.m_scheduled % m_slots.size() != index)
+        {
+            // stale reference, entry was rescheduled to other slot
+            continue;
+        }
+
+        if (entry.m_scheduled > tick)
+        {
+            // entry is scheduled in one of next wheel rounds
+
+            m_slots[index].push_back(key);
+            continue;
+        }
+
+        if (entry.m_timestamp + m_agingTime <= tick)
+        {
+            aged.push_back(entry.m_fdbInfo);
+
+            m_entries.erase(it);
+            continue;
+        }
+
+        // entry was refreshed after it was scheduled
+
+        schedule(key, entry);
+    }
+}
+
+std::vector<FdbInfo> FdbAgingWheel::expire(
+        _In_ uint32_t now)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<FdbInfo> aged;
+
+    if (m_agingTime == 0)
+    {
+        // aging disabled, wheel will be rebuilt when aging is enabled again
+
+        m_started = false;
+
+        return aged;
+    }
+
+    if (!m_started)
+    {
+        m_started = true;
+        m_lastTick = now - 1;
+
+        rebuild();
+    }
+
+    if (now <= m_lastTick)
+    {
+        return aged;
+    }
+
+    if (now - m_lastTick > m_slots.size())
+    {
+        // each slot needs to be processed only once
+
+        m_lastTick = now - (uint32_t)m_slots.size();
+    }
+
+    for (uint32_t tick = m_lastTick + 1; tick <= now; tick++)
+    {
+        processSlot(tick, aged);
+    }
+
+    m_lastTick = now;
+
+    return aged;
+}
+
+void FdbAgingWheel::rebuild()
+{
+    SWSS_LOG_ENTER();
+
+    for (auto& slot: m_slots)
+    {
+        slot.clear();
+    }
+
+    for (auto& kvp: m_entries)
+    {
+        schedule(kvp.first, kvp.second);
+    }
+}
+
+size_t FdbAgingWheel::size() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_entries.size();
+}
+
+void FdbAgingWheel::clear()
+{
+    SWSS_LOG_ENTER();
+
+    m_entries.clear();
+
+    for (auto& slot: m_slots)
+    {
+        slot.clear();
+    }
+}
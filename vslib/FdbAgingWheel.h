@@ -0,0 +1,108 @@
+#pragma once
+
+#include "FdbInfo.h"
+
+#include <unordered_map>
+#include <vector>
+
+namespace saivs
+{
+    /**
+     * @brief FDB aging timer wheel.
+     *
+     * Hashed timer wheel with one second resolution keyed by FDB expire time.
+     * Refreshing entry timestamp on relearn is O(1) since entries are
+     * rescheduled lazily when their slot is reached, and each tick only
+     * touches entries scheduled in the slots that elapsed.
+     */
+    class FdbAgingWheel
+    {
+        public:
+
+            FdbAgingWheel(
+                    _In_ size_t slotCount = DEFAULT_SLOT_COUNT);
+
+            virtual ~FdbAgingWheel() = default;
+
+        public:
+
+            /**
+             * @brief Set aging time in seconds, zero disables aging.
+             *
+             * If aging time changed, all entries are rescheduled.
+             */
+            void setAgingTime(
+                    _In_ uint32_t agingTime);
+
+            uint32_t getAgingTime() const;
+
+            /**
+             * @brief Insert new entry or refresh timestamp of existing one.
+             */
+            void touch(
+                    _In_ const FdbInfo& fi,
+                    _In_ uint32_t timestamp);
+
+            void remove(
+                    _In_ const FdbInfo& fi);
+
+            /**
+             * @brief Get last seen timestamp of entry, or entry timestamp if
+             * entry is not present in the wheel.
+             */
+            uint32_t getTimestamp(
+                    _In_ const FdbInfo& fi) const;
+
+            /**
+             * @brief Advance wheel to current time and remove all aged entries.
+             *
+             * @return Aged entries.
+             */
+            std::vector<FdbInfo> expire(
+                    _In_ uint32_t now);
+
+            size_t size() const;
+
+            void clear();
+
+        public:
+
+            static uint64_t getKey(
+                    _In_ const FdbInfo& fi);
+
+            static constexpr size_t DEFAULT_SLOT_COUNT = 1024;
+
+        private:
+
+            struct Entry
+            {
+                FdbInfo m_fdbInfo;
+
+                uint32_t m_timestamp;
+
+                uint32_t m_scheduled;
+            };
+
+            void schedule(
+                    _In_ uint64_t key,
+                    _Inout_ Entry& entry);
+
+            void processSlot(
+                    _In_ uint32_t tick,
+                    _Inout_ std::vector<FdbInfo>& aged);
+
+            void rebuild();
+
+        private:
+
+            std::unordered_map<uint64_t, Entry> m_entries;
+
+            std::vector<std::vector<uint64_t>> m_slots;
+
+            uint32_t m_agingTime;
+
+            uint32_t m_lastTick;
+
+            bool m_started;
+    };
+}
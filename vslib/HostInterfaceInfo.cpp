@@ -62,6 +62,12 @@ HostInterfaceInfo::~HostInterfaceInfo()
         m_e2t->join();
     }
 
+    if (m_packetIoPool)
+    {
+        m_packetIoPool->remove(m_packet_socket);
+        m_packetIoPool->remove(m_tapfd);
+    }
+
     // remove tap device
 
     int err = close(m_tapfd);
@@ -89,6 +95,54 @@ void HostInterfaceInfo::runThreads()
     m_t2e = std::make_shared<std::thread>(&HostInterfaceInfo::tap2veth_fun, this);
 }
 
+bool HostInterfaceInfo::runPacketIoPool(
+        _In_ std::shared_ptr<PacketIoPool> pool)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_run_thread || m_packetIoPool)
+    {
+        SWSS_LOG_ERROR("forwarding for %s is already running", m_name.c_str());
+
+        return false;
+    }
+
+    // pool threads must never block on tap read
+
+    int flags = fcntl(m_tapfd, F_GETFL, 0);
+
+    if (flags < 0 || fcntl(m_tapfd, F_SETFL, flags | O_NONBLOCK) < 0)
+    {
+        SWSS_LOG_ERROR("failed to set O_NONBLOCK on tap fd %d for %s, errno(%d): %s",
+                m_tapfd, m_name.c_str(), errno, strerror(errno));
+
+        return false;
+    }
+
+    m_packetIoPool = pool;
+
+    if (!pool->add(m_packet_socket, std::bind(&HostInterfaceInfo::veth2tap_batch, this, std::placeholders::_1)) ||
+        !pool->add(m_tapfd, std::bind(&HostInterfaceInfo::tap2veth_batch, this, std::placeholders::_1)))
+    {
+        SWSS_LOG_ERROR("failed to add %s to packet I/O pool", m_name.c_str());
+
+        pool->remove(m_packet_socket);
+
+        m_packetIoPool = nullptr;
+
+        return false;
+    }
+
+    return true;
+}
+
+std::shared_ptr<PacketIoPool> HostInterfaceInfo::getPacketIoPool() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_packetIoPool;
+}
+
 void HostInterfaceInfo::async_process_packet_for_fdb_event(
         _In_ const uint8_t *data,
         _In_ size_t size) const
@@ -303,3 +357,120 @@ void HostInterfaceInfo::tap2veth_fun()
 
     SWSS_LOG_NOTICE("ending thread proc for %s", m_name.c_str());
 }
+
+bool HostInterfaceInfo::veth2tap_batch(
+        _Inout_ PacketBatch& batch)
+{
+    SWSS_LOG_ENTER();
+
+    int count = batch.receive(m_packet_socket);
+
+    if (count < 0)
+    {
+        if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)
+        {
+            return true;
+        }
+
+        if (errno != ENETDOWN)
+        {
+            SWSS_LOG_ERROR("failed to read from socket fd %d, errno(%d): %s",
+                    m_packet_socket, errno, strerror(errno));
+        }
+
+        return errno != EBADF;
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+        size_t length = batch.getLength(i);
+
+        if (length < sizeof(ethhdr))
+        {
+            SWSS_LOG_ERROR("invalid ethernet frame length: %zu", length);
+            continue;
+        }
+
+        unsigned char* buffer = batch.getBuffer(i);
+
+        // Buffer include the ingress packets
+        // MACsec scenario: EAPOL packets and encrypted packets
+        auto ret = m_e2tFilters.execute(buffer, length);
+
+        if (ret == TrafficFilter::TERMINATE)
+        {
+            continue;
+        }
+        else if (ret == TrafficFilter::ERROR)
+        {
+            // Error log should be recorded in filter
+            return false;
+        }
+
+        addVlanTag(buffer, length, batch.getMsg(i));
+
+        async_process_packet_for_fdb_event(buffer, length);
+
+        if (!sendTo(m_tapfd, buffer, length))
+        {
+            SWSS_LOG_NOTICE("ending packet I/O for %s", m_name.c_str());
+
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool HostInterfaceInfo::tap2veth_batch(
+        _Inout_ PacketBatch& batch)
+{
+    SWSS_LOG_ENTER();
+
+    int count = batch.read(m_tapfd);
+
+    if (count < 0)
+    {
+        if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)
+        {
+            return true;
+        }
+
+        SWSS_LOG_ERROR("failed to read from tapfd fd %d, errno(%d): %s",
+                m_tapfd, errno, strerror(errno));
+
+        return errno != EBADF;
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+        // Buffer include the egress packets
+        // MACsec scenario: EAPOL packets and plaintext packets
+        size_t length = batch.getLength(i);
+        auto ret = m_t2eFilters.execute(batch.getBuffer(i), length);
+
+        if (ret == TrafficFilter::TERMINATE)
+        {
+            continue;
+        }
+        else if (ret == TrafficFilter::ERROR)
+        {
+            // Error log should be recorded in filter, queue is shared by all
+            // descriptors serviced by thread so it must be drained
+
+            batch.flush(m_packet_socket);
+
+            return false;
+        }
+
+        batch.enqueue(i, length);
+    }
+
+    if (batch.flush(m_packet_socket) < 0 && errno != ENETDOWN)
+    {
+        SWSS_LOG_ERROR("failed to write to socket fd %d, errno(%d): %s",
+                m_packet_socket, errno, strerror(errno));
+    }
+
+    return true;
+}
@@ -7,6 +7,7 @@ extern "C" {
 #include "EventQueue.h"
 #include "TrafficFilterPipes.h"
 #include "TrafficForwarder.h"
+#include "PacketIoPool.h"
 
 #include "swss/selectableevent.h"
 
@@ -57,12 +58,27 @@ namespace saivs
 
             void runThreads();
 
+            /**
+             * @brief Forward frames using shared packet I/O pool instead of
+             * dedicated threads, frames are forwarded in batches.
+             */
+            bool runPacketIoPool(
+                    _In_ std::shared_ptr<PacketIoPool> pool);
+
+            std::shared_ptr<PacketIoPool> getPacketIoPool() const;
+
         private:
 
             void veth2tap_fun();
 
             void tap2veth_fun();
 
+            bool veth2tap_batch(
+                    _Inout_ PacketBatch& batch);
+
+            bool tap2veth_batch(
+                    _Inout_ PacketBatch& batch);
+
         public: // TODO to private
 
             int m_ifindex;
@@ -89,5 +105,7 @@ namespace saivs
 
             swss::SelectableEvent m_e2tEvent;
             swss::SelectableEvent m_t2eEvent;
+
+            std::shared_ptr<PacketIoPool> m_packetIoPool;
     };
 }
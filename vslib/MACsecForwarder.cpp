@@ -69,7 +69,24 @@ MACsecForwarder::MACsecForwarder(
                 m_macsecInterfaceName.c_str());
     }
 
-    m_forwardThread = std::make_shared<std::thread>(&MACsecForwarder::forward, this);
+    // use the same forwarding model as host interface
+
+    m_packetIoPool = m_info->getPacketIoPool();
+
+    if (m_packetIoPool)
+    {
+        if (!m_packetIoPool->add(m_macsecfd, std::bind(&MACsecForwarder::forwardBatch, this, std::placeholders::_1)))
+        {
+            close(m_macsecfd);
+            SWSS_LOG_THROW(
+                    "failed to add %s to packet I/O pool",
+                    m_macsecInterfaceName.c_str());
+        }
+    }
+    else
+    {
+        m_forwardThread = std::make_shared<std::thread>(&MACsecForwarder::forward, this);
+    }
 
     SWSS_LOG_NOTICE(
             "setup MACsec forward rule for %s succeeded",
@@ -81,8 +98,16 @@ MACsecForwarder::~MACsecForwarder()
     SWSS_LOG_ENTER();
 
     m_runThread = false;
-    m_exitEvent.notify();
-    m_forwardThread->join();
+
+    if (m_packetIoPool)
+    {
+        m_packetIoPool->remove(m_macsecfd);
+    }
+    else
+    {
+        m_exitEvent.notify();
+        m_forwardThread->join();
+    }
 
     int err = close(m_macsecfd);
 
@@ -196,3 +221,57 @@ void MACsecForwarder::forward()
             "ending thread proc for %s",
             m_macsecInterfaceName.c_str());
 }
+
+bool MACsecForwarder::forwardBatch(
+        _Inout_ PacketBatch& batch)
+{
+    SWSS_LOG_ENTER();
+
+    int count = batch.receive(m_macsecfd);
+
+    if (count < 0)
+    {
+        if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)
+        {
+            return true;
+        }
+
+        SWSS_LOG_WARN(
+                "failed to read from macsec device %s fd %d, errno(%d): %s",
+                m_macsecInterfaceName.c_str(),
+                m_macsecfd,
+                errno,
+                strerror(errno));
+
+        return errno != EBADF;
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+        size_t length = batch.getLength(i);
+
+        if (length < sizeof(ethhdr))
+        {
+            SWSS_LOG_ERROR("invalid ethernet frame length: %zu", length);
+
+            continue;
+        }
+
+        unsigned char* buffer = batch.getBuffer(i);
+
+        addVlanTag(buffer, length, batch.getMsg(i));
+
+        m_info->async_process_packet_for_fdb_event(buffer, length);
+
+        if (!sendTo(m_info->m_tapfd, buffer, length))
+        {
+            SWSS_LOG_NOTICE(
+                    "ending packet I/O for %s",
+                    m_macsecInterfaceName.c_str());
+
+            return false;
+        }
+    }
+
+    return true;
+}
@@ -27,6 +27,11 @@ namespace saivs
 
             void forward();
 
+        private:
+
+            bool forwardBatch(
+                    _Inout_ PacketBatch& batch);
+
         private:
 
             int m_macsecfd;
@@ -40,5 +45,7 @@ namespace saivs
             std::shared_ptr<std::thread> m_forwardThread;
 
             std::shared_ptr<HostInterfaceInfo> m_info;
+
+            std::shared_ptr<PacketIoPool> m_packetIoPool;
     };
 }
@@ -21,7 +21,7 @@ MACsecManager::MACsecManager()
 {
     SWSS_LOG_ENTER();
 
-    // empty
+    m_netlink = std::make_shared<MACsecNetlink>();
 }
 
 MACsecManager::~MACsecManager()
@@ -298,6 +298,17 @@ bool MACsecManager::update_macsec_sa_pn(
 {
     SWSS_LOG_ENTER();
 
+    if (use_netlink())
+    {
+        SWSS_LOG_NOTICE("update MACsec SA %s:%u pn %" PRIu64 " at the device %s",
+                attr.m_sci.c_str(),
+                static_cast<std::uint32_t>(attr.m_an),
+                pn,
+                attr.m_macsecName.c_str());
+
+        return m_netlink->updateSAPn(attr, pn);
+    }
+
     std::ostringstream ostream;
     ostream
         << "/sbin/ip macsec set "
@@ -333,6 +344,29 @@ bool MACsecManager::get_macsec_sa_pn(
     SWSS_LOG_ENTER();
 
     pn = 1;
+
+    if (use_netlink())
+    {
+        MACsecNetlink::DeviceInfo device;
+
+        auto sc = get_macsec_sc(attr.m_macsecName, attr.m_direction, attr.m_sci, device);
+
+        if (sc == nullptr)
+        {
+            return false;
+        }
+
+        auto itr = sc->m_sas.find(attr.m_an);
+
+        if (itr == sc->m_sas.end())
+        {
+            return false;
+        }
+
+        pn = itr->second.m_pn;
+        return true;
+    }
+
     std::string macsecSaInfo;
 
     if (!get_macsec_sa_info( attr.m_macsecName, attr.m_direction, attr.m_sci, attr.m_an, macsecSaInfo))
@@ -403,7 +437,10 @@ bool MACsecManager::create_macsec_egress_sc(
 
     SWSS_LOG_NOTICE("%s", ostream.str().c_str());
 
-    if (!exec(ostream.str()))
+    // MACsec module may be loaded only on first device creation, so netlink
+    // backend is not available before the first command is executed
+
+    if (use_netlink() ? !m_netlink->createSecY(attr) : !exec(ostream.str()))
     {
         return false;
     }
@@ -430,6 +467,11 @@ bool MACsecManager::create_macsec_ingress_sc(
 
     SWSS_LOG_NOTICE("%s", ostream.str().c_str());
 
+    if (use_netlink())
+    {
+        return m_netlink->createRxSC(attr);
+    }
+
     return exec(ostream.str());
 }
 
@@ -466,6 +508,11 @@ bool MACsecManager::create_macsec_egress_sa(
 
     SWSS_LOG_NOTICE("%s", ostream.str().c_str());
 
+    if (use_netlink())
+    {
+        return m_netlink->createSA(attr);
+    }
+
     return exec(ostream.str());
 }
 
@@ -497,6 +544,11 @@ bool MACsecManager::create_macsec_ingress_sa(
 
     SWSS_LOG_NOTICE("%s", ostream.str().c_str());
 
+    if (use_netlink())
+    {
+        return m_netlink->createSA(attr);
+    }
+
     return exec(ostream.str());
 }
 
@@ -520,7 +572,7 @@ bool MACsecManager::delete_macsec_egress_sc(
 
     result &= delete_macsec_forwarder(attr.m_macsecName);
     result &= enable_macsec_filter(attr.m_macsecName, false);
-    result &= exec(ostream.str());
+    result &= use_netlink() ? m_netlink->deleteSecY(attr.m_macsecName) : exec(ostream.str());
 
     return result;
 }
@@ -547,6 +599,11 @@ bool MACsecManager::delete_macsec_ingress_sc(
 
     SWSS_LOG_NOTICE("%s", ostream.str().c_str());
 
+    if (use_netlink())
+    {
+        return m_netlink->deleteRxSC(attr);
+    }
+
     return exec(ostream.str());
 }
 
@@ -573,6 +630,11 @@ bool MACsecManager::delete_macsec_egress_sa(
 
     SWSS_LOG_NOTICE("%s", ostream.str().c_str());
 
+    if (use_netlink())
+    {
+        return m_netlink->deleteSA(attr);
+    }
+
     return exec(ostream.str());
 }
 
@@ -602,6 +664,11 @@ bool MACsecManager::delete_macsec_ingress_sa(
 
     SWSS_LOG_NOTICE("%s", ostream.str().c_str());
 
+    if (use_netlink())
+    {
+        return m_netlink->deleteSA(attr);
+    }
+
     return exec(ostream.str());
 }
 
@@ -729,6 +796,13 @@ bool MACsecManager::is_macsec_device_existing(
 {
     SWSS_LOG_ENTER();
 
+    if (use_netlink())
+    {
+        MACsecNetlink::DeviceInfo device;
+
+        return m_netlink->getDevice(macsecDevice, device);
+    }
+
     std::string macsec_info;
 
     return get_macsec_device_info(macsecDevice, macsec_info);
@@ -790,6 +864,13 @@ bool MACsecManager::is_macsec_sc_existing(
 {
     SWSS_LOG_ENTER();
 
+    if (use_netlink())
+    {
+        MACsecNetlink::DeviceInfo device;
+
+        return get_macsec_sc(macsecDevice, direction, sci, device) != nullptr;
+    }
+
     std::string macsec_sc_info;
 
     return get_macsec_sc_info(macsecDevice, direction, sci, macsec_sc_info);
@@ -846,6 +927,15 @@ bool MACsecManager::is_macsec_sa_existing(
 {
     SWSS_LOG_ENTER();
 
+    if (use_netlink())
+    {
+        MACsecNetlink::DeviceInfo device;
+
+        auto sc = get_macsec_sc(macsecDevice, direction, sci, device);
+
+        return sc && sc->m_sas.find(an) != sc->m_sas.end();
+    }
+
     std::string macsecSaInfo;
 
     return get_macsec_sa_info( macsecDevice, direction, sci, an, macsecSaInfo);
@@ -875,6 +965,29 @@ void MACsecManager::cleanup_macsec_device() const
 {
     SWSS_LOG_ENTER();
 
+    if (use_netlink())
+    {
+        std::map<std::string, MACsecNetlink::DeviceInfo> devices;
+
+        if (!m_netlink->getDevices(devices))
+        {
+            SWSS_LOG_WARN("Cannot show MACsec ports");
+            return;
+        }
+
+        for (auto &device: devices)
+        {
+            if (!m_netlink->deleteSecY(device.first))
+            {
+                SWSS_LOG_WARN(
+                        "Cannot cleanup MACsec interface %s",
+                        device.first.c_str());
+            }
+        }
+
+        return;
+    }
+
     if (access("/sbin/ip", F_OK) == -1)
     {
         SWSS_LOG_WARN("file /sbin/ip not accessible, skipping");
@@ -957,3 +1070,37 @@ bool MACsecManager::exec(
 
     return exec(command, res);
 }
+
+bool MACsecManager::use_netlink() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_netlink && m_netlink->isAvailable();
+}
+
+const MACsecNetlink::SCInfo* MACsecManager::get_macsec_sc(
+        _In_ const std::string &macsecDevice,
+        _In_ sai_int32_t direction,
+        _In_ const std::string &sci,
+        _Out_ MACsecNetlink::DeviceInfo &device) const
+{
+    SWSS_LOG_ENTER();
+
+    if (!m_netlink->getDevice(macsecDevice, device))
+    {
+        SWSS_LOG_DEBUG(
+                "MACsec device %s is nonexisting",
+                macsecDevice.c_str());
+
+        return nullptr;
+    }
+
+    if (direction == SAI_MACSEC_DIRECTION_EGRESS)
+    {
+        return (device.m_sci == sci) ? &device.m_txsc : nullptr;
+    }
+
+    auto itr = device.m_rxscs.find(sci);
+
+    return (itr == device.m_rxscs.end()) ? nullptr : &itr->second;
+}
@@ -3,6 +3,7 @@
 #include "MACsecAttr.h"
 #include "MACsecFilter.h"
 #include "MACsecForwarder.h"
+#include "MACsecNetlink.h"
 
 namespace saivs
 {
@@ -134,6 +135,24 @@ namespace saivs
             bool exec(
                     _In_ const std::string &command) const;
 
+            /**
+             * @brief Check if MACsec netlink backend can be used, otherwise
+             * "ip" command is executed.
+             */
+            bool use_netlink() const;
+
+            /**
+             * @brief Get MACsec SC state over netlink, device is filled with
+             * state of whole MACsec device.
+             */
+            const MACsecNetlink::SCInfo* get_macsec_sc(
+                    _In_ const std::string &macsecDevice,
+                    _In_ sai_int32_t direction,
+                    _In_ const std::string &sci,
+                    _Out_ MACsecNetlink::DeviceInfo &device) const;
+
+            std::shared_ptr<MACsecNetlink> m_netlink;
+
             struct MACsecTrafficManager
             {
                 std::shared_ptr<HostInterfaceInfo> m_info;
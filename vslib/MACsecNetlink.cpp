@@ -0,0 +1,905 @@
+#include "MACsecNetlink.h"
+
+#include "swss/logger.h"
+
+#include <netlink/netlink.h>
+#include <netlink/genl/genl.h>
+#include <netlink/genl/ctrl.h>
+#include <netlink/route/link.h>
+#include <netlink/route/link/macsec.h>
+
+#include <linux/if_macsec.h>
+
+#include <net/if.h>
+#include <arpa/inet.h>
+#include <endian.h>
+
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+
+using namespace saivs;
+
+#define MACSEC_SCI_STRING_LENGTH (16)
+
+MACsecNetlink::MACsecNetlink():
+    m_routeSocket(nullptr),
+    m_genlSocket(nullptr),
+    m_familyId(-1)
+{
+    SWSS_LOG_ENTER();
+
+    m_routeSocket = nl_socket_alloc();
+
+    if (m_routeSocket && nl_connect(m_routeSocket, NETLINK_ROUTE) < 0)
+    {
+        SWSS_LOG_WARN("failed to connect route netlink socket");
+
+        nl_socket_free(m_routeSocket);
+
+        m_routeSocket = nullptr;
+    }
+
+    m_genlSocket = nl_socket_alloc();
+
+    if (m_genlSocket && genl_connect(m_genlSocket) < 0)
+    {
+        SWSS_LOG_WARN("failed to connect generic netlink socket");
+
+        nl_socket_free(m_genlSocket);
+
+        m_genlSocket = nullptr;
+    }
+}
+
+MACsecNetlink::~MACsecNetlink()
+{
+    SWSS_LOG_ENTER();
+
+    rollback();
+
+    if (m_routeSocket)
+    {
+        nl_socket_free(m_routeSocket);
+    }
+
+    if (m_genlSocket)
+    {
+        nl_socket_free(m_genlSocket);
+    }
+}
+
+bool MACsecNetlink::isAvailable()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_familyId >= 0)
+    {
+        return true;
+    }
+
+    if (m_routeSocket == nullptr || m_genlSocket == nullptr)
+    {
+        return false;
+    }
+
+    int id = genl_ctrl_resolve(m_genlSocket, MACSEC_GENL_NAME);
+
+    if (id < 0)
+    {
+        SWSS_LOG_INFO("generic netlink family %s not found: %s", MACSEC_GENL_NAME, nl_geterror(id));
+
+        return false;
+    }
+
+    SWSS_LOG_NOTICE("generic netlink family %s id: %d", MACSEC_GENL_NAME, id);
+
+    m_familyId = id;
+
+    return true;
+}
+
+static int hex_digit(
+        _In_ char c)
+{
+    SWSS_LOG_ENTER();
+
+    if (c >= '0' && c <= '9')
+        return c - '0';
+
+    if (c >= 'a' && c <= 'f')
+        return c - 'a' + 10;
+
+    if (c >= 'A' && c <= 'F')
+        return c - 'A' + 10;
+
+    return -1;
+}
+
+bool MACsecNetlink::parseHex(
+        _In_ const std::string &str,
+        _Out_ std::vector<uint8_t> &bytes)
+{
+    SWSS_LOG_ENTER();
+
+    bytes.clear();
+
+    if (str.size() % 2)
+    {
+        return false;
+    }
+
+    for (size_t idx = 0; idx < str.size(); idx += 2)
+    {
+        int hi = hex_digit(str[idx]);
+        int lo = hex_digit(str[idx + 1]);
+
+        if (hi < 0 || lo < 0)
+        {
+            return false;
+        }
+
+        bytes.push_back((uint8_t)((hi << 4) | lo));
+    }
+
+    return true;
+}
+
+bool MACsecNetlink::parseSci(
+        _In_ const std::string &sci,
+        _Out_ uint64_t &value)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<uint8_t> bytes;
+
+    if (sci.size() != MACSEC_SCI_STRING_LENGTH || !parseHex(sci, bytes))
+    {
+        SWSS_LOG_ERROR("invalid SCI: '%s'", sci.c_str());
+
+        return false;
+    }
+
+    value = 0;
+
+    for (auto b: bytes)
+    {
+        value = (value << 8) | b;
+    }
+
+    return true;
+}
+
+std::string MACsecNetlink::serializeSci(
+        _In_ uint64_t value)
+{
+    SWSS_LOG_ENTER();
+
+    std::ostringstream ostream;
+
+    ostream << std::setw(MACSEC_SCI_STRING_LENGTH) << std::setfill('0') << std::hex << value;
+
+    return ostream.str();
+}
+
+uint64_t MACsecNetlink::getCipherSuite(
+        _In_ const std::string &cipher)
+{
+    SWSS_LOG_ENTER();
+
+    if (cipher == MACsecAttr::CIPHER_NAME_GCM_AES_128)
+        return MACSEC_CIPHER_ID_GCM_AES_128;
+
+    if (cipher == MACsecAttr::CIPHER_NAME_GCM_AES_256)
+        return MACSEC_CIPHER_ID_GCM_AES_256;
+
+    if (cipher == MACsecAttr::CIPHER_NAME_GCM_AES_XPN_128)
+        return MACSEC_CIPHER_ID_GCM_AES_XPN_128;
+
+    if (cipher == MACsecAttr::CIPHER_NAME_GCM_AES_XPN_256)
+        return MACSEC_CIPHER_ID_GCM_AES_XPN_256;
+
+    return 0;
+}
+
+// Same as:
+// $ ip link add link <VETH_NAME> name <MACSEC_NAME> type macsec sci <SCI> ...
+// $ ip link set dev <MACSEC_NAME> up
+bool MACsecNetlink::createSecY(
+        _In_ const MACsecAttr &attr)
+{
+    SWSS_LOG_ENTER();
+
+    uint64_t sci;
+
+    if (!parseSci(attr.m_sci, sci))
+    {
+        return false;
+    }
+
+    uint64_t cipherSuite = getCipherSuite(attr.m_cipher);
+
+    if (cipherSuite == 0)
+    {
+        SWSS_LOG_ERROR("unsupported cipher: '%s'", attr.m_cipher.c_str());
+
+        return false;
+    }
+
+    unsigned int ifindex = if_nametoindex(attr.m_vethName.c_str());
+
+    if (ifindex == 0)
+    {
+        SWSS_LOG_ERROR("failed to get interface index for %s", attr.m_vethName.c_str());
+
+        return false;
+    }
+
+    struct rtnl_link *link = rtnl_link_macsec_alloc();
+
+    if (link == nullptr)
+    {
+        SWSS_LOG_ERROR("failed to allocate macsec link");
+
+        return false;
+    }
+
+    rtnl_link_set_link(link, (int)ifindex);
+    rtnl_link_set_name(link, attr.m_macsecName.c_str());
+    rtnl_link_macsec_set_sci(link, sci);
+    rtnl_link_macsec_set_cipher_suite(link, cipherSuite);
+    rtnl_link_macsec_set_encrypt(link, attr.m_encryptionEnable ? 1 : 0);
+    rtnl_link_macsec_set_send_sci(link, attr.m_sendSci ? 1 : 0);
+    rtnl_link_set_flags(link, IFF_UP);
+
+    int err = rtnl_link_add(m_routeSocket, link, NLM_F_CREATE | NLM_F_EXCL);
+
+    rtnl_link_put(link);
+
+    if (err < 0)
+    {
+        SWSS_LOG_ERROR("failed to create macsec device %s: %s", attr.m_macsecName.c_str(), nl_geterror(err));
+
+        return false;
+    }
+
+    return true;
+}
+
+bool MACsecNetlink::deleteSecY(
+        _In_ const std::string &macsecName)
+{
+    SWSS_LOG_ENTER();
+
+    struct rtnl_link *link = rtnl_link_alloc();
+
+    if (link == nullptr)
+    {
+        SWSS_LOG_ERROR("failed to allocate link");
+
+        return false;
+    }
+
+    rtnl_link_set_name(link, macsecName.c_str());
+
+    int err = rtnl_link_delete(m_routeSocket, link);
+
+    rtnl_link_put(link);
+
+    if (err < 0)
+    {
+        SWSS_LOG_ERROR("failed to delete macsec device %s: %s", macsecName.c_str(), nl_geterror(err));
+
+        return false;
+    }
+
+    return true;
+}
+
+// Same as:
+// $ ip link set link <VETH_NAME> name <MACSEC_NAME> type macsec encodingsa <AN>
+bool MACsecNetlink::setEncodingSA(
+        _In_ const std::string &macsecName,
+        _In_ macsec_an_t an)
+{
+    SWSS_LOG_ENTER();
+
+    struct rtnl_link *orig = nullptr;
+
+    int err = rtnl_link_get_kernel(m_routeSocket, 0, macsecName.c_str(), &orig);
+
+    if (err < 0)
+    {
+        SWSS_LOG_ERROR("failed to get macsec device %s: %s", macsecName.c_str(), nl_geterror(err));
+
+        return false;
+    }
+
+    struct rtnl_link *change = rtnl_link_macsec_alloc();
+
+    if (change == nullptr)
+    {
+        rtnl_link_put(orig);
+
+        SWSS_LOG_ERROR("failed to allocate macsec link");
+
+        return false;
+    }
+
+    rtnl_link_macsec_set_encoding_sa(change, (uint8_t)an);
+
+    err = rtnl_link_change(m_routeSocket, orig, change, 0);
+
+    rtnl_link_put(change);
+    rtnl_link_put(orig);
+
+    if (err < 0)
+    {
+        SWSS_LOG_ERROR("failed to set encoding sa %u on %s: %s", static_cast<std::uint32_t>(an), macsecName.c_str(), nl_geterror(err));
+
+        return false;
+    }
+
+    return true;
+}
+
+struct nl_msg* MACsecNetlink::addMessage(
+        _In_ uint8_t cmd,
+        _In_ int ifindex)
+{
+    SWSS_LOG_ENTER();
+
+    struct nl_msg *msg = nlmsg_alloc();
+
+    if (msg == nullptr)
+    {
+        SWSS_LOG_ERROR("failed to allocate netlink message");
+
+        return nullptr;
+    }
+
+    if (genlmsg_put(msg, NL_AUTO_PORT, NL_AUTO_SEQ, m_familyId, 0, NLM_F_ACK, cmd, MACSEC_GENL_VERSION) == nullptr ||
+            nla_put_u32(msg, MACSEC_ATTR_IFINDEX, (uint32_t)ifindex) < 0)
+    {
+        SWSS_LOG_ERROR("failed to build macsec command %u", cmd);
+
+        nlmsg_free(msg);
+
+        return nullptr;
+    }
+
+    m_transaction.push_back(msg);
+
+    return msg;
+}
+
+bool MACsecNetlink::putRxSC(
+        _In_ struct nl_msg *msg,
+        _In_ const std::string &sci,
+        _In_ bool putActive,
+        _In_ bool active)
+{
+    SWSS_LOG_ENTER();
+
+    uint64_t value;
+
+    if (msg == nullptr || !parseSci(sci, value))
+    {
+        return false;
+    }
+
+    struct nlattr *nest = nla_nest_start(msg, MACSEC_ATTR_RXSC_CONFIG);
+
+    if (nest == nullptr ||
+            nla_put_u64(msg, MACSEC_RXSC_ATTR_SCI, htobe64(value)) < 0 ||
+            (putActive && nla_put_u8(msg, MACSEC_RXSC_ATTR_ACTIVE, active ? 1 : 0) < 0))
+    {
+        SWSS_LOG_ERROR("failed to put rx sc %s", sci.c_str());
+
+        return false;
+    }
+
+    nla_nest_end(msg, nest);
+
+    return true;
+}
+
+bool MACsecNetlink::putSA(
+        _In_ struct nl_msg *msg,
+        _In_ const MACsecAttr &attr,
+        _In_ bool putKey,
+        _In_ bool putPn,
+        _In_ macsec_pn_t pn,
+        _In_ bool putActive,
+        _In_ bool active)
+{
+    SWSS_LOG_ENTER();
+
+    if (msg == nullptr)
+    {
+        return false;
+    }
+
+    struct nlattr *nest = nla_nest_start(msg, MACSEC_ATTR_SA_CONFIG);
+
+    if (nest == nullptr || nla_put_u8(msg, MACSEC_SA_ATTR_AN, (uint8_t)attr.m_an) < 0)
+    {
+        return false;
+    }
+
+    if (putPn)
+    {
+        // kernel expects 64 bit packet number only on XPN cipher suites
+
+        int err = attr.is_xpn()
+            ? nla_put_u64(msg, MACSEC_SA_ATTR_PN, pn)
+            : nla_put_u32(msg, MACSEC_SA_ATTR_PN, (uint32_t)pn);
+
+        if (err < 0)
+        {
+            return false;
+        }
+    }
+
+    if (putActive && nla_put_u8(msg, MACSEC_SA_ATTR_ACTIVE, active ? 1 : 0) < 0)
+    {
+        return false;
+    }
+
+    if (putKey)
+    {
+        std::vector<uint8_t> key;
+        std::vector<uint8_t> keyId;
+
+        if (!parseHex(attr.m_sak, key) || !parseHex(attr.m_authKey, keyId))
+        {
+            SWSS_LOG_ERROR("invalid key of SA %s:%u", attr.m_sci.c_str(), static_cast<std::uint32_t>(attr.m_an));
+
+            return false;
+        }
+
+        keyId.resize(MACSEC_KEYID_LEN, 0);
+
+        if (nla_put(msg, MACSEC_SA_ATTR_KEYID, MACSEC_KEYID_LEN, keyId.data()) < 0 ||
+                nla_put(msg, MACSEC_SA_ATTR_KEY, (int)key.size(), key.data()) < 0)
+        {
+            return false;
+        }
+
+        if (attr.is_xpn())
+        {
+            std::vector<uint8_t> salt;
+
+            if (!parseHex(attr.m_salt, salt))
+            {
+                SWSS_LOG_ERROR("invalid salt of SA %s:%u", attr.m_sci.c_str(), static_cast<std::uint32_t>(attr.m_an));
+
+                return false;
+            }
+
+            salt.resize(MACSEC_SALT_LEN, 0);
+
+            // ssci is hex string of host order value, kernel expects network order
+
+            uint32_t ssci = (uint32_t)std::stoul(attr.m_ssci.empty() ? "0" : attr.m_ssci, nullptr, 16);
+
+            if (nla_put_u32(msg, MACSEC_SA_ATTR_SSCI, htonl(ssci)) < 0 ||
+                    nla_put(msg, MACSEC_SA_ATTR_SALT, MACSEC_SALT_LEN, salt.data()) < 0)
+            {
+                return false;
+            }
+        }
+    }
+
+    nla_nest_end(msg, nest);
+
+    return true;
+}
+
+bool MACsecNetlink::commit()
+{
+    SWSS_LOG_ENTER();
+
+    bool result = true;
+
+    size_t sent = 0;
+
+    for (auto *msg: m_transaction)
+    {
+        int err = nl_send_auto(m_genlSocket, msg);
+
+        if (err < 0)
+        {
+            SWSS_LOG_ERROR("failed to send macsec message: %s", nl_geterror(err));
+
+            result = false;
+            break;
+        }
+
+        sent++;
+    }
+
+    // all messages are applied by kernel even if one of them fails, collect
+    // all acknowledges to keep socket sequence in sync
+
+    for (size_t idx = 0; idx < sent; idx++)
+    {
+        int err = nl_wait_for_ack(m_genlSocket);
+
+        if (err < 0)
+        {
+            SWSS_LOG_ERROR("macsec message %zu/%zu failed: %s", idx + 1, sent, nl_geterror(err));
+
+            result = false;
+        }
+    }
+
+    rollback();
+
+    return result;
+}
+
+void MACsecNetlink::rollback()
+{
+    SWSS_LOG_ENTER();
+
+    for (auto *msg: m_transaction)
+    {
+        nlmsg_free(msg);
+    }
+
+    m_transaction.clear();
+}
+
+// Same as:
+// $ ip macsec add <MACSEC_NAME> rx sci <SCI> on
+bool MACsecNetlink::createRxSC(
+        _In_ const MACsecAttr &attr)
+{
+    SWSS_LOG_ENTER();
+
+    int ifindex = (int)if_nametoindex(attr.m_macsecName.c_str());
+
+    if (ifindex == 0 || !isAvailable())
+    {
+        return false;
+    }
+
+    if (!putRxSC(addMessage(MACSEC_CMD_ADD_RXSC, ifindex), attr.m_sci, true, true))
+    {
+        rollback();
+
+        return false;
+    }
+
+    return commit();
+}
+
+// Same as:
+// $ ip macsec set <MACSEC_NAME> rx sci <SCI> off
+// $ ip macsec del <MACSEC_NAME> rx sci <SCI>
+bool MACsecNetlink::deleteRxSC(
+        _In_ const MACsecAttr &attr)
+{
+    SWSS_LOG_ENTER();
+
+    int ifindex = (int)if_nametoindex(attr.m_macsecName.c_str());
+
+    if (ifindex == 0 || !isAvailable())
+    {
+        return false;
+    }
+
+    if (!putRxSC(addMessage(MACSEC_CMD_UPD_RXSC, ifindex), attr.m_sci, true, false) ||
+            !putRxSC(addMessage(MACSEC_CMD_DEL_RXSC, ifindex), attr.m_sci, false, false))
+    {
+        rollback();
+
+        return false;
+    }
+
+    return commit();
+}
+
+// Same as:
+// $ ip macsec add <MACSEC_NAME> tx sa <AN> pn <PN> on key <AUTH_KEY> <SAK>
+// $ ip link set link <VETH_NAME> name <MACSEC_NAME> type macsec encodingsa <AN>
+// or
+// $ ip macsec add <MACSEC_NAME> rx sci <SCI> sa <AN> pn <PN> on key <AUTH_KEY> <SAK>
+bool MACsecNetlink::createSA(
+        _In_ const MACsecAttr &attr)
+{
+    SWSS_LOG_ENTER();
+
+    int ifindex = (int)if_nametoindex(attr.m_macsecName.c_str());
+
+    if (ifindex == 0 || !isAvailable())
+    {
+        return false;
+    }
+
+    if (attr.m_direction == SAI_MACSEC_DIRECTION_EGRESS)
+    {
+        if (!putSA(addMessage(MACSEC_CMD_ADD_TXSA, ifindex), attr, true, true, attr.m_pn, true, true))
+        {
+            rollback();
+
+            return false;
+        }
+
+        return commit() && setEncodingSA(attr.m_macsecName, attr.m_an);
+    }
+
+    auto *msg = addMessage(MACSEC_CMD_ADD_RXSA, ifindex);
+
+    if (!putRxSC(msg, attr.m_sci, false, false) ||
+            !putSA(msg, attr, true, true, attr.m_pn, true, true))
+    {
+        rollback();
+
+        return false;
+    }
+
+    return commit();
+}
+
+// Same as:
+// $ ip macsec set <MACSEC_NAME> tx sa <AN> off
+// $ ip macsec del <MACSEC_NAME> tx sa <AN>
+// or
+// $ ip macsec set <MACSEC_NAME> rx sci <SCI> sa <AN> off
+// $ ip macsec del <MACSEC_NAME> rx sci <SCI> sa <AN>
+bool MACsecNetlink::deleteSA(
+        _In_ const MACsecAttr &attr)
+{
+    SWSS_LOG_ENTER();
+
+    int ifindex = (int)if_nametoindex(attr.m_macsecName.c_str());
+
+    if (ifindex == 0 || !isAvailable())
+    {
+        return false;
+    }
+
+    bool egress = (attr.m_direction == SAI_MACSEC_DIRECTION_EGRESS);
+
+    auto *upd = addMessage(egress ? MACSEC_CMD_UPD_TXSA : MACSEC_CMD_UPD_RXSA, ifindex);
+
+    bool ok = (egress || putRxSC(upd, attr.m_sci, false, false)) &&
+        putSA(upd, attr, false, false, 0, true, false);
+
+    auto *del = addMessage(egress ? MACSEC_CMD_DEL_TXSA : MACSEC_CMD_DEL_RXSA, ifindex);
+
+    ok = ok && (egress || putRxSC(del, attr.m_sci, false, false)) &&
+        putSA(del, attr, false, false, 0, false, false);
+
+    if (!ok)
+    {
+        rollback();
+
+        return false;
+    }
+
+    return commit();
+}
+
+// Same as:
+// $ ip macsec set <MACSEC_NAME> tx sa <AN> pn <PN>
+// or
+// $ ip macsec set <MACSEC_NAME> rx sci <SCI> sa <AN> pn <PN>
+bool MACsecNetlink::updateSAPn(
+        _In_ const MACsecAttr &attr,
+        _In_ macsec_pn_t pn)
+{
+    SWSS_LOG_ENTER();
+
+    int ifindex = (int)if_nametoindex(attr.m_macsecName.c_str());
+
+    if (ifindex == 0 || !isAvailable())
+    {
+        return false;
+    }
+
+    bool egress = (attr.m_direction == SAI_MACSEC_DIRECTION_EGRESS);
+
+    auto *msg = addMessage(egress ? MACSEC_CMD_UPD_TXSA : MACSEC_CMD_UPD_RXSA, ifindex);
+
+    if (!(egress || putRxSC(msg, attr.m_sci, false, false)) ||
+            !putSA(msg, attr, false, true, pn, false, false))
+    {
+        rollback();
+
+        return false;
+    }
+
+    return commit();
+}
+
+static void parse_sa_list(
+        _In_ struct nlattr *list,
+        _Out_ MACsecNetlink::SCInfo &sc)
+{
+    SWSS_LOG_ENTER();
+
+    if (list == nullptr)
+        return;
+
+    struct nlattr *nla;
+    int rem;
+
+    nla_for_each_nested(nla, list, rem)
+    {
+        struct nlattr *sa[MACSEC_SA_ATTR_MAX + 1];
+
+        if (nla_parse_nested(sa, MACSEC_SA_ATTR_MAX, nla, nullptr) < 0 || sa[MACSEC_SA_ATTR_AN] == nullptr)
+            continue;
+
+        auto &info = sc.m_sas[nla_get_u8(sa[MACSEC_SA_ATTR_AN])];
+
+        info.m_active = sa[MACSEC_SA_ATTR_ACTIVE] && nla_get_u8(sa[MACSEC_SA_ATTR_ACTIVE]);
+        info.m_pn = 0;
+
+        if (sa[MACSEC_SA_ATTR_PN])
+        {
+            info.m_pn = (nla_len(sa[MACSEC_SA_ATTR_PN]) == sizeof(uint64_t))
+                ? nla_get_u64(sa[MACSEC_SA_ATTR_PN])
+                : nla_get_u32(sa[MACSEC_SA_ATTR_PN]);
+        }
+    }
+}
+
+static int parse_device(
+        _In_ struct nl_msg *msg,
+        _In_ void *arg)
+{
+    SWSS_LOG_ENTER();
+
+    auto &devices = *(std::map<std::string, MACsecNetlink::DeviceInfo>*)arg;
+
+    struct nlattr *attrs[MACSEC_ATTR_MAX + 1];
+
+    if (genlmsg_parse(nlmsg_hdr(msg), 0, attrs, MACSEC_ATTR_MAX, nullptr) < 0 || attrs[MACSEC_ATTR_IFINDEX] == nullptr)
+    {
+        return NL_SKIP;
+    }
+
+    char name[IF_NAMESIZE];
+
+    if (if_indextoname(nla_get_u32(attrs[MACSEC_ATTR_IFINDEX]), name) == nullptr)
+    {
+        return NL_SKIP;
+    }
+
+    auto &device = devices[name];
+
+    device.m_name = name;
+    device.m_encodingSa = 0;
+    device.m_txsc.m_active = false;
+
+    if (attrs[MACSEC_ATTR_SECY])
+    {
+        struct nlattr *secy[MACSEC_SECY_ATTR_MAX + 1];
+
+        if (nla_parse_nested(secy, MACSEC_SECY_ATTR_MAX, attrs[MACSEC_ATTR_SECY], nullptr) == 0)
+        {
+            if (secy[MACSEC_SECY_ATTR_SCI])
+                device.m_sci = MACsecNetlink::serializeSci(be64toh(nla_get_u64(secy[MACSEC_SECY_ATTR_SCI])));
+
+            if (secy[MACSEC_SECY_ATTR_ENCODING_SA])
+                device.m_encodingSa = nla_get_u8(secy[MACSEC_SECY_ATTR_ENCODING_SA]);
+
+            device.m_txsc.m_active = secy[MACSEC_SECY_ATTR_OPER] && nla_get_u8(secy[MACSEC_SECY_ATTR_OPER]);
+        }
+    }
+
+    parse_sa_list(attrs[MACSEC_ATTR_TXSA_LIST], device.m_txsc);
+
+    if (attrs[MACSEC_ATTR_RXSC_LIST])
+    {
+        struct nlattr *nla;
+        int rem;
+
+        nla_for_each_nested(nla, attrs[MACSEC_ATTR_RXSC_LIST], rem)
+        {
+            struct nlattr *rxsc[MACSEC_RXSC_ATTR_MAX + 1];
+
+            if (nla_parse_nested(rxsc, MACSEC_RXSC_ATTR_MAX, nla, nullptr) < 0 || rxsc[MACSEC_RXSC_ATTR_SCI] == nullptr)
+                continue;
+
+            auto &sc = device.m_rxscs[MACsecNetlink::serializeSci(be64toh(nla_get_u64(rxsc[MACSEC_RXSC_ATTR_SCI])))];
+
+            sc.m_active = rxsc[MACSEC_RXSC_ATTR_ACTIVE] && nla_get_u8(rxsc[MACSEC_RXSC_ATTR_ACTIVE]);
+
+            parse_sa_list(rxsc[MACSEC_RXSC_ATTR_SA_LIST], sc);
+        }
+    }
+
+    return NL_OK;
+}
+
+// Same as:
+// $ ip macsec show
+bool MACsecNetlink::getDevices(
+        _Out_ std::map<std::string, DeviceInfo> &devices)
+{
+    SWSS_LOG_ENTER();
+
+    devices.clear();
+
+    if (!isAvailable())
+    {
+        return false;
+    }
+
+    struct nl_msg *msg = nlmsg_alloc();
+
+    if (msg == nullptr)
+    {
+        return false;
+    }
+
+    if (genlmsg_put(msg, NL_AUTO_PORT, NL_AUTO_SEQ, m_familyId, 0, NLM_F_DUMP, MACSEC_CMD_GET_TXSC, MACSEC_GENL_VERSION) == nullptr)
+    {
+        nlmsg_free(msg);
+
+        return false;
+    }
+
+    int err = nl_send_auto(m_genlSocket, msg);
+
+    nlmsg_free(msg);
+
+    if (err < 0)
+    {
+        SWSS_LOG_ERROR("failed to send macsec dump: %s", nl_geterror(err));
+
+        return false;
+    }
+
+    struct nl_cb *cb = nl_cb_clone(nl_socket_get_cb(m_genlSocket));
+
+    if (cb == nullptr)
+    {
+        return false;
+    }
+
+    nl_cb_set(cb, NL_CB_VALID, NL_CB_CUSTOM, parse_device, &devices);
+
+    err = nl_recvmsgs(m_genlSocket, cb);
+
+    nl_cb_put(cb);
+
+    if (err < 0)
+    {
+        SWSS_LOG_ERROR("failed to receive macsec dump: %s", nl_geterror(err));
+
+        return false;
+    }
+
+    return true;
+}
+
+bool MACsecNetlink::getDevice(
+        _In_ const std::string &macsecName,
+        _Out_ DeviceInfo &device)
+{
+    SWSS_LOG_ENTER();
+
+    std::map<std::string, DeviceInfo> devices;
+
+    if (!getDevices(devices))
+    {
+        return false;
+    }
+
+    auto it = devices.find(macsecName);
+
+    if (it == devices.end())
+    {
+        return false;
+    }
+
+    device = it->second;
+
+    return true;
+}
@@ -0,0 +1,178 @@
+#pragma once
+
+#include "MACsecAttr.h"
+
+#include "swss/sal.h"
+
+#include <string>
+#include <vector>
+#include <map>
+
+struct nl_sock;
+struct nl_msg;
+
+namespace saivs
+{
+    /**
+     * @brief MACsec netlink backend.
+     *
+     * Programs Linux MACsec devices directly over netlink instead of spawning
+     * "ip macsec" processes. SecY (MACsec device) is created and deleted over
+     * rtnetlink, SC and SA are programmed and queried over "macsec" generic
+     * netlink family. Messages of single operation on single MACsec device
+     * are sent as one transaction, and acknowledges are collected after all
+     * messages are sent.
+     */
+    class MACsecNetlink
+    {
+        private:
+
+            MACsecNetlink(const MACsecNetlink&) = delete;
+            MACsecNetlink& operator=(const MACsecNetlink&) = delete;
+
+        public:
+
+            MACsecNetlink();
+
+            virtual ~MACsecNetlink();
+
+        public:
+
+            struct SAInfo
+            {
+                bool m_active;
+
+                macsec_pn_t m_pn;
+            };
+
+            struct SCInfo
+            {
+                bool m_active;
+
+                std::map<macsec_an_t, SAInfo> m_sas;
+            };
+
+            struct DeviceInfo
+            {
+                std::string m_name;
+
+                /**
+                 * @brief Secure channel identifier in the same format as
+                 * MACsecAttr::m_sci.
+                 */
+                std::string m_sci;
+
+                macsec_an_t m_encodingSa;
+
+                SCInfo m_txsc;
+
+                /**
+                 * @brief Receive secure channels by SCI.
+                 */
+                std::map<std::string, SCInfo> m_rxscs;
+            };
+
+        public:
+
+            /**
+             * @brief Check if MACsec generic netlink family is present.
+             *
+             * Family is registered by kernel when MACsec module is loaded, so
+             * this check is repeated until it succeeds.
+             */
+            bool isAvailable();
+
+            bool createSecY(
+                    _In_ const MACsecAttr &attr);
+
+            bool deleteSecY(
+                    _In_ const std::string &macsecName);
+
+            bool createRxSC(
+                    _In_ const MACsecAttr &attr);
+
+            bool deleteRxSC(
+                    _In_ const MACsecAttr &attr);
+
+            bool createSA(
+                    _In_ const MACsecAttr &attr);
+
+            bool deleteSA(
+                    _In_ const MACsecAttr &attr);
+
+            bool updateSAPn(
+                    _In_ const MACsecAttr &attr,
+                    _In_ macsec_pn_t pn);
+
+            /**
+             * @brief Get state of all MACsec devices, by device name.
+             */
+            bool getDevices(
+                    _Out_ std::map<std::string, DeviceInfo> &devices);
+
+            bool getDevice(
+                    _In_ const std::string &macsecName,
+                    _Out_ DeviceInfo &device);
+
+        public:
+
+            static bool parseHex(
+                    _In_ const std::string &str,
+                    _Out_ std::vector<uint8_t> &bytes);
+
+            /**
+             * @brief Convert SCI string from MACsecAttr to host order value.
+             */
+            static bool parseSci(
+                    _In_ const std::string &sci,
+                    _Out_ uint64_t &value);
+
+            static std::string serializeSci(
+                    _In_ uint64_t value);
+
+            static uint64_t getCipherSuite(
+                    _In_ const std::string &cipher);
+
+        private:
+
+            bool setEncodingSA(
+                    _In_ const std::string &macsecName,
+                    _In_ macsec_an_t an);
+
+            struct nl_msg* addMessage(
+                    _In_ uint8_t cmd,
+                    _In_ int ifindex);
+
+            bool putRxSC(
+                    _In_ struct nl_msg *msg,
+                    _In_ const std::string &sci,
+                    _In_ bool putActive,
+                    _In_ bool active);
+
+            bool putSA(
+                    _In_ struct nl_msg *msg,
+                    _In_ const MACsecAttr &attr,
+                    _In_ bool putKey,
+                    _In_ bool putPn,
+                    _In_ macsec_pn_t pn,
+                    _In_ bool putActive,
+                    _In_ bool active);
+
+            bool commit();
+
+            void rollback();
+
+        private:
+
+            struct nl_sock *m_routeSocket;
+
+            struct nl_sock *m_genlSocket;
+
+            int m_familyId;
+
+            /**
+             * @brief Messages of currently built transaction.
+             */
+            std::vector<struct nl_msg*> m_transaction;
+    };
+}
@@ -0,0 +1,183 @@
+#include "PacketBatch.h"
+
+#include "swss/logger.h"
+
+#include <unistd.h>
+#include <string.h>
+#include <errno.h>
+
+using namespace saivs;
+
+constexpr size_t PacketBatch::DEFAULT_BATCH_SIZE;
+
+PacketBatch::PacketBatch(
+        _In_ size_t capacity):
+    m_capacity(capacity),
+    m_buffers(capacity * ETH_FRAME_BUFFER_SIZE),
+    m_controls(capacity * CONTROL_MESSAGE_BUFFER_SIZE),
+    m_addrs(capacity),
+    m_iovs(capacity),
+    m_msgs(capacity),
+    m_lengths(capacity),
+    m_sendIovs(capacity),
+    m_sendMsgs(capacity),
+    m_sendCount(0)
+{
+    SWSS_LOG_ENTER();
+
+    if (capacity == 0)
+    {
+        SWSS_LOG_THROW("batch capacity must be positive");
+    }
+}
+
+int PacketBatch::receive(
+        _In_ int fd)
+{
+    SWSS_LOG_ENTER();
+
+    // kernel modifies name and control lengths, they need to be reset on each call
+
+    for (size_t i = 0; i < m_capacity; i++)
+    {
+        m_iovs[i].iov_base = getBuffer(i);
+        m_iovs[i].iov_len = ETH_FRAME_BUFFER_SIZE;
+
+        struct msghdr& msg = m_msgs[i].msg_hdr;
+
+        memset(&msg, 0, sizeof(struct msghdr));
+
+        msg.msg_name = &m_addrs[i];
+        msg.msg_namelen = sizeof(struct sockaddr_storage);
+        msg.msg_iov = &m_iovs[i];
+        msg.msg_iovlen = 1;
+        msg.msg_control = &m_controls[i * CONTROL_MESSAGE_BUFFER_SIZE];
+        msg.msg_controllen = CONTROL_MESSAGE_BUFFER_SIZE;
+
+        m_msgs[i].msg_len = 0;
+    }
+
+    int count = recvmmsg(fd, m_msgs.data(), (unsigned int)m_capacity, MSG_DONTWAIT, nullptr);
+
+    for (int i = 0; i < count; i++)
+    {
+        m_lengths[i] = m_msgs[i].msg_len;
+    }
+
+    return count;
+}
+
+int PacketBatch::read(
+        _In_ int fd)
+{
+    SWSS_LOG_ENTER();
+
+    size_t count = 0;
+
+    while (count < m_capacity)
+    {
+        ssize_t size = ::read(fd, getBuffer(count), ETH_FRAME_BUFFER_SIZE);
+
+        if (size < 0)
+        {
+            // report error only if nothing was read, otherwise it will be
+            // reported on next read
+
+            if (count == 0)
+            {
+                return -1;
+            }
+
+            break;
+        }
+
+        m_lengths[count++] = (size_t)size;
+    }
+
+    return (int)count;
+}
+
+void PacketBatch::enqueue(
+        _In_ size_t index,
+        _In_ size_t length)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_sendCount >= m_capacity)
+    {
+        SWSS_LOG_THROW("send queue is full, capacity %zu", m_capacity);
+    }
+
+    struct iovec& iov = m_sendIovs[m_sendCount];
+
+    iov.iov_base = getBuffer(index);
+    iov.iov_len = length;
+
+    struct msghdr& msg = m_sendMsgs[m_sendCount].msg_hdr;
+
+    memset(&msg, 0, sizeof(struct msghdr));
+
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+
+    m_sendMsgs[m_sendCount].msg_len = 0;
+
+    m_sendCount++;
+}
+
+int PacketBatch::flush(
+        _In_ int fd)
+{
+    SWSS_LOG_ENTER();
+
+    size_t sent = 0;
+
+    while (sent < m_sendCount)
+    {
+        int count = sendmmsg(fd, &m_sendMsgs[sent], (unsigned int)(m_sendCount - sent), 0);
+
+        if (count <= 0)
+        {
+            m_sendCount = 0;
+
+            return (sent == 0) ? -1 : (int)sent;
+        }
+
+        sent += (size_t)count;
+    }
+
+    m_sendCount = 0;
+
+    return (int)sent;
+}
+
+unsigned char* PacketBatch::getBuffer(
+        _In_ size_t index)
+{
+    SWSS_LOG_ENTER();
+
+    return &m_buffers[index * ETH_FRAME_BUFFER_SIZE];
+}
+
+size_t PacketBatch::getLength(
+        _In_ size_t index) const
+{
+    SWSS_LOG_ENTER();
+
+    return m_lengths.at(index);
+}
+
+struct msghdr& PacketBatch::getMsg(
+        _In_ size_t index)
+{
+    SWSS_LOG_ENTER();
+
+    return m_msgs.at(index).msg_hdr;
+}
+
+size_t PacketBatch::getCapacity() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_capacity;
+}
@@ -0,0 +1,109 @@
+#pragma once
+
+#include "TrafficForwarder.h"
+
+#include "swss/sal.h"
+
+#include <sys/socket.h>
+
+#include <vector>
+
+namespace saivs
+{
+    /**
+     * @brief Packet batch.
+     *
+     * Set of preallocated frame buffers used to receive and send multiple
+     * frames with single recvmmsg/sendmmsg system call. Each batch is owned
+     * by single packet I/O thread, so it's not thread safe.
+     */
+    class PacketBatch
+    {
+        private:
+
+            PacketBatch(const PacketBatch&) = delete;
+            PacketBatch& operator=(const PacketBatch&) = delete;
+
+        public:
+
+            PacketBatch(
+                    _In_ size_t capacity = DEFAULT_BATCH_SIZE);
+
+            virtual ~PacketBatch() = default;
+
+        public:
+
+            /**
+             * @brief Receive up to capacity frames from socket without blocking.
+             *
+             * Each received frame has its own control message buffer, so
+             * addVlanTag can be applied on returned message header.
+             *
+             * @return Number of received frames or -1 on error (errno is set).
+             */
+            int receive(
+                    _In_ int fd);
+
+            /**
+             * @brief Read up to capacity frames from fd (like tap device)
+             * without blocking, one frame per read.
+             *
+             * @return Number of read frames or -1 on error (errno is set).
+             */
+            int read(
+                    _In_ int fd);
+
+            /**
+             * @brief Queue frame at given index to be sent with given length.
+             */
+            void enqueue(
+                    _In_ size_t index,
+                    _In_ size_t length);
+
+            /**
+             * @brief Send all queued frames on connected (bound) socket and
+             * clear send queue.
+             *
+             * @return Number of sent frames or -1 on error (errno is set).
+             */
+            int flush(
+                    _In_ int fd);
+
+            unsigned char* getBuffer(
+                    _In_ size_t index);
+
+            size_t getLength(
+                    _In_ size_t index) const;
+
+            struct msghdr& getMsg(
+                    _In_ size_t index);
+
+            size_t getCapacity() const;
+
+        public:
+
+            static constexpr size_t DEFAULT_BATCH_SIZE = 32;
+
+        private:
+
+            size_t m_capacity;
+
+            std::vector<unsigned char> m_buffers;
+
+            std::vector<char> m_controls;
+
+            std::vector<struct sockaddr_storage> m_addrs;
+
+            std::vector<struct iovec> m_iovs;
+
+            std::vector<struct mmsghdr> m_msgs;
+
+            std::vector<size_t> m_lengths;
+
+            std::vector<struct iovec> m_sendIovs;
+
+            std::vector<struct mmsghdr> m_sendMsgs;
+
+            size_t m_sendCount;
+    };
+}
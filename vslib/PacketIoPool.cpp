@@ -0,0 +1,249 @@
+#include "PacketIoPool.h"
+
+#include "swss/logger.h"
+
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include <string.h>
+#include <errno.h>
+
+using namespace saivs;
+
+#define EPOLL_MAX_EVENTS 16
+
+PacketIoPool::PacketIoPool(
+        _In_ size_t threadCount):
+    m_run(true)
+{
+    SWSS_LOG_ENTER();
+
+    if (threadCount == 0)
+    {
+        SWSS_LOG_THROW("thread count must be positive");
+    }
+
+    m_epollfd = epoll_create1(EPOLL_CLOEXEC);
+
+    if (m_epollfd < 0)
+    {
+        SWSS_LOG_THROW("failed to create epoll, errno(%d): %s", errno, strerror(errno));
+    }
+
+    m_exitfd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+
+    if (m_exitfd < 0)
+    {
+        close(m_epollfd);
+
+        SWSS_LOG_THROW("failed to create eventfd, errno(%d): %s", errno, strerror(errno));
+    }
+
+    // exit event is level triggered and it's never read, so it wakes up all threads
+
+    struct epoll_event ev;
+
+    memset(&ev, 0, sizeof(ev));
+
+    ev.events = EPOLLIN;
+    ev.data.fd = m_exitfd;
+
+    if (epoll_ctl(m_epollfd, EPOLL_CTL_ADD, m_exitfd, &ev) < 0)
+    {
+        close(m_exitfd);
+        close(m_epollfd);
+
+        SWSS_LOG_THROW("failed to add exit event to epoll, errno(%d): %s", errno, strerror(errno));
+    }
+
+    for (size_t i = 0; i < threadCount; i++)
+    {
+        m_threads.push_back(std::make_shared<std::thread>(&PacketIoPool::threadFun, this));
+    }
+
+    SWSS_LOG_NOTICE("started packet I/O pool with %zu threads", threadCount);
+}
+
+PacketIoPool::~PacketIoPool()
+{
+    SWSS_LOG_ENTER();
+
+    m_run = false;
+
+    uint64_t value = 1;
+
+    if (write(m_exitfd, &value, sizeof(value)) < 0)
+    {
+        SWSS_LOG_ERROR("failed to notify exit event, errno(%d): %s", errno, strerror(errno));
+    }
+
+    for (auto& thread: m_threads)
+    {
+        thread->join();
+    }
+
+    close(m_exitfd);
+    close(m_epollfd);
+
+    SWSS_LOG_NOTICE("joined packet I/O pool threads");
+}
+
+bool PacketIoPool::arm(
+        _In_ int fd,
+        _In_ int op)
+{
+    SWSS_LOG_ENTER();
+
+    struct epoll_event ev;
+
+    memset(&ev, 0, sizeof(ev));
+
+    ev.events = EPOLLIN | EPOLLONESHOT;
+    ev.data.fd = fd;
+
+    if (epoll_ctl(m_epollfd, op, fd, &ev) < 0)
+    {
+        SWSS_LOG_ERROR("epoll_ctl %d failed on fd %d, errno(%d): %s", op, fd, errno, strerror(errno));
+
+        return false;
+    }
+
+    return true;
+}
+
+bool PacketIoPool::add(
+        _In_ int fd,
+        _In_ const Handler& handler)
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (m_registrations.find(fd) != m_registrations.end())
+    {
+        SWSS_LOG_ERROR("fd %d is already registered", fd);
+
+        return false;
+    }
+
+    auto reg = std::make_shared<Registration>();
+
+    reg->m_handler = handler;
+    reg->m_busy = false;
+
+    m_registrations[fd] = reg;
+
+    if (!arm(fd, EPOLL_CTL_ADD))
+    {
+        m_registrations.erase(fd);
+
+        return false;
+    }
+
+    return true;
+}
+
+void PacketIoPool::remove(
+        _In_ int fd)
+{
+    SWSS_LOG_ENTER();
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    auto it = m_registrations.find(fd);
+
+    if (it == m_registrations.end())
+    {
+        return;
+    }
+
+    auto reg = it->second;
+
+    m_registrations.erase(it);
+
+    if (epoll_ctl(m_epollfd, EPOLL_CTL_DEL, fd, nullptr) < 0)
+    {
+        SWSS_LOG_WARN("failed to remove fd %d from epoll, errno(%d): %s", fd, errno, strerror(errno));
+    }
+
+    // wait for in flight handler
+
+    m_cv.wait(lock, [&]{ return !reg->m_busy; });
+}
+
+size_t PacketIoPool::getThreadCount() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_threads.size();
+}
+
+void PacketIoPool::threadFun()
+{
+    SWSS_LOG_ENTER();
+
+    PacketBatch batch;
+
+    struct epoll_event events[EPOLL_MAX_EVENTS];
+
+    while (m_run)
+    {
+        int count = epoll_wait(m_epollfd, events, EPOLL_MAX_EVENTS, -1);
+
+        if (count < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            SWSS_LOG_ERROR("epoll_wait failed, errno(%d): %s, ending thread", errno, strerror(errno));
+
+            break;
+        }
+
+        for (int i = 0; i < count && m_run; i++)
+        {
+            int fd = events[i].data.fd;
+
+            if (fd == m_exitfd)
+            {
+                continue;
+            }
+
+            std::shared_ptr<Registration> reg;
+
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+
+                auto it = m_registrations.find(fd);
+
+                if (it == m_registrations.end())
+                {
+                    // fd was removed after event was reported
+                    continue;
+                }
+
+                reg = it->second;
+                reg->m_busy = true;
+            }
+
+            bool keep = reg->m_handler(batch);
+
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            reg->m_busy = false;
+
+            auto it = m_registrations.find(fd);
+
+            if (keep && it != m_registrations.end() && it->second == reg)
+            {
+                arm(fd, EPOLL_CTL_MOD);
+            }
+
+            m_cv.notify_all();
+        }
+    }
+
+    SWSS_LOG_NOTICE("ending packet I/O pool thread");
+}
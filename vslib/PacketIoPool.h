@@ -0,0 +1,100 @@
+#pragma once
+
+#include "PacketBatch.h"
+
+#include "swss/sal.h"
+
+#include <functional>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <vector>
+#include <map>
+
+namespace saivs
+{
+    /**
+     * @brief Packet I/O thread pool.
+     *
+     * Fixed number of threads servicing registered file descriptors using
+     * single epoll instance, instead of dedicated threads per descriptor.
+     * Descriptors are registered as one shot, so single descriptor is
+     * serviced by at most one thread at a time and frames on it are never
+     * reordered. Each thread owns its own packet batch which is passed to
+     * handler.
+     */
+    class PacketIoPool
+    {
+        private:
+
+            PacketIoPool(const PacketIoPool&) = delete;
+            PacketIoPool& operator=(const PacketIoPool&) = delete;
+
+        public:
+
+            /**
+             * @brief Handler called when descriptor is readable.
+             *
+             * Handler should process available data without blocking. If
+             * handler returns false, descriptor will not be serviced
+             * anymore (it stays registered until removed).
+             */
+            typedef std::function<bool(PacketBatch&)> Handler;
+
+            PacketIoPool(
+                    _In_ size_t threadCount);
+
+            virtual ~PacketIoPool();
+
+        public:
+
+            bool add(
+                    _In_ int fd,
+                    _In_ const Handler& handler);
+
+            /**
+             * @brief Remove descriptor from pool.
+             *
+             * When this function returns, handler is not executing and it
+             * will not be executed anymore, so descriptor can be closed.
+             * Must not be called from handler of the same descriptor.
+             */
+            void remove(
+                    _In_ int fd);
+
+            size_t getThreadCount() const;
+
+        private:
+
+            void threadFun();
+
+            bool arm(
+                    _In_ int fd,
+                    _In_ int op);
+
+        private:
+
+            struct Registration
+            {
+                Handler m_handler;
+
+                bool m_busy;
+            };
+
+            int m_epollfd;
+
+            int m_exitfd;
+
+            std::atomic_bool m_run;
+
+            std::mutex m_mutex;
+
+            std::condition_variable m_cv;
+
+            std::map<int, std::shared_ptr<Registration>> m_registrations;
+
+            std::vector<std::shared_ptr<std::thread>> m_threads;
+    };
+}
@@ -0,0 +1,113 @@
+#include "ReferenceIndex.h"
+
+#include "swss/logger.h"
+
+using namespace saivs;
+
+static const std::map<sai_object_type_t, std::vector<sai_attr_id_t>> g_indexedAttributes =
+{
+    { SAI_OBJECT_TYPE_VLAN_MEMBER, { SAI_VLAN_MEMBER_ATTR_VLAN_ID } },
+    { SAI_OBJECT_TYPE_BRIDGE_PORT, { SAI_BRIDGE_PORT_ATTR_BRIDGE_ID } },
+    { SAI_OBJECT_TYPE_ACL_ENTRY, { SAI_ACL_ENTRY_ATTR_TABLE_ID } },
+    { SAI_OBJECT_TYPE_ACL_COUNTER, { SAI_ACL_COUNTER_ATTR_TABLE_ID } },
+};
+
+const std::vector<sai_attr_id_t>& ReferenceIndex::getIndexedAttributes(
+        _In_ sai_object_type_t objectType)
+{
+    SWSS_LOG_ENTER();
+
+    static const std::vector<sai_attr_id_t> empty;
+
+    auto it = g_indexedAttributes.find(objectType);
+
+    if (it == g_indexedAttributes.end())
+    {
+        return empty;
+    }
+
+    return it->second;
+}
+
+bool ReferenceIndex::isIndexed(
+        _In_ sai_object_type_t objectType,
+        _In_ sai_attr_id_t attrId)
+{
+    SWSS_LOG_ENTER();
+
+    for (auto id: getIndexedAttributes(objectType))
+    {
+        if (id == attrId)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void ReferenceIndex::insert(
+        _In_ sai_object_type_t objectType,
+        _In_ sai_attr_id_t attrId,
+        _In_ sai_object_id_t referencedId,
+        _In_ const std::string& serializedObjectId)
+{
+    SWSS_LOG_ENTER();
+
+    m_index[Key(objectType, attrId)][referencedId].insert(serializedObjectId);
+}
+
+void ReferenceIndex::remove(
+        _In_ sai_object_type_t objectType,
+        _In_ sai_attr_id_t attrId,
+        _In_ sai_object_id_t referencedId,
+        _In_ const std::string& serializedObjectId)
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_index.find(Key(objectType, attrId));
+
+    if (it == m_index.end())
+        return;
+
+    auto rit = it->second.find(referencedId);
+
+    if (rit == it->second.end())
+        return;
+
+    rit->second.erase(serializedObjectId);
+
+    if (rit->second.empty())
+    {
+        it->second.erase(rit);
+    }
+}
+
+const std::set<std::string>& ReferenceIndex::getReferencing(
+        _In_ sai_object_type_t objectType,
+        _In_ sai_attr_id_t attrId,
+        _In_ sai_object_id_t referencedId) const
+{
+    SWSS_LOG_ENTER();
+
+    static const std::set<std::string> empty;
+
+    auto it = m_index.find(Key(objectType, attrId));
+
+    if (it == m_index.end())
+        return empty;
+
+    auto rit = it->second.find(referencedId);
+
+    if (rit == it->second.end())
+        return empty;
+
+    return rit->second;
+}
+
+void ReferenceIndex::clear()
+{
+    SWSS_LOG_ENTER();
+
+    m_index.clear();
+}
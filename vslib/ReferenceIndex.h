@@ -0,0 +1,77 @@
+#pragma once
+
+extern "C" {
+#include "saimetadata.h"
+}
+
+#include <unordered_map>
+#include <vector>
+#include <string>
+#include <map>
+#include <set>
+
+namespace saivs
+{
+    /**
+     * @brief Reverse reference index.
+     *
+     * For selected member type objects (like VLAN member or ACL entry) keeps
+     * parent object id to set of member objects referencing it by given
+     * attribute. This allows read only list attributes like VLAN member list
+     * to be recalculated in O(members) instead of walking all objects of
+     * member type. Members which don't have indexed attribute set are kept
+     * under SAI_NULL_OBJECT_ID.
+     */
+    class ReferenceIndex
+    {
+        public:
+
+            ReferenceIndex() = default;
+
+            virtual ~ReferenceIndex() = default;
+
+        public:
+
+            /**
+             * @brief Get indexed attributes of object type, empty if none.
+             */
+            static const std::vector<sai_attr_id_t>& getIndexedAttributes(
+                    _In_ sai_object_type_t objectType);
+
+            static bool isIndexed(
+                    _In_ sai_object_type_t objectType,
+                    _In_ sai_attr_id_t attrId);
+
+        public:
+
+            void insert(
+                    _In_ sai_object_type_t objectType,
+                    _In_ sai_attr_id_t attrId,
+                    _In_ sai_object_id_t referencedId,
+                    _In_ const std::string& serializedObjectId);
+
+            void remove(
+                    _In_ sai_object_type_t objectType,
+                    _In_ sai_attr_id_t attrId,
+                    _In_ sai_object_id_t referencedId,
+                    _In_ const std::string& serializedObjectId);
+
+            /**
+             * @brief Get serialized object ids referencing given object.
+             *
+             * Objects are ordered the same way as in switch state object hash.
+             */
+            const std::set<std::string>& getReferencing(
+                    _In_ sai_object_type_t objectType,
+                    _In_ sai_attr_id_t attrId,
+                    _In_ sai_object_id_t referencedId) const;
+
+            void clear();
+
+        private:
+
+            typedef std::pair<sai_object_type_t, sai_attr_id_t> Key;
+
+            std::map<Key, std::unordered_map<sai_object_id_t, std::set<std::string>>> m_index;
+    };
+}
@@ -163,6 +163,58 @@ sai_status_t Sai::apiInitialize(
 
     SWSS_LOG_NOTICE("use configured speed as oper speed: %s", (useConfiguredSpeedAsOperSpeed ? "true" : "false"));
 
+    const char *use_typed_object_store = service_method_table->profile_get_value(0, SAI_KEY_VS_USE_TYPED_OBJECT_STORE);
+
+    auto useTypedObjectStore = SwitchConfig::parseUseTypedObjectStore(use_typed_object_store);
+
+    SWSS_LOG_NOTICE("use typed object store: %s", (useTypedObjectStore ? "true" : "false"));
+
+    auto cstrHostifPacketIoThreads = service_method_table->profile_get_value(0, SAI_KEY_VS_HOSTIF_PACKET_IO_THREADS);
+
+    uint32_t hostifPacketIoThreads = 0;
+
+    if (cstrHostifPacketIoThreads != nullptr)
+    {
+        if (sscanf(cstrHostifPacketIoThreads, "%u", &hostifPacketIoThreads) != 1)
+        {
+            SWSS_LOG_WARN("failed to parse '%s' as uint32 using dedicated hostif threads", cstrHostifPacketIoThreads);
+
+            hostifPacketIoThreads = 0;
+        }
+    }
+
+    SWSS_LOG_NOTICE("hostif packet I/O threads: %u", hostifPacketIoThreads);
+
+    auto cstrTrafficModelPps = service_method_table->profile_get_value(0, SAI_KEY_VS_TRAFFIC_MODEL_PPS);
+
+    uint64_t trafficModelPps = 0;
+
+    if (cstrTrafficModelPps != nullptr)
+    {
+        if (sscanf(cstrTrafficModelPps, "%" SCNu64, &trafficModelPps) != 1)
+        {
+            SWSS_LOG_WARN("failed to parse '%s' as uint64 disabling traffic model", cstrTrafficModelPps);
+
+            trafficModelPps = 0;
+        }
+    }
+
+    auto cstrTrafficModelPacketSize = service_method_table->profile_get_value(0, SAI_KEY_VS_TRAFFIC_MODEL_PACKET_SIZE);
+
+    uint32_t trafficModelPacketSize = SAI_VS_TRAFFIC_MODEL_DEFAULT_PACKET_SIZE;
+
+    if (cstrTrafficModelPacketSize != nullptr)
+    {
+        if (sscanf(cstrTrafficModelPacketSize, "%u", &trafficModelPacketSize) != 1)
+        {
+            SWSS_LOG_WARN("failed to parse '%s' as uint32 using default traffic model packet size", cstrTrafficModelPacketSize);
+
+            trafficModelPacketSize = SAI_VS_TRAFFIC_MODEL_DEFAULT_PACKET_SIZE;
+        }
+    }
+
+    SWSS_LOG_NOTICE("traffic model: %" PRIu64 " pps, packet size %u", trafficModelPps, trafficModelPacketSize);
+
     auto cstrGlobalContext = service_method_table->profile_get_value(0, SAI_KEY_VS_GLOBAL_CONTEXT);
 
     m_globalContext = 0;
@@ -228,6 +280,10 @@ sai_status_t Sai::apiInitialize(
         sc->m_bootType = bootType;
         sc->m_useTapDevice = useTapDevice;
         sc->m_useConfiguredSpeedAsOperSpeed = useConfiguredSpeedAsOperSpeed;
+        sc->m_useTypedObjectStore = useTypedObjectStore;
+        sc->m_hostifPacketIoThreads = hostifPacketIoThreads;
+        sc->m_trafficModelPacketsPerSecond = trafficModelPps;
+        sc->m_trafficModelPacketSize = trafficModelPacketSize;
         sc->m_laneMap = m_laneMapContainer->getLaneMap(sc->m_switchIndex);
         sc->m_bfdOffload = bfdOffloadSupported;
 
@@ -560,7 +616,16 @@ sai_status_t Sai::bulkGetStats(
     SWSS_LOG_ENTER();
     VS_CHECK_API_INITIALIZED();
 
-    return SAI_STATUS_NOT_IMPLEMENTED;
+    return m_meta->bulkGetStats(
+            switchId,
+            object_type,
+            object_count,
+            object_key,
+            number_of_counters,
+            counter_ids,
+            mode,
+            object_statuses,
+            counters);
 }
 
 sai_status_t Sai::bulkClearStats(
@@ -577,7 +642,15 @@ sai_status_t Sai::bulkClearStats(
     SWSS_LOG_ENTER();
     VS_CHECK_API_INITIALIZED();
 
-    return SAI_STATUS_NOT_IMPLEMENTED;
+    return m_meta->bulkClearStats(
+            switchId,
+            object_type,
+            object_count,
+            object_key,
+            number_of_counters,
+            counter_ids,
+            mode,
+            object_statuses);
 }
 
 // BULK QUAD OID
@@ -3,6 +3,8 @@
 #include "swss/logger.h"
 #include "meta/sai_serialize.h"
 
+#include <algorithm>
+
 using namespace saivs;
 
 SwitchBCM56850::SwitchBCM56850(
@@ -495,63 +497,73 @@ sai_status_t SwitchBCM56850::refresh_bridge_port_list(
 
     sai_object_id_t default_1q_bridge_id = attr.value.oid;
 
-    std::map<sai_object_id_t, SwitchState::AttrHash> bridge_port_list_on_bridge_id;
+    // update default bridge port id's for bridge port if attr type is missing,
+    // such bridge ports are indexed under null bridge id, copy is made since
+    // set will update index
+
+    auto bridge_ports_without_bridge_id = m_referenceIndex.getReferencing(
+            SAI_OBJECT_TYPE_BRIDGE_PORT,
+            SAI_BRIDGE_PORT_ATTR_BRIDGE_ID,
+            SAI_NULL_OBJECT_ID);
 
-    // update default bridge port id's for bridge port if attr type is missing
-    for (const auto &bp: all_bridge_ports)
+    for (const auto &sid: bridge_ports_without_bridge_id)
     {
-        auto it = bp.second.find(m_type->attridname);
+        const auto &bp = all_bridge_ports.at(sid);
+
+        auto it = bp.find(m_type->attridname);
 
-        if (it == bp.second.end())
+        if (it == bp.end())
             continue;
 
         if (it->second->getAttr()->value.s32 != SAI_BRIDGE_PORT_TYPE_PORT)
             continue;
 
-        it = bp.second.find(m_bridge_id->attridname);
+        it = bp.find(m_bridge_id->attridname);
 
-        if (it != bp.second.end())
+        if (it != bp.end())
             continue;
 
         // this bridge port is type PORT, and it's missing BRIDGE_ID attr
 
         SWSS_LOG_NOTICE("setting default bridge id (%s) on bridge port %s",
                 sai_serialize_object_id(default_1q_bridge_id).c_str(),
-                bp.first.c_str());
+                sid.c_str());
 
         attr.id = SAI_BRIDGE_PORT_ATTR_BRIDGE_ID;
         attr.value.oid = default_1q_bridge_id;
 
         sai_object_id_t bridge_port;
-        sai_deserialize_object_id(bp.first, bridge_port);
+        sai_deserialize_object_id(sid, bridge_port);
 
         CHECK_STATUS(set(SAI_OBJECT_TYPE_BRIDGE_PORT, bridge_port, &attr));
     }
 
-    // will contain 1q router bridge port, which we want to skip?
-    for (const auto &bp: all_bridge_ports)
+    std::map<sai_object_id_t, std::vector<sai_object_id_t>> bridge_ports_on_port_id;
+
+    size_t bridge_port_count = 0;
+
+    for (const auto &sid: m_referenceIndex.getReferencing(SAI_OBJECT_TYPE_BRIDGE_PORT, SAI_BRIDGE_PORT_ATTR_BRIDGE_ID, bridge_id))
     {
-        auto it = bp.second.find(m_bridge_id->attridname);
+        /*
+         * This bridge port belongs to currently processing bridge ID.
+         */
 
-        if (it == bp.second.end())
+        const auto &bp = all_bridge_ports.at(sid);
+
+        auto it = bp.find(m_port_id->attridname);
+
+        if (it == bp.end())
         {
-            // fine on router 1q
-            SWSS_LOG_NOTICE("not found %s on bridge port: %s", m_bridge_id->attridname, bp.first.c_str());
-            continue;
+            SWSS_LOG_THROW("bridge port is missing %s, not supported yet, FIXME", m_port_id->attridname);
         }
 
-        if (bridge_id == it->second->getAttr()->value.oid)
-        {
-            /*
-             * This bridge port belongs to currently processing bridge ID.
-             */
+        sai_object_id_t bridge_port;
 
-            sai_object_id_t bridge_port;
+        sai_deserialize_object_id(sid, bridge_port);
 
-            sai_deserialize_object_id(bp.first, bridge_port);
+        bridge_ports_on_port_id[it->second->getAttr()->value.oid].push_back(bridge_port);
 
-            bridge_port_list_on_bridge_id[bridge_port] = bp.second;
-        }
+        bridge_port_count++;
     }
 
     /*
@@ -562,26 +574,20 @@ sai_status_t SwitchBCM56850::refresh_bridge_port_list(
 
     for (const auto &p: m_port_list)
     {
-        for (const auto &bp: bridge_port_list_on_bridge_id)
-        {
-            auto it = bp.second.find(m_port_id->attridname);
+        auto it = bridge_ports_on_port_id.find(p);
 
-            if (it == bp.second.end())
-            {
-                SWSS_LOG_THROW("bridge port is missing %s, not supported yet, FIXME", m_port_id->attridname);
-            }
+        if (it == bridge_ports_on_port_id.end())
+            continue;
 
-            if (p == it->second->getAttr()->value.oid)
-            {
-                bridge_port_list.push_back(bp.first);
-            }
-        }
+        std::sort(it->second.begin(), it->second.end());
+
+        bridge_port_list.insert(bridge_port_list.end(), it->second.begin(), it->second.end());
     }
 
-    if (bridge_port_list_on_bridge_id.size() != bridge_port_list.size())
+    if (bridge_port_count != bridge_port_list.size())
     {
         SWSS_LOG_THROW("filter by port id failed size on lists is different: %zu vs %zu",
-                bridge_port_list_on_bridge_id.size(),
+                bridge_port_count,
                 bridge_port_list.size());
     }
 
@@ -19,7 +19,11 @@ SwitchConfig::SwitchConfig(
     m_hardwareInfo(hwinfo),
     m_useTapDevice(false),
     m_bfdOffload(true),
-    m_useConfiguredSpeedAsOperSpeed(false)
+    m_useConfiguredSpeedAsOperSpeed(false),
+    m_useTypedObjectStore(true),
+    m_hostifPacketIoThreads(0),
+    m_trafficModelPacketsPerSecond(0),
+    m_trafficModelPacketSize(SAI_VS_TRAFFIC_MODEL_DEFAULT_PACKET_SIZE)
 {
     SWSS_LOG_ENTER();
 
@@ -173,3 +177,16 @@ bool SwitchConfig::parseBfdOffloadSupported(
 
     return true;
 }
+
+bool SwitchConfig::parseUseTypedObjectStore(
+        _In_ const char* useTypedObjectStoreStr)
+{
+    SWSS_LOG_ENTER();
+
+    if (useTypedObjectStoreStr)
+    {
+        return strcmp(useTypedObjectStoreStr, "true") == 0;
+    }
+
+    return true;
+}
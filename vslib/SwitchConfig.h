@@ -72,6 +72,9 @@ namespace saivs
             static bool parseBfdOffloadSupported(
                     _In_ const char* bfdOffloadSupportedStr);
 
+            static bool parseUseTypedObjectStore(
+                    _In_ const char* useTypedObjectStoreStr);
+
         public:
 
             sai_switch_type_t m_saiSwitchType;
@@ -90,6 +93,14 @@ namespace saivs
 
             bool m_useConfiguredSpeedAsOperSpeed;
 
+            bool m_useTypedObjectStore;
+
+            uint32_t m_hostifPacketIoThreads;
+
+            uint64_t m_trafficModelPacketsPerSecond;
+
+            uint32_t m_trafficModelPacketSize;
+
             std::shared_ptr<LaneMap> m_laneMap;
 
             std::shared_ptr<LaneMap> m_fabricLaneMap;
@@ -3,6 +3,8 @@
 #include "swss/logger.h"
 #include "meta/sai_serialize.h"
 
+#include <algorithm>
+
 using namespace saivs;
 
 SwitchMLNX2700::SwitchMLNX2700(
@@ -321,35 +323,37 @@ sai_status_t SwitchMLNX2700::refresh_bridge_port_list(
 
     auto me_port_list = sai_metadata_get_attr_metadata(SAI_OBJECT_TYPE_BRIDGE, SAI_BRIDGE_ATTR_PORT_LIST);
     auto m_port_id = sai_metadata_get_attr_metadata(SAI_OBJECT_TYPE_BRIDGE_PORT, SAI_BRIDGE_PORT_ATTR_PORT_ID);
-    auto m_bridge_id = sai_metadata_get_attr_metadata(SAI_OBJECT_TYPE_BRIDGE_PORT, SAI_BRIDGE_PORT_ATTR_BRIDGE_ID);
 
     /*
      * First get all port's that belong to this bridge id.
      */
 
-    std::map<sai_object_id_t, SwitchState::AttrHash> bridge_port_list_on_bridge_id;
+    std::map<sai_object_id_t, std::vector<sai_object_id_t>> bridge_ports_on_port_id;
+
+    size_t bridge_port_count = 0;
 
-    for (const auto &bp: all_bridge_ports)
+    for (const auto &sid: m_referenceIndex.getReferencing(SAI_OBJECT_TYPE_BRIDGE_PORT, SAI_BRIDGE_PORT_ATTR_BRIDGE_ID, bridge_id))
     {
-        auto it = bp.second.find(m_bridge_id->attridname);
+        /*
+         * This bridge port belongs to currently processing bridge ID.
+         */
+
+        const auto &bp = all_bridge_ports.at(sid);
+
+        auto it = bp.find(m_port_id->attridname);
 
-        if (it == bp.second.end())
+        if (it == bp.end())
         {
-            continue;
+            SWSS_LOG_THROW("bridge port is missing %s, not supported yet, FIXME", m_port_id->attridname);
         }
 
-        if (bridge_id == it->second->getAttr()->value.oid)
-        {
-            /*
-             * This bridge port belongs to currently processing bridge ID.
-             */
+        sai_object_id_t bridge_port;
 
-            sai_object_id_t bridge_port;
+        sai_deserialize_object_id(sid, bridge_port);
 
-            sai_deserialize_object_id(bp.first, bridge_port);
+        bridge_ports_on_port_id[it->second->getAttr()->value.oid].push_back(bridge_port);
 
-            bridge_port_list_on_bridge_id[bridge_port] = bp.second;
-        }
+        bridge_port_count++;
     }
 
     /*
@@ -360,26 +364,20 @@ sai_status_t SwitchMLNX2700::refresh_bridge_port_list(
 
     for (const auto &p: m_port_list)
     {
-        for (const auto &bp: bridge_port_list_on_bridge_id)
-        {
-            auto it = bp.second.find(m_port_id->attridname);
+        auto it = bridge_ports_on_port_id.find(p);
 
-            if (it == bp.second.end())
-            {
-                SWSS_LOG_THROW("bridge port is missing %s, not supported yet, FIXME", m_port_id->attridname);
-            }
+        if (it == bridge_ports_on_port_id.end())
+            continue;
 
-            if (p == it->second->getAttr()->value.oid)
-            {
-                bridge_port_list.push_back(bp.first);
-            }
-        }
+        std::sort(it->second.begin(), it->second.end());
+
+        bridge_port_list.insert(bridge_port_list.end(), it->second.begin(), it->second.end());
     }
 
-    if (bridge_port_list_on_bridge_id.size() != bridge_port_list.size())
+    if (bridge_port_count != bridge_port_list.size())
     {
         SWSS_LOG_THROW("filter by port id failed size on lists is different: %zu vs %zu",
-                bridge_port_list_on_bridge_id.size(),
+                bridge_port_count,
                 bridge_port_list.size());
     }
 
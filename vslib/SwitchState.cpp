@@ -13,10 +13,17 @@
 #include <netlink/route/addr.h>
 #include <linux/if.h>
 
+#include <chrono>
+
 using namespace saivs;
 
 #define VS_COUNTERS_COUNT_MSB (0x80000000)
 
+#define VS_STATS_MODES (SAI_STATS_MODE_READ_AND_CLEAR | \
+        SAI_STATS_MODE_BULK_READ | \
+        SAI_STATS_MODE_BULK_READ_AND_CLEAR | \
+        SAI_STATS_MODE_BULK_CLEAR)
+
 const std::map<sai_stat_id_t, std::string> SwitchState::m_statIdMap =
 {
         { SAI_PORT_STAT_IF_IN_OCTETS, "rx_bytes" },
@@ -73,6 +80,13 @@ SwitchState::SwitchState(
         SWSS_LOG_NOTICE("resource limiter is SET on switch %s",
                 sai_serialize_object_id(switch_id).c_str());
     }
+
+    if (m_switchConfig->m_trafficModelPacketsPerSecond)
+    {
+        m_counterStore.setTrafficModel(
+                m_switchConfig->m_trafficModelPacketsPerSecond,
+                m_switchConfig->m_trafficModelPacketSize);
+    }
 }
 
 SwitchState::~SwitchState()
@@ -310,56 +324,48 @@ sai_status_t SwitchState::getStatsExt(
         perform_set = true;
     }
 
-    auto str_object_id = sai_serialize_object_id(object_id);
-
-    auto mapit = m_countersMap.find(str_object_id);
+    if (perform_set)
+    {
+        m_counterStore.set(object_type, object_id, number_of_counters, counter_ids, counters);
 
-    if (mapit == m_countersMap.end())
-        m_countersMap[str_object_id] = { };
+        return SAI_STATUS_SUCCESS;
+    }
 
-    auto& localcounters = m_countersMap[str_object_id];
+    /*
+     * In non unit test mode, fetch port counters from host interface, unless
+     * traffic model is enabled, then synthetic counters are used.
+     */
 
-    for (uint32_t i = 0; i < number_of_counters; ++i)
+    if (!enabled && (object_type == SAI_OBJECT_TYPE_PORT) && !m_counterStore.isTrafficModelEnabled())
     {
-        int32_t id = counter_ids[i];
-        uint64_t counter;
-
-        if (perform_set)
-        {
-            localcounters[ id ] = counters[i];
-        }
-        else
+        for (uint32_t i = 0; i < number_of_counters; ++i)
         {
-            auto it = localcounters.find(id);
+            uint64_t counter;
 
-            if (it == localcounters.end())
-            {
-                // if counter is not found on list, just return 0
-                counters[i] = 0;
-            }
-            else
+            if (getPortStat(object_id, counter_ids[i], counter) != SAI_STATUS_SUCCESS)
             {
-                counters[i] = it->second;
+                return SAI_STATUS_FAILURE;
             }
 
-            /* In non unit test mode, fetch port counters from host interface */
-            if (!enabled && (object_type == SAI_OBJECT_TYPE_PORT))
-            {
-                if (getPortStat(object_id, id, counter) != SAI_STATUS_SUCCESS)
-                {
-                    return SAI_STATUS_FAILURE;
-                }
-
-                localcounters[ id ] = counter;
-            }
-
-            if (mode == SAI_STATS_MODE_READ_AND_CLEAR)
-            {
-                localcounters[ id ] = 0;
-            }
+            m_counterStore.set(object_type, object_id, 1, &counter_ids[i], &counter);
         }
     }
 
+    bool clear = (mode == SAI_STATS_MODE_READ_AND_CLEAR ||
+            mode == SAI_STATS_MODE_BULK_READ_AND_CLEAR ||
+            mode == SAI_STATS_MODE_BULK_CLEAR);
+
+    auto now = std::chrono::steady_clock::now().time_since_epoch();
+
+    m_counterStore.get(
+            object_type,
+            object_id,
+            number_of_counters,
+            counter_ids,
+            clear,
+            counters,
+            (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(now).count());
+
     return SAI_STATUS_SUCCESS;
 }
 
@@ -387,7 +393,7 @@ sai_status_t SwitchState::queryStatsCapability(
     for (uint32_t i = 0; i < stats_capability->count; i++)
     {
         stats_capability->list[i].stat_enum = statenumlist[i];
-        stats_capability->list[i].stat_modes = SAI_STATS_MODE_READ_AND_CLEAR;
+        stats_capability->list[i].stat_modes = VS_STATS_MODES;
     }
     return SAI_STATUS_SUCCESS;
 }
@@ -416,7 +422,7 @@ sai_status_t SwitchState::queryStatsStCapability(
     for (uint32_t i = 0; i < stats_capability->count; i++)
     {
         stats_capability->list[i].capability.stat_enum = statenumlist[i];
-        stats_capability->list[i].capability.stat_modes = SAI_STATS_MODE_READ_AND_CLEAR;
+        stats_capability->list[i].capability.stat_modes = VS_STATS_MODES;
         stats_capability->list[i].minimal_polling_interval = static_cast<uint64_t>(1e6 * 100);
     }
     return SAI_STATUS_SUCCESS;
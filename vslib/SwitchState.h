@@ -6,6 +6,8 @@ extern "C" {
 
 #include "SaiAttrWrap.h"
 #include "SwitchConfig.h"
+#include "TypedObjectStore.h"
+#include "CounterStore.h"
 
 #include "meta/Meta.h"
 
@@ -119,9 +121,15 @@ namespace saivs
 
             ObjectHash m_objectHash;
 
+            /**
+             * @brief Typed store for non object id entries, used only when
+             * switch config enables it, otherwise entries are in m_objectHash.
+             */
+            TypedObjectStore m_typedObjectStore;
+
         protected:
 
-            std::map<std::string, std::map<int, uint64_t>> m_countersMap;
+            CounterStore m_counterStore;
 
             sai_object_id_t m_switch_id;
 
@@ -22,6 +22,7 @@ SwitchStateBase::SwitchStateBase(
         _In_ std::shared_ptr<RealObjectIdManager> manager,
         _In_ std::shared_ptr<SwitchConfig> config):
     SwitchState(switch_id, config),
+    m_fdbAgingTimeValid(false),
     m_realObjectIdManager(manager)
 {
     SWSS_LOG_ENTER();
@@ -35,6 +36,7 @@ SwitchStateBase::SwitchStateBase(
         _In_ std::shared_ptr<SwitchConfig> config,
         _In_ std::shared_ptr<WarmBootState> warmBootState):
     SwitchState(switch_id, config),
+    m_fdbAgingTimeValid(false),
     m_realObjectIdManager(manager)
 {
     SWSS_LOG_ENTER();
@@ -45,15 +47,31 @@ SwitchStateBase::SwitchStateBase(
     {
         for (auto& kvp: warmBootState->m_objectHash)
         {
+            if (useTypedObjectStore(kvp.first))
+            {
+                loadTypedObjectStore(kvp.first, kvp.second);
+                continue;
+            }
+
             // we write only existing ones, since base constructor
             // created empty entries for non existing object types
             m_objectHash[kvp.first] = kvp.second;
+
+            for (auto& o: kvp.second)
+            {
+                indexObject(kvp.first, o.first, o.second, true);
+            }
         }
 
         if (m_switchConfig->m_useTapDevice)
         {
             m_fdb_info_set = warmBootState->m_fdbInfoSet;
 
+            for (auto& fi: m_fdb_info_set)
+            {
+                m_fdbAgingWheel.touch(fi, fi.getTimestamp());
+            }
+
             // TODO populate m_hostif_info_map - need to be able to remove port after warm boot
             // should be auto populated vs_recreate_hostif_tap_interfaces on create_switch
         }
@@ -249,6 +267,15 @@ sai_status_t SwitchStateBase::create_internal(
 {
     SWSS_LOG_ENTER();
 
+    if (useTypedObjectStore(object_type))
+    {
+        sai_object_meta_key_t metaKey;
+
+        TypedObjectStore::deserializeMetaKey(object_type, serializedObjectId, metaKey);
+
+        return create_internal_typed(metaKey, attr_count, attr_list);
+    }
+
     auto &objectHash = m_objectHash.at(object_type);
 
     if (m_switchConfig->m_resourceLimiter)
@@ -302,6 +329,8 @@ sai_status_t SwitchStateBase::create_internal(
         objectHash[serializedObjectId][a->getAttrMetadata()->attridname] = a;
     }
 
+    indexObject(object_type, serializedObjectId, objectHash.at(serializedObjectId), true);
+
     if (object_type == SAI_OBJECT_TYPE_SWITCH)
     {
         // Set POST state.
@@ -467,6 +496,15 @@ sai_status_t SwitchStateBase::remove_internal(
 
     SWSS_LOG_INFO("removing object: %s", serializedObjectId.c_str());
 
+    if (useTypedObjectStore(object_type))
+    {
+        sai_object_meta_key_t metaKey;
+
+        TypedObjectStore::deserializeMetaKey(object_type, serializedObjectId, metaKey);
+
+        return remove_typed(metaKey);
+    }
+
     auto &objectHash = m_objectHash.at(object_type);
 
     auto it = objectHash.find(serializedObjectId);
@@ -480,8 +518,18 @@ sai_status_t SwitchStateBase::remove_internal(
         return SAI_STATUS_ITEM_NOT_FOUND;
     }
 
+    indexObject(object_type, serializedObjectId, it->second, false);
+
     objectHash.erase(it);
 
+    if (m_counterStore.getObjectCount(object_type))
+    {
+        sai_object_id_t objectId;
+        sai_deserialize_object_id(serializedObjectId, objectId);
+
+        m_counterStore.remove(object_type, objectId);
+    }
+
     return SAI_STATUS_SUCCESS;
 }
 
@@ -582,6 +630,13 @@ sai_status_t SwitchStateBase::set(
 {
     SWSS_LOG_ENTER();
 
+    if (objectType == SAI_OBJECT_TYPE_SWITCH && attr && attr->id == SAI_SWITCH_ATTR_FDB_AGING_TIME)
+    {
+        // aging time is cached by aging thread
+
+        m_fdbAgingTimeValid = false;
+    }
+
     if (objectType == SAI_OBJECT_TYPE_PORT)
     {
         sai_object_id_t objectId;
@@ -620,6 +675,15 @@ sai_status_t SwitchStateBase::set_internal(
 {
     SWSS_LOG_ENTER();
 
+    if (useTypedObjectStore(objectType))
+    {
+        sai_object_meta_key_t metaKey;
+
+        TypedObjectStore::deserializeMetaKey(objectType, serializedObjectId, metaKey);
+
+        return set_typed(metaKey, attr);
+    }
+
     auto it = m_objectHash.at(objectType).find(serializedObjectId);
 
     if (it == m_objectHash.at(objectType).end())
@@ -633,6 +697,8 @@ sai_status_t SwitchStateBase::set_internal(
 
     auto &attrHash = it->second;
 
+    indexAttribute(objectType, serializedObjectId, attrHash, attr);
+
     auto a = std::make_shared<SaiAttrWrap>(objectType, attr);
 
     // set have only one attribute
@@ -684,6 +750,15 @@ sai_status_t SwitchStateBase::get(
         }
     }
 
+    if (useTypedObjectStore(objectType))
+    {
+        sai_object_meta_key_t metaKey;
+
+        TypedObjectStore::deserializeMetaKey(objectType, serializedObjectId, metaKey);
+
+        return get_typed(metaKey, attr_count, attr_list);
+    }
+
     const auto &objectHash = m_objectHash.at(objectType);
 
     auto it = objectHash.find(serializedObjectId);
@@ -810,6 +885,316 @@ sai_status_t SwitchStateBase::get(
     return final_status;
 }
 
+bool SwitchStateBase::useTypedObjectStore(
+        _In_ sai_object_type_t objectType) const
+{
+    SWSS_LOG_ENTER();
+
+    /*
+     * VPP switch is overriding all internal accessors and keeps its own
+     * object database in sync with m_objectHash, so typed store is not used
+     * there.
+     */
+
+    return m_switchConfig->m_useTypedObjectStore &&
+        m_switchConfig->m_switchType != SAI_VS_SWITCH_TYPE_VPP &&
+        TypedObjectStore::isSupportedObjectType(objectType);
+}
+
+sai_status_t SwitchStateBase::create_internal_typed(
+        _In_ const sai_object_meta_key_t& metaKey,
+        _In_ uint32_t attr_count,
+        _In_ const sai_attribute_t *attr_list)
+{
+    SWSS_LOG_ENTER();
+
+    auto object_type = metaKey.objecttype;
+
+    if (m_switchConfig->m_resourceLimiter)
+    {
+        size_t limit = m_switchConfig->m_resourceLimiter->getObjectTypeLimit(object_type);
+
+        if (m_typedObjectStore.size(object_type) >= limit)
+        {
+            SWSS_LOG_ERROR("too many %s, created %zu is resource limit",
+                    sai_serialize_object_type(object_type).c_str(),
+                    limit);
+
+            return SAI_STATUS_INSUFFICIENT_RESOURCES;
+        }
+    }
+
+    auto status = m_typedObjectStore.create(metaKey, attr_count, attr_list);
+
+    if (status == SAI_STATUS_ITEM_ALREADY_EXISTS)
+    {
+        SWSS_LOG_ERROR("create failed, object already exists, object type: %s: id: %s",
+                sai_serialize_object_type(object_type).c_str(),
+                TypedObjectStore::serializeObjectId(metaKey).c_str());
+    }
+
+    return status;
+}
+
+sai_status_t SwitchStateBase::remove_typed(
+        _In_ const sai_object_meta_key_t& metaKey)
+{
+    SWSS_LOG_ENTER();
+
+    auto status = m_typedObjectStore.remove(metaKey);
+
+    if (status != SAI_STATUS_SUCCESS)
+    {
+        SWSS_LOG_ERROR("not found %s", sai_serialize_object_meta_key(metaKey).c_str());
+    }
+
+    return status;
+}
+
+sai_status_t SwitchStateBase::set_typed(
+        _In_ const sai_object_meta_key_t& metaKey,
+        _In_ const sai_attribute_t* attr)
+{
+    SWSS_LOG_ENTER();
+
+    auto status = m_typedObjectStore.set(metaKey, attr);
+
+    if (status == SAI_STATUS_ITEM_NOT_FOUND)
+    {
+        SWSS_LOG_ERROR("not found %s", sai_serialize_object_meta_key(metaKey).c_str());
+    }
+
+    return status;
+}
+
+sai_status_t SwitchStateBase::get_typed(
+        _In_ const sai_object_meta_key_t& metaKey,
+        _In_ uint32_t attr_count,
+        _Out_ sai_attribute_t *attr_list)
+{
+    SWSS_LOG_ENTER();
+
+    auto objectType = metaKey.objecttype;
+
+    auto slots = m_typedObjectStore.find(metaKey);
+
+    if (slots == nullptr)
+    {
+        SWSS_LOG_ERROR("not found %s", sai_serialize_object_meta_key(metaKey).c_str());
+
+        return SAI_STATUS_ITEM_NOT_FOUND;
+    }
+
+    /*
+     * Non object id entries can't have read only attributes, so there is no
+     * need to refresh anything here.
+     */
+
+    sai_status_t final_status = SAI_STATUS_SUCCESS;
+
+    for (uint32_t idx = 0; idx < attr_count; ++idx)
+    {
+        sai_attr_id_t id = attr_list[idx].id;
+
+        auto meta = sai_metadata_get_attr_metadata(objectType, id);
+
+        if (meta == NULL)
+        {
+            SWSS_LOG_ERROR("failed to find attribute %d for %s", id,
+                    sai_serialize_object_meta_key(metaKey).c_str());
+
+            return SAI_STATUS_FAILURE;
+        }
+
+        auto attr = slots->get(id);
+
+        if (attr == nullptr)
+        {
+            SWSS_LOG_WARN("%s not implemented on %s",
+                    meta->attridname,
+                    sai_serialize_object_meta_key(metaKey).c_str());
+
+            return SAI_STATUS_NOT_IMPLEMENTED;
+        }
+
+        auto status = transfer_attributes(objectType, 1, attr, &attr_list[idx], false);
+
+        if (status == SAI_STATUS_BUFFER_OVERFLOW)
+        {
+            SWSS_LOG_NOTICE("BUFFER_OVERFLOW %s: %s",
+                    sai_serialize_object_meta_key(metaKey).c_str(),
+                    meta->attridname);
+
+            final_status = status;
+            continue;
+        }
+
+        if (status != SAI_STATUS_SUCCESS)
+        {
+            SWSS_LOG_ERROR("get failed %s: %s: %s",
+                    sai_serialize_object_meta_key(metaKey).c_str(),
+                    meta->attridname,
+                    sai_serialize_status(status).c_str());
+
+            return status;
+        }
+    }
+
+    return final_status;
+}
+
+sai_status_t SwitchStateBase::createEntry(
+        _In_ const sai_object_meta_key_t& metaKey,
+        _In_ sai_object_id_t switch_id,
+        _In_ uint32_t attr_count,
+        _In_ const sai_attribute_t *attr_list)
+{
+    SWSS_LOG_ENTER();
+
+    // neighbor entries on VOQ systems need extra programming done by string api
+
+    bool voqNeighbor = metaKey.objecttype == SAI_OBJECT_TYPE_NEIGHBOR_ENTRY && m_system_port_list.size();
+
+    if (useTypedObjectStore(metaKey.objecttype) && !voqNeighbor)
+    {
+        return create_internal_typed(metaKey, attr_count, attr_list);
+    }
+
+    return create(metaKey.objecttype, TypedObjectStore::serializeObjectId(metaKey), switch_id, attr_count, attr_list);
+}
+
+sai_status_t SwitchStateBase::removeEntry(
+        _In_ const sai_object_meta_key_t& metaKey)
+{
+    SWSS_LOG_ENTER();
+
+    if (useTypedObjectStore(metaKey.objecttype))
+    {
+        return remove_typed(metaKey);
+    }
+
+    return remove(metaKey.objecttype, TypedObjectStore::serializeObjectId(metaKey));
+}
+
+sai_status_t SwitchStateBase::setEntry(
+        _In_ const sai_object_meta_key_t& metaKey,
+        _In_ const sai_attribute_t* attr)
+{
+    SWSS_LOG_ENTER();
+
+    if (useTypedObjectStore(metaKey.objecttype))
+    {
+        return set_typed(metaKey, attr);
+    }
+
+    return set(metaKey.objecttype, TypedObjectStore::serializeObjectId(metaKey), attr);
+}
+
+sai_status_t SwitchStateBase::getEntry(
+        _In_ const sai_object_meta_key_t& metaKey,
+        _In_ uint32_t attr_count,
+        _Out_ sai_attribute_t *attr_list)
+{
+    SWSS_LOG_ENTER();
+
+    if (useTypedObjectStore(metaKey.objecttype))
+    {
+        return get_typed(metaKey, attr_count, attr_list);
+    }
+
+    return get(metaKey.objecttype, TypedObjectStore::serializeObjectId(metaKey), attr_count, attr_list);
+}
+
+void SwitchStateBase::loadTypedObjectStore(
+        _In_ sai_object_type_t objectType,
+        _In_ const std::map<std::string, AttrHash>& objects)
+{
+    SWSS_LOG_ENTER();
+
+    for (auto& o: objects)
+    {
+        sai_object_meta_key_t metaKey;
+
+        TypedObjectStore::deserializeMetaKey(objectType, o.first, metaKey);
+
+        std::vector<sai_attribute_t> attrs;
+
+        for (auto& a: o.second)
+        {
+            attrs.push_back(*a.second->getAttr());
+        }
+
+        auto status = m_typedObjectStore.create(metaKey, (uint32_t)attrs.size(), attrs.data());
+
+        if (status != SAI_STATUS_SUCCESS)
+        {
+            SWSS_LOG_THROW("failed to load %s:%s into typed object store: %s",
+                    sai_serialize_object_type(objectType).c_str(),
+                    o.first.c_str(),
+                    sai_serialize_status(status).c_str());
+        }
+    }
+}
+
+static sai_object_id_t get_referenced_id(
+        _In_ sai_object_type_t objectType,
+        _In_ sai_attr_id_t attrId,
+        _In_ const SwitchState::AttrHash& attrHash)
+{
+    SWSS_LOG_ENTER();
+
+    auto meta = sai_metadata_get_attr_metadata(objectType, attrId);
+
+    auto it = attrHash.find(meta->attridname);
+
+    if (it == attrHash.end())
+    {
+        return SAI_NULL_OBJECT_ID;
+    }
+
+    return it->second->getAttr()->value.oid;
+}
+
+void SwitchStateBase::indexObject(
+        _In_ sai_object_type_t objectType,
+        _In_ const std::string &serializedObjectId,
+        _In_ const AttrHash& attrHash,
+        _In_ bool insert)
+{
+    SWSS_LOG_ENTER();
+
+    for (auto attrId: ReferenceIndex::getIndexedAttributes(objectType))
+    {
+        auto referencedId = get_referenced_id(objectType, attrId, attrHash);
+
+        if (insert)
+        {
+            m_referenceIndex.insert(objectType, attrId, referencedId, serializedObjectId);
+        }
+        else
+        {
+            m_referenceIndex.remove(objectType, attrId, referencedId, serializedObjectId);
+        }
+    }
+}
+
+void SwitchStateBase::indexAttribute(
+        _In_ sai_object_type_t objectType,
+        _In_ const std::string &serializedObjectId,
+        _In_ const AttrHash& attrHash,
+        _In_ const sai_attribute_t* attr)
+{
+    SWSS_LOG_ENTER();
+
+    if (!ReferenceIndex::isIndexed(objectType, attr->id))
+        return;
+
+    auto referencedId = get_referenced_id(objectType, attr->id, attrHash);
+
+    m_referenceIndex.remove(objectType, attr->id, referencedId, serializedObjectId);
+    m_referenceIndex.insert(objectType, attr->id, attr->value.oid, serializedObjectId);
+}
+
 sai_status_t SwitchStateBase::bulkCreate(
         _In_ sai_object_id_t switch_id,
         _In_ sai_object_type_t object_type,
@@ -2415,43 +2800,18 @@ sai_status_t SwitchStateBase::refresh_vlan_member_list(
 {
     SWSS_LOG_ENTER();
 
-    auto &all_vlan_members = m_objectHash.at(SAI_OBJECT_TYPE_VLAN_MEMBER);
-
     auto m_member_list = sai_metadata_get_attr_metadata(SAI_OBJECT_TYPE_VLAN, SAI_VLAN_ATTR_MEMBER_LIST);
-    auto md_vlan_id = sai_metadata_get_attr_metadata(SAI_OBJECT_TYPE_VLAN_MEMBER, SAI_VLAN_MEMBER_ATTR_VLAN_ID);
-    //auto md_brportid = sai_metadata_get_attr_metadata(SAI_OBJECT_TYPE_VLAN_MEMBER, SAI_VLAN_MEMBER_ATTR_BRIDGE_PORT_ID);
 
     std::vector<sai_object_id_t> vlan_member_list;
 
-    /*
-     * We want order as bridge port order (so port order)
-     */
-
     sai_attribute_t attr;
 
-    auto me = m_objectHash.at(SAI_OBJECT_TYPE_VLAN).at(sai_serialize_object_id(vlan_id));
-
-    for (auto vm: all_vlan_members)
-    {
-        if (vm.second.at(md_vlan_id->attridname)->getAttr()->value.oid != vlan_id)
-        {
-            /*
-             * Only interested in our vlan
-             */
-
-            continue;
-        }
-
-        // TODO we need order as bridge ports, but we need bridge id!
+    // TODO we need order as bridge ports, but we need bridge id!
 
-        {
-            sai_object_id_t vlan_member_id;
+    attr.id = SAI_VLAN_MEMBER_ATTR_VLAN_ID;
+    attr.value.oid = vlan_id;
 
-            sai_deserialize_object_id(vm.first, vlan_member_id);
-
-            vlan_member_list.push_back(vlan_member_id);
-        }
-    }
+    findObjects(SAI_OBJECT_TYPE_VLAN_MEMBER, attr, vlan_member_list);
 
     uint32_t vlan_member_list_count = (uint32_t)vlan_member_list.size();
 
@@ -2942,44 +3302,43 @@ void SwitchStateBase::processFdbEntriesForAging()
 
     uint32_t current = (uint32_t)time(NULL);
 
-    sai_attribute_t attr;
+    if (!m_fdbAgingTimeValid)
+    {
+        sai_attribute_t attr;
 
-    attr.id = SAI_SWITCH_ATTR_FDB_AGING_TIME;
+        attr.id = SAI_SWITCH_ATTR_FDB_AGING_TIME;
 
-    sai_status_t status = get(SAI_OBJECT_TYPE_SWITCH, m_switch_id, 1, &attr);
+        sai_status_t status = get(SAI_OBJECT_TYPE_SWITCH, m_switch_id, 1, &attr);
 
-    if (status != SAI_STATUS_SUCCESS)
-    {
-        SWSS_LOG_WARN("failed to get FDB aging time for switch %s",
-                sai_serialize_object_id(m_switch_id).c_str());
+        if (status != SAI_STATUS_SUCCESS)
+        {
+            SWSS_LOG_WARN("failed to get FDB aging time for switch %s",
+                    sai_serialize_object_id(m_switch_id).c_str());
 
-        return;
-    }
+            return;
+        }
 
-    uint32_t aging_time = attr.value.u32;
+        m_fdbAgingWheel.setAgingTime(attr.value.u32);
 
-    if (aging_time == 0)
-    {
-        SWSS_LOG_DEBUG("aging is disabled");
-        return;
+        m_fdbAgingTimeValid = true;
     }
 
-    // find aged fdb entries
+    // only entries scheduled in elapsed wheel slots are examined
 
-    for (auto it = m_fdb_info_set.begin(); it != m_fdb_info_set.end();)
-    {
-        if ((current - it->getTimestamp()) >= aging_time)
-        {
-            FdbInfo fi = *it;
+    auto aged = m_fdbAgingWheel.expire(current);
 
-            processFdbInfo(fi, SAI_FDB_EVENT_AGED);
+    for (auto& fi: aged)
+    {
+        auto it = m_fdb_info_set.find(fi);
 
-            it = m_fdb_info_set.erase(it);
-        }
-        else
+        if (it == m_fdb_info_set.end())
         {
-            ++it;
+            continue;
         }
+
+        processFdbInfo(*it, SAI_FDB_EVENT_AGED);
+
+        m_fdb_info_set.erase(it);
     }
 }
 
@@ -3474,6 +3833,33 @@ std::string SwitchStateBase::dump_switch_database_for_warm_restart() const
         }
     }
 
+    m_typedObjectStore.forEach([&](const sai_object_meta_key_t& metaKey, const TypedObjectStore::AttrSlots& slots) {
+
+        auto strObjectType = sai_serialize_object_type(metaKey.objecttype);
+        auto strObjectId = TypedObjectStore::serializeObjectId(metaKey);
+
+        count++;
+
+        if (slots.size() == 0)
+        {
+            ss << strObjectType << " " << strObjectId << " NULL NULL" << std::endl;
+            return;
+        }
+
+        for (size_t idx = 0; idx < slots.size(); ++idx)
+        {
+            auto meta = slots.getMetadata(idx);
+
+            ss << strObjectType << " ";
+            ss << strObjectId;
+            ss << " ";
+            ss << meta->attridname;
+            ss << " ";
+            ss << sai_serialize_attr_value(*meta, *slots.getAttr(idx));
+            ss << std::endl;
+        }
+    });
+
     if (m_switchConfig->m_useTapDevice)
     {
         /*
@@ -3483,6 +3869,10 @@ std::string SwitchStateBase::dump_switch_database_for_warm_restart() const
 
         for (auto fi: m_fdb_info_set)
         {
+            // timestamp is refreshed only inside aging wheel
+
+            fi.setTimestamp(m_fdbAgingWheel.getTimestamp(fi));
+
             ss << SAI_VS_FDB_INFO << " " << fi.serialize() << std::endl;
         }
 
@@ -3520,11 +3910,11 @@ void SwitchStateBase::debugSetStats(
 {
     SWSS_LOG_ENTER();
 
-    auto key = sai_serialize_object_id(oid);
+    auto objectType = objectTypeQuery(oid);
 
     for (auto& kvp: stats)
     {
-        m_countersMap[key][kvp.first] = kvp.second;
+        m_counterStore.set(objectType, oid, 1, &kvp.first, &kvp.second);
     }
 }
 
@@ -4059,6 +4449,18 @@ void SwitchStateBase::findObjects(
 
     objects.clear();
 
+    if (ReferenceIndex::isIndexed(object_type, expect.id) && expect.value.oid != SAI_NULL_OBJECT_ID)
+    {
+        for (auto& sid: m_referenceIndex.getReferencing(object_type, expect.id, expect.value.oid))
+        {
+            sai_object_id_t object_id;
+            sai_deserialize_object_id(sid, object_id);
+            objects.push_back(object_id);
+        }
+
+        return;
+    }
+
     SaiAttrWrap expect_wrap(object_type, &expect);
 
     for (auto &obj : m_objectHash.at(object_type))
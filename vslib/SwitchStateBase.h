@@ -2,12 +2,14 @@
 
 #include "SwitchState.h"
 #include "FdbInfo.h"
+#include "FdbAgingWheel.h"
 #include "HostInterfaceInfo.h"
 #include "WarmBootState.h"
 #include "SwitchConfig.h"
 #include "RealObjectIdManager.h"
 #include "EventPayloadNetLinkMsg.h"
 #include "MACsecManager.h"
+#include "ReferenceIndex.h"
 
 #include <set>
 #include <unordered_set>
@@ -292,6 +294,34 @@ namespace saivs
                     _In_ uint32_t attr_count,
                     _Out_ sai_attribute_t *attr_list);
 
+        public: // non object id entries
+
+            /*
+             * Entries held by typed object store are passed by meta key, so
+             * they are not serialized and parsed back on each operation.
+             * Other entries are serialized and passed to string api.
+             */
+
+            sai_status_t createEntry(
+                    _In_ const sai_object_meta_key_t& metaKey,
+                    _In_ sai_object_id_t switch_id,
+                    _In_ uint32_t attr_count,
+                    _In_ const sai_attribute_t *attr_list);
+
+            sai_status_t removeEntry(
+                    _In_ const sai_object_meta_key_t& metaKey);
+
+            sai_status_t setEntry(
+                    _In_ const sai_object_meta_key_t& metaKey,
+                    _In_ const sai_attribute_t* attr);
+
+            sai_status_t getEntry(
+                    _In_ const sai_object_meta_key_t& metaKey,
+                    _In_ uint32_t attr_count,
+                    _Out_ sai_attribute_t *attr_list);
+
+        public:
+
             virtual sai_status_t bulkCreate(
                     _In_ sai_object_id_t switch_id,
                     _In_ sai_object_type_t object_type,
@@ -365,6 +395,54 @@ namespace saivs
                     _In_ const std::string &serializedObjectId,
                     _In_ const sai_attribute_t* attr);
 
+        protected: // typed object store
+
+            bool useTypedObjectStore(
+                    _In_ sai_object_type_t objectType) const;
+
+            sai_status_t create_internal_typed(
+                    _In_ const sai_object_meta_key_t& metaKey,
+                    _In_ uint32_t attr_count,
+                    _In_ const sai_attribute_t *attr_list);
+
+            sai_status_t remove_typed(
+                    _In_ const sai_object_meta_key_t& metaKey);
+
+            sai_status_t set_typed(
+                    _In_ const sai_object_meta_key_t& metaKey,
+                    _In_ const sai_attribute_t* attr);
+
+            sai_status_t get_typed(
+                    _In_ const sai_object_meta_key_t& metaKey,
+                    _In_ uint32_t attr_count,
+                    _Out_ sai_attribute_t *attr_list);
+
+            void loadTypedObjectStore(
+                    _In_ sai_object_type_t objectType,
+                    _In_ const std::map<std::string, AttrHash>& objects);
+
+        protected: // reverse reference index
+
+            /**
+             * @brief Insert or remove all indexed attributes of object.
+             */
+            void indexObject(
+                    _In_ sai_object_type_t objectType,
+                    _In_ const std::string &serializedObjectId,
+                    _In_ const AttrHash& attrHash,
+                    _In_ bool insert);
+
+            /**
+             * @brief Update index before attribute is set on object.
+             */
+            void indexAttribute(
+                    _In_ sai_object_type_t objectType,
+                    _In_ const std::string &serializedObjectId,
+                    _In_ const AttrHash& attrHash,
+                    _In_ const sai_attribute_t* attr);
+
+            ReferenceIndex m_referenceIndex;
+
         protected:
 
             sai_object_type_t objectTypeQuery(
@@ -797,10 +875,26 @@ namespace saivs
             virtual sai_status_t queryQueueStatsCapability(
                                       _Inout_ sai_stat_capability_list_t *stats_capability);
 
+        protected:
+
+            /**
+             * @brief Indicates whether FDB aging time cached in aging wheel
+             * is valid, invalidated on SAI_SWITCH_ATTR_FDB_AGING_TIME set.
+             */
+            bool m_fdbAgingTimeValid;
+
+            /**
+             * @brief Shared packet I/O pool for host interfaces, created on
+             * first host interface when SAI_VS_HOSTIF_PACKET_IO_THREADS is set.
+             */
+            std::shared_ptr<PacketIoPool> m_packetIoPool;
+
         public: // TODO private
 
             std::set<FdbInfo> m_fdb_info_set;
 
+            FdbAgingWheel m_fdbAgingWheel;
+
             std::map<std::string, std::shared_ptr<HostInterfaceInfo>> m_hostif_info_map;
 
             std::shared_ptr<RealObjectIdManager> m_realObjectIdManager;
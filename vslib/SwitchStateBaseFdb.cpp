@@ -518,14 +518,9 @@ void SwitchStateBase::process_packet_for_fdb_event(
 
     if (it != m_fdb_info_set.end())
     {
-        // this key was found, update timestamp
-        // and since iterator is const we need to reinsert
+        // this key was found, update timestamp in aging wheel
 
-        fi = *it;
-
-        fi.setTimestamp(frametime);
-
-        m_fdb_info_set.insert(fi);
+        m_fdbAgingWheel.touch(*it, frametime);
 
         return;
     }
@@ -563,6 +558,8 @@ void SwitchStateBase::process_packet_for_fdb_event(
 
             m_fdb_info_set.insert(fi);
 
+            m_fdbAgingWheel.touch(fi, frametime);
+
             processFdbInfo(fi, SAI_FDB_EVENT_LEARNED);
         }
         else if (attr.value.s32 == SAI_BRIDGE_PORT_FDB_LEARNING_MODE_DISABLE)
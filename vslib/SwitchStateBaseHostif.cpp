@@ -508,7 +508,27 @@ bool SwitchStateBase::hostif_create_tap_veth_forwarding(
                 port_id,
                 m_switchConfig->m_eventQueue);
 
-    m_hostif_info_map[tapname]->runThreads();
+    if (m_switchConfig->m_hostifPacketIoThreads)
+    {
+        if (m_packetIoPool == nullptr)
+        {
+            m_packetIoPool = std::make_shared<PacketIoPool>(m_switchConfig->m_hostifPacketIoThreads);
+        }
+
+        if (!m_hostif_info_map[tapname]->runPacketIoPool(m_packetIoPool))
+        {
+            // tap is still usable, forwarding threads are select based so
+            // they don't mind O_NONBLOCK set by pool
+
+            SWSS_LOG_WARN("failed to attach %s to packet I/O pool, using forwarding threads", tapname.c_str());
+
+            m_hostif_info_map[tapname]->runThreads();
+        }
+    }
+    else
+    {
+        m_hostif_info_map[tapname]->runThreads();
+    }
 
     SWSS_LOG_NOTICE("setup forward rule for %s succeeded", tapname.c_str());
 
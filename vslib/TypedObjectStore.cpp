@@ -0,0 +1,374 @@
+#include "TypedObjectStore.h"
+
+#include "swss/logger.h"
+#include "meta/sai_serialize.h"
+
+#include <algorithm>
+
+using namespace saivs;
+
+TypedObjectStore::AttrSlots::AttrSlots(
+        _Inout_ AttrSlots&& other) noexcept:
+    m_slots(std::move(other.m_slots))
+{
+    SWSS_LOG_ENTER();
+
+    other.m_slots.clear();
+}
+
+TypedObjectStore::AttrSlots& TypedObjectStore::AttrSlots::operator=(
+        _Inout_ AttrSlots&& other) noexcept
+{
+    SWSS_LOG_ENTER();
+
+    if (this != &other)
+    {
+        release();
+
+        m_slots = std::move(other.m_slots);
+
+        other.m_slots.clear();
+    }
+
+    return *this;
+}
+
+TypedObjectStore::AttrSlots::~AttrSlots()
+{
+    SWSS_LOG_ENTER();
+
+    release();
+}
+
+void TypedObjectStore::AttrSlots::release()
+{
+    SWSS_LOG_ENTER();
+
+    for (auto& slot: m_slots)
+    {
+        if (!slot.m_meta->isprimitive)
+        {
+            sai_deserialize_free_attribute_value(slot.m_meta->attrvaluetype, slot.m_attr);
+        }
+    }
+
+    m_slots.clear();
+}
+
+void TypedObjectStore::AttrSlots::set(
+        _In_ const sai_attr_metadata_t* meta,
+        _In_ const sai_attribute_t* attr)
+{
+    SWSS_LOG_ENTER();
+
+    auto it = std::lower_bound(m_slots.begin(), m_slots.end(), attr->id,
+            [](const Slot& s, sai_attr_id_t id) { return s.m_meta->attrid < id; });
+
+    if (it == m_slots.end() || it->m_meta->attrid != attr->id)
+    {
+        it = m_slots.insert(it, Slot{meta, {}});
+    }
+    else if (!it->m_meta->isprimitive)
+    {
+        sai_deserialize_free_attribute_value(it->m_meta->attrvaluetype, it->m_attr);
+    }
+
+    it->m_meta = meta;
+
+    if (meta->isprimitive)
+    {
+        /*
+         * Primitive values don't contain any pointers, so they can be
+         * stored inline without serialize/deserialize round trip.
+         */
+
+        it->m_attr = *attr;
+
+        return;
+    }
+
+    it->m_attr.id = attr->id;
+
+    auto value = sai_serialize_attr_value(*meta, *attr, false);
+
+    sai_deserialize_attr_value(value, *meta, it->m_attr, false);
+}
+
+const sai_attribute_t* TypedObjectStore::AttrSlots::get(
+        _In_ sai_attr_id_t id) const
+{
+    SWSS_LOG_ENTER();
+
+    auto it = std::lower_bound(m_slots.begin(), m_slots.end(), id,
+            [](const Slot& s, sai_attr_id_t id) { return s.m_meta->attrid < id; });
+
+    if (it == m_slots.end() || it->m_meta->attrid != id)
+    {
+        return nullptr;
+    }
+
+    return &it->m_attr;
+}
+
+const sai_attr_metadata_t* TypedObjectStore::AttrSlots::getMetadata(
+        _In_ size_t index) const
+{
+    SWSS_LOG_ENTER();
+
+    return m_slots.at(index).m_meta;
+}
+
+const sai_attribute_t* TypedObjectStore::AttrSlots::getAttr(
+        _In_ size_t index) const
+{
+    SWSS_LOG_ENTER();
+
+    return &m_slots.at(index).m_attr;
+}
+
+size_t TypedObjectStore::AttrSlots::size() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_slots.size();
+}
+
+bool TypedObjectStore::isSupportedObjectType(
+        _In_ sai_object_type_t objectType)
+{
+    SWSS_LOG_ENTER();
+
+    switch (objectType)
+    {
+        case SAI_OBJECT_TYPE_ROUTE_ENTRY:
+        case SAI_OBJECT_TYPE_NEIGHBOR_ENTRY:
+        case SAI_OBJECT_TYPE_NAT_ENTRY:
+        case SAI_OBJECT_TYPE_INSEG_ENTRY:
+        case SAI_OBJECT_TYPE_MY_SID_ENTRY:
+        case SAI_OBJECT_TYPE_L2MC_ENTRY:
+        case SAI_OBJECT_TYPE_IPMC_ENTRY:
+        case SAI_OBJECT_TYPE_MCAST_FDB_ENTRY:
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+void TypedObjectStore::deserializeMetaKey(
+        _In_ sai_object_type_t objectType,
+        _In_ const std::string& serializedObjectId,
+        _Out_ sai_object_meta_key_t& metaKey)
+{
+    SWSS_LOG_ENTER();
+
+    metaKey.objecttype = objectType;
+
+    switch (objectType)
+    {
+        case SAI_OBJECT_TYPE_ROUTE_ENTRY:
+            sai_deserialize_route_entry(serializedObjectId, metaKey.objectkey.key.route_entry);
+            break;
+
+        case SAI_OBJECT_TYPE_NEIGHBOR_ENTRY:
+            sai_deserialize_neighbor_entry(serializedObjectId, metaKey.objectkey.key.neighbor_entry);
+            break;
+
+        case SAI_OBJECT_TYPE_NAT_ENTRY:
+            sai_deserialize_nat_entry(serializedObjectId, metaKey.objectkey.key.nat_entry);
+            break;
+
+        case SAI_OBJECT_TYPE_INSEG_ENTRY:
+            sai_deserialize_inseg_entry(serializedObjectId, metaKey.objectkey.key.inseg_entry);
+            break;
+
+        case SAI_OBJECT_TYPE_MY_SID_ENTRY:
+            sai_deserialize_my_sid_entry(serializedObjectId, metaKey.objectkey.key.my_sid_entry);
+            break;
+
+        case SAI_OBJECT_TYPE_L2MC_ENTRY:
+            sai_deserialize_l2mc_entry(serializedObjectId, metaKey.objectkey.key.l2mc_entry);
+            break;
+
+        case SAI_OBJECT_TYPE_IPMC_ENTRY:
+            sai_deserialize_ipmc_entry(serializedObjectId, metaKey.objectkey.key.ipmc_entry);
+            break;
+
+        case SAI_OBJECT_TYPE_MCAST_FDB_ENTRY:
+            sai_deserialize_mcast_fdb_entry(serializedObjectId, metaKey.objectkey.key.mcast_fdb_entry);
+            break;
+
+        default:
+            SWSS_LOG_THROW("object type %s is not supported by typed object store",
+                    sai_serialize_object_type(objectType).c_str());
+    }
+}
+
+std::string TypedObjectStore::serializeObjectId(
+        _In_ const sai_object_meta_key_t& metaKey)
+{
+    SWSS_LOG_ENTER();
+
+    // object type name don't contain ':' so first one is separator
+
+    auto key = sai_serialize_object_meta_key(metaKey);
+
+    return key.substr(key.find(":") + 1);
+}
+
+sai_status_t TypedObjectStore::create(
+        _In_ const sai_object_meta_key_t& metaKey,
+        _In_ uint32_t attr_count,
+        _In_ const sai_attribute_t *attr_list)
+{
+    SWSS_LOG_ENTER();
+
+    auto& entries = m_entries[metaKey.objecttype];
+
+    auto res = entries.emplace(metaKey, AttrSlots());
+
+    if (!res.second)
+    {
+        return SAI_STATUS_ITEM_ALREADY_EXISTS;
+    }
+
+    auto& slots = res.first->second;
+
+    for (uint32_t i = 0; i < attr_count; ++i)
+    {
+        auto meta = sai_metadata_get_attr_metadata(metaKey.objecttype, attr_list[i].id);
+
+        if (meta == NULL)
+        {
+            entries.erase(res.first);
+
+            SWSS_LOG_ERROR("failed to find attribute %d for %s",
+                    attr_list[i].id,
+                    sai_serialize_object_type(metaKey.objecttype).c_str());
+
+            return SAI_STATUS_FAILURE;
+        }
+
+        slots.set(meta, &attr_list[i]);
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
+sai_status_t TypedObjectStore::remove(
+        _In_ const sai_object_meta_key_t& metaKey)
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_entries.find(metaKey.objecttype);
+
+    if (it == m_entries.end() || it->second.erase(metaKey) == 0)
+    {
+        return SAI_STATUS_ITEM_NOT_FOUND;
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
+sai_status_t TypedObjectStore::set(
+        _In_ const sai_object_meta_key_t& metaKey,
+        _In_ const sai_attribute_t *attr)
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_entries.find(metaKey.objecttype);
+
+    if (it == m_entries.end())
+    {
+        return SAI_STATUS_ITEM_NOT_FOUND;
+    }
+
+    auto eit = it->second.find(metaKey);
+
+    if (eit == it->second.end())
+    {
+        return SAI_STATUS_ITEM_NOT_FOUND;
+    }
+
+    auto meta = sai_metadata_get_attr_metadata(metaKey.objecttype, attr->id);
+
+    if (meta == NULL)
+    {
+        SWSS_LOG_ERROR("failed to find attribute %d for %s",
+                attr->id,
+                sai_serialize_object_type(metaKey.objecttype).c_str());
+
+        return SAI_STATUS_FAILURE;
+    }
+
+    eit->second.set(meta, attr);
+
+    return SAI_STATUS_SUCCESS;
+}
+
+const TypedObjectStore::AttrSlots* TypedObjectStore::find(
+        _In_ const sai_object_meta_key_t& metaKey) const
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_entries.find(metaKey.objecttype);
+
+    if (it == m_entries.end())
+    {
+        return nullptr;
+    }
+
+    auto eit = it->second.find(metaKey);
+
+    if (eit == it->second.end())
+    {
+        return nullptr;
+    }
+
+    return &eit->second;
+}
+
+size_t TypedObjectStore::size(
+        _In_ sai_object_type_t objectType) const
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_entries.find(objectType);
+
+    return (it == m_entries.end()) ? 0 : it->second.size();
+}
+
+size_t TypedObjectStore::size() const
+{
+    SWSS_LOG_ENTER();
+
+    size_t count = 0;
+
+    for (auto& kvp: m_entries)
+    {
+        count += kvp.second.size();
+    }
+
+    return count;
+}
+
+void TypedObjectStore::forEach(
+        _In_ const std::function<void(const sai_object_meta_key_t&, const AttrSlots&)>& fun) const
+{
+    SWSS_LOG_ENTER();
+
+    for (auto& kvp: m_entries)
+    {
+        for (auto& entry: kvp.second)
+        {
+            fun(entry.first, entry.second);
+        }
+    }
+}
+
+void TypedObjectStore::clear()
+{
+    SWSS_LOG_ENTER();
+
+    m_entries.clear();
+}
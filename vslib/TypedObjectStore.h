@@ -0,0 +1,145 @@
+#pragma once
+
+extern "C" {
+#include "saimetadata.h"
+}
+
+#include "meta/MetaKeyHasher.h"
+
+#include <unordered_map>
+#include <functional>
+#include <vector>
+#include <string>
+#include <map>
+
+namespace saivs
+{
+    /**
+     * @brief Typed object store.
+     *
+     * Alternative storage for non object id entries (routes, neighbors,
+     * etc.) used by SwitchStateBase unless SAI_VS_USE_TYPED_OBJECT_STORE is
+     * disabled. Entries are keyed by binary meta key instead of serialized
+     * object id, and attributes are kept in compact slots sorted by attribute
+     * id. Primitive attribute values are stored inline, so only list values
+     * require extra memory allocation.
+     */
+    class TypedObjectStore
+    {
+        public:
+
+            class AttrSlots
+            {
+                private:
+
+                    AttrSlots(const AttrSlots&) = delete;
+                    AttrSlots& operator=(const AttrSlots&) = delete;
+
+                public:
+
+                    AttrSlots() = default;
+
+                    AttrSlots(
+                            _Inout_ AttrSlots&& other) noexcept;
+
+                    AttrSlots& operator=(
+                            _Inout_ AttrSlots&& other) noexcept;
+
+                    virtual ~AttrSlots();
+
+                public:
+
+                    /**
+                     * @brief Set attribute value, deep copy is made.
+                     */
+                    void set(
+                            _In_ const sai_attr_metadata_t* meta,
+                            _In_ const sai_attribute_t* attr);
+
+                    /**
+                     * @brief Get attribute by id, returns nullptr if attribute is not present.
+                     */
+                    const sai_attribute_t* get(
+                            _In_ sai_attr_id_t id) const;
+
+                    const sai_attr_metadata_t* getMetadata(
+                            _In_ size_t index) const;
+
+                    const sai_attribute_t* getAttr(
+                            _In_ size_t index) const;
+
+                    size_t size() const;
+
+                private:
+
+                    void release();
+
+                    struct Slot
+                    {
+                        const sai_attr_metadata_t* m_meta;
+
+                        sai_attribute_t m_attr;
+                    };
+
+                    std::vector<Slot> m_slots;
+            };
+
+            typedef std::unordered_map<sai_object_meta_key_t, AttrSlots, saimeta::MetaKeyHasher, saimeta::MetaKeyHasher> EntryHash;
+
+        public:
+
+            TypedObjectStore() = default;
+
+            virtual ~TypedObjectStore() = default;
+
+        public:
+
+            /**
+             * @brief Object types which can be held by typed object store.
+             *
+             * Only non object id entries which are not iterated by vslib
+             * internally (like FDB entries on flush) are supported.
+             */
+            static bool isSupportedObjectType(
+                    _In_ sai_object_type_t objectType);
+
+            static void deserializeMetaKey(
+                    _In_ sai_object_type_t objectType,
+                    _In_ const std::string& serializedObjectId,
+                    _Out_ sai_object_meta_key_t& metaKey);
+
+            static std::string serializeObjectId(
+                    _In_ const sai_object_meta_key_t& metaKey);
+
+        public:
+
+            sai_status_t create(
+                    _In_ const sai_object_meta_key_t& metaKey,
+                    _In_ uint32_t attr_count,
+                    _In_ const sai_attribute_t *attr_list);
+
+            sai_status_t remove(
+                    _In_ const sai_object_meta_key_t& metaKey);
+
+            sai_status_t set(
+                    _In_ const sai_object_meta_key_t& metaKey,
+                    _In_ const sai_attribute_t *attr);
+
+            const AttrSlots* find(
+                    _In_ const sai_object_meta_key_t& metaKey) const;
+
+            size_t size(
+                    _In_ sai_object_type_t objectType) const;
+
+            size_t size() const;
+
+            void forEach(
+                    _In_ const std::function<void(const sai_object_meta_key_t&, const AttrSlots&)>& fun) const;
+
+            void clear();
+
+        private:
+
+            std::map<sai_object_type_t, EntryHash> m_entries;
+    };
+}
@@ -158,6 +158,8 @@ void VirtualSwitchSaiInterface::update_local_metadata(
 
     const auto &objectHash = m_switchStateMap.at(switch_id)->m_objectHash;//.at(object_type);
 
+    const auto &typedObjectStore = m_switchStateMap.at(switch_id)->m_typedObjectStore;
+
     // first create switch
     // first we need to create all "oid" objects to have reference base
     // then set all object attributes on those oids
@@ -240,6 +242,10 @@ void VirtualSwitchSaiInterface::update_local_metadata(
         }
     }
 
+    typedObjectStore.forEach([&](const sai_object_meta_key_t& metaKey, const TypedObjectStore::AttrSlots& slots) {
+        mmeta->meta_generic_validation_post_create(metaKey, switch_id, 0, NULL);
+    });
+
     /*
      * Set all attributes on all objects. Since attributes maybe OID attributes
      * we need to set them too for correct reference count.
@@ -275,6 +281,17 @@ void VirtualSwitchSaiInterface::update_local_metadata(
         }
     }
 
+    typedObjectStore.forEach([&](const sai_object_meta_key_t& metaKey, const TypedObjectStore::AttrSlots& slots) {
+
+        for (size_t idx = 0; idx < slots.size(); ++idx)
+        {
+            if (slots.getMetadata(idx)->isreadonly)
+                continue;
+
+            mmeta->meta_generic_validation_post_set(metaKey, slots.getAttr(idx));
+        }
+    });
+
     /*
      * Since this method is called inside internal_vs_generic_create next
      * meta_generic_validation_post_create will be called after success return
@@ -414,10 +431,11 @@ sai_status_t VirtualSwitchSaiInterface::remove(                 \
         _In_ const sai_ ## ot ## _t* entry)                     \
 {                                                               \
     SWSS_LOG_ENTER();                                           \
-    return remove(                                              \
-            entry->switch_id,                                   \
-            (sai_object_type_t)SAI_OBJECT_TYPE_ ## OT,          \
-            sai_serialize_ ## ot(*entry));                      \
+    sai_object_meta_key_t metaKey = {                           \
+        .objecttype = (sai_object_type_t)SAI_OBJECT_TYPE_ ## OT,\
+        .objectkey = { .key = { .ot = *entry } } };             \
+    auto ss = m_switchStateMap.at(entry->switch_id);            \
+    return ss->removeEntry(metaKey);                            \
 }
 
 SAIREDIS_DECLARE_EVERY_ENTRY(DECLARE_REMOVE_ENTRY);
@@ -432,10 +450,13 @@ sai_status_t VirtualSwitchSaiInterface::create(                 \
     static PerformanceIntervalTimer                             \
     timer("VirtualSwitchSaiInterface::create(" #ot ")");        \
     timer.start();                                              \
-    auto status =  create(                                      \
+    sai_object_meta_key_t metaKey = {                           \
+        .objecttype = (sai_object_type_t)SAI_OBJECT_TYPE_ ## OT,\
+        .objectkey = { .key = { .ot = *entry } } };             \
+    auto ss = m_switchStateMap.at(entry->switch_id);            \
+    auto status = ss->createEntry(                              \
+            metaKey,                                            \
             entry->switch_id,                                   \
-            (sai_object_type_t)SAI_OBJECT_TYPE_ ## OT,          \
-            sai_serialize_ ## ot(*entry),                       \
             attr_count,                                         \
             attr_list);                                         \
     timer.stop();                                               \
@@ -451,11 +472,11 @@ sai_status_t VirtualSwitchSaiInterface::set(                    \
         _In_ const sai_attribute_t *attr)                       \
 {                                                               \
     SWSS_LOG_ENTER();                                           \
-    return set(                                                 \
-            entry->switch_id,                                   \
-            (sai_object_type_t)SAI_OBJECT_TYPE_ ## OT,          \
-            sai_serialize_ ## ot(*entry),                       \
-            attr);                                              \
+    sai_object_meta_key_t metaKey = {                           \
+        .objecttype = (sai_object_type_t)SAI_OBJECT_TYPE_ ## OT,\
+        .objectkey = { .key = { .ot = *entry } } };             \
+    auto ss = m_switchStateMap.at(entry->switch_id);            \
+    return ss->setEntry(metaKey, attr);                         \
 }
 
 SAIREDIS_DECLARE_EVERY_ENTRY(DECLARE_SET_ENTRY);
@@ -826,12 +847,11 @@ sai_status_t VirtualSwitchSaiInterface::get(                    \
         _Inout_ sai_attribute_t *attr_list)                     \
 {                                                               \
     SWSS_LOG_ENTER();                                           \
-    return get(                                                 \
-            entry->switch_id,                                   \
-            (sai_object_type_t)SAI_OBJECT_TYPE_ ## OT,          \
-            sai_serialize_ ## ot(*entry),                       \
-            attr_count,                                         \
-            attr_list);                                         \
+    sai_object_meta_key_t metaKey = {                           \
+        .objecttype = (sai_object_type_t)SAI_OBJECT_TYPE_ ## OT,\
+        .objectkey = { .key = { .ot = *entry } } };             \
+    auto ss = m_switchStateMap.at(entry->switch_id);            \
+    return ss->getEntry(metaKey, attr_count, attr_list);        \
 }
 
 SAIREDIS_DECLARE_EVERY_ENTRY(DECLARE_GET_ENTRY);
@@ -1176,7 +1196,15 @@ sai_status_t VirtualSwitchSaiInterface::bulkGetStats(
 {
     SWSS_LOG_ENTER();
 
-    return SAI_STATUS_NOT_IMPLEMENTED;
+    if (mode != SAI_STATS_MODE_BULK_READ && mode != SAI_STATS_MODE_BULK_READ_AND_CLEAR)
+    {
+        SWSS_LOG_ERROR("mode %s is not supported for bulk get stats",
+                sai_serialize_enum(mode, &sai_metadata_enum_sai_stats_mode_t).c_str());
+
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    return bulkStats(switchId, object_type, object_count, object_key, number_of_counters, counter_ids, mode, object_statuses, counters);
 }
 
 sai_status_t VirtualSwitchSaiInterface::bulkClearStats(
@@ -1191,7 +1219,94 @@ sai_status_t VirtualSwitchSaiInterface::bulkClearStats(
 {
     SWSS_LOG_ENTER();
 
-    return SAI_STATUS_NOT_IMPLEMENTED;
+    if (mode != SAI_STATS_MODE_BULK_CLEAR)
+    {
+        SWSS_LOG_ERROR("mode %s is not supported for bulk clear stats",
+                sai_serialize_enum(mode, &sai_metadata_enum_sai_stats_mode_t).c_str());
+
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    return bulkStats(switchId, object_type, object_count, object_key, number_of_counters, counter_ids, mode, object_statuses, nullptr);
+}
+
+sai_status_t VirtualSwitchSaiInterface::bulkStats(
+        _In_ sai_object_id_t switchId,
+        _In_ sai_object_type_t object_type,
+        _In_ uint32_t object_count,
+        _In_ const sai_object_key_t *object_key,
+        _In_ uint32_t number_of_counters,
+        _In_ const sai_stat_id_t *counter_ids,
+        _In_ sai_stats_mode_t mode,
+        _Inout_ sai_status_t *object_statuses,
+        _Out_ uint64_t *counters)
+{
+    SWSS_LOG_ENTER();
+
+    if (switchId != SAI_NULL_OBJECT_ID && m_switchStateMap.find(switchId) == m_switchStateMap.end())
+    {
+        SWSS_LOG_ERROR("failed to find switch %s in switch state map", sai_serialize_object_id(switchId).c_str());
+
+        return SAI_STATUS_FAILURE;
+    }
+
+    // counters are laid out object after object, same as in vendor SAI
+
+    std::vector<uint64_t> discard;
+
+    if (counters == nullptr)
+    {
+        discard.resize(number_of_counters);
+    }
+
+    sai_status_t status = SAI_STATUS_SUCCESS;
+
+    for (uint32_t idx = 0; idx < object_count; idx++)
+    {
+        uint64_t* objectCounters = counters ? counters + (size_t)idx * number_of_counters : discard.data();
+
+        sai_object_id_t objectId = object_key[idx].key.object_id;
+
+        // flex counter passes NULL switch id, then switch is resolved for
+        // each object, since objects may belong to different switches
+
+        sai_object_id_t objectSwitchId = SAI_NULL_OBJECT_ID;
+
+        if (m_realObjectIdManager->saiObjectTypeQuery(objectId) != SAI_OBJECT_TYPE_NULL)
+        {
+            objectSwitchId = switchIdQuery(objectId);
+        }
+
+        auto it = m_switchStateMap.find(objectSwitchId);
+
+        if (it == m_switchStateMap.end() || (switchId != SAI_NULL_OBJECT_ID && objectSwitchId != switchId))
+        {
+            SWSS_LOG_ERROR("object %s don't belong to switch %s",
+                    sai_serialize_object_id(objectId).c_str(),
+                    sai_serialize_object_id(switchId).c_str());
+
+            object_statuses[idx] = SAI_STATUS_INVALID_OBJECT_ID;
+
+            status = SAI_STATUS_FAILURE;
+
+            continue;
+        }
+
+        object_statuses[idx] = it->second->getStatsExt(
+                object_type,
+                objectId,
+                number_of_counters,
+                counter_ids,
+                mode,
+                objectCounters);
+
+        if (object_statuses[idx] != SAI_STATUS_SUCCESS)
+        {
+            status = SAI_STATUS_FAILURE;
+        }
+    }
+
+    return status;
 }
 
 sai_status_t VirtualSwitchSaiInterface::bulkRemove(
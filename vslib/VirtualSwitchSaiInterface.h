@@ -259,6 +259,21 @@ namespace saivs
                     _In_ sai_bulk_op_error_mode_t mode,
                     _Out_ sai_status_t *object_statuses);
 
+            /**
+             * @brief Get or clear stats on each object, counters can be
+             * nullptr when stats are only cleared.
+             */
+            sai_status_t bulkStats(
+                    _In_ sai_object_id_t switchId,
+                    _In_ sai_object_type_t object_type,
+                    _In_ uint32_t object_count,
+                    _In_ const sai_object_key_t *object_key,
+                    _In_ uint32_t number_of_counters,
+                    _In_ const sai_stat_id_t *counter_ids,
+                    _In_ sai_stats_mode_t mode,
+                    _Inout_ sai_status_t *object_statuses,
+                    _Out_ uint64_t *counters);
+
         private: // QUAD pre
 
             sai_status_t preSet(
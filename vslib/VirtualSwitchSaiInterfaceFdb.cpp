@@ -204,6 +204,8 @@ sai_status_t VirtualSwitchSaiInterface::flushFdbEntries(
             }
             else
             {
+                ss->m_fdbAgingWheel.remove(*fit);
+
                 ss->m_fdb_info_set.erase(fit);
             }
 
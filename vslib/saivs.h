@@ -79,6 +79,58 @@ extern "C" {
  */
 #define SAI_KEY_VS_USE_CONFIGURED_SPEED_AS_OPER_SPEED "SAI_VS_USE_CONFIGURED_SPEED_AS_OPER_SPEED"
 
+/**
+ * @def SAI_KEY_VS_USE_TYPED_OBJECT_STORE
+ *
+ * Bool flag, (true/false). If set to true, non object id entries like routes
+ * and neighbors are kept in typed object store keyed by binary meta key
+ * instead of serialized object id. This reduces memory and CPU usage on
+ * scale tests.
+ *
+ * By default this flag is set to true.
+ */
+#define SAI_KEY_VS_USE_TYPED_OBJECT_STORE "SAI_VS_USE_TYPED_OBJECT_STORE"
+
+/**
+ * @def SAI_KEY_VS_HOSTIF_PACKET_IO_THREADS
+ *
+ * Number of threads (uint32) used to forward packets between host interface
+ * tap devices and veth interfaces. If set to non zero value, all host
+ * interfaces of switch are serviced by shared thread pool which forwards
+ * frames in batches using recvmmsg/sendmmsg, instead of two dedicated threads
+ * per host interface forwarding single frame per system call.
+ *
+ * By default this value is 0 (dedicated threads).
+ */
+#define SAI_KEY_VS_HOSTIF_PACKET_IO_THREADS "SAI_VS_HOSTIF_PACKET_IO_THREADS"
+
+/**
+ * @def SAI_KEY_VS_TRAFFIC_MODEL_PPS
+ *
+ * Traffic model rate in packets per second (uint64). If set to non zero
+ * value, packet and byte counters of ports, queues and ingress priority
+ * groups are advanced at this rate, starting from first counter read of each
+ * object. Error, drop and pause counters are not advanced. Counter values
+ * depend only on time elapsed since first read, so scale tests of counter
+ * polling can be run without hardware. Port counters are not read from host
+ * interfaces when traffic model is enabled.
+ *
+ * By default this value is 0 (traffic model disabled).
+ */
+#define SAI_KEY_VS_TRAFFIC_MODEL_PPS "SAI_VS_TRAFFIC_MODEL_PPS"
+
+/**
+ * @def SAI_KEY_VS_TRAFFIC_MODEL_PACKET_SIZE
+ *
+ * Packet size in bytes (uint32) used by traffic model to advance byte
+ * counters.
+ *
+ * By default this value is SAI_VS_TRAFFIC_MODEL_DEFAULT_PACKET_SIZE.
+ */
+#define SAI_KEY_VS_TRAFFIC_MODEL_PACKET_SIZE "SAI_VS_TRAFFIC_MODEL_PACKET_SIZE"
+
+#define SAI_VS_TRAFFIC_MODEL_DEFAULT_PACKET_SIZE 512
+
 /**
  * @def SAI_KEY_VS_CORE_PORT_INDEX_MAP_FILE
  *
@@ -21,6 +21,8 @@ SwitchVpp::SwitchVpp(
 {
     SWSS_LOG_ENTER();
 
+    m_acl_tbl_config_deferred = false;
+
     vpp_dp_initialize();
 }
 
@@ -36,6 +38,8 @@ SwitchVpp::SwitchVpp(
 {
     SWSS_LOG_ENTER();
 
+    m_acl_tbl_config_deferred = false;
+
     vpp_dp_initialize();
 }
 
@@ -1006,6 +1010,8 @@ sai_status_t SwitchVpp::create_internal(
         objectHash[serializedObjectId][a->getAttrMetadata()->attridname] = a;
     }
 
+    indexObject(object_type, serializedObjectId, objectHash.at(serializedObjectId), true);
+
     m_object_db.create_or_update(object_type, serializedObjectId, attr_count, attr_list, true /*is_create*/);
 
     return SAI_STATUS_SUCCESS;
@@ -1201,6 +1207,8 @@ sai_status_t SwitchVpp::remove_internal(
         return SAI_STATUS_ITEM_NOT_FOUND;
     }
 
+    indexObject(object_type, serializedObjectId, it->second, false);
+
     objectHash.erase(it);
 
     return SAI_STATUS_SUCCESS;
@@ -1341,6 +1349,8 @@ sai_status_t SwitchVpp::set_internal(
 
     auto &attrHash = it->second;
 
+    indexAttribute(objectType, serializedObjectId, attrHash, attr);
+
     auto a = std::make_shared<SaiAttrWrap>(objectType, attr);
 
     // set have only one attribute
@@ -1504,6 +1514,11 @@ sai_status_t SwitchVpp::bulkCreate(
         return SAI_STATUS_FAILURE;
     }
 
+    if (object_type == SAI_OBJECT_TYPE_ACL_ENTRY)
+    {
+        return bulkCreateAclEntries(switch_id, serialized_object_ids, attr_count, attr_list, mode, object_statuses);
+    }
+
     sai_status_t status = SAI_STATUS_SUCCESS;
     uint32_t it;
 
@@ -1548,6 +1563,11 @@ sai_status_t SwitchVpp::bulkRemove(
         return SAI_STATUS_FAILURE;
     }
 
+    if (object_type == SAI_OBJECT_TYPE_ACL_ENTRY)
+    {
+        return bulkRemoveAclEntries(serialized_object_ids, mode, object_statuses);
+    }
+
     sai_status_t status = SAI_STATUS_SUCCESS;
     uint32_t it;
 
@@ -1576,6 +1596,23 @@ sai_status_t SwitchVpp::bulkRemove(
     return status;
 }
 
+sai_status_t SwitchVpp::bulkSet(
+        _In_ sai_object_type_t object_type,
+        _In_ const std::vector<std::string> &serialized_object_ids,
+        _In_ const sai_attribute_t *attr_list,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_status_t *object_statuses)
+{
+    SWSS_LOG_ENTER();
+
+    if (object_type == SAI_OBJECT_TYPE_ACL_ENTRY && serialized_object_ids.size() && attr_list && object_statuses)
+    {
+        return bulkSetAclEntries(serialized_object_ids, attr_list, mode, object_statuses);
+    }
+
+    return SwitchStateBase::bulkSet(object_type, serialized_object_ids, attr_list, mode, object_statuses);
+}
+
 sai_status_t SwitchVpp::get_max(
         _In_ sai_object_type_t objectType,
         _In_ const std::string &serializedObjectId,
@@ -178,6 +178,13 @@ namespace saivs
                     _In_ sai_bulk_op_error_mode_t mode,
                     _Out_ sai_status_t *object_statuses) override;
 
+            virtual sai_status_t bulkSet(
+                    _In_ sai_object_type_t object_type,
+                    _In_ const std::vector<std::string> &serialized_object_ids,
+                    _In_ const sai_attribute_t *attr_list,
+                    _In_ sai_bulk_op_error_mode_t mode,
+                    _Out_ sai_status_t *object_statuses) override;
+
         protected: // hostif
 
             static int vs_create_tap_device(
@@ -616,6 +623,17 @@ namespace saivs
             std::map<sai_object_id_t, std::list<sai_object_id_t>> m_acl_tbl_grp_ports_map;
             std::map<sai_object_id_t, vpp_ace_cntr_info_t> m_ace_cntr_info_map;
 
+            /**
+             * @brief ACL tables with entry changes not yet programmed to VPP.
+             *
+             * While ACL table configuration is deferred (bulk ACL entry
+             * operations), each table is rebuilt once when deferral ends or
+             * when table is used by bind or counter get.
+             */
+            std::set<sai_object_id_t> m_acl_tbl_dirty_set;
+
+            bool m_acl_tbl_config_deferred;
+
         protected: // VPP
 
             sai_status_t createAclEntry(
@@ -644,6 +662,71 @@ namespace saivs
             sai_status_t AclAddRemoveCheck(
                     _In_ sai_object_id_t tbl_oid);
 
+            /**
+             * @brief Programs all ACL tables marked dirty while ACL table
+             * configuration was deferred.
+             *
+             * @return SAI_STATUS_SUCCESS if all tables were programmed,
+             * otherwise status of last failed table.
+             */
+            sai_status_t aclFlushDirtyTables();
+
+            /**
+             * @brief Defers ACL table configuration while in scope.
+             *
+             * Deferral ends and dirty tables are programmed on every exit
+             * path, so exception thrown by entry operation can't leave ACL
+             * table configuration deferred.
+             */
+            class AclConfigDeferScope
+            {
+                public:
+
+                    AclConfigDeferScope(
+                            _In_ SwitchVpp& vpp);
+
+                    virtual ~AclConfigDeferScope();
+
+                private:
+
+                    AclConfigDeferScope(const AclConfigDeferScope&) = delete;
+                    AclConfigDeferScope& operator=(const AclConfigDeferScope&) = delete;
+
+                public:
+
+                    /**
+                     * @brief End deferral and program dirty tables.
+                     *
+                     * @return Status of aclFlushDirtyTables.
+                     */
+                    sai_status_t flush();
+
+                private:
+
+                    SwitchVpp& m_vpp;
+
+                    bool m_flushed;
+            };
+
+            sai_status_t bulkCreateAclEntries(
+                    _In_ sai_object_id_t switch_id,
+                    _In_ const std::vector<std::string> &serialized_object_ids,
+                    _In_ const uint32_t *attr_count,
+                    _In_ const sai_attribute_t **attr_list,
+                    _In_ sai_bulk_op_error_mode_t mode,
+                    _Out_ sai_status_t *object_statuses);
+
+            sai_status_t bulkRemoveAclEntries(
+                    _In_ const std::vector<std::string> &serialized_object_ids,
+                    _In_ sai_bulk_op_error_mode_t mode,
+                    _Out_ sai_status_t *object_statuses);
+
+            sai_status_t bulkSetAclEntries(
+                    _In_ const std::vector<std::string> &serialized_object_ids,
+                    _In_ const sai_attribute_t *attr_list,
+                    _In_ sai_bulk_op_error_mode_t mode,
+                    _Out_ sai_status_t *object_statuses);
+
             sai_status_t aclTableRemove(
                     _In_ const std::string &serializedObjectId);
 
@@ -1244,6 +1244,8 @@ sai_status_t SwitchVpp::AclTblRemove(
 
     sai_status_t status;
 
+    m_acl_tbl_dirty_set.erase(tbl_oid);
+
     auto it = m_acl_tbl_rules_map.find(tbl_oid);
 
     if (it != m_acl_tbl_rules_map.end()) {
@@ -1323,10 +1325,224 @@ sai_status_t SwitchVpp::AclAddRemoveCheck(
         return SAI_STATUS_SUCCESS;
     }
 
+    if (m_acl_tbl_config_deferred) {
+        /*
+         * Each table config rebuilds whole VPP ACL, so table is programmed
+         * only once after all entries in bulk are processed.
+         */
+        m_acl_tbl_dirty_set.insert(tbl_oid);
+        return SAI_STATUS_SUCCESS;
+    }
+
     status = AclTblConfig(tbl_oid);
     return status;
 }
 
+sai_status_t SwitchVpp::aclFlushDirtyTables()
+{
+    SWSS_LOG_ENTER();
+
+    sai_status_t status = SAI_STATUS_SUCCESS;
+
+    if (m_acl_tbl_dirty_set.empty()) {
+        return status;
+    }
+
+    std::set<sai_object_id_t> dirty_set;
+
+    dirty_set.swap(m_acl_tbl_dirty_set);
+
+    for (auto tbl_oid: dirty_set) {
+        if (m_acl_tbl_rules_map.find(tbl_oid) == m_acl_tbl_rules_map.end()) {
+            continue;
+        }
+
+        sai_status_t tbl_status = AclTblConfig(tbl_oid);
+
+        SWSS_LOG_INFO("ACL table %s deferred config status %d",
+                      sai_serialize_object_id(tbl_oid).c_str(), tbl_status);
+
+        if (tbl_status != SAI_STATUS_SUCCESS) {
+            status = tbl_status;
+        }
+    }
+
+    return status;
+}
+
+SwitchVpp::AclConfigDeferScope::AclConfigDeferScope(
+        _In_ SwitchVpp& vpp):
+    m_vpp(vpp),
+    m_flushed(false)
+{
+    SWSS_LOG_ENTER();
+
+    m_vpp.m_acl_tbl_config_deferred = true;
+}
+
+SwitchVpp::AclConfigDeferScope::~AclConfigDeferScope()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_flushed) {
+        return;
+    }
+
+    try {
+        sai_status_t status = flush();
+
+        if (status != SAI_STATUS_SUCCESS) {
+            SWSS_LOG_ERROR("Failed to program deferred ACL tables, status %d", status);
+        }
+    }
+    catch (const std::exception& e) {
+        SWSS_LOG_ERROR("Failed to program deferred ACL tables: %s", e.what());
+    }
+}
+
+sai_status_t SwitchVpp::AclConfigDeferScope::flush()
+{
+    SWSS_LOG_ENTER();
+
+    m_flushed = true;
+
+    m_vpp.m_acl_tbl_config_deferred = false;
+
+    return m_vpp.aclFlushDirtyTables();
+}
+
+sai_status_t SwitchVpp::bulkCreateAclEntries(
+        _In_ sai_object_id_t switch_id,
+        _In_ const std::vector<std::string> &serialized_object_ids,
+        _In_ const uint32_t *attr_count,
+        _In_ const sai_attribute_t **attr_list,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_status_t *object_statuses)
+{
+    SWSS_LOG_ENTER();
+
+    uint32_t object_count = (uint32_t) serialized_object_ids.size();
+    sai_status_t status = SAI_STATUS_SUCCESS;
+    uint32_t it;
+
+    AclConfigDeferScope deferScope(*this);
+
+    for (it = 0; it < object_count; it++) {
+        sai_object_id_t object_id;
+
+        sai_deserialize_object_id(serialized_object_ids[it], object_id);
+
+        object_statuses[it] = createAclEntry(object_id, switch_id, attr_count[it], attr_list[it]);
+
+        if (object_statuses[it] != SAI_STATUS_SUCCESS) {
+            SWSS_LOG_ERROR("Failed to create ACL entry %s", serialized_object_ids[it].c_str());
+
+            status = SAI_STATUS_FAILURE;
+
+            if (mode == SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR) {
+                break;
+            }
+        }
+    }
+
+    while (++it < object_count) {
+        object_statuses[it] = SAI_STATUS_NOT_EXECUTED;
+    }
+
+    if (deferScope.flush() != SAI_STATUS_SUCCESS) {
+        status = SAI_STATUS_FAILURE;
+    }
+
+    SWSS_LOG_NOTICE("Bulk created %u ACL entries, status %d", object_count, status);
+
+    return status;
+}
+
+sai_status_t SwitchVpp::bulkRemoveAclEntries(
+        _In_ const std::vector<std::string> &serialized_object_ids,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_status_t *object_statuses)
+{
+    SWSS_LOG_ENTER();
+
+    uint32_t object_count = (uint32_t) serialized_object_ids.size();
+    sai_status_t status = SAI_STATUS_SUCCESS;
+    uint32_t it;
+
+    AclConfigDeferScope deferScope(*this);
+
+    for (it = 0; it < object_count; it++) {
+        object_statuses[it] = removeAclEntry(serialized_object_ids[it]);
+
+        if (object_statuses[it] != SAI_STATUS_SUCCESS) {
+            SWSS_LOG_ERROR("Failed to remove ACL entry %s", serialized_object_ids[it].c_str());
+
+            status = SAI_STATUS_FAILURE;
+
+            if (mode == SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR) {
+                break;
+            }
+        }
+    }
+
+    while (++it < object_count) {
+        object_statuses[it] = SAI_STATUS_NOT_EXECUTED;
+    }
+
+    if (deferScope.flush() != SAI_STATUS_SUCCESS) {
+        status = SAI_STATUS_FAILURE;
+    }
+
+    SWSS_LOG_NOTICE("Bulk removed %u ACL entries, status %d", object_count, status);
+
+    return status;
+}
+
+sai_status_t SwitchVpp::bulkSetAclEntries(
+        _In_ const std::vector<std::string> &serialized_object_ids,
+        _In_ const sai_attribute_t *attr_list,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_status_t *object_statuses)
+{
+    SWSS_LOG_ENTER();
+
+    uint32_t object_count = (uint32_t) serialized_object_ids.size();
+    sai_status_t status = SAI_STATUS_SUCCESS;
+    uint32_t it;
+
+    AclConfigDeferScope deferScope(*this);
+
+    for (it = 0; it < object_count; it++) {
+        sai_object_id_t object_id;
+
+        sai_deserialize_object_id(serialized_object_ids[it], object_id);
+
+        object_statuses[it] = setAclEntry(object_id, &attr_list[it]);
+
+        if (object_statuses[it] != SAI_STATUS_SUCCESS) {
+            SWSS_LOG_ERROR("Failed to set ACL entry %s", serialized_object_ids[it].c_str());
+
+            status = SAI_STATUS_FAILURE;
+
+            if (mode == SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR) {
+                break;
+            }
+        }
+    }
+
+    while (++it < object_count) {
+        object_statuses[it] = SAI_STATUS_NOT_EXECUTED;
+    }
+
+    if (deferScope.flush() != SAI_STATUS_SUCCESS) {
+        status = SAI_STATUS_FAILURE;
+    }
+
+    SWSS_LOG_NOTICE("Bulk set %u ACL entries, status %d", object_count, status);
+
+    return status;
+}
+
 sai_status_t SwitchVpp::createAclEntry(
         _In_ sai_object_id_t object_id,
         _In_ sai_object_id_t switch_id,
@@ -1609,6 +1825,9 @@ sai_status_t SwitchVpp::aclBindUnbindPort(
 {
     SWSS_LOG_ENTER();
 
+    // bind needs VPP ACL index of tables, pending configuration must be applied first
+    CHECK_STATUS(aclFlushDirtyTables());
+
     addRemovePortTblGrp(port_oid, tbl_grp_oid, is_bind);
 
     auto it = m_acl_tbl_grp_mbr_map.find(tbl_grp_oid);
@@ -1676,6 +1895,8 @@ sai_status_t SwitchVpp::aclBindUnbindPorts(
 {
     SWSS_LOG_ENTER();
 
+    CHECK_STATUS(aclFlushDirtyTables());
+
     auto it = m_acl_tbl_grp_ports_map.find(tbl_grp_oid);
 
     if (it == m_acl_tbl_grp_ports_map.end()) {
@@ -1772,6 +1993,9 @@ sai_status_t SwitchVpp::getAclEntryStats(
     sai_status_t status = SAI_STATUS_FAILURE;
     uint32_t acl_index, ace_index;
 
+    // counter indices are assigned when table is programmed
+    CHECK_STATUS(aclFlushDirtyTables());
+
     if (aclGetVppIndices(ace_cntr_oid, &acl_index, &ace_index) == SAI_STATUS_SUCCESS) {
         vpp_ace_stats_t ace_stats;
 